@@ -0,0 +1,257 @@
+/*
+ * decmem.c
+ *
+ * Tiered allocator for the image decoders, see decmem.h.
+ */
+
+#include "decmem.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "rom/ets_sys.h"
+static portMUX_TYPE decmem_mux = portMUX_INITIALIZER_UNLOCKED;
+#define DECMEM_LOCK() portENTER_CRITICAL(&decmem_mux)
+#define DECMEM_UNLOCK() portEXIT_CRITICAL(&decmem_mux)
+#else
+#define DECMEM_LOCK() do {} while (0)
+#define DECMEM_UNLOCK() do {} while (0)
+#endif
+
+/* Each block starts with its size and tier. The union keeps the payload
+ * aligned for doubles, which libjpeg's pools rely on. */
+typedef union {
+  struct {
+    uint32_t size;
+    uint32_t tier;
+  } h;
+  double align;
+} block_hdr_t;
+
+/* Arena blocks have this bit set in their tier. */
+#define ARENA_BLOCK 0x100u
+
+typedef struct {
+  uint8_t* base;
+  size_t size;
+  size_t top;
+} region_t;
+
+static decmem_stats_t stats;
+static region_t arena[DECMEM_NUM_TIERS];
+static int arena_active = 0;
+static uint32_t arena_live = 0; /* arena blocks not yet freed */
+static size_t arena_live_bytes[DECMEM_NUM_TIERS];
+
+static void* raw_alloc(size_t size, decmem_tier_t tier, int zero) {
+#ifdef ESP_PLATFORM
+  const uint32_t caps = (tier == DECMEM_PSRAM)
+                            ? (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+                            : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  return zero ? heap_caps_calloc(1, size, caps) : heap_caps_malloc(size, caps);
+#else
+  (void)tier;
+  return zero ? calloc(1, size) : malloc(size);
+#endif
+}
+
+/* Can a HOT block of 'size' bytes go to DRAM? */
+static int dram_allowed(size_t size) {
+  if (stats.tier[DECMEM_DRAM].bytes + size > DECMEM_DRAM_BUDGET) return 0;
+#ifdef ESP_PLATFORM
+  if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) <
+      size + DECMEM_DRAM_RESERVE) {
+    return 0;
+  }
+#endif
+  return 1;
+}
+
+/* Bumps 'total' bytes from the arena: the DRAM region for HOT blocks while
+ * it has room, the PSRAM region otherwise. Called with the lock held. */
+static block_hdr_t* arena_alloc(size_t total, decmem_hint_t hint,
+                                decmem_tier_t* tier) {
+  region_t* r;
+  block_hdr_t* hdr;
+  total = (total + sizeof(block_hdr_t) - 1) & ~(sizeof(block_hdr_t) - 1);
+  if (stats.arena_used + total > stats.arena_cap) {
+    ++stats.arena_overflows;
+    return NULL;
+  }
+  *tier = DECMEM_PSRAM;
+  if (hint == DECMEM_HOT &&
+      arena[DECMEM_DRAM].size - arena[DECMEM_DRAM].top >= total) {
+    *tier = DECMEM_DRAM;
+  }
+  r = &arena[*tier];
+  if (r->size - r->top < total) {
+    ++stats.arena_overflows;
+    return NULL;
+  }
+  hdr = (block_hdr_t*)(r->base + r->top);
+  r->top += total;
+  stats.arena_used += total;
+  if (stats.arena_used > stats.arena_peak) stats.arena_peak = stats.arena_used;
+  ++arena_live;
+  arena_live_bytes[*tier] += total;
+  hdr->h.size = (uint32_t)total;
+  hdr->h.tier = (uint32_t)*tier | ARENA_BLOCK;
+  return hdr;
+}
+
+static void* alloc_block(size_t size, decmem_hint_t hint, int zero) {
+  const size_t total = size + sizeof(block_hdr_t);
+  decmem_tier_t tier;
+  block_hdr_t* hdr;
+  int fallback = 0;
+
+  if (size > UINT32_MAX - 2 * sizeof(block_hdr_t)) return NULL;
+  if (hint == DECMEM_AUTO) {
+    hint = (size <= DECMEM_SMALL_MAX) ? DECMEM_HOT : DECMEM_BULK;
+  }
+  if (arena_active) {
+    DECMEM_LOCK();
+    hdr = arena_alloc(total, hint, &tier);
+    if (hdr != NULL) {
+      decmem_tier_stats_t* const t = &stats.tier[tier];
+      t->bytes += hdr->h.size;
+      if (t->bytes > t->peak) t->peak = t->bytes;
+      ++t->allocs;
+    }
+    DECMEM_UNLOCK();
+    if (hdr == NULL) {
+#ifdef ESP_PLATFORM
+      ets_printf("[DECMEM] arena full: %u bytes refused (%u/%u used)\n",
+                 (unsigned)size, (unsigned)stats.arena_used,
+                 (unsigned)stats.arena_cap);
+#endif
+      return NULL;
+    }
+    if (zero) memset(hdr + 1, 0, size);
+    return hdr + 1;
+  }
+  tier = (hint == DECMEM_HOT && dram_allowed(total)) ? DECMEM_DRAM
+                                                     : DECMEM_PSRAM;
+  hdr = (block_hdr_t*)raw_alloc(total, tier, zero);
+  if (hdr == NULL) {
+    /* the other tier is better than failing the decode */
+    tier = (tier == DECMEM_DRAM) ? DECMEM_PSRAM : DECMEM_DRAM;
+    hdr = (block_hdr_t*)raw_alloc(total, tier, zero);
+    fallback = 1;
+#ifdef ESP_PLATFORM
+    ets_printf("[DECMEM] %u bytes fell back to %s: %p\n", (unsigned)size,
+               (tier == DECMEM_DRAM) ? "DRAM" : "PSRAM", hdr);
+#endif
+  }
+  DECMEM_LOCK();
+  if (hdr == NULL) {
+    ++stats.failures;
+  } else {
+    decmem_tier_stats_t* const t = &stats.tier[tier];
+    t->bytes += total;
+    if (t->bytes > t->peak) t->peak = t->bytes;
+    ++t->allocs;
+    t->fallbacks += fallback;
+  }
+  DECMEM_UNLOCK();
+  if (hdr == NULL) return NULL;
+  hdr->h.size = (uint32_t)total;
+  hdr->h.tier = (uint32_t)tier;
+  return hdr + 1;
+}
+
+void* decmem_malloc(size_t size, decmem_hint_t hint) {
+  return alloc_block(size, hint, 0);
+}
+
+void* decmem_calloc(size_t nmemb, size_t size, decmem_hint_t hint) {
+  if (size != 0 && nmemb > SIZE_MAX / size) return NULL;
+  return alloc_block(nmemb * size, hint, 1);
+}
+
+void decmem_free(void* ptr) {
+  block_hdr_t* hdr;
+  uint32_t tier;
+  if (ptr == NULL) return;
+  hdr = (block_hdr_t*)ptr - 1;
+  tier = hdr->h.tier;
+  DECMEM_LOCK();
+  stats.tier[tier & ~ARENA_BLOCK].bytes -= hdr->h.size;
+  if (tier & ARENA_BLOCK) {
+    region_t* const r = &arena[tier & ~ARENA_BLOCK];
+    --arena_live;
+    arena_live_bytes[tier & ~ARENA_BLOCK] -= hdr->h.size;
+    /* only the last block of a region can be given back before the reset */
+    if ((uint8_t*)hdr + hdr->h.size == r->base + r->top) {
+      r->top -= hdr->h.size;
+      stats.arena_used -= hdr->h.size;
+    }
+  }
+  DECMEM_UNLOCK();
+  if (!(tier & ARENA_BLOCK)) free(hdr);
+}
+
+int decmem_arena_reserve(size_t dram_bytes, size_t psram_bytes) {
+  if (arena[DECMEM_PSRAM].base != NULL) return 1;
+  arena[DECMEM_PSRAM].base = (uint8_t*)raw_alloc(psram_bytes, DECMEM_PSRAM, 0);
+  if (arena[DECMEM_PSRAM].base == NULL) return 0;
+  arena[DECMEM_PSRAM].size = psram_bytes;
+  if (dram_bytes > 0 && dram_allowed(dram_bytes)) {
+    arena[DECMEM_DRAM].base = (uint8_t*)raw_alloc(dram_bytes, DECMEM_DRAM, 0);
+    if (arena[DECMEM_DRAM].base != NULL) arena[DECMEM_DRAM].size = dram_bytes;
+  }
+  return 1;
+}
+
+int decmem_arena_begin(size_t cap) {
+  const size_t total = arena[DECMEM_DRAM].size + arena[DECMEM_PSRAM].size;
+  if (arena[DECMEM_PSRAM].base == NULL) return 0;
+  DECMEM_LOCK();
+  stats.arena_cap = (cap == 0 || cap > total) ? total : cap;
+  stats.arena_used = 0;
+  stats.arena_peak = 0;
+  arena_active = 1;
+  DECMEM_UNLOCK();
+  return 1;
+}
+
+void decmem_arena_end(void) {
+  uint32_t live;
+  int i;
+  if (!arena_active) return;
+  DECMEM_LOCK();
+  live = arena_live;
+  for (i = 0; i < DECMEM_NUM_TIERS; ++i) {
+    /* blocks still live are reclaimed by the rewind */
+    stats.tier[i].bytes -= arena_live_bytes[i];
+    arena_live_bytes[i] = 0;
+    arena[i].top = 0;
+  }
+  arena_live = 0;
+  arena_active = 0;
+  stats.arena_used = 0;
+  DECMEM_UNLOCK();
+#ifdef ESP_PLATFORM
+  if (live > 0) ets_printf("[DECMEM] arena end: %u blocks not freed\n", (unsigned)live);
+#else
+  (void)live;
+#endif
+}
+
+void decmem_get_stats(decmem_stats_t* out) {
+  DECMEM_LOCK();
+  *out = stats;
+  DECMEM_UNLOCK();
+}
+
+void decmem_reset_peaks(void) {
+  int i;
+  DECMEM_LOCK();
+  for (i = 0; i < DECMEM_NUM_TIERS; ++i) {
+    stats.tier[i].peak = stats.tier[i].bytes;
+  }
+  DECMEM_UNLOCK();
+}
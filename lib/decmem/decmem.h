@@ -0,0 +1,104 @@
+/*
+ * decmem.h
+ *
+ * Memory placement for the image decoders (libjpeg, libwebp, PNG).
+ *
+ * ESP32 has two heaps: a few hundred KB of internal DRAM, which is fast but
+ * shared with WiFi/TLS, and several MB of PSRAM behind the SPI bus, which is
+ * large but much slower on cache misses. Small tables that are read for every
+ * pixel or macroblock (Huffman lookups, probability tables, intra caches) are
+ * worth keeping in DRAM, while pixel and coefficient buffers belong in PSRAM.
+ *
+ * Every block is tagged with the tier it came from, so that decmem_free()
+ * can keep per-tier counters. Host builds use malloc() for both tiers but
+ * apply the same policy, so the counters are meaningful there too.
+ *
+ * Decode arena: decmem_arena_reserve() takes one DRAM and one PSRAM region
+ * up front. Between decmem_arena_begin() and decmem_arena_end() every
+ * allocation is bumped from those regions (HOT from the DRAM one while it
+ * has room) instead of going to the heap, up to a hard per-decode cap; past
+ * the cap allocations fail, there is no heap fallback. decmem_free() only
+ * gives memory back when it is the last block of its region, and
+ * decmem_arena_end() resets both regions, so the heap looks the same after
+ * every decode and its worst case is the reserved size.
+ */
+
+#ifndef DECMEM_H
+#define DECMEM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Placement hints. */
+typedef enum {
+  DECMEM_AUTO = 0, /* by size: up to DECMEM_SMALL_MAX bytes is HOT */
+  DECMEM_HOT,      /* DRAM while under budget, PSRAM otherwise */
+  DECMEM_BULK      /* PSRAM */
+} decmem_hint_t;
+
+/* Tiers. */
+typedef enum {
+  DECMEM_DRAM = 0,
+  DECMEM_PSRAM,
+  DECMEM_NUM_TIERS
+} decmem_tier_t;
+
+/* DRAM bytes that HOT blocks may hold at once. */
+#ifndef DECMEM_DRAM_BUDGET
+#define DECMEM_DRAM_BUDGET (32 * 1024)
+#endif
+
+/* Internal heap left untouched for WiFi/TLS: HOT blocks go to PSRAM rather
+ * than bring free DRAM below this. */
+#ifndef DECMEM_DRAM_RESERVE
+#define DECMEM_DRAM_RESERVE (48 * 1024)
+#endif
+
+/* DECMEM_AUTO blocks up to this size are treated as HOT. */
+#ifndef DECMEM_SMALL_MAX
+#define DECMEM_SMALL_MAX 1024
+#endif
+
+typedef struct {
+  size_t bytes;      /* currently allocated */
+  size_t peak;       /* max of 'bytes' since the last decmem_reset_peaks() */
+  uint32_t allocs;   /* successful allocations */
+  uint32_t fallbacks; /* allocations that ended up in the other tier */
+} decmem_tier_stats_t;
+
+typedef struct {
+  decmem_tier_stats_t tier[DECMEM_NUM_TIERS];
+  uint32_t failures; /* allocations that failed in both tiers */
+  size_t arena_cap;  /* cap of the current/last arena scope, 0 = none */
+  size_t arena_used; /* bytes bumped in the current scope */
+  size_t arena_peak; /* max of 'arena_used' in the current/last scope */
+  uint32_t arena_overflows; /* allocations refused by the cap */
+} decmem_stats_t;
+
+void* decmem_malloc(size_t size, decmem_hint_t hint);
+void* decmem_calloc(size_t nmemb, size_t size, decmem_hint_t hint);
+void decmem_free(void* ptr);
+
+/* Reserves the arena regions. Returns 0 if they could not be allocated, in
+ * which case decmem_arena_begin() is a no-op and allocations use the heap.
+ * The DRAM region is skipped if it would break DECMEM_DRAM_RESERVE. */
+int decmem_arena_reserve(size_t dram_bytes, size_t psram_bytes);
+/* Starts a decode: allocations come from the arena, at most 'cap' bytes in
+ * total (0 = the whole arena). Returns 0 if no arena is reserved. */
+int decmem_arena_begin(size_t cap);
+/* Ends the decode and rewinds the arena. Blocks still live are logged; their
+ * memory is reclaimed regardless. */
+void decmem_arena_end(void);
+
+void decmem_get_stats(decmem_stats_t* stats);
+void decmem_reset_peaks(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DECMEM_H */
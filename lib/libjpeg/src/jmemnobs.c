@@ -26,57 +26,45 @@ extern void * malloc JPP((size_t size));
 extern void free JPP((void *ptr));
 #endif
 
-/* ESP32: Use PSRAM for libjpeg allocations (progressive JPEG needs lots of memory) */
-#ifdef ESP_PLATFORM
-#include "esp_heap_caps.h"
-#include "esp32-hal.h"  /* for Serial-like logging via ets_printf */
-#include "rom/ets_sys.h"
-static void* jpeg_psram_malloc(size_t sz) {
-  void* p = heap_caps_malloc(sz, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-  if (!p && sz > 0) {
-    /* fallback to any available memory */
-    p = malloc(sz);
-    ets_printf("[JPEG-MEM] PSRAM fail %d, fallback=%p\n", sz, p);
-  }
-  return p;
-}
-#define JPEG_MALLOC(sz) jpeg_psram_malloc(sz)
-#else
-#define JPEG_MALLOC(sz) malloc(sz)
-#endif
+/* ESP32: placement goes through decmem (lib/decmem). Small objects are the
+ * pool chunks holding Huffman/quantization tables and per-component state,
+ * which are read for every block and go to internal DRAM while under budget.
+ * Large objects are sample and coefficient buffers, which go to PSRAM.
+ */
+#include "decmem.h"
 
 /*
- * Memory allocation and freeing are controlled by the regular library
- * routines malloc() and free().
+ * Memory allocation and freeing are controlled by decmem_malloc() and
+ * decmem_free().
  */
 
 GLOBAL(void *)
 jpeg_get_small (j_common_ptr cinfo, size_t sizeofobject)
 {
-  return (void *) JPEG_MALLOC(sizeofobject);
+  return (void *) decmem_malloc(sizeofobject, DECMEM_HOT);
 }
 
 GLOBAL(void)
 jpeg_free_small (j_common_ptr cinfo, void * object, size_t sizeofobject)
 {
-  free(object);
+  decmem_free(object);
 }
 
 
 /*
- * "Large" objects are treated the same as "small" ones.
+ * "Large" objects only differ by their placement.
  */
 
 GLOBAL(void FAR *)
 jpeg_get_large (j_common_ptr cinfo, size_t sizeofobject)
 {
-  return (void FAR *) JPEG_MALLOC(sizeofobject);
+  return (void FAR *) decmem_malloc(sizeofobject, DECMEM_BULK);
 }
 
 GLOBAL(void)
 jpeg_free_large (j_common_ptr cinfo, void FAR * object, size_t sizeofobject)
 {
-  free(object);
+  decmem_free(object);
 }
 
 
@@ -0,0 +1,196 @@
+// Host check and benchmark for the task worker (thread_task_utils.c, here
+// on pthreads):
+//
+//   sh bench/run.sh
+//
+// Decodes synthetic pictures (synth_vp8.c) without and with use_threads,
+// checks that the output is bit-exact, and that the worker tasks are
+// created once and reused instead of once per decode. Prints the time per
+// decode for both.
+//
+// Pictures with several token partitions go through the row workers of
+// VP8DecodeRowsParallel() (mt_method 3) when threaded, at any width; the
+// check also covers odd sizes, cropping and scaling there.
+//
+// 'bench hash' only prints a hash of each serial decode; run.sh compares
+// them between a build with the SWAR kernels and one without.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "src/webp/decode.h"
+
+uint8_t* SynthVP8(int w, int h, int parts, int filter_type, int level,
+                  uint32_t seed, int mode, size_t* size);
+
+// Counts the tasks the worker starts (linked with --wrap=pthread_create).
+static int threads_created = 0;
+int __real_pthread_create(pthread_t* thread, const pthread_attr_t* attr,
+                          void* (*start)(void*), void* arg);
+int __wrap_pthread_create(pthread_t* thread, const pthread_attr_t* attr,
+                          void* (*start)(void*), void* arg) {
+  ++threads_created;
+  return __real_pthread_create(thread, attr, start, arg);
+}
+
+// Counts the threaded decodes that took the row worker path.
+static int parallel_decodes = 0;
+struct VP8Decoder;
+struct VP8Io;
+int __real_VP8DecodeRowsParallel(struct VP8Decoder* const dec,
+                                 struct VP8Io* const io);
+int __wrap_VP8DecodeRowsParallel(struct VP8Decoder* const dec,
+                                 struct VP8Io* const io) {
+  ++parallel_decodes;
+  return __real_VP8DecodeRowsParallel(dec, io);
+}
+
+static double Now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef struct {
+  int w, h, parts, filter_type, level, mode;
+  int crop_x, crop_y, crop_w, crop_h;  // crop_w = 0: no cropping
+  int scaled_w, scaled_h;              // scaled_w = 0: no scaling
+} Case;
+
+// Decodes to RGB; returns the pixels (malloc'd) or NULL.
+static uint8_t* Decode(const Case* const c, const uint8_t* data, size_t size,
+                       int threads, int* w, int* h) {
+  WebPDecoderConfig config;
+  uint8_t* rgb;
+  WebPInitDecoderConfig(&config);
+  config.options.use_threads = threads;
+  if (c->crop_w > 0) {
+    config.options.use_cropping = 1;
+    config.options.crop_left = c->crop_x;
+    config.options.crop_top = c->crop_y;
+    config.options.crop_width = c->crop_w;
+    config.options.crop_height = c->crop_h;
+  }
+  if (c->scaled_w > 0) {
+    config.options.use_scaling = 1;
+    config.options.scaled_width = c->scaled_w;
+    config.options.scaled_height = c->scaled_h;
+  }
+  config.output.colorspace = MODE_RGB;
+  if (WebPDecode(data, size, &config) != VP8_STATUS_OK) return NULL;
+  *w = config.output.width;
+  *h = config.output.height;
+  rgb = (uint8_t*)malloc((size_t)*w * *h * 3);
+  {
+    int y;
+    for (y = 0; y < *h; ++y) {
+      memcpy(rgb + (size_t)y * *w * 3,
+             config.output.u.RGBA.rgba + (size_t)y * config.output.u.RGBA.stride,
+             (size_t)*w * 3);
+    }
+  }
+  WebPFreeDecBuffer(&config.output);
+  return rgb;
+}
+
+static const Case kCases[] = {
+  // FinishRow() worker (mt_method 2): single partition, >= 512 wide
+  {640, 480, 1, 0, 0, 0},  // no filter
+  {640, 480, 1, 1, 20, 0},  // simple filter
+  {800, 600, 1, 2, 30, 0},  // complex filter
+  {512, 512, 1, 2, 63, 2},
+  {1024, 768, 1, 2, 16, 0},
+  // row workers (mt_method 3): several partitions
+  {320, 240, 2, 0, 0, 0},
+  {320, 240, 2, 1, 24, 0},
+  {320, 240, 2, 2, 40, 0},
+  {400, 300, 4, 2, 32, 0},
+  {360, 360, 8, 1, 63, 0},
+  {97, 61, 8, 2, 10, 0},  // partial macroblocks, fewer rows than partitions
+  {16, 16, 2, 2, 20, 0},  // a single macroblock
+  {64, 1024, 4, 2, 28, 1},
+  {1024, 768, 4, 2, 30, 0},  // wide: partitions win over mt_method 2
+  {400, 300, 2, 2, 36, 0, 37, 21, 211, 150},  // cropped
+  {400, 400, 4, 2, 20, 2, 0, 0, 0, 0, 32, 32},  // scaled (icon)
+  {500, 375, 2, 1, 30, 0, 50, 25, 400, 300, 100, 75},  // both
+};
+#define NUM_CASES ((int)(sizeof(kCases) / sizeof(kCases[0])))
+#define ROUNDS 20
+
+// FNV-1a over the decoded pixels.
+static uint32_t Hash(const uint8_t* p, size_t n) {
+  uint32_t h = 2166136261u;
+  size_t i;
+  for (i = 0; i < n; ++i) h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+static int PrintHashes(void) {
+  int i;
+  for (i = 0; i < NUM_CASES; ++i) {
+    const Case* const c = &kCases[i];
+    size_t size;
+    uint8_t* const data = SynthVP8(c->w, c->h, c->parts, c->filter_type,
+                                   c->level, 1000u + i, c->mode, &size);
+    int w, h;
+    uint8_t* const rgb = Decode(c, data, size, 0, &w, &h);
+    if (rgb == NULL) return 1;
+    printf("%dx%d parts=%d filter=%d/%d: %08x\n", c->w, c->h, c->parts,
+           c->filter_type, c->level, Hash(rgb, (size_t)w * h * 3));
+    free(rgb);
+    free(data);
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  int failed = 0;
+  int i;
+  if (argc > 1 && !strcmp(argv[1], "hash")) return PrintHashes();
+  WebPInitTaskWorker();
+  for (i = 0; i < NUM_CASES; ++i) {
+    const Case* const c = &kCases[i];
+    size_t size;
+    uint8_t* const data = SynthVP8(c->w, c->h, c->parts, c->filter_type,
+                                   c->level, 1000u + i, c->mode, &size);
+    int w0, h0, w1, h1, r;
+    const int parallel_before = parallel_decodes;
+    uint8_t* const serial = Decode(c, data, size, 0, &w0, &h0);
+    uint8_t* const threaded = Decode(c, data, size, 1, &w1, &h1);
+    double t_serial, t_threaded;
+    if (serial == NULL || threaded == NULL || w0 != w1 || h0 != h1 ||
+        memcmp(serial, threaded, (size_t)w0 * h0 * 3)) {
+      printf("%dx%d parts=%d filter=%d/%d: MISMATCH\n", c->w, c->h, c->parts,
+             c->filter_type, c->level);
+      failed = 1;
+    }
+    if ((parallel_decodes - parallel_before) != (c->parts > 1)) {
+      printf("%dx%d parts=%d: row workers %sused\n", c->w, c->h, c->parts,
+             (c->parts > 1) ? "not " : "");
+      failed = 1;
+    }
+    t_serial = Now();
+    for (r = 0; r < ROUNDS; ++r) free(Decode(c, data, size, 0, &w0, &h0));
+    t_serial = (Now() - t_serial) / ROUNDS;
+    t_threaded = Now();
+    for (r = 0; r < ROUNDS; ++r) free(Decode(c, data, size, 1, &w1, &h1));
+    t_threaded = (Now() - t_threaded) / ROUNDS;
+    printf("%dx%d parts=%d filter=%d/%d -> %dx%d: serial %.2f ms, "
+           "threaded %.2f ms\n", c->w, c->h, c->parts, c->filter_type,
+           c->level, w0, h0, t_serial * 1e3, t_threaded * 1e3);
+    free(serial);
+    free(threaded);
+    free(data);
+  }
+  printf("worker tasks created: %d over %d threaded decodes\n",
+         threads_created, NUM_CASES * (ROUNDS + 1));
+  if (threads_created > 2) {  // WEBP_TASK_WORKER_POOL_SIZE
+    printf("worker tasks are not reused\n");
+    failed = 1;
+  }
+  printf(failed ? "FAILED\n" : "ok\n");
+  return failed;
+}
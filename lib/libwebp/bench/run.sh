@@ -0,0 +1,38 @@
+#!/bin/sh
+# Builds the decoder subset the firmware uses (SWAR paths, pthread worker) on
+# the host and runs bench.c and swar.c, then builds it again without the SWAR
+# paths and checks that both decode the bench pictures to the same pixels.
+# Usage: sh bench/run.sh [cc flags]
+set -e
+cd "$(dirname "$0")/.."
+out=${TMPDIR:-/tmp}/webp_bench
+mkdir -p "$out"
+srcs=
+for f in src/dec/*.c src/dsp/*.c src/utils/*.c; do
+  case $f in
+    # synth_vp8.c includes tree_dec.c for its probability tables
+    *neon*|*sse*|*mips*|*msa*|*avx*|*/cost*|*/enc*|*lossless_enc*|*/tree_dec.c) ;;
+    *) srcs="$srcs $f" ;;
+  esac
+done
+build() {  # build <output> <main source> [cc flags]
+  o=$1 main=$2
+  shift 2
+  ${CC:-cc} -O2 -I. -I../decmem -U__SSE2__ -DWEBP_USE_THREAD "$@" $srcs ../decmem/decmem.c bench/synth_vp8.c "$main" \
+    -lpthread -lm -o "$out/$o"
+}
+wrap=-Wl,--wrap=pthread_create,--wrap=VP8DecodeRowsParallel
+build bench bench/bench.c -DWEBP_HAVE_SWAR $wrap "$@"
+build swar bench/swar.c -DWEBP_HAVE_SWAR "$@"
+build bench_c bench/bench.c $wrap "$@"
+"$out/bench"
+"$out/swar"
+"$out/bench" hash > "$out/hash_swar"
+"$out/bench_c" hash > "$out/hash_c"
+if cmp -s "$out/hash_swar" "$out/hash_c"; then
+  echo "C and SWAR decodes: bit-exact ($(wc -l < "$out/hash_c") pictures)"
+else
+  diff "$out/hash_c" "$out/hash_swar"
+  echo "C and SWAR decodes: MISMATCH"
+  exit 1
+fi
@@ -0,0 +1,243 @@
+// Host check and benchmark for the SWAR kernels (dsp/dec_swar.c,
+// dsp/lossless_swar.c), built by:
+//
+//   sh bench/run.sh
+//
+// Collects the C function tables (VP8GetCPUInfo = NULL) and the SWAR ones,
+// runs every entry that differs on random inputs (pixels, borders and
+// coefficients), checks the outputs are bit-exact, and prints the time per
+// call for both (per pixel for VP8LPredictorsAdd).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "src/dsp/dsp.h"
+#include "src/dsp/lossless.h"
+
+extern VP8CPUInfo VP8GetCPUInfo;
+
+static double Now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t seed = 1;
+static uint32_t Rand(void) {
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+static void RandomBytes(uint8_t* p, int n) {
+  int i;
+  // Mostly uniform, sometimes flat extremes so that the saturating paths run.
+  const int flat = (Rand() & 7) == 0 ? (int)(Rand() & 1) * 255 : -1;
+  for (i = 0; i < n; ++i) p[i] = (flat >= 0) ? flat : (uint8_t)Rand();
+}
+
+typedef struct {
+  VP8DecIdct transform_dc;
+  VP8PredFunc luma4[NUM_BMODES];
+  VP8PredFunc luma16[NUM_B_DC_MODES];
+  VP8PredFunc chroma8[NUM_B_DC_MODES];
+  VP8LPredictorFunc predictors[16];
+  VP8LPredictorAddSubFunc predictors_add[16];
+} Kernels;
+
+static void Collect(Kernels* const k) {
+  VP8DspInit();
+  VP8LDspInit();
+  k->transform_dc = VP8TransformDC;
+  memcpy(k->luma4, VP8PredLuma4, sizeof(k->luma4));
+  memcpy(k->luma16, VP8PredLuma16, sizeof(k->luma16));
+  memcpy(k->chroma8, VP8PredChroma8, sizeof(k->chroma8));
+  memcpy(k->predictors, VP8LPredictors, sizeof(k->predictors));
+  memcpy(k->predictors_add, VP8LPredictorsAdd, sizeof(k->predictors_add));
+}
+
+#define TESTS 20000
+#define ROUNDS 200000
+
+static int failed = 0;
+static int compared = 0;
+
+static void Report(const char* name, int index, int ok, double t_c,
+                   double t_swar) {
+  printf("%-16s %2d: %s  C %6.1f ns, SWAR %6.1f ns (%.2fx)\n", name, index,
+         ok ? "ok  " : "DIFF", t_c * 1e9, t_swar * 1e9, t_c / t_swar);
+  if (!ok) failed = 1;
+  ++compared;
+}
+
+// The work area of an intra predictor: up to 16 rows below one border row, at
+// stride BPS, with the left border and the top-left/top-right samples.
+#define WORK_OFFSET (BPS + 8)
+#define WORK_SIZE (BPS * 17)
+
+static int CheckPred(VP8PredFunc c_func, VP8PredFunc swar_func) {
+  static uint8_t work[2][WORK_SIZE] __attribute__((aligned(16)));
+  int n;
+  for (n = 0; n < TESTS; ++n) {
+    RandomBytes(work[0], WORK_SIZE);
+    memcpy(work[1], work[0], WORK_SIZE);
+    c_func(work[0] + WORK_OFFSET);
+    swar_func(work[1] + WORK_OFFSET);
+    if (memcmp(work[0], work[1], WORK_SIZE)) return 0;
+  }
+  return 1;
+}
+
+static double TimePred(VP8PredFunc func) {
+  static uint8_t work[WORK_SIZE] __attribute__((aligned(16)));
+  double t;
+  int r;
+  RandomBytes(work, WORK_SIZE);
+  t = Now();
+  for (r = 0; r < ROUNDS; ++r) func(work + WORK_OFFSET);
+  return (Now() - t) / ROUNDS;
+}
+
+static void ComparePreds(const char* name, const VP8PredFunc* c_funcs,
+                         const VP8PredFunc* swar_funcs, int num) {
+  int i;
+  for (i = 0; i < num; ++i) {
+    if (c_funcs[i] == swar_funcs[i]) continue;
+    Report(name, i, CheckPred(c_funcs[i], swar_funcs[i]),
+           TimePred(c_funcs[i]), TimePred(swar_funcs[i]));
+  }
+}
+
+static int CheckTransformDC(VP8DecIdct c_func, VP8DecIdct swar_func) {
+  static uint8_t work[2][BPS * 4] __attribute__((aligned(16)));
+  int16_t in[16];
+  int n;
+  memset(in, 0, sizeof(in));
+  for (n = 0; n < TESTS; ++n) {
+    // Dequantized DC coefficients stay well inside int16_t; cover all of it.
+    in[0] = (int16_t)(Rand() & 0xffff);
+    if (in[0] > 32767 - 4) in[0] = 32767 - 4;
+    RandomBytes(work[0], sizeof(work[0]));
+    memcpy(work[1], work[0], sizeof(work[0]));
+    c_func(in, work[0]);
+    swar_func(in, work[1]);
+    if (memcmp(work[0], work[1], sizeof(work[0]))) return 0;
+  }
+  return 1;
+}
+
+static double TimeTransformDC(VP8DecIdct func) {
+  static uint8_t work[BPS * 4] __attribute__((aligned(16)));
+  int16_t in[16];
+  double t;
+  int r;
+  memset(in, 0, sizeof(in));
+  RandomBytes(work, sizeof(work));
+  t = Now();
+  for (r = 0; r < ROUNDS; ++r) {
+    in[0] = (int16_t)((r & 255) - 128);
+    func(in, work);
+  }
+  return (Now() - t) / ROUNDS;
+}
+
+// Lossless rows: 'upper' and 'out' are read from index -1.
+#define ROW 64
+
+static int CheckPredictor(VP8LPredictorFunc c_func,
+                          VP8LPredictorFunc swar_func) {
+  uint32_t pixels[2];
+  int n;
+  for (n = 0; n < TESTS; ++n) {
+    uint32_t left;
+    RandomBytes((uint8_t*)pixels, sizeof(pixels));
+    RandomBytes((uint8_t*)&left, sizeof(left));
+    if (c_func(&left, pixels + 1) != swar_func(&left, pixels + 1)) return 0;
+  }
+  return 1;
+}
+
+static double TimePredictor(VP8LPredictorFunc func) {
+  uint32_t pixels[ROW + 1];
+  volatile uint32_t sink = 0;
+  double t;
+  int r;
+  RandomBytes((uint8_t*)pixels, sizeof(pixels));
+  t = Now();
+  for (r = 0; r < ROUNDS; ++r) {
+    sink += func(&pixels[r & (ROW - 1)], &pixels[(r & (ROW - 1)) + 1]);
+  }
+  (void)sink;
+  return (Now() - t) / ROUNDS;
+}
+
+static int CheckPredictorAdd(VP8LPredictorAddSubFunc c_func,
+                             VP8LPredictorAddSubFunc swar_func) {
+  uint32_t in[ROW], upper[ROW + 1], out[2][ROW + 1];
+  int n;
+  for (n = 0; n < TESTS / 16; ++n) {
+    const int num_pixels = 1 + (int)(Rand() % ROW);
+    RandomBytes((uint8_t*)in, sizeof(in));
+    RandomBytes((uint8_t*)upper, sizeof(upper));
+    RandomBytes((uint8_t*)out[0], sizeof(out[0]));
+    memcpy(out[1], out[0], sizeof(out[0]));
+    c_func(in, upper + 1, num_pixels, out[0] + 1);
+    swar_func(in, upper + 1, num_pixels, out[1] + 1);
+    if (memcmp(out[0], out[1], sizeof(out[0]))) return 0;
+  }
+  return 1;
+}
+
+// Per pixel.
+static double TimePredictorAdd(VP8LPredictorAddSubFunc func) {
+  uint32_t in[ROW], upper[ROW + 1], out[ROW + 1];
+  double t;
+  int r;
+  RandomBytes((uint8_t*)in, sizeof(in));
+  RandomBytes((uint8_t*)upper, sizeof(upper));
+  RandomBytes((uint8_t*)out, sizeof(out));
+  t = Now();
+  for (r = 0; r < ROUNDS / ROW; ++r) func(in, upper + 1, ROW, out + 1);
+  return (Now() - t) / (ROUNDS / ROW * ROW);
+}
+
+int main(void) {
+  const VP8CPUInfo cpu_info = VP8GetCPUInfo;
+  Kernels c, swar;
+  int i;
+  if (cpu_info == NULL || !cpu_info(kSWAR)) {
+    printf("built without WEBP_USE_SWAR\nFAILED\n");
+    return 1;
+  }
+  VP8GetCPUInfo = NULL;
+  Collect(&c);
+  VP8GetCPUInfo = cpu_info;
+  Collect(&swar);
+
+  if (c.transform_dc != swar.transform_dc) {
+    Report("TransformDC", 0,
+           CheckTransformDC(c.transform_dc, swar.transform_dc),
+           TimeTransformDC(c.transform_dc), TimeTransformDC(swar.transform_dc));
+  }
+  ComparePreds("PredLuma4", c.luma4, swar.luma4, NUM_BMODES);
+  ComparePreds("PredLuma16", c.luma16, swar.luma16, NUM_B_DC_MODES);
+  ComparePreds("PredChroma8", c.chroma8, swar.chroma8, NUM_B_DC_MODES);
+  for (i = 0; i < 16; ++i) {
+    if (c.predictors[i] == swar.predictors[i]) continue;
+    Report("LPredictors", i,
+           CheckPredictor(c.predictors[i], swar.predictors[i]),
+           TimePredictor(c.predictors[i]), TimePredictor(swar.predictors[i]));
+  }
+  for (i = 0; i < 16; ++i) {
+    if (c.predictors_add[i] == swar.predictors_add[i]) continue;
+    Report("LPredictorsAdd", i,
+           CheckPredictorAdd(c.predictors_add[i], swar.predictors_add[i]),
+           TimePredictorAdd(c.predictors_add[i]),
+           TimePredictorAdd(swar.predictors_add[i]));
+  }
+  printf("%d SWAR kernels compared\n", compared);
+  if (compared == 0) failed = 1;
+  printf(failed ? "FAILED\n" : "ok\n");
+  return failed;
+}
@@ -0,0 +1,246 @@
+// Synthetic VP8 keyframes for the host bench: random modes and coefficients
+// written with the default probabilities, any size, 1/2/4/8 token partitions
+// and any loop filter. The pictures are noise, but they go through every
+// path of the decoder, and they need no encoder or binary fixtures.
+//
+// mode: 0 = random intra modes, 1 = all DC_PRED 16x16, 2 = smooth (DC only,
+// small coefficients)
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/utils/bit_writer_utils.h"
+
+// The probability tables; run.sh leaves tree_dec.c out of the library.
+#include "src/dec/tree_dec.c"
+
+
+static const uint8_t kCat3[] = {173, 148, 140, 0};
+static const uint8_t kCat4[] = {176, 155, 140, 135, 0};
+static const uint8_t kCat5[] = {180, 157, 141, 134, 130, 0};
+static const uint8_t kCat6[] = {254, 254, 243, 230, 196, 177, 153, 140, 133, 130, 129, 0};
+static const uint8_t* const kCat3456[] = {kCat3, kCat4, kCat5, kCat6};
+
+static uint32_t rng = 1;
+static int Rand(int n) { rng = rng * 1103515245u + 12345u; return (int)((rng >> 8) % (uint32_t)n); }
+
+#define P(t, n, c) (CoeffsProba0[t][kBands[n]][c])
+
+static void PutLarge(VP8BitWriter* bw, int v, const uint8_t* p) {
+  if (v <= 4) {
+    VP8PutBit(bw, 0, p[3]);
+    if (v == 2) { VP8PutBit(bw, 0, p[4]); }
+    else { VP8PutBit(bw, 1, p[4]); VP8PutBit(bw, v == 4, p[5]); }
+  } else if (v <= 10) {
+    VP8PutBit(bw, 1, p[3]);
+    VP8PutBit(bw, 0, p[6]);
+    if (v <= 6) { VP8PutBit(bw, 0, p[7]); VP8PutBit(bw, v - 5, 159); }
+    else { VP8PutBit(bw, 1, p[7]); VP8PutBit(bw, (v - 7) >> 1, 165); VP8PutBit(bw, (v - 7) & 1, 145); }
+  } else {
+    int cat = (v < 19) ? 0 : (v < 35) ? 1 : (v < 67) ? 2 : 3;
+    const uint8_t* tab = kCat3456[cat];
+    int nb = (int)strlen((const char*)tab), i;
+    int r = v - (3 + (8 << cat));
+    VP8PutBit(bw, 1, p[3]);
+    VP8PutBit(bw, 1, p[6]);
+    VP8PutBit(bw, cat >> 1, p[8]);
+    VP8PutBit(bw, cat & 1, p[9 + (cat >> 1)]);
+    for (i = 0; i < nb; ++i) VP8PutBit(bw, (r >> (nb - 1 - i)) & 1, tab[i]);
+  }
+}
+
+// c[] in zigzag (coding) order. returns nz flag
+static int PutCoeffs(VP8BitWriter* bw, int type, int ctx, int first, const int* c) {
+  int n = first, last = -1, i;
+  const uint8_t* p = P(type, n, ctx);
+  for (i = first; i < 16; ++i) if (c[i]) last = i;
+  if (last < 0) { VP8PutBit(bw, 0, p[0]); return 0; }
+  VP8PutBit(bw, 1, p[0]);
+  for (;;) {
+    int v;
+    while (c[n] == 0) { VP8PutBit(bw, 0, p[1]); ++n; p = P(type, n, 0); }
+    VP8PutBit(bw, 1, p[1]);
+    v = abs(c[n]);
+    if (v == 1) { VP8PutBit(bw, 0, p[2]); p = P(type, n + 1, 1); }
+    else { VP8PutBit(bw, 1, p[2]); PutLarge(bw, v, p); p = P(type, n + 1, 2); }
+    VP8PutBitUniform(bw, c[n] < 0);
+    ++n;
+    if (n == 16) break;
+    if (n > last) { VP8PutBit(bw, 0, p[0]); break; }
+    VP8PutBit(bw, 1, p[0]);
+  }
+  return 1;
+}
+
+static void RandBlock(int* c, int first, int amp, int density) {
+  int i;
+  memset(c, 0, 16 * sizeof(*c));
+  for (i = first; i < 16; ++i) {
+    if (Rand(100) < density * (16 - i) / 16) {
+      int v = 1 + Rand(amp);
+      c[i] = Rand(2) ? -v : v;
+    }
+  }
+}
+
+static void PutBModeTree(VP8BitWriter* bw, int m, const uint8_t* prob) {
+  switch (m) {
+    case B_DC_PRED: VP8PutBit(bw, 0, prob[0]); break;
+    case B_TM_PRED: VP8PutBit(bw, 1, prob[0]); VP8PutBit(bw, 0, prob[1]); break;
+    case B_VE_PRED: VP8PutBit(bw, 1, prob[0]); VP8PutBit(bw, 1, prob[1]); VP8PutBit(bw, 0, prob[2]); break;
+    default:
+      VP8PutBit(bw, 1, prob[0]); VP8PutBit(bw, 1, prob[1]); VP8PutBit(bw, 1, prob[2]);
+      if (m == B_HE_PRED || m == B_RD_PRED || m == B_VR_PRED) {
+        VP8PutBit(bw, 0, prob[3]);
+        if (m == B_HE_PRED) VP8PutBit(bw, 0, prob[4]);
+        else { VP8PutBit(bw, 1, prob[4]); VP8PutBit(bw, m == B_VR_PRED, prob[5]); }
+      } else {
+        VP8PutBit(bw, 1, prob[3]);
+        if (m == B_LD_PRED) VP8PutBit(bw, 0, prob[6]);
+        else {
+          VP8PutBit(bw, 1, prob[6]);
+          if (m == B_VL_PRED) VP8PutBit(bw, 0, prob[7]);
+          else { VP8PutBit(bw, 1, prob[7]); VP8PutBit(bw, m == B_HU_PRED, prob[8]); }
+        }
+      }
+  }
+}
+
+static uint8_t* Put32(uint8_t* d, uint32_t v) {
+  d[0] = v & 255; d[1] = (v >> 8) & 255; d[2] = (v >> 16) & 255; d[3] = v >> 24;
+  return d + 4;
+}
+
+uint8_t* SynthVP8(int W, int H, int parts, int ftype, int level, uint32_t seed,
+                  int mode, size_t* size) {
+  int log2p = parts == 8 ? 3 : parts == 4 ? 2 : parts == 2 ? 1 : 0;
+  int mb_w = (W + 15) / 16, mb_h = (H + 15) / 16, x, y, i, t, b, c, p;
+  VP8BitWriter bw0, tok[8];
+  uint8_t* intra_t = calloc(4 * mb_w, 1);
+  uint8_t* top_nz = calloc(mb_w, 1);     // bits: 0-3 y, 4-5 u, 6-7 v
+  uint8_t* top_nzdc = calloc(mb_w, 1);
+  const int use_skip = 1, skip_p = 200;
+  rng = seed;
+  VP8BitWriterInit(&bw0, 1024);
+  for (i = 0; i < parts; ++i) VP8BitWriterInit(&tok[i], 1024);
+  VP8PutBitUniform(&bw0, 0);  // colorspace
+  VP8PutBitUniform(&bw0, 0);  // clamp
+  VP8PutBitUniform(&bw0, 0);  // segment
+  VP8PutBitUniform(&bw0, ftype == 1);  // simple
+  VP8PutBits(&bw0, ftype ? level : 0, 6);
+  VP8PutBits(&bw0, 2, 3);  // sharpness
+  VP8PutBitUniform(&bw0, 0);  // lf delta
+  VP8PutBits(&bw0, log2p, 2);
+  VP8PutBits(&bw0, 30, 7);  // base q
+  for (i = 0; i < 5; ++i) VP8PutBitUniform(&bw0, 0);
+  VP8PutBitUniform(&bw0, 0);  // update proba
+  for (t = 0; t < NUM_TYPES; ++t)
+    for (b = 0; b < NUM_BANDS; ++b)
+      for (c = 0; c < NUM_CTX; ++c)
+        for (p = 0; p < NUM_PROBAS; ++p) VP8PutBit(&bw0, 0, CoeffsUpdateProba[t][b][c][p]);
+  VP8PutBitUniform(&bw0, use_skip);
+  VP8PutBits(&bw0, skip_p, 8);
+  memset(intra_t, B_DC_PRED, 4 * mb_w);
+  for (y = 0; y < mb_h; ++y) {
+    VP8BitWriter* const bw = &tok[y & (parts - 1)];
+    uint8_t intra_l[4] = {0, 0, 0, 0};
+    int left_nz = 0, left_nzdc = 0;
+    for (x = 0; x < mb_w; ++x) {
+      uint8_t* top = intra_t + 4 * x;
+      int i4 = (mode == 0) ? (Rand(3) == 0) : 0;
+      int skip = (mode == 2) ? 0 : (Rand(8) == 0);
+      int uvm = (mode == 0) ? Rand(4) : DC_PRED;
+      int ymode = (mode == 0) ? Rand(4) : DC_PRED;
+      VP8PutBit(&bw0, skip, skip_p);
+      VP8PutBit(&bw0, !i4, 145);
+      if (!i4) {
+        if (ymode == TM_PRED || ymode == H_PRED) { VP8PutBit(&bw0, 1, 156); VP8PutBit(&bw0, ymode == TM_PRED, 128); }
+        else { VP8PutBit(&bw0, 0, 156); VP8PutBit(&bw0, ymode == V_PRED, 163); }
+        memset(top, ymode, 4); memset(intra_l, ymode, 4);
+      } else {
+        int yy, xx;
+        for (yy = 0; yy < 4; ++yy) {
+          int ym = intra_l[yy];
+          for (xx = 0; xx < 4; ++xx) {
+            int m = Rand(10);
+            PutBModeTree(&bw0, m, kBModesProba[top[xx]][ym]);
+            ym = m; top[xx] = m;
+          }
+          intra_l[yy] = ym;
+        }
+      }
+      if (uvm == DC_PRED) VP8PutBit(&bw0, 0, 142);
+      else { VP8PutBit(&bw0, 1, 142); if (uvm == V_PRED) VP8PutBit(&bw0, 0, 114); else { VP8PutBit(&bw0, 1, 114); VP8PutBit(&bw0, uvm == TM_PRED, 183); } }
+
+      // residuals
+      if (skip) {
+        top_nz[x] = 0; left_nz = 0;
+        if (!i4) { top_nzdc[x] = 0; left_nzdc = 0; }
+      } else {
+        int cf[16], first, type, yy, xx, ch;
+        int tnz = top_nz[x], lnz = left_nz, ntnz = 0, nlnz = 0;
+        int amp = (mode == 2) ? 2 : 6, dens = (mode == 2) ? 20 : 50;
+        if (!i4) {
+          RandBlock(cf, 0, (mode == 2) ? 30 : 40, 60);
+          if (mode == 2) { for (i = 1; i < 16; ++i) cf[i] = 0; }
+          top_nzdc[x] = left_nzdc = PutCoeffs(bw, 1, top_nzdc[x] + left_nzdc, 0, cf);
+          first = 1; type = 0;
+        } else { first = 0; type = 3; }
+        for (yy = 0; yy < 4; ++yy) {
+          int l = (lnz >> yy) & 1;
+          for (xx = 0; xx < 4; ++xx) {
+            int tt = (tnz >> xx) & 1;
+            RandBlock(cf, first, amp, dens);
+            l = PutCoeffs(bw, type, l + tt, first, cf);
+            tnz = (tnz & ~(1 << xx)) | (l << xx);
+          }
+          nlnz |= l << yy;
+        }
+        ntnz = tnz & 15;
+        for (ch = 0; ch < 2; ++ch) {
+          int tb = (top_nz[x] >> (4 + 2 * ch)) & 3, lb = (left_nz >> (4 + 2 * ch)) & 3;
+          for (yy = 0; yy < 2; ++yy) {
+            int l = (lb >> yy) & 1;
+            for (xx = 0; xx < 2; ++xx) {
+              int tt = (tb >> xx) & 1;
+              RandBlock(cf, 0, amp, dens);
+              l = PutCoeffs(bw, 2, l + tt, 0, cf);
+              tb = (tb & ~(1 << xx)) | (l << xx);
+            }
+            lb = (lb & ~(1 << yy)) | (l << yy);
+          }
+          ntnz |= tb << (4 + 2 * ch);
+          nlnz |= lb << (4 + 2 * ch);
+        }
+        top_nz[x] = ntnz; left_nz = nlnz;
+      }
+    }
+  }
+  {
+    uint8_t* p0 = VP8BitWriterFinish(&bw0);
+    size_t s0 = VP8BitWriterSize(&bw0), total;
+    size_t ps[8];
+    uint8_t* pd[8];
+    uint8_t* out;
+    uint8_t* d;
+    for (i = 0; i < parts; ++i) { pd[i] = VP8BitWriterFinish(&tok[i]); ps[i] = VP8BitWriterSize(&tok[i]); }
+    total = 10 + s0 + 3 * (parts - 1);
+    for (i = 0; i < parts; ++i) total += ps[i];
+    *size = 20 + total + (total & 1);
+    out = d = (uint8_t*)calloc(*size, 1);
+    memcpy(d, "RIFF", 4); d = Put32(d + 4, (uint32_t)(*size - 8));
+    memcpy(d, "WEBPVP8 ", 8); d = Put32(d + 8, (uint32_t)total);
+    {
+      uint32_t bits = 0 | (0 << 1) | (1 << 4) | ((uint32_t)s0 << 5);
+      uint8_t hdr[10] = {bits & 255, (bits >> 8) & 255, bits >> 16, 0x9d, 0x01, 0x2a, W & 255, W >> 8, H & 255, H >> 8};
+      memcpy(d, hdr, 10); d += 10;
+    }
+    memcpy(d, p0, s0); d += s0;
+    for (i = 0; i < parts - 1; ++i) { d[0] = ps[i] & 255; d[1] = (ps[i] >> 8) & 255; d[2] = ps[i] >> 16; d += 3; }
+    for (i = 0; i < parts; ++i) { memcpy(d, pd[i], ps[i]); d += ps[i]; }
+    VP8BitWriterWipeOut(&bw0);
+    for (i = 0; i < parts; ++i) VP8BitWriterWipeOut(&tok[i]);
+    free(intra_t); free(top_nz); free(top_nzdc);
+    return out;
+  }
+}
@@ -80,15 +80,12 @@ static void DoUVTransform(uint32_t bits, const int16_t* const src,
   }
 }
 
-static void ReconstructRow(const VP8Decoder* const dec,
-                           const VP8ThreadContext* ctx) {
+// Initialize the left-most samples of 'yuv_b' before reconstructing row mb_y.
+static void InitLeftSamples(uint8_t* const yuv_b, int mb_y) {
   int j;
-  int mb_x;
-  const int mb_y = ctx->mb_y;
-  const int cache_id = ctx->id;
-  uint8_t* const y_dst = dec->yuv_b + Y_OFF;
-  uint8_t* const u_dst = dec->yuv_b + U_OFF;
-  uint8_t* const v_dst = dec->yuv_b + V_OFF;
+  uint8_t* const y_dst = yuv_b + Y_OFF;
+  uint8_t* const u_dst = yuv_b + U_OFF;
+  uint8_t* const v_dst = yuv_b + V_OFF;
 
   // Initialize left-most block.
   for (j = 0; j < 16; ++j) {
@@ -109,102 +106,115 @@ static void ReconstructRow(const VP8Decoder* const dec,
     WEBP_UNSAFE_MEMSET(u_dst - BPS - 1, 127, 8 + 1);
     WEBP_UNSAFE_MEMSET(v_dst - BPS - 1, 127, 8 + 1);
   }
+}
 
-  // Reconstruct one row.
-  for (mb_x = 0; mb_x < dec->mb_w; ++mb_x) {
-    const VP8MBData* const block = ctx->mb_data + mb_x;
-
-    // Rotate in the left samples from previously decoded block. We move four
-    // pixels at a time for alignment reason, and because of in-loop filter.
-    if (mb_x > 0) {
-      for (j = -1; j < 16; ++j) {
-        Copy32b(&y_dst[j * BPS - 4], &y_dst[j * BPS + 12]);
-      }
-      for (j = -1; j < 8; ++j) {
-        Copy32b(&u_dst[j * BPS - 4], &u_dst[j * BPS + 4]);
-        Copy32b(&v_dst[j * BPS - 4], &v_dst[j * BPS + 4]);
-      }
+// Reconstruct one macroblock using 'yuv_b' as work area, and transfer it to
+// the cache row 'cache_id'.
+static void ReconstructMB(const VP8Decoder* const dec, uint8_t* const yuv_b,
+                          const VP8MBData* const block, int mb_x, int mb_y,
+                          int cache_id) {
+  int j;
+  uint8_t* const y_dst = yuv_b + Y_OFF;
+  uint8_t* const u_dst = yuv_b + U_OFF;
+  uint8_t* const v_dst = yuv_b + V_OFF;
+
+  // Rotate in the left samples from previously decoded block. We move four
+  // pixels at a time for alignment reason, and because of in-loop filter.
+  if (mb_x > 0) {
+    for (j = -1; j < 16; ++j) {
+      Copy32b(&y_dst[j * BPS - 4], &y_dst[j * BPS + 12]);
     }
-    {
-      // bring top samples into the cache
-      VP8TopSamples* const top_yuv = dec->yuv_t + mb_x;
-      const int16_t* const coeffs = block->coeffs;
-      uint32_t bits = block->non_zero_y;
-      int n;
-
-      if (mb_y > 0) {
-        WEBP_UNSAFE_MEMCPY(y_dst - BPS, top_yuv[0].y, 16);
-        WEBP_UNSAFE_MEMCPY(u_dst - BPS, top_yuv[0].u, 8);
-        WEBP_UNSAFE_MEMCPY(v_dst - BPS, top_yuv[0].v, 8);
-      }
+    for (j = -1; j < 8; ++j) {
+      Copy32b(&u_dst[j * BPS - 4], &u_dst[j * BPS + 4]);
+      Copy32b(&v_dst[j * BPS - 4], &v_dst[j * BPS + 4]);
+    }
+  }
+  {
+    // bring top samples into the cache
+    VP8TopSamples* const top_yuv = dec->yuv_t + mb_x;
+    const int16_t* const coeffs = block->coeffs;
+    uint32_t bits = block->non_zero_y;
+    int n;
 
-      // predict and add residuals
-      if (block->is_i4x4) {  // 4x4
-        uint32_t* const top_right = (uint32_t*)(y_dst - BPS + 16);
+    if (mb_y > 0) {
+      WEBP_UNSAFE_MEMCPY(y_dst - BPS, top_yuv[0].y, 16);
+      WEBP_UNSAFE_MEMCPY(u_dst - BPS, top_yuv[0].u, 8);
+      WEBP_UNSAFE_MEMCPY(v_dst - BPS, top_yuv[0].v, 8);
+    }
 
-        if (mb_y > 0) {
-          if (mb_x >= dec->mb_w - 1) {  // on rightmost border
-            WEBP_UNSAFE_MEMSET(top_right, top_yuv[0].y[15], sizeof(*top_right));
-          } else {
-            WEBP_UNSAFE_MEMCPY(top_right, top_yuv[1].y, sizeof(*top_right));
-          }
-        }
-        // replicate the top-right pixels below
-        top_right[BPS] = top_right[2 * BPS] = top_right[3 * BPS] = top_right[0];
+    // predict and add residuals
+    if (block->is_i4x4) {  // 4x4
+      uint32_t* const top_right = (uint32_t*)(y_dst - BPS + 16);
 
-        // predict and add residuals for all 4x4 blocks in turn.
-        for (n = 0; n < 16; ++n, bits <<= 2) {
-          uint8_t* const dst = y_dst + kScan[n];
-          VP8PredLuma4[block->imodes[n]](dst);
-          DoTransform(bits, coeffs + n * 16, dst);
-        }
-      } else {  // 16x16
-        const int pred_func = CheckMode(mb_x, mb_y, block->imodes[0]);
-        VP8PredLuma16[pred_func](y_dst);
-        if (bits != 0) {
-          for (n = 0; n < 16; ++n, bits <<= 2) {
-            DoTransform(bits, coeffs + n * 16, y_dst + kScan[n]);
-          }
+      if (mb_y > 0) {
+        if (mb_x >= dec->mb_w - 1) {  // on rightmost border
+          WEBP_UNSAFE_MEMSET(top_right, top_yuv[0].y[15], sizeof(*top_right));
+        } else {
+          WEBP_UNSAFE_MEMCPY(top_right, top_yuv[1].y, sizeof(*top_right));
         }
       }
-      {
-        // Chroma
-        const uint32_t bits_uv = block->non_zero_uv;
-        const int pred_func = CheckMode(mb_x, mb_y, block->uvmode);
-        VP8PredChroma8[pred_func](u_dst);
-        VP8PredChroma8[pred_func](v_dst);
-        DoUVTransform(bits_uv >> 0, coeffs + 16 * 16, u_dst);
-        DoUVTransform(bits_uv >> 8, coeffs + 20 * 16, v_dst);
+      // replicate the top-right pixels below
+      top_right[BPS] = top_right[2 * BPS] = top_right[3 * BPS] = top_right[0];
+
+      // predict and add residuals for all 4x4 blocks in turn.
+      for (n = 0; n < 16; ++n, bits <<= 2) {
+        uint8_t* const dst = y_dst + kScan[n];
+        VP8PredLuma4[block->imodes[n]](dst);
+        DoTransform(bits, coeffs + n * 16, dst);
       }
-
-      // stash away top samples for next block
-      if (mb_y < dec->mb_h - 1) {
-        WEBP_UNSAFE_MEMCPY(top_yuv[0].y, y_dst + 15 * BPS, 16);
-        WEBP_UNSAFE_MEMCPY(top_yuv[0].u, u_dst + 7 * BPS, 8);
-        WEBP_UNSAFE_MEMCPY(top_yuv[0].v, v_dst + 7 * BPS, 8);
+    } else {  // 16x16
+      const int pred_func = CheckMode(mb_x, mb_y, block->imodes[0]);
+      VP8PredLuma16[pred_func](y_dst);
+      if (bits != 0) {
+        for (n = 0; n < 16; ++n, bits <<= 2) {
+          DoTransform(bits, coeffs + n * 16, y_dst + kScan[n]);
+        }
       }
     }
-    // Transfer reconstructed samples from yuv_b cache to final destination.
     {
-      const int y_offset = cache_id * 16 * dec->cache_y_stride;
-      const int uv_offset = cache_id * 8 * dec->cache_uv_stride;
-      uint8_t* const y_out = dec->cache_y + mb_x * 16 + y_offset;
-      uint8_t* const u_out = dec->cache_u + mb_x * 8 + uv_offset;
-      uint8_t* const v_out = dec->cache_v + mb_x * 8 + uv_offset;
-      for (j = 0; j < 16; ++j) {
-        WEBP_UNSAFE_MEMCPY(y_out + j * dec->cache_y_stride, y_dst + j * BPS,
-                           16);
-      }
-      for (j = 0; j < 8; ++j) {
-        WEBP_UNSAFE_MEMCPY(u_out + j * dec->cache_uv_stride, u_dst + j * BPS,
-                           8);
-        WEBP_UNSAFE_MEMCPY(v_out + j * dec->cache_uv_stride, v_dst + j * BPS,
-                           8);
-      }
+      // Chroma
+      const uint32_t bits_uv = block->non_zero_uv;
+      const int pred_func = CheckMode(mb_x, mb_y, block->uvmode);
+      VP8PredChroma8[pred_func](u_dst);
+      VP8PredChroma8[pred_func](v_dst);
+      DoUVTransform(bits_uv >> 0, coeffs + 16 * 16, u_dst);
+      DoUVTransform(bits_uv >> 8, coeffs + 20 * 16, v_dst);
+    }
+
+    // stash away top samples for next block
+    if (mb_y < dec->mb_h - 1) {
+      WEBP_UNSAFE_MEMCPY(top_yuv[0].y, y_dst + 15 * BPS, 16);
+      WEBP_UNSAFE_MEMCPY(top_yuv[0].u, u_dst + 7 * BPS, 8);
+      WEBP_UNSAFE_MEMCPY(top_yuv[0].v, v_dst + 7 * BPS, 8);
+    }
+  }
+  // Transfer reconstructed samples from yuv_b cache to final destination.
+  {
+    const int y_offset = cache_id * 16 * dec->cache_y_stride;
+    const int uv_offset = cache_id * 8 * dec->cache_uv_stride;
+    uint8_t* const y_out = dec->cache_y + mb_x * 16 + y_offset;
+    uint8_t* const u_out = dec->cache_u + mb_x * 8 + uv_offset;
+    uint8_t* const v_out = dec->cache_v + mb_x * 8 + uv_offset;
+    for (j = 0; j < 16; ++j) {
+      WEBP_UNSAFE_MEMCPY(y_out + j * dec->cache_y_stride, y_dst + j * BPS, 16);
+    }
+    for (j = 0; j < 8; ++j) {
+      WEBP_UNSAFE_MEMCPY(u_out + j * dec->cache_uv_stride, u_dst + j * BPS, 8);
+      WEBP_UNSAFE_MEMCPY(v_out + j * dec->cache_uv_stride, v_dst + j * BPS, 8);
     }
   }
 }
 
+static void ReconstructRow(const VP8Decoder* const dec,
+                           const VP8ThreadContext* ctx) {
+  int mb_x;
+  InitLeftSamples(dec->yuv_b, ctx->mb_y);
+  for (mb_x = 0; mb_x < dec->mb_w; ++mb_x) {
+    ReconstructMB(dec, dec->yuv_b, ctx->mb_data + mb_x, mb_x, ctx->mb_y,
+                  ctx->id);
+  }
+}
+
 //------------------------------------------------------------------------------
 // Filtering
 
@@ -215,8 +225,8 @@ static void ReconstructRow(const VP8Decoder* const dec,
 //                 U/V, so it's 8 samples total (because of the 2x upsampling).
 static const uint8_t kFilterExtraRows[3] = {0, 2, 8};
 
-static void DoFilter(const VP8Decoder* const dec, int mb_x, int mb_y) {
-  const VP8ThreadContext* const ctx = &dec->thread_ctx;
+static void DoFilter(const VP8Decoder* const dec,
+                     const VP8ThreadContext* const ctx, int mb_x, int mb_y) {
   const int cache_id = ctx->id;
   const int y_bps = dec->cache_y_stride;
   const VP8FInfo* const f_info = ctx->f_info + mb_x;
@@ -265,12 +275,13 @@ static void DoFilter(const VP8Decoder* const dec, int mb_x, int mb_y) {
 }
 
 // Filter the decoded macroblock row (if needed)
-static void FilterRow(const VP8Decoder* const dec) {
+static void FilterRow(const VP8Decoder* const dec,
+                      const VP8ThreadContext* const ctx) {
   int mb_x;
-  const int mb_y = dec->thread_ctx.mb_y;
-  assert(dec->thread_ctx.filter_row);
+  const int mb_y = ctx->mb_y;
+  assert(ctx->filter_row);
   for (mb_x = dec->tl_mb_x; mb_x < dec->br_mb_x; ++mb_x) {
-    DoFilter(dec, mb_x, mb_y);
+    DoFilter(dec, ctx, mb_x, mb_y);
   }
 }
 
@@ -382,11 +393,11 @@ static void Dither8x8(VP8Random* const rg, uint8_t* dst, int bps, int amp) {
   VP8DitherCombine8x8(dither, dst, bps);
 }
 
-static void DitherRow(VP8Decoder* const dec) {
+static void DitherRow(VP8Decoder* const dec,
+                      const VP8ThreadContext* const ctx) {
   int mb_x;
   assert(dec->dither);
   for (mb_x = dec->tl_mb_x; mb_x < dec->br_mb_x; ++mb_x) {
-    const VP8ThreadContext* const ctx = &dec->thread_ctx;
     const VP8MBData* const data = ctx->mb_data + mb_x;
     const int cache_id = ctx->id;
     const int uv_bps = dec->cache_uv_stride;
@@ -413,11 +424,9 @@ static void DitherRow(VP8Decoder* const dec) {
 #define MACROBLOCK_VPOS(mb_y) ((mb_y) * 16)  // vertical position of a MB
 
 // Finalize and transmit a complete row. Return false in case of user-abort.
-static int FinishRow(void* arg1, void* arg2) {
-  VP8Decoder* const dec = (VP8Decoder*)arg1;
-  VP8Io* const io = (VP8Io*)arg2;
+static int DoFinishRow(VP8Decoder* const dec, const VP8ThreadContext* const ctx,
+                       VP8Io* const io) {
   int ok = 1;
-  const VP8ThreadContext* const ctx = &dec->thread_ctx;
   const int cache_id = ctx->id;
   const int extra_y_rows = kFilterExtraRows[dec->filter_type];
   const int ysize = extra_y_rows * dec->cache_y_stride;
@@ -436,11 +445,11 @@ static int FinishRow(void* arg1, void* arg2) {
   }
 
   if (ctx->filter_row) {
-    FilterRow(dec);
+    FilterRow(dec, ctx);
   }
 
   if (dec->dither) {
-    DitherRow(dec);
+    DitherRow(dec, ctx);
   }
 
   if (io->put != NULL) {
@@ -511,8 +520,161 @@ static int FinishRow(void* arg1, void* arg2) {
   return ok;
 }
 
+static int FinishRow(void* arg1, void* arg2) {
+  VP8Decoder* const dec = (VP8Decoder*)arg1;
+  return DoFinishRow(dec, &dec->thread_ctx, (VP8Io*)arg2);
+}
+
 #undef MACROBLOCK_VPOS
 
+//------------------------------------------------------------------------------
+// DC-only reconstruction
+//
+// Each macroblock is reduced to its mean value. The predictions of the 16x16
+// and chroma modes are approximated by a flat value computed from the mean
+// bottom row of the macroblock above and mean right column of the one on the
+// left. These edge means are in turn obtained from the first row / column of
+// coefficients of the edge blocks, which is much cheaper than the inverse
+// transforms. Filtering, upsampling and rescaling are skipped too, at the
+// expense of some drift compared to the exact decode.
+
+static WEBP_INLINE int DcClip8(int v) {
+  return (v < 0) ? 0 : (v > 255) ? 255 : v;
+}
+
+// Flat approximation of a 16x16 (or 8x8) prediction, given the edge means of
+// the top, left and top-left macroblocks. Intra4x4 macroblocks are treated as
+// DC_PRED.
+static int PredictDC(int mode, int mb_x, int mb_y, int top, int left,
+                     int top_left) {
+  // same border values as in ReconstructRow()
+  const int T = (mb_y > 0) ? top : 127;
+  const int L = (mb_x > 0) ? left : 129;
+  switch (mode) {
+    case V_PRED:
+      return T;
+    case H_PRED:
+      return L;
+    case TM_PRED:
+      return DcClip8(L + T - ((mb_y == 0)   ? 127
+                              : (mb_x == 0) ? 129
+                                            : top_left));
+    default:  // DC_PRED
+      if (mb_y > 0 && mb_x > 0) return (top + left + 1) >> 1;
+      return (mb_y > 0) ? top : (mb_x > 0) ? left : 128;
+  }
+}
+
+// Residual sums of a macroblock made of 'size' x 'size' 4x4 blocks. 'bits'
+// holds their 2b non-zero codes, first block in the topmost bits. All sums are
+// 8x the mean per block: sum[0] over the whole blocks, sum[1] over the bottom
+// row of the last block row and sum[2] over the right column of the last
+// block column (see TransformOne(): only the first column, resp. row, of
+// coefficients contributes to these means).
+static void SumResiduals(uint32_t bits, const int16_t* coeffs, int size,
+                         int sum[3]) {
+  int n;
+  sum[0] = sum[1] = sum[2] = 0;
+  for (n = 0; n < size * size; ++n, bits <<= 2, coeffs += 16) {
+    if (!(bits >> 30)) continue;
+    sum[0] += coeffs[0];
+    if (n >= size * (size - 1)) {
+      sum[1] += coeffs[0] + coeffs[8] - WEBP_TRANSFORM_AC3_MUL1(coeffs[4]) -
+                WEBP_TRANSFORM_AC3_MUL2(coeffs[12]);
+    }
+    if ((n % size) == size - 1) {
+      sum[2] += coeffs[0] + coeffs[2] - WEBP_TRANSFORM_AC3_MUL1(coeffs[1]) -
+                WEBP_TRANSFORM_AC3_MUL2(coeffs[3]);
+    }
+  }
+}
+
+// Reconstructs one plane of macroblock 'mb_x'. 'mean' receives the output
+// sample, 'bottom' holds the bottom edge of the macroblock above on input and
+// receives this one's, '*left' likewise for the right edge of the macroblock
+// on the left. 'log_size' is log2 of the number of 4x4 blocks per side.
+static void ReconstructDcMB(int mode, int mb_x, int mb_y, uint32_t bits,
+                            const int16_t* const coeffs, int log_size,
+                            uint8_t* const mean, uint8_t* const bottom,
+                            int* const left, int* const top_left) {
+  const int size = 1 << log_size;
+  const int top = *bottom;
+  const int pred = PredictDC(mode, mb_x, mb_y, top, *left, *top_left);
+  int sum[3];
+  SumResiduals(bits, coeffs, size, sum);
+  *mean = DcClip8(pred + ((sum[0] + (4 << (2 * log_size))) >>
+                          (3 + 2 * log_size)));
+  *bottom = DcClip8(pred + ((sum[1] + (4 << log_size)) >> (3 + log_size)));
+  *left = DcClip8(pred + ((sum[2] + (4 << log_size)) >> (3 + log_size)));
+  *top_left = top;
+}
+
+static void ReconstructDcRow(const VP8Decoder* const dec) {
+  const int mb_y = dec->mb_y;
+  const int mb_w = dec->mb_w;
+  // the bottom edges of the previous row follow the alpha row
+  uint8_t* const y_edge = dec->cache_v + 2 * mb_w;
+  uint8_t* const u_edge = y_edge + mb_w;
+  uint8_t* const v_edge = u_edge + mb_w;
+  int left_y = 0, left_u = 0, left_v = 0;
+  int top_left_y = 0, top_left_u = 0, top_left_v = 0;
+  int mb_x;
+  for (mb_x = 0; mb_x < mb_w; ++mb_x) {
+    const VP8MBData* const block = dec->mb_data + mb_x;
+    const int16_t* const coeffs = block->coeffs;
+    const int ymode = block->is_i4x4 ? DC_PRED : block->imodes[0];
+    ReconstructDcMB(ymode, mb_x, mb_y, block->non_zero_y, coeffs, 2,
+                    dec->cache_y + mb_x, y_edge + mb_x, &left_y, &top_left_y);
+    ReconstructDcMB(block->uvmode, mb_x, mb_y, block->non_zero_uv << 24,
+                    coeffs + 16 * 16, 1, dec->cache_u + mb_x, u_edge + mb_x,
+                    &left_u, &top_left_u);
+    ReconstructDcMB(block->uvmode, mb_x, mb_y,
+                    (block->non_zero_uv >> 8) << 24, coeffs + 20 * 16, 1,
+                    dec->cache_v + mb_x, v_edge + mb_x, &left_v, &top_left_v);
+  }
+}
+
+// Reconstruct the DCs of the last decoded row, average the matching alpha
+// rows if any, and pass everything to put(). Returns false in case of error.
+static int FinishDcRow(VP8Decoder* const dec, VP8Io* const io) {
+  const int y_start = 16 * dec->mb_y;
+  const int y_end =
+      (y_start + 16 < io->crop_bottom) ? y_start + 16 : io->crop_bottom;
+  uint8_t* const a_dst = dec->cache_v + dec->mb_w;
+  ReconstructDcRow(dec);
+  if (io->put == NULL || y_start >= y_end) return 1;
+
+  io->a = NULL;
+  if (dec->alpha_data != NULL) {
+    const uint8_t* const alpha =
+        VP8DecompressAlphaRows(dec, io, y_start, y_end - y_start);
+    int mb_x;
+    if (alpha == NULL) {
+      return VP8SetError(dec, VP8_STATUS_BITSTREAM_ERROR,
+                         "Could not decode alpha data.");
+    }
+    for (mb_x = 0; mb_x < dec->mb_w; ++mb_x) {
+      const int x_start = 16 * mb_x;
+      const int x_end = (x_start + 16 < io->width) ? x_start + 16 : io->width;
+      const int count = (x_end - x_start) * (y_end - y_start);
+      int sum = 0;
+      int x, y;
+      for (y = 0; y < y_end - y_start; ++y) {
+        for (x = x_start; x < x_end; ++x) sum += alpha[y * io->width + x];
+      }
+      a_dst[mb_x] = (sum + count / 2) / count;
+    }
+    io->a = a_dst;
+  }
+  io->y = dec->cache_y;
+  io->u = dec->cache_u;
+  io->v = dec->cache_v;
+  io->mb_y = y_start;
+  io->mb_w = dec->mb_w;
+  io->mb_h = y_end - y_start;
+  return io->put(io);
+}
+
 //------------------------------------------------------------------------------
 
 int VP8ProcessRow(VP8Decoder* const dec, VP8Io* const io) {
@@ -521,7 +683,9 @@ int VP8ProcessRow(VP8Decoder* const dec, VP8Io* const io) {
   const int filter_row = (dec->filter_type > 0) &&
                          (dec->mb_y >= dec->tl_mb_y) &&
                          (dec->mb_y <= dec->br_mb_y);
-  if (dec->mt_method == 0) {
+  if (dec->dc_only) {
+    ok = FinishDcRow(dec, io);
+  } else if (dec->mt_method == 0) {
     // ctx->id and ctx->f_info are already set
     ctx->mb_y = dec->mb_y;
     ctx->filter_row = filter_row;
@@ -560,6 +724,288 @@ int VP8ProcessRow(VP8Decoder* const dec, VP8Io* const io) {
   return ok;
 }
 
+//------------------------------------------------------------------------------
+// Partition-parallel decoding (mt_method == 3)
+//
+// Rows using different token partitions are independent as far as the
+// residuals are concerned. What still ties them together is:
+//  * the intra modes, which are all stored in partition #0 and must be parsed
+//    in row order,
+//  * the top contexts: macroblock (x, y) needs dec->mb_info[x] and
+//    dec->yuv_t[x] from (x, y - 1), plus the top-right samples of (x + 1, y - 1),
+//  * filtering and output, which must happen in row order (dithering, alpha
+//    and io->put() are sequential).
+// Each worker hence decodes its rows as a wavefront, two macroblocks behind
+// the row above, and then finishes them in turn. Since a worker only starts a
+// new row once its previous one is finished, num_row_workers cache rows (plus
+// one for the filtering delay line) are enough.
+//
+// A worker waiting for another one spins for a short while (the partner is
+// usually a macroblock away), then blocks on its own binary semaphore. Every
+// progress update wakes the workers that are blocked. Spinning alone is not
+// an option on ESP32: taskYIELD() does not let lower-priority tasks run, so a
+// worker whose partner was preempted would starve IDLE and trip the task
+// watchdog.
+
+#if defined(WEBP_USE_THREAD) && defined(__GNUC__)
+#define WEBP_USE_ROW_WORKERS
+#endif
+
+#if defined(WEBP_USE_ROW_WORKERS)
+
+// Polls of the awaited counter before blocking.
+#ifndef WEBP_ROW_WORKER_SPINS
+#define WEBP_ROW_WORKER_SPINS 64
+#endif
+
+#if defined(ESP_PLATFORM)
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#define ROW_WORKER_YIELD() taskYIELD()
+
+static void* RowWakeNew(void) { return (void*)xSemaphoreCreateBinary(); }
+
+static void RowWakeDelete(void* const wake) {
+  vSemaphoreDelete((SemaphoreHandle_t)wake);
+}
+
+static void RowWakeGive(void* const wake) {
+  xSemaphoreGive((SemaphoreHandle_t)wake);
+}
+
+static void RowWakeTake(void* const wake) {
+  while (xSemaphoreTake((SemaphoreHandle_t)wake, portMAX_DELAY) != pdTRUE) {
+  }
+}
+
+#else  // !ESP_PLATFORM
+
+#include <pthread.h>
+#include <sched.h>
+#define ROW_WORKER_YIELD() sched_yield()
+
+typedef struct {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int given;
+} RowWake;
+
+static void* RowWakeNew(void) {
+  RowWake* const wake = (RowWake*)WebPSafeMalloc(1ULL, sizeof(*wake));
+  if (wake == NULL) return NULL;
+  wake->given = 0;
+  if (pthread_mutex_init(&wake->mutex, NULL)) {
+    WebPSafeFree(wake);
+    return NULL;
+  }
+  if (pthread_cond_init(&wake->cond, NULL)) {
+    pthread_mutex_destroy(&wake->mutex);
+    WebPSafeFree(wake);
+    return NULL;
+  }
+  return wake;
+}
+
+static void RowWakeDelete(void* const ptr) {
+  RowWake* const wake = (RowWake*)ptr;
+  pthread_mutex_destroy(&wake->mutex);
+  pthread_cond_destroy(&wake->cond);
+  WebPSafeFree(wake);
+}
+
+static void RowWakeGive(void* const ptr) {
+  RowWake* const wake = (RowWake*)ptr;
+  pthread_mutex_lock(&wake->mutex);
+  wake->given = 1;
+  pthread_mutex_unlock(&wake->mutex);
+  pthread_cond_signal(&wake->cond);
+}
+
+static void RowWakeTake(void* const ptr) {
+  RowWake* const wake = (RowWake*)ptr;
+  pthread_mutex_lock(&wake->mutex);
+  while (!wake->given) pthread_cond_wait(&wake->cond, &wake->mutex);
+  wake->given = 0;
+  pthread_mutex_unlock(&wake->mutex);
+}
+
+#endif  // ESP_PLATFORM
+
+static WEBP_INLINE int LoadAcquire(const int* const ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+// Publishes progress and wakes the workers blocked in WaitFor(). The store
+// and the loads of 'waiting' are sequentially consistent, as are the
+// waiter's store of 'waiting' and its re-check of the counter: either the
+// waiter sees the new value or this sees the waiter, so no wakeup is lost.
+// A wakeup that was not needed leaves the semaphore given, which only costs
+// the next WaitFor() one extra check.
+static void Publish(VP8Decoder* const dec, int* const ptr, int value) {
+  int i;
+  __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+  for (i = 0; i < dec->num_row_workers; ++i) {
+    VP8RowWorker* const rw = &dec->row_workers[i];
+    if (__atomic_load_n(&rw->waiting, __ATOMIC_SEQ_CST) &&
+        __atomic_exchange_n(&rw->waiting, 0, __ATOMIC_SEQ_CST)) {
+      RowWakeGive(rw->wake);
+    }
+  }
+}
+
+// Wait until '*counter' reaches 'value'. Returns false if another worker
+// failed in the meantime.
+static int WaitFor(const VP8Decoder* const dec, VP8RowWorker* const self,
+                   const int* const counter, int value) {
+  int spins = 0;
+  while (LoadAcquire(counter) < value) {
+    if (LoadAcquire(&dec->row_abort)) return 0;
+    if (++spins < WEBP_ROW_WORKER_SPINS) {
+      ROW_WORKER_YIELD();
+      continue;
+    }
+    __atomic_store_n(&self->waiting, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(counter, __ATOMIC_SEQ_CST) < value &&
+        !__atomic_load_n(&dec->row_abort, __ATOMIC_SEQ_CST)) {
+      RowWakeTake(self->wake);
+    }
+    __atomic_store_n(&self->waiting, 0, __ATOMIC_SEQ_CST);
+  }
+  return 1;
+}
+
+static int RowError(VP8Decoder* const dec, VP8RowWorker* const rw,
+                    VP8StatusCode status, const char* const msg) {
+  rw->status = status;
+  rw->error_msg = msg;
+  Publish(dec, &dec->row_abort, 1);
+  return 0;
+}
+
+// Worker hook: decode, reconstruct and finish rows 'index + k * n'.
+static int DecodeRows(void* arg1, void* arg2) {
+  VP8Decoder* const dec = (VP8Decoder*)arg1;
+  VP8RowWorker* const rw = (VP8RowWorker*)arg2;
+  VP8ThreadContext* const ctx = &rw->ctx;
+  const int num_workers = dec->num_row_workers;
+  const int mb_w = dec->mb_w;
+  int mb_y;
+  for (mb_y = (int)(rw - dec->row_workers); mb_y < dec->br_mb_y;
+       mb_y += num_workers) {
+    const VP8RowWorker* const above =
+        &dec->row_workers[(mb_y - 1) & (num_workers - 1)];
+    VP8BitReader* const token_br =
+        &dec->parts[mb_y & dec->num_parts_minus_one];
+    int mb_x;
+    ctx->id = mb_y % dec->num_caches;
+    ctx->mb_y = mb_y;
+    ctx->filter_row = (dec->filter_type > 0) && (mb_y >= dec->tl_mb_y) &&
+                      (mb_y <= dec->br_mb_y);
+
+    if (!WaitFor(dec, rw, &dec->modes_row, mb_y)) return 0;
+    WEBP_UNSAFE_MEMSET(dec->intra_l, B_DC_PRED, sizeof(dec->intra_l));
+    if (!VP8ParseIntraModeRowInto(&dec->br, dec, ctx->mb_data)) {
+      return RowError(dec, rw, VP8_STATUS_NOT_ENOUGH_DATA,
+                      "Premature end-of-partition0 encountered.");
+    }
+    Publish(dec, &dec->modes_row, mb_y + 1);
+
+    rw->left.nz = 0;
+    rw->left.nz_dc = 0;
+    InitLeftSamples(rw->yuv_b, mb_y);
+    for (mb_x = 0; mb_x < mb_w; ++mb_x) {
+      if (mb_y > 0) {
+        const int top_right = (mb_x + 2 < mb_w) ? mb_x + 2 : mb_w;
+        if (!WaitFor(dec, rw, &above->pos, (mb_y - 1) * mb_w + top_right)) {
+          return 0;
+        }
+      }
+      if (!VP8DecodeMBInto(dec, mb_x, &rw->left, ctx->mb_data + mb_x,
+                           ctx->f_info, token_br)) {
+        return RowError(dec, rw, VP8_STATUS_NOT_ENOUGH_DATA,
+                        "Premature end-of-file encountered.");
+      }
+      ReconstructMB(dec, rw->yuv_b, ctx->mb_data + mb_x, mb_x, mb_y, ctx->id);
+      Publish(dec, &rw->pos, mb_y * mb_w + mb_x + 1);
+    }
+
+    if (!WaitFor(dec, rw, &dec->finished_row, mb_y)) return 0;
+    if (!DoFinishRow(dec, ctx, &ctx->io)) {
+      return RowError(dec, rw, VP8_STATUS_USER_ABORT, "Output aborted.");
+    }
+    Publish(dec, &dec->finished_row, mb_y + 1);
+  }
+  return 1;
+}
+
+int VP8DecodeRowsParallel(VP8Decoder* const dec, VP8Io* const io) {
+  const WebPWorkerInterface* const winterface = WebPGetWorkerInterface();
+  int ok;
+  int i;
+  assert(dec->mt_method == 3);
+  dec->modes_row = 0;
+  dec->finished_row = 0;
+  dec->row_abort = 0;
+  for (i = 0; i < dec->num_row_workers; ++i) {
+    VP8RowWorker* const rw = &dec->row_workers[i];
+    rw->ctx.io = *io;
+    rw->pos = 0;
+    rw->status = VP8_STATUS_OK;
+    rw->error_msg = NULL;
+    rw->waiting = 0;
+  }
+  for (i = 1; i < dec->num_row_workers; ++i) {
+    winterface->Launch(&dec->row_workers[i].worker);
+  }
+  ok = DecodeRows(dec, &dec->row_workers[0]);
+  for (i = 1; i < dec->num_row_workers; ++i) {
+    ok &= winterface->Sync(&dec->row_workers[i].worker);
+  }
+  if (!ok) {
+    for (i = 0; i < dec->num_row_workers; ++i) {
+      const VP8RowWorker* const rw = &dec->row_workers[i];
+      if (rw->status != VP8_STATUS_OK) {
+        return VP8SetError(dec, rw->status, rw->error_msg);
+      }
+    }
+    return VP8SetError(dec, VP8_STATUS_USER_ABORT, "Output aborted.");
+  }
+  return 1;
+}
+
+static int InitRowWakes(VP8Decoder* const dec) {
+  int i;
+  for (i = 0; i < dec->num_row_workers; ++i) {
+    VP8RowWorker* const rw = &dec->row_workers[i];
+    if (rw->wake == NULL) rw->wake = RowWakeNew();
+    if (rw->wake == NULL) return 0;
+  }
+  return 1;
+}
+
+void VP8EndRowWorkers(VP8Decoder* const dec) {
+  int i;
+  for (i = 0; i < WEBP_MAX_ROW_WORKERS; ++i) {
+    VP8RowWorker* const rw = &dec->row_workers[i];
+    if (rw->wake != NULL) RowWakeDelete(rw->wake);
+    rw->wake = NULL;
+  }
+}
+
+#else  // !WEBP_USE_ROW_WORKERS
+
+int VP8DecodeRowsParallel(VP8Decoder* const dec, VP8Io* const io) {
+  (void)io;
+  return VP8SetError(dec, VP8_STATUS_UNSUPPORTED_FEATURE,
+                     "Partition-parallel decoding is not available.");
+}
+
+void VP8EndRowWorkers(VP8Decoder* const dec) { (void)dec; }
+
+#endif  // WEBP_USE_ROW_WORKERS
+
 //------------------------------------------------------------------------------
 // Finish setting up the decoding parameter once user's setup() is called.
 
@@ -571,8 +1017,9 @@ VP8StatusCode VP8EnterCritical(VP8Decoder* const dec, VP8Io* const io) {
     return dec->status;
   }
 
-  // Disable filtering per user request
-  if (io->bypass_filtering) {
+  // Disable filtering per user request, or when only the DCs are needed
+  dec->dc_only = io->use_dc_only;
+  if (io->bypass_filtering || dec->dc_only) {
     dec->filter_type = 0;
   }
 
@@ -657,6 +1104,41 @@ int VP8ExitCritical(VP8Decoder* const dec, VP8Io* const io) {
 // Initialize multi/single-thread worker
 static int InitThreadContext(VP8Decoder* const dec) {
   dec->cache_id = 0;
+  if (dec->dc_only) dec->mt_method = 0;  // not worth it
+#if defined(WEBP_USE_ROW_WORKERS)
+  // Now that the number of token partitions is known, switch to decoding
+  // them in parallel if there are several. Incremental decoding parses the
+  // data row by row as it arrives, so it keeps the regular methods.
+  if (dec->mt_method > 0 && dec->num_parts_minus_one > 0 &&
+      !dec->incremental && WEBP_MAX_ROW_WORKERS > 1) {
+    const int num_parts = (int)dec->num_parts_minus_one + 1;
+    dec->mt_method = 3;
+    dec->num_row_workers = (num_parts < WEBP_MAX_ROW_WORKERS)
+                               ? num_parts
+                               : WEBP_MAX_ROW_WORKERS;
+  } else if (dec->mt_method == 3) {
+    dec->mt_method = 0;
+  }
+  if (dec->mt_method == 3) {
+    int i;
+    if (!InitRowWakes(dec)) {
+      return VP8SetError(dec, VP8_STATUS_OUT_OF_MEMORY,
+                         "thread initialization failed.");
+    }
+    for (i = 1; i < dec->num_row_workers; ++i) {
+      WebPWorker* const worker = &dec->row_workers[i].worker;
+      if (!WebPGetWorkerInterface()->Reset(worker)) {
+        return VP8SetError(dec, VP8_STATUS_OUT_OF_MEMORY,
+                           "thread initialization failed.");
+      }
+      worker->data1 = dec;
+      worker->data2 = (void*)&dec->row_workers[i];
+      worker->hook = DecodeRows;
+    }
+    dec->num_caches = dec->num_row_workers + (dec->filter_type > 0);
+    return 1;
+  }
+#endif
   if (dec->mt_method > 0) {
     WebPWorker* const worker = &dec->worker;
     if (!WebPGetWorkerInterface()->Reset(worker)) {
@@ -687,7 +1169,13 @@ int VP8GetThreadMethod(const WebPDecoderOptions* const options,
 #if defined(WEBP_USE_THREAD)
   if (width >= MIN_WIDTH_FOR_THREADS) return 2;
 #endif
+#if defined(WEBP_USE_ROW_WORKERS)
+  // Narrower pictures can still use parallel partitions, if any. This is
+  // resolved in VP8InitFrame(), once the partitions are known.
+  return 3;
+#else
   return 0;
+#endif
 }
 
 #undef MT_CACHE_LINES
@@ -696,47 +1184,68 @@ int VP8GetThreadMethod(const WebPDecoderOptions* const options,
 //------------------------------------------------------------------------------
 // Memory setup
 
+// Makes sure '*mem' holds at least 'needed' bytes. Returns false on error.
+static int GrowMemory(void** const mem, size_t* const mem_size,
+                      uint64_t needed, WebPMemHint hint) {
+  if (needed > *mem_size) {
+    WebPSafeFree(*mem);
+    *mem_size = 0;
+    *mem = WebPSafeMallocHint(needed, sizeof(uint8_t), hint);
+    if (*mem == NULL) return 0;
+    // down-cast is ok, thanks to WebPSafeMallocHint() above.
+    *mem_size = (size_t)needed;
+  }
+  return 1;
+}
+
 static int AllocateMemory(VP8Decoder* const dec) {
   const int num_caches = dec->num_caches;
   const int mb_w = dec->mb_w;
+  // number of macroblock rows decoded concurrently by mt_method 3
+  const int num_rows = (dec->mt_method == 3) ? dec->num_row_workers : 1;
   // Note: we use 'size_t' when there's no overflow risk, uint64_t otherwise.
   const size_t intra_pred_mode_size = 4 * mb_w * sizeof(uint8_t);
   const size_t top_size = sizeof(VP8TopSamples) * mb_w;
   const size_t mb_info_size = (mb_w + 1) * sizeof(VP8MB);
   const size_t f_info_size =
       (dec->filter_type > 0)
-          ? mb_w * (dec->mt_method > 0 ? 2 : 1) * sizeof(VP8FInfo)
+          ? mb_w * (dec->mt_method == 3  ? num_rows
+                    : dec->mt_method > 0 ? 2
+                                         : 1) * sizeof(VP8FInfo)
           : 0;
-  const size_t yuv_size = YUV_SIZE * sizeof(*dec->yuv_b);
-  const size_t mb_data_size =
-      (dec->mt_method == 2 ? 2 : 1) * mb_w * sizeof(*dec->mb_data);
+  const size_t yuv_size = num_rows * YUV_SIZE * sizeof(*dec->yuv_b);
+  const size_t mb_data_size = (dec->mt_method == 2 ? 2 : num_rows) * mb_w *
+                              sizeof(*dec->mb_data);
   const size_t cache_height =
       (16 * num_caches + kFilterExtraRows[dec->filter_type]) * 3 / 2;
-  const size_t cache_size = top_size * cache_height;
+  // DC-only: a single row of Y, U, V and alpha samples
+  const size_t cache_size =
+      dec->dc_only ? 7 * mb_w * sizeof(uint8_t) : top_size * cache_height;
   // alpha_size is the only one that scales as width x height.
   const uint64_t alpha_size =
       (dec->alpha_data != NULL)
           ? (uint64_t)dec->pic_hdr.width * dec->pic_hdr.height
           : 0ULL;
-  const uint64_t needed = (uint64_t)intra_pred_mode_size + top_size +
-                          mb_info_size + f_info_size + yuv_size + mb_data_size +
-                          cache_size + alpha_size + WEBP_ALIGN_CST;
+  // ESP32 port: the intra caches and the per-macroblock side info are read
+  // for every macroblock and go to 'hot_mem' (internal DRAM, if the budget
+  // allows). Coefficients, samples and alpha go to 'mem' (PSRAM).
+  const uint64_t hot_needed = (uint64_t)intra_pred_mode_size + top_size +
+                              mb_info_size + f_info_size + yuv_size +
+                              WEBP_ALIGN_CST;
+  const uint64_t needed = (uint64_t)mb_data_size + cache_size + alpha_size +
+                          WEBP_ALIGN_CST;
   uint8_t* mem;
 
-  if (!CheckSizeOverflow(needed)) return 0;  // check for overflow
-  if (needed > dec->mem_size) {
-    WebPSafeFree(dec->mem);
-    dec->mem_size = 0;
-    dec->mem = WebPSafeMalloc(needed, sizeof(uint8_t));
-    if (dec->mem == NULL) {
-      return VP8SetError(dec, VP8_STATUS_OUT_OF_MEMORY,
-                         "no memory during frame initialization.");
-    }
-    // down-cast is ok, thanks to WebPSafeMalloc() above.
-    dec->mem_size = (size_t)needed;
+  // check for overflow
+  if (!CheckSizeOverflow(needed) || !CheckSizeOverflow(hot_needed)) return 0;
+  if (!GrowMemory(&dec->hot_mem, &dec->hot_mem_size, hot_needed,
+                  WEBP_MEM_HOT) ||
+      !GrowMemory(&dec->mem, &dec->mem_size, needed, WEBP_MEM_BULK)) {
+    return VP8SetError(dec, VP8_STATUS_OUT_OF_MEMORY,
+                       "no memory during frame initialization.");
   }
 
-  mem = (uint8_t*)dec->mem;
+  mem = (uint8_t*)dec->hot_mem;
   dec->intra_t = mem;
   mem += intra_pred_mode_size;
 
@@ -761,7 +1270,9 @@ static int AllocateMemory(VP8Decoder* const dec) {
   assert((yuv_size & WEBP_ALIGN_CST) == 0);
   dec->yuv_b = mem;
   mem += yuv_size;
+  assert(mem <= (uint8_t*)dec->hot_mem + dec->hot_mem_size);
 
+  mem = (uint8_t*)WEBP_ALIGN(dec->mem);
   dec->mb_data = (VP8MBData*)mem;
   dec->thread_ctx.mb_data = (VP8MBData*)mem;
   if (dec->mt_method == 2) {
@@ -771,7 +1282,14 @@ static int AllocateMemory(VP8Decoder* const dec) {
 
   dec->cache_y_stride = 16 * mb_w;
   dec->cache_uv_stride = 8 * mb_w;
-  {
+  if (dec->dc_only) {
+    dec->cache_y_stride = dec->cache_uv_stride = mb_w;
+    dec->cache_y = mem;
+    dec->cache_u = dec->cache_y + mb_w;
+    dec->cache_v = dec->cache_u + mb_w;
+    dec->cache_id = 0;
+    WEBP_UNSAFE_MEMSET(mem, 0, cache_size);
+  } else {
     const int extra_rows = kFilterExtraRows[dec->filter_type];
     const int extra_y = extra_rows * dec->cache_y_stride;
     const int extra_uv = (extra_rows / 2) * dec->cache_uv_stride;
@@ -784,6 +1302,16 @@ static int AllocateMemory(VP8Decoder* const dec) {
   }
   mem += cache_size;
 
+  if (dec->mt_method == 3) {
+    int i;
+    for (i = 0; i < dec->num_row_workers; ++i) {
+      VP8RowWorker* const rw = &dec->row_workers[i];
+      rw->ctx.f_info = (dec->f_info != NULL) ? dec->f_info + i * mb_w : NULL;
+      rw->ctx.mb_data = dec->mb_data + i * mb_w;
+      rw->yuv_b = dec->yuv_b + i * YUV_SIZE;
+    }
+  }
+
   // alpha plane
   dec->alpha_plane = alpha_size ? mem : NULL;
   mem += alpha_size;
@@ -241,6 +241,210 @@ static int EmitAlphaRGBA4444(const VP8Io* const io, WebPDecParams* const p,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Background blending: MODE_RGB_565 has no alpha channel, so transparent
+// pixels are blended over options->bgcolor instead.
+
+static int UseBgcolor(const WebPDecParams* const p) {
+  return (p->output->colorspace == MODE_RGB_565) && (p->options != NULL) &&
+         p->options->use_bgcolor;
+}
+
+#define BLEND_565(c, bg, a) (((c) * (a) + (bg) * (255 - (a)) + 127) / 255)
+
+static void BlendRGB565Row(const uint8_t* const alpha, uint8_t* dst, int width,
+                           uint32_t bgcolor) {
+  const int bg_r = (bgcolor >> 19) & 0x1f;
+  const int bg_g = (bgcolor >> 10) & 0x3f;
+  const int bg_b = (bgcolor >> 3) & 0x1f;
+  int i;
+  for (i = 0; i < width; ++i, dst += 2) {
+    const int a = alpha[i];
+    if (a != 0xff) {
+#if (WEBP_SWAP_16BIT_CSP == 1)
+      const int rgb = (dst[1] << 8) | dst[0];
+#else
+      const int rgb = (dst[0] << 8) | dst[1];
+#endif
+      const int r = BLEND_565(rgb >> 11, bg_r, a);
+      const int g = BLEND_565((rgb >> 5) & 0x3f, bg_g, a);
+      const int b = BLEND_565(rgb & 0x1f, bg_b, a);
+      const int out = (r << 11) | (g << 5) | b;
+#if (WEBP_SWAP_16BIT_CSP == 1)
+      dst[0] = out & 0xff;
+      dst[1] = out >> 8;
+#else
+      dst[0] = out >> 8;
+      dst[1] = out & 0xff;
+#endif
+    }
+  }
+}
+
+#undef BLEND_565
+
+static int EmitAlphaRGB565(const VP8Io* const io, WebPDecParams* const p,
+                           int expected_num_lines_out) {
+  const uint8_t* alpha = io->a;
+  if (alpha != NULL) {
+    const WebPRGBABuffer* const buf = &p->output->u.RGBA;
+    int num_rows, j;
+    const int start_y = GetAlphaSourceRow(io, &alpha, &num_rows);
+    uint8_t* dst = buf->rgba + (ptrdiff_t)start_y * buf->stride;
+    (void)expected_num_lines_out;
+    assert(expected_num_lines_out == num_rows);
+    for (j = 0; j < num_rows; ++j) {
+      BlendRGB565Row(alpha, dst, io->mb_w, p->options->bgcolor);
+      alpha += io->width;
+      dst += buf->stride;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// DC-only output: each macroblock row comes as a single row of mb_w samples.
+// Every macroblock is accounted to the output pixel containing its center,
+// and each output pixel is the average of its macroblocks. Since the output
+// is at most 1/16 of the cropped area, no output pixel is left empty.
+
+// Center of the 16-pixel block starting at 'pos', clipped to [lo, hi).
+static int DcCenter(int pos, int size, int lo, int hi) {
+  const int end = (pos + 16 < size) ? pos + 16 : size;
+  const int center = (pos + end) >> 1;
+  return (center < lo) ? lo : (center >= hi) ? hi - 1 : center;
+}
+
+static int InitDcRGB(const VP8Io* const io, WebPDecParams* const p) {
+  const int out_width = io->scaled_width;
+  const int mb_w = (io->width + 15) >> 4;
+  const int crop_w = io->crop_right - io->crop_left;
+  const uint64_t col_size = (uint64_t)mb_w * sizeof(*p->dc_col);
+  const uint64_t sum_size = (uint64_t)out_width * 5 * sizeof(*p->dc_sum);
+  const uint64_t tmp_size = (uint64_t)out_width * 3;
+  uint8_t* mem;
+  int mb_x;
+
+  p->memory = WebPSafeCalloc(1ULL, col_size + sum_size + tmp_size);
+  if (p->memory == NULL) {
+    return 0;  // memory error
+  }
+  mem = (uint8_t*)p->memory;
+  p->dc_col = (int*)mem;
+  mem += col_size;
+  p->dc_sum = (uint32_t*)mem;
+  mem += sum_size;
+  p->tmp_y = mem;
+  p->tmp_u = p->tmp_y + out_width;
+  p->tmp_v = p->tmp_u + out_width;
+
+  for (mb_x = 0; mb_x < mb_w; ++mb_x) {
+    const int x = 16 * mb_x;
+    const int inside = (x + 16 > io->crop_left) && (x < io->crop_right);
+    const int center = DcCenter(x, io->width, io->crop_left, io->crop_right);
+    p->dc_col[mb_x] =
+        inside ? (center - io->crop_left) * out_width / crop_w : -1;
+  }
+  WebPInitYUV444Converters();
+  if (WebPIsAlphaMode(p->output->colorspace)) {
+    WebPInitAlphaProcessing();
+  }
+  return 1;
+}
+
+// Output row receiving the macroblock row starting at 'y', or -1 if cropped.
+static int DcRow(const VP8Io* const io, int y) {
+  const int crop_h = io->crop_bottom - io->crop_top;
+  if (y + 16 <= io->crop_top || y >= io->crop_bottom) return -1;
+  return (DcCenter(y, io->height, io->crop_top, io->crop_bottom) -
+          io->crop_top) * io->scaled_height / crop_h;
+}
+
+static void EmitDcAlphaRow(const uint8_t* const alpha, uint8_t* const dst,
+                           WebPDecParams* const p) {
+  const WEBP_CSP_MODE colorspace = p->output->colorspace;
+  const int width = p->output->width;
+  if (colorspace == MODE_RGB_565) {
+    BlendRGB565Row(alpha, dst, width, p->options->bgcolor);
+  } else if (colorspace == MODE_RGBA_4444 || colorspace == MODE_rgbA_4444) {
+#if (WEBP_SWAP_16BIT_CSP == 1)
+    uint8_t* const alpha_dst = dst;
+#else
+    uint8_t* const alpha_dst = dst + 1;
+#endif
+    uint32_t alpha_mask = 0x0f;
+    int i;
+    for (i = 0; i < width; ++i) {
+      const uint32_t alpha_value = alpha[i] >> 4;
+      alpha_dst[2 * i] = (alpha_dst[2 * i] & 0xf0) | alpha_value;
+      alpha_mask &= alpha_value;
+    }
+    if (alpha_mask != 0x0f && WebPIsPremultipliedMode(colorspace)) {
+      WebPApplyAlphaMultiply4444(dst, width, 1, 0);
+    }
+  } else {
+    const int alpha_first =
+        (colorspace == MODE_ARGB || colorspace == MODE_Argb);
+    const int has_alpha = WebPDispatchAlpha(alpha, 0, width, 1,
+                                            dst + (alpha_first ? 0 : 3), 0);
+    if (has_alpha && WebPIsPremultipliedMode(colorspace)) {
+      WebPApplyAlphaMultiply(dst, alpha_first, width, 1, 0);
+    }
+  }
+}
+
+static int EmitDcRGB(const VP8Io* const io, WebPDecParams* const p) {
+  const int out_width = p->output->width;
+  const int mb_w = io->mb_w;
+  const int row = DcRow(io, io->mb_y);
+  uint32_t* const sum = p->dc_sum;
+  int mb_x, i;
+
+  if (row < 0) return 0;
+  for (mb_x = 0; mb_x < mb_w; ++mb_x) {
+    const int col = p->dc_col[mb_x];
+    if (col >= 0) {
+      uint32_t* const s = sum + 5 * col;
+      s[0] += io->y[mb_x];
+      s[1] += io->u[mb_x];
+      s[2] += io->v[mb_x];
+      s[3] += (io->a != NULL) ? io->a[mb_x] : 0xff;
+      s[4] += 1;
+    }
+  }
+  // Is this the last macroblock row of this output row?
+  if (io->mb_y + 16 < io->crop_bottom && DcRow(io, io->mb_y + 16) == row) {
+    return 0;
+  }
+  {
+    const WebPRGBABuffer* const buf = &p->output->u.RGBA;
+    uint8_t* const dst = buf->rgba + (ptrdiff_t)p->last_y * buf->stride;
+    const WEBP_CSP_MODE colorspace = p->output->colorspace;
+    int has_alpha = 0;
+    assert(p->last_y == row);
+    for (i = 0; i < out_width; ++i) {
+      const uint32_t* const s = sum + 5 * i;
+      const uint32_t n = (s[4] > 0) ? s[4] : 1;
+      p->tmp_y[i] = (s[0] + n / 2) / n;
+      p->tmp_u[i] = (s[1] + n / 2) / n;
+      p->tmp_v[i] = (s[2] + n / 2) / n;
+    }
+    WebPYUV444Converters[colorspace](p->tmp_y, p->tmp_u, p->tmp_v, dst,
+                                     out_width);
+    if (io->a != NULL && (WebPIsAlphaMode(colorspace) || UseBgcolor(p))) {
+      for (i = 0; i < out_width; ++i) {  // tmp_y is free again
+        const uint32_t* const s = sum + 5 * i;
+        const uint32_t n = (s[4] > 0) ? s[4] : 1;
+        p->tmp_y[i] = (s[3] + n / 2) / n;
+        has_alpha |= (p->tmp_y[i] != 0xff);
+      }
+      if (has_alpha) EmitDcAlphaRow(p->tmp_y, dst, p);
+    }
+    WEBP_UNSAFE_MEMSET(sum, 0, 5 * out_width * sizeof(*sum));
+  }
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 // YUV rescaling (no final RGB conversion needed)
 
@@ -475,6 +679,24 @@ static int ExportAlphaRGBA4444(WebPDecParams* const p, int y_pos,
   return num_lines_out;
 }
 
+static int ExportAlphaRGB565(WebPDecParams* const p, int y_pos,
+                             int max_lines_out) {
+  const WebPRGBABuffer* const buf = &p->output->u.RGBA;
+  uint8_t* dst = buf->rgba + (ptrdiff_t)y_pos * buf->stride;
+  const int width = p->scaler_a->dst_width;
+  int num_lines_out = 0;
+
+  while (WebPRescalerHasPendingOutput(p->scaler_a) &&
+         num_lines_out < max_lines_out) {
+    assert(y_pos + num_lines_out < p->output->height);
+    WebPRescalerExportRow(p->scaler_a);
+    BlendRGB565Row(p->scaler_a->dst, dst, width, p->options->bgcolor);
+    dst += buf->stride;
+    ++num_lines_out;
+  }
+  return num_lines_out;
+}
+
 static int EmitRescaledAlphaRGB(const VP8Io* const io, WebPDecParams* const p,
                                 int expected_num_out_lines) {
   if (io->a != NULL) {
@@ -492,7 +714,8 @@ static int EmitRescaledAlphaRGB(const VP8Io* const io, WebPDecParams* const p,
 }
 
 static int InitRGBRescaler(const VP8Io* const io, WebPDecParams* const p) {
-  const int has_alpha = WebPIsAlphaMode(p->output->colorspace);
+  const int has_alpha =
+      WebPIsAlphaMode(p->output->colorspace) || UseBgcolor(p);
   const int out_width = io->scaled_width;
   const int out_height = io->scaled_height;
   const int uv_in_width = (io->mb_w + 1) >> 1;
@@ -552,6 +775,8 @@ static int InitRGBRescaler(const VP8Io* const io, WebPDecParams* const p) {
     if (p->output->colorspace == MODE_RGBA_4444 ||
         p->output->colorspace == MODE_rgbA_4444) {
       p->emit_alpha_row = ExportAlphaRGBA4444;
+    } else if (p->output->colorspace == MODE_RGB_565) {
+      p->emit_alpha_row = ExportAlphaRGB565;
     } else {
       p->emit_alpha_row = ExportAlpha;
     }
@@ -583,7 +808,15 @@ static int CustomSetup(VP8Io* io) {
   if (is_alpha && WebPIsPremultipliedMode(colorspace)) {
     WebPInitUpsamplers();
   }
-  if (io->use_scaling) {
+  if (io->use_dc_only && !is_rgb) {
+    io->use_dc_only = 0;  // only implemented for RGB output
+  }
+  if (io->use_dc_only) {
+    if (!InitDcRGB(io, p)) {
+      return 0;  // memory error
+    }
+    p->emit = EmitDcRGB;  // takes care of alpha too
+  } else if (io->use_scaling) {
 #if !defined(WEBP_REDUCE_SIZE)
     const int ok = is_rgb ? InitRGBRescaler(io, p) : InitYUVRescaler(io, p);
     if (!ok) {
@@ -622,6 +855,8 @@ static int CustomSetup(VP8Io* io) {
       if (is_rgb) {
         WebPInitAlphaProcessing();
       }
+    } else if (UseBgcolor(p)) {
+      p->emit_alpha = EmitAlphaRGB565;
     }
   }
 
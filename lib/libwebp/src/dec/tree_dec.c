@@ -254,10 +254,9 @@ void VP8ResetProba(VP8Proba* const proba) {
 }
 
 static void ParseIntraMode(VP8BitReader* const br, VP8Decoder* const dec,
-                           int mb_x) {
+                           int mb_x, VP8MBData* const block) {
   uint8_t* const top = dec->intra_t + 4 * mb_x;
   uint8_t* const left = dec->intra_l;
-  VP8MBData* const block = dec->mb_data + mb_x;
 
   // Note: we don't save segment map (yet), as we don't expect
   // to decode more than 1 keyframe.
@@ -330,14 +329,19 @@ static void ParseIntraMode(VP8BitReader* const br, VP8Decoder* const dec,
                                                          : H_PRED;
 }
 
-int VP8ParseIntraModeRow(VP8BitReader* const br, VP8Decoder* const dec) {
+int VP8ParseIntraModeRowInto(VP8BitReader* const br, VP8Decoder* const dec,
+                             VP8MBData* const mb_data) {
   int mb_x;
   for (mb_x = 0; mb_x < dec->mb_w; ++mb_x) {
-    ParseIntraMode(br, dec, mb_x);
+    ParseIntraMode(br, dec, mb_x, mb_data + mb_x);
   }
   return !dec->br.eof;
 }
 
+int VP8ParseIntraModeRow(VP8BitReader* const br, VP8Decoder* const dec) {
+  return VP8ParseIntraModeRowInto(br, dec, dec->mb_data);
+}
+
 //------------------------------------------------------------------------------
 // Paragraph 13
 
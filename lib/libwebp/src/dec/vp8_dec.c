@@ -69,10 +69,16 @@ int VP8InitIoInternal(VP8Io* const io, int version) {
 }
 
 VP8Decoder* VP8New(void) {
-  VP8Decoder* const dec = (VP8Decoder*)WebPSafeCalloc(1ULL, sizeof(*dec));
+  // probabilities and segment info are read for every token
+  VP8Decoder* const dec =
+      (VP8Decoder*)WebPSafeCallocHint(1ULL, sizeof(*dec), WEBP_MEM_HOT);
   if (dec != NULL) {
+    int i;
     SetOk(dec);
     WebPGetWorkerInterface()->Init(&dec->worker);
+    for (i = 0; i < WEBP_MAX_ROW_WORKERS; ++i) {
+      WebPGetWorkerInterface()->Init(&dec->row_workers[i].worker);
+    }
     dec->ready = 0;
     dec->num_parts_minus_one = 0;
     InitGetCoeffs();
@@ -530,14 +536,13 @@ static WEBP_INLINE uint32_t NzCodeBits(uint32_t nz_coeffs, int nz, int dc_nz) {
   return nz_coeffs;
 }
 
-static int ParseResiduals(VP8Decoder* const dec, VP8MB* const mb,
+static int ParseResiduals(const VP8Decoder* const dec, VP8MB* const mb,
+                          VP8MB* const left_mb, VP8MBData* const block,
                           VP8BitReader* const token_br) {
-  const VP8BandProbas*(*const bands)[16 + 1] = dec->proba.bands_ptr;
+  const VP8BandProbas* const(*const bands)[16 + 1] = dec->proba.bands_ptr;
   const VP8BandProbas* const* ac_proba;
-  VP8MBData* const block = dec->mb_data + dec->mb_x;
   const VP8QuantMatrix* const q = &dec->dqm[block->segment];
   int16_t* dst = block->coeffs;
-  VP8MB* const left_mb = dec->mb_info - 1;
   uint8_t tnz, lnz;
   uint32_t non_zero_y = 0;
   uint32_t non_zero_uv = 0;
@@ -624,14 +629,14 @@ static int ParseResiduals(VP8Decoder* const dec, VP8MB* const mb,
 //------------------------------------------------------------------------------
 // Main loop
 
-int VP8DecodeMB(VP8Decoder* const dec, VP8BitReader* const token_br) {
-  VP8MB* const left = dec->mb_info - 1;
-  VP8MB* const mb = dec->mb_info + dec->mb_x;
-  VP8MBData* const block = dec->mb_data + dec->mb_x;
+int VP8DecodeMBInto(const VP8Decoder* const dec, int mb_x, VP8MB* const left,
+                    VP8MBData* const block, VP8FInfo* const f_info,
+                    VP8BitReader* const token_br) {
+  VP8MB* const mb = dec->mb_info + mb_x;
   int skip = dec->use_skip_proba ? block->skip : 0;
 
   if (!skip) {
-    skip = ParseResiduals(dec, mb, token_br);
+    skip = ParseResiduals(dec, mb, left, block, token_br);
   } else {
     left->nz = mb->nz = 0;
     if (!block->is_i4x4) {
@@ -643,7 +648,7 @@ int VP8DecodeMB(VP8Decoder* const dec, VP8BitReader* const token_br) {
   }
 
   if (dec->filter_type > 0) {  // store filter info
-    VP8FInfo* const finfo = dec->f_info + dec->mb_x;
+    VP8FInfo* const finfo = f_info + mb_x;
     *finfo = dec->fstrengths[block->segment][block->is_i4x4];
     finfo->f_inner |= !skip;
   }
@@ -651,6 +656,11 @@ int VP8DecodeMB(VP8Decoder* const dec, VP8BitReader* const token_br) {
   return !token_br->eof;
 }
 
+int VP8DecodeMB(VP8Decoder* const dec, VP8BitReader* const token_br) {
+  return VP8DecodeMBInto(dec, dec->mb_x, dec->mb_info - 1,
+                         dec->mb_data + dec->mb_x, dec->f_info, token_br);
+}
+
 void VP8InitScanline(VP8Decoder* const dec) {
   VP8MB* const left = dec->mb_info - 1;
   left->nz = 0;
@@ -660,6 +670,9 @@ void VP8InitScanline(VP8Decoder* const dec) {
 }
 
 static int ParseFrame(VP8Decoder* const dec, VP8Io* io) {
+  if (dec->mt_method == 3) {
+    return VP8DecodeRowsParallel(dec, io);
+  }
   for (dec->mb_y = 0; dec->mb_y < dec->br_mb_y; ++dec->mb_y) {
     // Parse bitstream for this row.
     VP8BitReader* const token_br =
@@ -733,10 +746,20 @@ void VP8Clear(VP8Decoder* const dec) {
     return;
   }
   WebPGetWorkerInterface()->End(&dec->worker);
+  {
+    int i;
+    for (i = 0; i < WEBP_MAX_ROW_WORKERS; ++i) {
+      WebPGetWorkerInterface()->End(&dec->row_workers[i].worker);
+    }
+  }
+  VP8EndRowWorkers(dec);
   WebPDeallocateAlphaMemory(dec);
   WebPSafeFree(dec->mem);
   dec->mem = NULL;
   dec->mem_size = 0;
+  WebPSafeFree(dec->hot_mem);
+  dec->hot_mem = NULL;
+  dec->hot_mem_size = 0;
   WEBP_UNSAFE_MEMSET(&dec->br, 0, sizeof(dec->br));
   dec->ready = 0;
 }
@@ -106,6 +106,11 @@ struct VP8Io {
   int use_scaling;
   int scaled_width, scaled_height;
 
+  // If true, only the DC of each macroblock is reconstructed. put() then
+  // receives a single row of mb_w Y/U/V samples (and alpha, if any) per
+  // macroblock row, mb_y and mb_h still being in pixels.
+  int use_dc_only;
+
   // If non NULL, pointer to the alpha data (if present) corresponding to the
   // start of the current row (That is: it is pre-offset by mb_y and takes
   // cropping into account).
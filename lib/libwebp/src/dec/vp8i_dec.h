@@ -71,6 +71,12 @@ extern "C" {
 // minimal width under which lossy multi-threading is always disabled
 #define MIN_WIDTH_FOR_THREADS 512
 
+// maximal number of workers (including the calling thread) decoding the token
+// partitions in parallel. Must be a power of 2, in [1..MAX_NUM_PARTITIONS].
+#ifndef WEBP_MAX_ROW_WORKERS
+#define WEBP_MAX_ROW_WORKERS 2
+#endif
+
 //------------------------------------------------------------------------------
 // Headers
 
@@ -178,6 +184,21 @@ typedef struct {
   VP8Io io;            // copy of the VP8Io to pass to put()
 } VP8ThreadContext;
 
+// Per-worker state for partition-parallel decoding (mt_method == 3).
+// Worker #k handles rows k, k + n, k + 2n... (n = dec->num_row_workers), so
+// all the rows of a given token partition are decoded by the same worker.
+typedef struct {
+  WebPWorker worker;     // not used by worker #0, which runs in the caller
+  VP8ThreadContext ctx;  // row in progress, its cache row, mb_data and f_info
+  VP8MB left;            // left syntax context for the row in progress
+  uint8_t* yuv_b;        // own Y/U/V prediction block (size = YUV_SIZE)
+  int pos;               // progress: mb_y * mb_w + number of MBs reconstructed
+  VP8StatusCode status;  // error status of this worker, if any
+  const char* error_msg;
+  int waiting;           // set while blocked on 'wake' for another worker
+  void* wake;            // binary semaphore (frame_dec.c), created on first use
+} VP8RowWorker;
+
 // Saved top samples, per macroblock. Fits into a cache-line.
 typedef struct {
   uint8_t y[16], u[8], v[8];
@@ -205,10 +226,18 @@ struct VP8Decoder {
   WebPWorker worker;
   int mt_method;   // multi-thread method: 0=off, 1=[parse+recon][filter]
                    // 2=[parse][recon+filter]
+                   // 3=[parse+recon+filter] per token partition
   int cache_id;    // current cache row
-  int num_caches;  // number of cached rows of 16 pixels (1, 2 or 3)
+  int num_caches;  // number of cached rows of 16 pixels
   VP8ThreadContext thread_ctx;  // Thread context
 
+  // Partition-parallel decoding (mt_method == 3)
+  int num_row_workers;
+  VP8RowWorker row_workers[WEBP_MAX_ROW_WORKERS];
+  int modes_row;     // next row whose intra modes are to be parsed
+  int finished_row;  // number of rows already filtered and emitted
+  int row_abort;     // set when one of the row workers failed
+
   // dimension, in macroblock units.
   int mb_w, mb_h;
 
@@ -249,9 +278,14 @@ struct VP8Decoder {
   int cache_y_stride;
   int cache_uv_stride;
 
-  // main memory chunk for the above data. Persistent.
+  // main memory chunk for the caches above, mb_data and the alpha plane.
+  // Persistent.
   void* mem;
   size_t mem_size;
+  // ESP32 port: separate chunk for intra_t, yuv_t, mb_info, f_info and yuv_b,
+  // placed in internal DRAM when possible. Persistent too.
+  void* hot_mem;
+  size_t hot_mem_size;
 
   // Per macroblock non-persistent infos.
   int mb_x, mb_y;      // current position, in macroblock units
@@ -261,6 +295,11 @@ struct VP8Decoder {
   int filter_type;                          // 0=off, 1=simple, 2=complex
   VP8FInfo fstrengths[NUM_MB_SEGMENTS][2];  // precalculated per-segment/type
 
+  // DC-only reconstruction (io->use_dc_only). The cache then holds a single
+  // row of mb_w Y, U, V and alpha samples, one per macroblock, followed by
+  // the Y, U and V bottom edge means of the previous macroblock row.
+  int dc_only;
+
   // Alpha
   struct ALPHDecoder* alph_dec;  // alpha-plane decoder object
   const uint8_t* WEBP_COUNTED_BY(alpha_data_size)
@@ -285,6 +324,9 @@ void VP8ResetProba(VP8Proba* const proba);
 void VP8ParseProba(VP8BitReader* const br, VP8Decoder* const dec);
 // parses one row of intra mode data in partition 0, returns !eof
 int VP8ParseIntraModeRow(VP8BitReader* const br, VP8Decoder* const dec);
+// same, but stores the modes into 'mb_data' instead of dec->mb_data
+int VP8ParseIntraModeRowInto(VP8BitReader* const br, VP8Decoder* const dec,
+                             VP8MBData* const mb_data);
 
 // in quant.c
 void VP8ParseQuant(VP8Decoder* const dec);
@@ -309,11 +351,23 @@ void VP8InitDithering(const WebPDecoderOptions* const options,
                       VP8Decoder* const dec);
 // Process the last decoded row (filtering + output).
 WEBP_NODISCARD int VP8ProcessRow(VP8Decoder* const dec, VP8Io* const io);
+// Decode, reconstruct, filter and emit all the rows with the row workers
+// (mt_method == 3). Returns false in case of error.
+WEBP_NODISCARD int VP8DecodeRowsParallel(VP8Decoder* const dec,
+                                         VP8Io* const io);
+// Release what the row workers keep between decodes. Called by VP8Clear().
+void VP8EndRowWorkers(VP8Decoder* const dec);
 // To be called at the start of a new scanline, to initialize predictors.
 void VP8InitScanline(VP8Decoder* const dec);
 // Decode one macroblock. Returns false if there is not enough data.
 WEBP_NODISCARD int VP8DecodeMB(VP8Decoder* const dec,
                                VP8BitReader* const token_br);
+// Same as VP8DecodeMB(), with explicit left context and destination.
+// Only the shared top context dec->mb_info[mb_x] is touched in 'dec'.
+WEBP_NODISCARD int VP8DecodeMBInto(const VP8Decoder* const dec, int mb_x,
+                                   VP8MB* const left, VP8MBData* const block,
+                                   VP8FInfo* const f_info,
+                                   VP8BitReader* const token_br);
 
 // in alpha.c
 const uint8_t* VP8DecompressAlphaRows(VP8Decoder* const dec,
@@ -642,6 +642,31 @@ static int EmitRescaledRowsRGBA(const VP8LDecoder* const dec, uint8_t* in,
 #endif  // WEBP_REDUCE_SIZE
 
 // Emit rows without any scaling.
+// MODE_RGB_565 has no alpha channel: if requested, blend the (unpremultiplied)
+// BGRA rows over options->bgcolor before the conversion.
+static void BlendRowsOverBgcolor(uint8_t* rows, int stride, int width,
+                                 int num_rows, uint32_t bgcolor) {
+  const uint32_t bg_r = (bgcolor >> 16) & 0xff;
+  const uint32_t bg_g = (bgcolor >> 8) & 0xff;
+  const uint32_t bg_b = (bgcolor >> 0) & 0xff;
+  int i, j;
+  for (j = 0; j < num_rows; ++j, rows += stride) {
+    uint32_t* const argb = (uint32_t*)rows;
+    for (i = 0; i < width; ++i) {
+      const uint32_t a = argb[i] >> 24;
+      if (a != 0xff) {
+        const uint32_t r = (argb[i] >> 16) & 0xff;
+        const uint32_t g = (argb[i] >> 8) & 0xff;
+        const uint32_t b = (argb[i] >> 0) & 0xff;
+        argb[i] = 0xff000000u |
+                  (((r * a + bg_r * (255 - a) + 127) / 255) << 16) |
+                  (((g * a + bg_g * (255 - a) + 127) / 255) << 8) |
+                  (((b * a + bg_b * (255 - a) + 127) / 255) << 0);
+      }
+    }
+  }
+}
+
 static int EmitRows(WEBP_CSP_MODE colorspace, const uint8_t* row_in,
                     int in_stride, int mb_w, int mb_h, uint8_t* const out,
                     int out_stride) {
@@ -899,6 +924,13 @@ static void ProcessRows(VP8LDecoder* const dec, int row,
       // Nothing to output (this time).
     } else {
       const WebPDecBuffer* const output = dec->output;
+      const WebPDecoderOptions* const options =
+          ((const WebPDecParams*)io->opaque)->options;
+      if (output->colorspace == MODE_RGB_565 && options != NULL &&
+          options->use_bgcolor) {
+        BlendRowsOverBgcolor(rows_data, in_stride, io->mb_w, io->mb_h,
+                             options->bgcolor);
+      }
       if (WebPIsRGBMode(output->colorspace)) {  // convert to RGBA
         const WebPRGBABuffer* const buf = &output->u.RGBA;
         uint8_t* const rgba =
@@ -1480,7 +1512,8 @@ static void ClearMetadata(VP8LMetadata* const hdr) {
 // VP8LDecoder
 
 VP8LDecoder* VP8LNew(void) {
-  VP8LDecoder* const dec = (VP8LDecoder*)WebPSafeCalloc(1ULL, sizeof(*dec));
+  VP8LDecoder* const dec =
+      (VP8LDecoder*)WebPSafeCallocHint(1ULL, sizeof(*dec), WEBP_MEM_HOT);
   if (dec == NULL) return NULL;
   dec->status = VP8_STATUS_OK;
   dec->state = READ_DIM;
@@ -941,7 +941,35 @@ int WebPIoInitFromOptions(const WebPDecoderOptions* const options,
     }
     io->scaled_width = scaled_width;
     io->scaled_height = scaled_height;
+    if (options->use_box_scaling) {
+      // Trim the crop area down to a multiple of the scaled size when that
+      // costs at most 1/16 of each dimension, so that the rescaler works
+      // with integer ratios (WebPRescalerImportRowBox()).
+      const int trim_w = (w >= scaled_width) ? w % scaled_width : 0;
+      const int trim_h = (h >= scaled_height) ? h % scaled_height : 0;
+      if (trim_w * 16 <= w && trim_h * 16 <= h && (trim_w | trim_h)) {
+        x += trim_w >> 1;
+        y += trim_h >> 1;
+        if (!WebPIsRGBMode(src_colorspace)) {  // keep the YUV420 snapping
+          x &= ~1;
+          y &= ~1;
+        }
+        w -= trim_w;
+        h -= trim_h;
+        io->crop_left = x;
+        io->crop_top = y;
+        io->crop_right = x + w;
+        io->crop_bottom = y + h;
+        io->mb_w = w;
+        io->mb_h = h;
+        io->use_cropping = 1;
+      }
+    }
   }
+  // DC-only reconstruction: one sample per macroblock is enough.
+  io->use_dc_only = io->use_scaling && options->use_dc_only &&
+                    (io->scaled_width * 16 <= w) &&
+                    (io->scaled_height * 16 <= h);
 
   // Filter
   io->bypass_filtering = (options != NULL) && options->bypass_filtering;
@@ -51,6 +51,10 @@ struct WebPDecParams {
   OutputFunc emit;               // output RGB or YUV samples
   OutputAlphaFunc emit_alpha;    // output alpha channel
   OutputRowFunc emit_alpha_row;  // output one line of rescaled alpha values
+
+  // DC-only output (io->use_dc_only)
+  int* dc_col;        // output column of each macroblock, or -1 if cropped
+  uint32_t* dc_sum;   // Y, U, V, alpha sums and count, per output column
 };
 
 // Should be called first, before any use of the WebPDecParams object.
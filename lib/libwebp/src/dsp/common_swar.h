@@ -0,0 +1,95 @@
+// Copyright 2025 Google Inc. All Rights Reserved.
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the COPYING file in the root of the source
+// tree. An additional intellectual property rights grant can be found
+// in the file PATENTS. All contributing project authors may
+// be found in the AUTHORS file in the root of the source tree.
+// -----------------------------------------------------------------------------
+//
+// SWAR code common to several files: four unsigned 8-bit lanes packed in a
+// uint32_t. Per-lane operations are byte-order independent, so words are
+// loaded and stored in native order.
+
+#ifndef WEBP_DSP_COMMON_SWAR_H_
+#define WEBP_DSP_COMMON_SWAR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(WEBP_USE_SWAR)
+
+#include <string.h>
+
+#include "src/webp/types.h"
+
+#define SWAR_LSB 0x01010101u
+#define SWAR_MSB 0x80808080u
+
+// Loads/stores of 4-byte aligned words. Cores without unaligned access (the
+// ESP32 among them) otherwise get four byte accesses out of memcpy().
+#if defined(__GNUC__)
+#define SWAR_ALIGNED4(p) __builtin_assume_aligned((p), 4)
+#else
+#define SWAR_ALIGNED4(p) (p)
+#endif
+
+static WEBP_INLINE uint32_t SwarLoad(const uint8_t* const ptr) {
+  uint32_t v;
+  memcpy(&v, SWAR_ALIGNED4(ptr), sizeof(v));
+  return v;
+}
+
+static WEBP_INLINE void SwarStore(uint8_t* const ptr, uint32_t v) {
+  memcpy(SWAR_ALIGNED4(ptr), &v, sizeof(v));
+}
+
+// 'v' in all four lanes.
+static WEBP_INLINE uint32_t SwarSplat(uint32_t v) { return v * SWAR_LSB; }
+
+// Expands the 0x80 bits of 'm' to 0xff lanes. (m << 1) overflows out of the
+// top lane, which the borrow of the subtraction restores.
+static WEBP_INLINE uint32_t SwarMask(uint32_t m) { return (m << 1) - (m >> 7); }
+
+// min(a + b, 255) per lane.
+static WEBP_INLINE uint32_t SwarAddSat(uint32_t a, uint32_t b) {
+  const uint32_t low = (a & ~SWAR_MSB) + (b & ~SWAR_MSB);
+  const uint32_t sum = low ^ ((a ^ b) & SWAR_MSB);
+  const uint32_t carry = ((a & b) | ((a ^ b) & low)) & SWAR_MSB;
+  return sum | SwarMask(carry);
+}
+
+// max(a - b, 0) per lane, as 255 - min(255 - a + b, 255).
+static WEBP_INLINE uint32_t SwarSubSat(uint32_t a, uint32_t b) {
+  return ~SwarAddSat(~a, b);
+}
+
+// (a + b) >> 1 and (a + b + 1) >> 1 per lane.
+static WEBP_INLINE uint32_t SwarAvgFloor(uint32_t a, uint32_t b) {
+  return (a & b) + (((a ^ b) & ~SWAR_LSB) >> 1);
+}
+
+static WEBP_INLINE uint32_t SwarAvgRound(uint32_t a, uint32_t b) {
+  return (a | b) - (((a ^ b) & ~SWAR_LSB) >> 1);
+}
+
+// (a + 2 * b + c + 2) >> 2 per lane, which equals the rounded average of 'b'
+// and the floored average of 'a' and 'c'.
+static WEBP_INLINE uint32_t SwarAvg3(uint32_t a, uint32_t b, uint32_t c) {
+  return SwarAvgRound(SwarAvgFloor(a, c), b);
+}
+
+// Sum of the four lanes.
+static WEBP_INLINE uint32_t SwarSum(uint32_t v) {
+  const uint32_t pairs = (v & 0x00ff00ffu) + ((v >> 8) & 0x00ff00ffu);
+  return (pairs + (pairs >> 16)) & 0xffff;
+}
+
+#endif  // WEBP_USE_SWAR
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // WEBP_DSP_COMMON_SWAR_H_
@@ -120,6 +120,11 @@ static int x86CPUInfo(CPUFeature feature) {
   int cpu_info[4];
   int is_intel = 0;
 
+#if defined(WEBP_USE_SWAR)
+  // SWAR is plain C: available whenever it was compiled in (WEBP_HAVE_SWAR).
+  if (feature == kSWAR) return 1;
+#endif
+
   // get the highest feature value cpuid supports
   GetCPUInfo(cpu_info, 0);
   max_cpuid_value = cpu_info[0];
@@ -245,6 +250,13 @@ static int mipsCPUInfo(CPUFeature feature) {
 }
 WEBP_EXTERN VP8CPUInfo VP8GetCPUInfo;
 VP8CPUInfo VP8GetCPUInfo = mipsCPUInfo;
+#elif defined(WEBP_USE_SWAR)
+// No SIMD unit (e.g. ESP32): only the SWAR kernels apply.
+static int swarCPUInfo(CPUFeature feature) {
+  return (feature == kSWAR);
+}
+WEBP_EXTERN VP8CPUInfo VP8GetCPUInfo;
+VP8CPUInfo VP8GetCPUInfo = swarCPUInfo;
 #else
 WEBP_EXTERN VP8CPUInfo VP8GetCPUInfo;
 VP8CPUInfo VP8GetCPUInfo = NULL;
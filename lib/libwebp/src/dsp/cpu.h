@@ -165,6 +165,18 @@ static WEBP_INLINE int _mm256_cvtsi256_si32(__m256i a) {
 #define WEBP_USE_MSA
 #endif
 
+//------------------------------------------------------------------------------
+// SWAR defines.
+//
+// SWAR ("SIMD within a register") kernels are plain C operating on four 8-bit
+// lanes packed in a 32-bit word, for in-order cores with no SIMD unit such as
+// the ESP32's Xtensa LX6. They are portable, so WEBP_HAVE_SWAR enables them on
+// any target (e.g. to check them against the C reference on a desktop).
+
+#if defined(__XTENSA__) || defined(WEBP_HAVE_SWAR)
+#define WEBP_USE_SWAR
+#endif
+
 //------------------------------------------------------------------------------
 
 #ifndef WEBP_DSP_OMIT_C_CODE
@@ -313,7 +325,8 @@ typedef enum {
   kNEON,
   kMIPS32,
   kMIPSdspR2,
-  kMSA
+  kMSA,
+  kSWAR
 } CPUFeature;
 
 // returns true if the CPU supports the feature.
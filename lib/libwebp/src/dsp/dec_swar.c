@@ -0,0 +1,242 @@
+// Copyright 2025 Google Inc. All Rights Reserved.
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the COPYING file in the root of the source
+// tree. An additional intellectual property rights grant can be found
+// in the file PATENTS. All contributing project authors may
+// be found in the AUTHORS file in the root of the source tree.
+// -----------------------------------------------------------------------------
+//
+// SWAR version of some decoding functions (DC transform, intra predictions),
+// bit-exact with the plain-C ones.
+//
+// All of them work in the 'yuv_b' scratch area, whose blocks start on 4-byte
+// boundaries (BPS = 32), so each row of four pixels is one aligned word.
+// Where the C code goes through memcpy()/memset() or per-pixel clip tables,
+// this does one load or store per four pixels and stays branch-free.
+//
+// Not covered: the full IDCT and the loop filters. They need signed,
+// saturated 8-bit lanes; emulating those costs more operations per pixel
+// than the table lookups of the C code.
+
+#include "src/dsp/dsp.h"
+
+#if defined(WEBP_USE_SWAR)
+
+#include <assert.h>
+
+#include "src/dec/vp8i_dec.h"
+#include "src/dsp/common_swar.h"
+#include "src/dsp/cpu.h"
+#include "src/webp/types.h"
+
+#define ASSERT_ALIGNED(p) assert(((uintptr_t)(p) & 3) == 0)
+
+// Adds 'v' to the 'num_words' x 'num_rows' block, with clipping to [0, 255].
+static WEBP_INLINE void AddClipBlock(uint8_t* dst, int v, int num_words,
+                                     int num_rows) {
+  const uint32_t amount = SwarSplat((v < 0) ? ((v < -255) ? 255 : -v)
+                                            : ((v > 255) ? 255 : v));
+  int i, j;
+  ASSERT_ALIGNED(dst);
+  for (j = 0; j < num_rows; ++j) {
+    for (i = 0; i < num_words; ++i) {
+      const uint32_t d = SwarLoad(dst + 4 * i);
+      SwarStore(dst + 4 * i,
+                (v < 0) ? SwarSubSat(d, amount) : SwarAddSat(d, amount));
+    }
+    dst += BPS;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Transforms
+
+static void TransformDC_SWAR(const int16_t* WEBP_RESTRICT in,
+                             uint8_t* WEBP_RESTRICT dst) {
+  AddClipBlock(dst, (in[0] + 4) >> 3, 1, 4);
+}
+
+//------------------------------------------------------------------------------
+// Fills
+
+static WEBP_INLINE void Fill(uint8_t* dst, uint32_t v, int num_words,
+                             int num_rows) {
+  int i, j;
+  ASSERT_ALIGNED(dst);
+  for (j = 0; j < num_rows; ++j) {
+    for (i = 0; i < num_words; ++i) SwarStore(dst + 4 * i, v);
+    dst += BPS;
+  }
+}
+
+// Copies the row above into every row.
+static WEBP_INLINE void Vertical(uint8_t* dst, int num_words, int num_rows) {
+  uint32_t top[4];
+  int i, j;
+  ASSERT_ALIGNED(dst);
+  for (i = 0; i < num_words; ++i) top[i] = SwarLoad(dst - BPS + 4 * i);
+  for (j = 0; j < num_rows; ++j) {
+    for (i = 0; i < num_words; ++i) SwarStore(dst + 4 * i, top[i]);
+    dst += BPS;
+  }
+}
+
+// Fills every row with its left sample.
+static WEBP_INLINE void Horizontal(uint8_t* dst, int num_words, int num_rows) {
+  int i, j;
+  ASSERT_ALIGNED(dst);
+  for (j = 0; j < num_rows; ++j) {
+    const uint32_t v = SwarSplat(dst[-1]);
+    for (i = 0; i < num_words; ++i) SwarStore(dst + 4 * i, v);
+    dst += BPS;
+  }
+}
+
+// clip(top[x] + left[y] - top_left). The offset is the same for the whole
+// row, so each row is one saturated add or subtract of the top row.
+static WEBP_INLINE void TrueMotion(uint8_t* dst, int num_words) {
+  const uint8_t* const top = dst - BPS;
+  const int top_left = top[-1];
+  uint32_t t[4];
+  int i, j;
+  ASSERT_ALIGNED(dst);
+  for (i = 0; i < num_words; ++i) t[i] = SwarLoad(top + 4 * i);
+  for (j = 0; j < 4 * num_words; ++j) {
+    const int delta = dst[-1] - top_left;  // in [-255, 255]
+    if (delta >= 0) {
+      const uint32_t amount = SwarSplat(delta);
+      for (i = 0; i < num_words; ++i) {
+        SwarStore(dst + 4 * i, SwarAddSat(t[i], amount));
+      }
+    } else {
+      const uint32_t amount = SwarSplat(-delta);
+      for (i = 0; i < num_words; ++i) {
+        SwarStore(dst + 4 * i, SwarSubSat(t[i], amount));
+      }
+    }
+    dst += BPS;
+  }
+}
+
+// Sum of the 'num_words' * 4 samples above.
+static WEBP_INLINE uint32_t SumTop(const uint8_t* dst, int num_words) {
+  uint32_t sum = 0;
+  int i;
+  for (i = 0; i < num_words; ++i) sum += SwarSum(SwarLoad(dst - BPS + 4 * i));
+  return sum;
+}
+
+// Sum of the 'num_rows' samples on the left.
+static WEBP_INLINE uint32_t SumLeft(const uint8_t* dst, int num_rows) {
+  uint32_t sum = 0;
+  int j;
+  for (j = 0; j < num_rows; ++j) sum += dst[-1 + j * BPS];
+  return sum;
+}
+
+//------------------------------------------------------------------------------
+// 4x4
+
+static void TM4_SWAR(uint8_t* dst) { TrueMotion(dst, 1); }
+
+static void VE4_SWAR(uint8_t* dst) {  // vertical
+  const uint8_t* const top = dst - BPS;
+  const uint32_t b = SwarLoad(top);
+  // the same four lanes, shifted by one sample to the left and to the right
+#if defined(WORDS_BIGENDIAN)
+  const uint32_t a = (b >> 8) | ((uint32_t)top[-1] << 24);
+  const uint32_t c = (b << 8) | top[4];
+#else
+  const uint32_t a = (b << 8) | top[-1];
+  const uint32_t c = (b >> 8) | ((uint32_t)top[4] << 24);
+#endif
+  Fill(dst, SwarAvg3(a, b, c), 1, 4);
+}
+
+static void DC4_SWAR(uint8_t* dst) {  // DC
+  Fill(dst, SwarSplat((SumTop(dst, 1) + SumLeft(dst, 4) + 4) >> 3), 1, 4);
+}
+
+//------------------------------------------------------------------------------
+// 16x16
+
+static void TM16_SWAR(uint8_t* dst) { TrueMotion(dst, 4); }
+static void VE16_SWAR(uint8_t* dst) { Vertical(dst, 4, 16); }
+static void HE16_SWAR(uint8_t* dst) { Horizontal(dst, 4, 16); }
+
+static void DC16_SWAR(uint8_t* dst) {  // DC
+  Fill(dst, SwarSplat((SumTop(dst, 4) + SumLeft(dst, 16) + 16) >> 5), 4, 16);
+}
+
+static void DC16NoTop_SWAR(uint8_t* dst) {  // DC with top samples missing
+  Fill(dst, SwarSplat((SumLeft(dst, 16) + 8) >> 4), 4, 16);
+}
+
+static void DC16NoLeft_SWAR(uint8_t* dst) {  // DC with left samples missing
+  Fill(dst, SwarSplat((SumTop(dst, 4) + 8) >> 4), 4, 16);
+}
+
+static void DC16NoTopLeft_SWAR(uint8_t* dst) {  // DC with no top and left
+  Fill(dst, SwarSplat(0x80), 4, 16);
+}
+
+//------------------------------------------------------------------------------
+// Chroma
+
+static void TM8uv_SWAR(uint8_t* dst) { TrueMotion(dst, 2); }
+static void VE8uv_SWAR(uint8_t* dst) { Vertical(dst, 2, 8); }
+static void HE8uv_SWAR(uint8_t* dst) { Horizontal(dst, 2, 8); }
+
+static void DC8uv_SWAR(uint8_t* dst) {  // DC
+  Fill(dst, SwarSplat((SumTop(dst, 2) + SumLeft(dst, 8) + 8) >> 4), 2, 8);
+}
+
+static void DC8uvNoLeft_SWAR(uint8_t* dst) {  // DC with no left samples
+  Fill(dst, SwarSplat((SumTop(dst, 2) + 4) >> 3), 2, 8);
+}
+
+static void DC8uvNoTop_SWAR(uint8_t* dst) {  // DC with no top samples
+  Fill(dst, SwarSplat((SumLeft(dst, 8) + 4) >> 3), 2, 8);
+}
+
+static void DC8uvNoTopLeft_SWAR(uint8_t* dst) {  // DC with nothing
+  Fill(dst, SwarSplat(0x80), 2, 8);
+}
+
+#undef ASSERT_ALIGNED
+
+//------------------------------------------------------------------------------
+// Entry point
+
+extern void VP8DspInitSWAR(void);
+
+WEBP_TSAN_IGNORE_FUNCTION void VP8DspInitSWAR(void) {
+  VP8TransformDC = TransformDC_SWAR;
+
+  VP8PredLuma4[0] = DC4_SWAR;
+  VP8PredLuma4[1] = TM4_SWAR;
+  VP8PredLuma4[2] = VE4_SWAR;
+
+  VP8PredLuma16[0] = DC16_SWAR;
+  VP8PredLuma16[1] = TM16_SWAR;
+  VP8PredLuma16[2] = VE16_SWAR;
+  VP8PredLuma16[3] = HE16_SWAR;
+  VP8PredLuma16[4] = DC16NoTop_SWAR;
+  VP8PredLuma16[5] = DC16NoLeft_SWAR;
+  VP8PredLuma16[6] = DC16NoTopLeft_SWAR;
+
+  VP8PredChroma8[0] = DC8uv_SWAR;
+  VP8PredChroma8[1] = TM8uv_SWAR;
+  VP8PredChroma8[2] = VE8uv_SWAR;
+  VP8PredChroma8[3] = HE8uv_SWAR;
+  VP8PredChroma8[4] = DC8uvNoTop_SWAR;
+  VP8PredChroma8[5] = DC8uvNoLeft_SWAR;
+  VP8PredChroma8[6] = DC8uvNoTopLeft_SWAR;
+}
+
+#else  // !WEBP_USE_SWAR
+
+WEBP_DSP_INIT_STUB(VP8DspInitSWAR)
+
+#endif  // WEBP_USE_SWAR
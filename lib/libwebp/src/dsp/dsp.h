@@ -380,20 +380,23 @@ struct WebPRescaler;
 
 // Import a row of data and save its contribution in the rescaler.
 // 'channel' denotes the channel number to be imported. 'Expand' corresponds to
-// the wrk->x_expand case. Otherwise, 'Shrink' is to be used.
+// the wrk->x_expand case. Otherwise, 'Shrink' is to be used, or 'Box' for
+// integer ratios (wrk->box_w != 0), which adds straight into wrk->irow.
 typedef void (*WebPRescalerImportRowFunc)(
     struct WebPRescaler* WEBP_RESTRICT const wrk,
     const uint8_t* WEBP_RESTRICT src);
 
 extern WebPRescalerImportRowFunc WebPRescalerImportRowExpand;
 extern WebPRescalerImportRowFunc WebPRescalerImportRowShrink;
+extern WebPRescalerImportRowFunc WebPRescalerImportRowBox;
 
 // Export one row (starting at x_out position) from rescaler.
 // 'Expand' corresponds to the wrk->y_expand case.
-// Otherwise 'Shrink' is to be used
+// Otherwise 'Shrink' is to be used ('Box' for integer ratios).
 typedef void (*WebPRescalerExportRowFunc)(struct WebPRescaler* const wrk);
 extern WebPRescalerExportRowFunc WebPRescalerExportRowExpand;
 extern WebPRescalerExportRowFunc WebPRescalerExportRowShrink;
+extern WebPRescalerExportRowFunc WebPRescalerExportRowBox;
 
 // Plain-C implementation, as fall-back.
 extern void WebPRescalerImportRowExpand_C(
@@ -404,6 +407,10 @@ extern void WebPRescalerImportRowShrink_C(
     const uint8_t* WEBP_RESTRICT src);
 extern void WebPRescalerExportRowExpand_C(struct WebPRescaler* const wrk);
 extern void WebPRescalerExportRowShrink_C(struct WebPRescaler* const wrk);
+extern void WebPRescalerImportRowBox_C(
+    struct WebPRescaler* WEBP_RESTRICT const wrk,
+    const uint8_t* WEBP_RESTRICT src);
+extern void WebPRescalerExportRowBox_C(struct WebPRescaler* const wrk);
 
 // Main entry calls:
 extern void WebPRescalerImportRow(struct WebPRescaler* WEBP_RESTRICT const wrk,
@@ -606,6 +606,7 @@ extern void VP8LDspInitAVX2(void);
 extern void VP8LDspInitNEON(void);
 extern void VP8LDspInitMIPSdspR2(void);
 extern void VP8LDspInitMSA(void);
+extern void VP8LDspInitSWAR(void);
 
 #define COPY_PREDICTOR_ARRAY(IN, OUT)                       \
   do {                                                      \
@@ -650,6 +651,11 @@ WEBP_DSP_INIT_FUNC(VP8LDspInit) {
 
   // If defined, use CPUInfo() to overwrite some pointers with faster versions.
   if (VP8GetCPUInfo != NULL) {
+#if defined(WEBP_USE_SWAR)
+    if (VP8GetCPUInfo(kSWAR)) {
+      VP8LDspInitSWAR();
+    }
+#endif
 #if defined(WEBP_HAVE_SSE2)
     if (VP8GetCPUInfo(kSSE2)) {
       VP8LDspInitSSE2();
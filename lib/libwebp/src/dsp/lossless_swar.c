@@ -0,0 +1,121 @@
+// Copyright 2025 Google Inc. All Rights Reserved.
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the COPYING file in the root of the source
+// tree. An additional intellectual property rights grant can be found
+// in the file PATENTS. All contributing project authors may
+// be found in the AUTHORS file in the root of the source tree.
+// -----------------------------------------------------------------------------
+//
+// SWAR version of the clamped lossless predictors (12 and 13), bit-exact with
+// the plain-C ones.
+//
+// The C code extracts, clamps and repacks the four channels one at a time.
+// Here a pixel is split into two words of two 16-bit lanes (red/blue and
+// alpha/green), which leaves room for the intermediate sums, and each step
+// handles two channels. Select() (predictor 11) is left to the C code: it only
+// needs absolute differences, which cost as much in lanes as one at a time.
+
+#include "src/dsp/dsp.h"
+
+#if defined(WEBP_USE_SWAR)
+
+#include "src/dsp/cpu.h"
+#include "src/dsp/lossless.h"
+#include "src/dsp/lossless_common.h"
+#include "src/webp/types.h"
+
+#define LANES 0x00ff00ffu  // low byte of each 16-bit lane
+#define LANE_ONES 0x00010001u
+
+// clip(t - 256) to [0, 255] per lane, for lanes in [0, 1023].
+static WEBP_INLINE uint32_t ClipBiased(uint32_t t) {
+  const uint32_t over = (t >> 9) & LANE_ONES;    // t >= 512: 255
+  const uint32_t inside = (t >> 8) & LANE_ONES;  // t in [256, 511]: t - 256
+  return ((t & (inside * 0xff)) | (over * 0xff)) & LANES;
+}
+
+//------------------------------------------------------------------------------
+// Predictor Transform
+
+// clip(c0 + c1 - c2), computed as c0 + c1 + 256 - c2 in [1, 766].
+static WEBP_INLINE uint32_t ClampedAddSubtractFull_SWAR(uint32_t c0,
+                                                        uint32_t c1,
+                                                        uint32_t c2) {
+  const uint32_t rb = (c0 & LANES) + (c1 & LANES) + 0x01000100u - (c2 & LANES);
+  const uint32_t ag = ((c0 >> 8) & LANES) + ((c1 >> 8) & LANES) + 0x01000100u -
+                      ((c2 >> 8) & LANES);
+  return ClipBiased(rb) | (ClipBiased(ag) << 8);
+}
+
+// clip(a + (a - b) / 2) with 'a' the average of c0 and c1, 'b' = c2, and the
+// division truncating towards zero like in C.
+static WEBP_INLINE uint32_t AddSubtractHalf(uint32_t a, uint32_t b) {
+  const uint32_t e = a + 0x01000100u - b;         // a - b + 256, in [1, 511]
+  const uint32_t neg = (~e >> 8) & LANE_ONES;     // a < b
+  const uint32_t half = ((e + neg) >> 1) & LANES;  // (a - b) / 2 + 128
+  return ClipBiased(a + half + 0x00800080u);
+}
+
+static WEBP_INLINE uint32_t ClampedAddSubtractHalf_SWAR(uint32_t c0,
+                                                        uint32_t c1,
+                                                        uint32_t c2) {
+  const uint32_t ave = (((c0 ^ c1) & 0xfefefefeu) >> 1) + (c0 & c1);
+  return AddSubtractHalf(ave & LANES, c2 & LANES) |
+         (AddSubtractHalf((ave >> 8) & LANES, (c2 >> 8) & LANES) << 8);
+}
+
+#undef LANES
+#undef LANE_ONES
+
+static uint32_t Predictor12_SWAR(const uint32_t* const left,
+                                 const uint32_t* const top) {
+  return ClampedAddSubtractFull_SWAR(*left, top[0], top[-1]);
+}
+static uint32_t Predictor13_SWAR(const uint32_t* const left,
+                                 const uint32_t* const top) {
+  return ClampedAddSubtractHalf_SWAR(*left, top[0], top[-1]);
+}
+
+// The left pixel of one iteration is the output of the previous one, so the
+// loops carry it in a register instead of reading it back from 'out'.
+static void PredictorAdd12_SWAR(const uint32_t* in, const uint32_t* upper,
+                                int num_pixels, uint32_t* WEBP_RESTRICT out) {
+  uint32_t left = out[-1];
+  int x;
+  for (x = 0; x < num_pixels; ++x) {
+    left = VP8LAddPixels(
+        in[x], ClampedAddSubtractFull_SWAR(left, upper[x], upper[x - 1]));
+    out[x] = left;
+  }
+}
+
+static void PredictorAdd13_SWAR(const uint32_t* in, const uint32_t* upper,
+                                int num_pixels, uint32_t* WEBP_RESTRICT out) {
+  uint32_t left = out[-1];
+  int x;
+  for (x = 0; x < num_pixels; ++x) {
+    left = VP8LAddPixels(
+        in[x], ClampedAddSubtractHalf_SWAR(left, upper[x], upper[x - 1]));
+    out[x] = left;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Entry point
+
+extern void VP8LDspInitSWAR(void);
+
+WEBP_TSAN_IGNORE_FUNCTION void VP8LDspInitSWAR(void) {
+  VP8LPredictors[12] = Predictor12_SWAR;
+  VP8LPredictors[13] = Predictor13_SWAR;
+
+  VP8LPredictorsAdd[12] = PredictorAdd12_SWAR;
+  VP8LPredictorsAdd[13] = PredictorAdd13_SWAR;
+}
+
+#else  // !WEBP_USE_SWAR
+
+WEBP_DSP_INIT_STUB(VP8LDspInitSWAR)
+
+#endif  // WEBP_USE_SWAR
@@ -96,6 +96,37 @@ void WebPRescalerImportRowShrink_C(WebPRescaler* WEBP_RESTRICT const wrk,
   }
 }
 
+// Integer ratio: each output pixel sums 'box_w' source pixels, with no
+// fractional weight at either end of the box.
+void WebPRescalerImportRowBox_C(WebPRescaler* WEBP_RESTRICT const wrk,
+                                const uint8_t* WEBP_RESTRICT src) {
+  const int x_stride = wrk->num_channels;
+  const int x_out_max = wrk->dst_width * wrk->num_channels;
+  const int box_w = wrk->box_w;
+  rescaler_t* const irow = wrk->irow;
+  int x_out, i;
+  assert(!WebPRescalerInputDone(wrk));
+  assert(box_w > 0 && wrk->src_width == box_w * wrk->dst_width);
+  if (x_stride == 1) {  // Y, U, V planes
+    for (x_out = 0; x_out < x_out_max; ++x_out) {
+      uint32_t sum = 0;
+      for (i = 0; i < box_w; ++i) sum += src[i];
+      irow[x_out] += sum;
+      src += box_w;
+    }
+  } else {
+    for (x_out = 0; x_out < x_out_max; x_out += x_stride) {
+      int channel;
+      for (channel = 0; channel < x_stride; ++channel) {
+        uint32_t sum = 0;
+        for (i = 0; i < box_w; ++i) sum += src[i * x_stride + channel];
+        irow[x_out + channel] += sum;
+      }
+      src += box_w * x_stride;
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // Row export
 
@@ -153,6 +184,31 @@ void WebPRescalerExportRowShrink_C(WebPRescaler* const wrk) {
   }
 }
 
+// Rounded average of the box: a shift when its area is a power of two.
+void WebPRescalerExportRowBox_C(WebPRescaler* const wrk) {
+  int x_out;
+  uint8_t* const dst = wrk->dst;
+  rescaler_t* const irow = wrk->irow;
+  const int x_out_max = wrk->dst_width * wrk->num_channels;
+  const uint32_t area = wrk->box_area;
+  assert(!WebPRescalerOutputDone(wrk));
+  assert(wrk->y_accum == 0);
+  assert(wrk->box_w > 0);
+  if (wrk->box_shift >= 0) {
+    const int shift = wrk->box_shift;
+    const uint32_t half = (1u << shift) >> 1;
+    for (x_out = 0; x_out < x_out_max; ++x_out) {
+      dst[x_out] = (uint8_t)((irow[x_out] + half) >> shift);
+      irow[x_out] = 0;
+    }
+  } else {
+    for (x_out = 0; x_out < x_out_max; ++x_out) {
+      dst[x_out] = (uint8_t)((irow[x_out] + (area >> 1)) / area);
+      irow[x_out] = 0;
+    }
+  }
+}
+
 #undef MULT_FIX_FLOOR
 #undef MULT_FIX
 #undef ROUNDER
@@ -163,7 +219,9 @@ void WebPRescalerExportRowShrink_C(WebPRescaler* const wrk) {
 void WebPRescalerImportRow(WebPRescaler* WEBP_RESTRICT const wrk,
                            const uint8_t* WEBP_RESTRICT src) {
   assert(!WebPRescalerInputDone(wrk));
-  if (!wrk->x_expand) {
+  if (wrk->box_w) {
+    WebPRescalerImportRowBox(wrk, src);
+  } else if (!wrk->x_expand) {
     WebPRescalerImportRowShrink(wrk, src);
   } else {
     WebPRescalerImportRowExpand(wrk, src);
@@ -173,7 +231,9 @@ void WebPRescalerImportRow(WebPRescaler* WEBP_RESTRICT const wrk,
 void WebPRescalerExportRow(WebPRescaler* const wrk) {
   if (wrk->y_accum <= 0) {
     assert(!WebPRescalerOutputDone(wrk));
-    if (wrk->y_expand) {
+    if (wrk->box_w) {
+      WebPRescalerExportRowBox(wrk);
+    } else if (wrk->y_expand) {
       WebPRescalerExportRowExpand(wrk);
     } else if (wrk->fxy_scale) {
       WebPRescalerExportRowShrink(wrk);
@@ -196,9 +256,11 @@ void WebPRescalerExportRow(WebPRescaler* const wrk) {
 
 WebPRescalerImportRowFunc WebPRescalerImportRowExpand;
 WebPRescalerImportRowFunc WebPRescalerImportRowShrink;
+WebPRescalerImportRowFunc WebPRescalerImportRowBox;
 
 WebPRescalerExportRowFunc WebPRescalerExportRowExpand;
 WebPRescalerExportRowFunc WebPRescalerExportRowShrink;
+WebPRescalerExportRowFunc WebPRescalerExportRowBox;
 
 extern VP8CPUInfo VP8GetCPUInfo;
 extern void WebPRescalerDspInitSSE2(void);
@@ -216,6 +278,8 @@ WEBP_DSP_INIT_FUNC(WebPRescalerDspInit) {
 
   WebPRescalerImportRowExpand = WebPRescalerImportRowExpand_C;
   WebPRescalerImportRowShrink = WebPRescalerImportRowShrink_C;
+  WebPRescalerImportRowBox = WebPRescalerImportRowBox_C;
+  WebPRescalerExportRowBox = WebPRescalerExportRowBox_C;
 
   if (VP8GetCPUInfo != NULL) {
 #if defined(WEBP_HAVE_SSE2)
@@ -251,5 +315,7 @@ WEBP_DSP_INIT_FUNC(WebPRescalerDspInit) {
   assert(WebPRescalerExportRowShrink != NULL);
   assert(WebPRescalerImportRowExpand != NULL);
   assert(WebPRescalerImportRowShrink != NULL);
+  assert(WebPRescalerImportRowBox != NULL);
+  assert(WebPRescalerExportRowBox != NULL);
 #endif  // WEBP_REDUCE_SIZE
 }
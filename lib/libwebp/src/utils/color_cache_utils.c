@@ -28,8 +28,9 @@ WEBP_ASSUME_UNSAFE_INDEXABLE_ABI
 
 int VP8LColorCacheInit(VP8LColorCache* const color_cache, int hash_bits) {
   const int hash_size = 1 << hash_bits;
-  uint32_t* colors = (uint32_t*)WebPSafeCalloc((uint64_t)hash_size,
-                                               sizeof(*color_cache->colors));
+  // looked up and updated for every pixel: ask for DRAM
+  uint32_t* colors = (uint32_t*)WebPSafeCallocHint(
+      (uint64_t)hash_size, sizeof(*color_cache->colors), WEBP_MEM_HOT);
   assert(color_cache != NULL);
   assert(hash_bits > 0);
   if (colors == NULL) {
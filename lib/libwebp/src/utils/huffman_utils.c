@@ -30,7 +30,8 @@ WEBP_ASSUME_UNSAFE_INDEXABLE_ABI
 
 HTreeGroup* VP8LHtreeGroupsNew(int num_htree_groups) {
   HTreeGroup* const htree_groups =
-      (HTreeGroup*)WebPSafeMalloc(num_htree_groups, sizeof(*htree_groups));
+      (HTreeGroup*)WebPSafeMallocHint(num_htree_groups, sizeof(*htree_groups),
+                                      WEBP_MEM_HOT);
   if (htree_groups == NULL) {
     return NULL;
   }
@@ -258,7 +259,8 @@ int VP8LBuildHuffmanTable(HuffmanTables* const root_table, int root_bits,
       const int next_size =
           total_size > segment_size ? total_size : segment_size;
       HuffmanCode* WEBP_BIDI_INDEXABLE const next_start =
-          (HuffmanCode*)WebPSafeMalloc(next_size, sizeof(*next_start));
+          (HuffmanCode*)WebPSafeMallocHint(next_size, sizeof(*next_start),
+                                           WEBP_MEM_HOT);
       if (next_start == NULL) {
         WebPSafeFree(next);
         return 0;
@@ -301,10 +303,10 @@ int VP8LHuffmanTablesAllocate(int size, HuffmanTables* huffman_tables) {
   HuffmanTablesSegment* const root = &huffman_tables->root;
   huffman_tables->curr_segment = root;
   root->next = NULL;
-  // Allocate root.
+  // Allocate root. The tables are looked up for every pixel: ask for DRAM.
   {
-    HuffmanCode* WEBP_BIDI_INDEXABLE const start =
-        (HuffmanCode*)WebPSafeMalloc(size, sizeof(*root->start));
+    HuffmanCode* WEBP_BIDI_INDEXABLE const start = (HuffmanCode*)
+        WebPSafeMallocHint(size, sizeof(*root->start), WEBP_MEM_HOT);
     if (start == NULL) {
       root->start = NULL;
       root->size = 0;
@@ -84,6 +84,25 @@ int WebPRescalerInit(WebPRescaler* const rescaler, int src_width,
     // rescaler->fxy_scale is unused here.
   }
 
+  // Integer shrink ratios on both axes (common for thumbnails): every output
+  // pixel is the plain average of a box of source pixels, which needs no
+  // fractional weights. The area bound keeps the sums within 32 bits.
+  rescaler->box_w = 0;
+  rescaler->box_area = 0;
+  rescaler->box_shift = -1;
+  if (!rescaler->x_expand && !rescaler->y_expand &&
+      src_width % dst_width == 0 && src_height % dst_height == 0) {
+    const uint64_t area =
+        (uint64_t)(src_width / dst_width) * (src_height / dst_height);
+    if (area <= (1u << 24)) {
+      int shift = 0;
+      while ((1ull << shift) < area) ++shift;
+      rescaler->box_w = src_width / dst_width;
+      rescaler->box_area = (uint32_t)area;
+      rescaler->box_shift = ((1ull << shift) == area) ? shift : -1;
+    }
+  }
+
   WebPRescalerDspInit();
   return 1;
 }
@@ -144,7 +163,9 @@ int WebPRescalerImport(WebPRescaler* const rescaler, int num_lines,
       WEBP_SELF_ASSIGN(rescaler->num_channels);
     }
     WebPRescalerImportRow(rescaler, src);
-    if (!rescaler->y_expand) {  // Accumulate the contribution of the new row.
+    // Accumulate the contribution of the new row (the box filter adds it to
+    // 'irow' directly).
+    if (!rescaler->y_expand && !rescaler->box_w) {
       int x;
       for (x = 0; x < rescaler->num_channels * rescaler->dst_width; ++x) {
         rescaler->irow[x] += rescaler->frow[x];
@@ -44,6 +44,10 @@ struct WebPRescaler {
   int src_width, src_height;  // source dimensions
   int dst_width, dst_height;  // destination dimensions
   int src_y, dst_y;           // row counters for input and output
+  int box_w;                  // if not 0: integer ratios, exact box filter
+                              // over 'box_w' source pixels per row ...
+  uint32_t box_area;          // ... and 'box_area' source pixels per output
+  int box_shift;              // log2(box_area), or -1 if not a power of 2
   uint8_t* dst;
   int dst_stride;
   // work buffer
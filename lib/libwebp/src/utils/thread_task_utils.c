@@ -0,0 +1,324 @@
+// Copyright 2011 Google Inc. All Rights Reserved.
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the COPYING file in the root of the source
+// tree. An additional intellectual property rights grant can be found
+// in the file PATENTS. All contributing project authors may
+// be found in the AUTHORS file in the root of the source tree.
+// -----------------------------------------------------------------------------
+//
+// Task-based worker for the ESP32 port.
+//
+// A WebPWorker runs on a task driven by two binary semaphores: 'work'
+// (caller -> task: a new job or a stop request) and 'done' (task -> caller:
+// job finished). On ESP32 the task is a FreeRTOS task pinned to the core the
+// decoder is *not* running on, so FinishRow() (filtering + output) overlaps
+// macroblock parsing. Elsewhere the same code runs on pthreads, which is what
+// lib/libwebp/bench uses.
+//
+// Tasks are kept in a pool of WEBP_TASK_WORKER_POOL_SIZE: the first Reset()
+// creates one, End() only hands it back, and the next decode reuses it. So
+// decoding an icon does not allocate and free a task stack in internal RAM
+// every time. Only when the pool is exhausted does a worker get a task of
+// its own, deleted again by End().
+
+#include <assert.h>
+#include <string.h>  // for memset()
+
+#include "src/utils/bounds_safety.h"
+#include "src/utils/thread_utils.h"
+#include "src/utils/utils.h"
+#include "src/webp/decode.h"
+
+WEBP_ASSUME_UNSAFE_INDEXABLE_ABI
+
+// Stack for the worker task. FinishRow() with rescaling and the emitters in
+// io_dec.c stay well below this.
+#ifndef WEBP_TASK_WORKER_STACK_SIZE
+#define WEBP_TASK_WORKER_STACK_SIZE 8192
+#endif
+
+// Workers alive at the same time in one decode: the FinishRow() worker, or
+// WEBP_MAX_ROW_WORKERS - 1 row workers (frame_dec.c).
+#ifndef WEBP_TASK_WORKER_POOL_SIZE
+#define WEBP_TASK_WORKER_POOL_SIZE 2
+#endif
+
+#if defined(ESP_PLATFORM)
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// Same priority as the decoding task unless overridden.
+#ifndef WEBP_TASK_WORKER_PRIORITY
+#define WEBP_TASK_WORKER_PRIORITY uxTaskPriorityGet(NULL)
+#endif
+
+typedef SemaphoreHandle_t TaskSem;
+
+static int TaskSemInit(TaskSem* const sem) {
+  *sem = xSemaphoreCreateBinary();
+  return (*sem != NULL);
+}
+
+static void TaskSemDestroy(TaskSem* const sem) { vSemaphoreDelete(*sem); }
+
+static void TaskSemGive(TaskSem* const sem) { xSemaphoreGive(*sem); }
+
+static void TaskSemTake(TaskSem* const sem) {
+  while (xSemaphoreTake(*sem, portMAX_DELAY) != pdTRUE) {
+  }
+}
+
+typedef TaskHandle_t TaskThread;
+
+static void TaskEntry(void* ptr);
+
+static int TaskThreadStart(TaskThread* const thread, void* const arg) {
+#if portNUM_PROCESSORS > 1
+  const BaseType_t core = 1 - xPortGetCoreID();
+#else
+  const BaseType_t core = tskNO_AFFINITY;
+#endif
+  return (xTaskCreatePinnedToCore(TaskEntry, "webp_worker",
+                                  WEBP_TASK_WORKER_STACK_SIZE, arg,
+                                  WEBP_TASK_WORKER_PRIORITY, thread,
+                                  core) == pdPASS);
+}
+
+// FreeRTOS tasks must not return: the loop has already signaled 'done' for
+// the stop request, so the task just deletes itself.
+static void TaskThreadExit(void) { vTaskDelete(NULL); }
+
+static void TaskThreadJoin(TaskThread* const thread) { (void)thread; }
+
+static portMUX_TYPE pool_lock = portMUX_INITIALIZER_UNLOCKED;
+static void PoolLock(void) { portENTER_CRITICAL(&pool_lock); }
+static void PoolUnlock(void) { portEXIT_CRITICAL(&pool_lock); }
+
+#else  // !ESP_PLATFORM
+
+#include <pthread.h>
+
+typedef struct {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int given;
+} TaskSem;
+
+static int TaskSemInit(TaskSem* const sem) {
+  sem->given = 0;
+  if (pthread_mutex_init(&sem->mutex, NULL)) return 0;
+  if (pthread_cond_init(&sem->cond, NULL)) {
+    pthread_mutex_destroy(&sem->mutex);
+    return 0;
+  }
+  return 1;
+}
+
+static void TaskSemDestroy(TaskSem* const sem) {
+  pthread_mutex_destroy(&sem->mutex);
+  pthread_cond_destroy(&sem->cond);
+}
+
+static void TaskSemGive(TaskSem* const sem) {
+  pthread_mutex_lock(&sem->mutex);
+  sem->given = 1;
+  pthread_mutex_unlock(&sem->mutex);
+  pthread_cond_signal(&sem->cond);
+}
+
+static void TaskSemTake(TaskSem* const sem) {
+  pthread_mutex_lock(&sem->mutex);
+  while (!sem->given) pthread_cond_wait(&sem->cond, &sem->mutex);
+  sem->given = 0;
+  pthread_mutex_unlock(&sem->mutex);
+}
+
+typedef pthread_t TaskThread;
+
+static void TaskEntry(void* ptr);
+
+static void* PThreadEntry(void* ptr) {
+  TaskEntry(ptr);
+  return NULL;
+}
+
+static int TaskThreadStart(TaskThread* const thread, void* const arg) {
+  return !pthread_create(thread, NULL, PThreadEntry, arg);
+}
+
+static void TaskThreadExit(void) {}
+
+static void TaskThreadJoin(TaskThread* const thread) {
+  pthread_join(*thread, NULL);
+}
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static void PoolLock(void) { pthread_mutex_lock(&pool_lock); }
+static void PoolUnlock(void) { pthread_mutex_unlock(&pool_lock); }
+
+#endif  // ESP_PLATFORM
+
+//------------------------------------------------------------------------------
+
+typedef struct {
+  TaskSem work;       // given by the caller to start a job or stop the task
+  TaskSem done;       // given by the task when the job (or the stop) is done
+  TaskThread thread;
+  WebPWorker* worker;  // the worker whose jobs the task runs; NULL = stop
+  int busy;           // caller side: a job was launched and not synced yet
+  int pooled;         // lives in 'pool' and is never stopped
+  int started;        // pool: semaphores and task exist
+  int in_use;         // pool: attached to a worker
+} TaskRunner;
+
+static TaskRunner pool[WEBP_TASK_WORKER_POOL_SIZE];
+
+static void TaskEntry(void* ptr) {
+  TaskRunner* const runner = (TaskRunner*)ptr;
+  for (;;) {
+    WebPWorker* worker;
+    TaskSemTake(&runner->work);
+    worker = runner->worker;
+    if (worker == NULL) break;  // End() of a runner outside the pool
+    WebPGetWorkerInterface()->Execute(worker);
+    worker->status = OK;
+    TaskSemGive(&runner->done);
+  }
+  TaskSemGive(&runner->done);
+  TaskThreadExit();
+}
+
+static int RunnerStart(TaskRunner* const runner) {
+  if (!TaskSemInit(&runner->work)) return 0;
+  if (!TaskSemInit(&runner->done)) {
+    TaskSemDestroy(&runner->work);
+    return 0;
+  }
+  if (!TaskThreadStart(&runner->thread, runner)) {
+    TaskSemDestroy(&runner->work);
+    TaskSemDestroy(&runner->done);
+    return 0;
+  }
+  return 1;
+}
+
+// A runner from the pool (starting its task the first time), or a new one
+// of its own if all are taken.
+static TaskRunner* RunnerAcquire(void) {
+  TaskRunner* runner = NULL;
+  int i;
+  PoolLock();
+  for (i = 0; i < WEBP_TASK_WORKER_POOL_SIZE; ++i) {
+    if (!pool[i].in_use) {
+      runner = &pool[i];
+      runner->in_use = 1;
+      break;
+    }
+  }
+  PoolUnlock();
+  if (runner != NULL) {
+    if (!runner->started) {
+      runner->pooled = 1;
+      if (!RunnerStart(runner)) {
+        PoolLock();
+        runner->in_use = 0;
+        PoolUnlock();
+        return NULL;
+      }
+      runner->started = 1;
+    }
+    return runner;
+  }
+  runner = (TaskRunner*)WebPSafeCalloc(1, sizeof(TaskRunner));
+  if (runner == NULL) return NULL;
+  if (!RunnerStart(runner)) {
+    WebPSafeFree(runner);
+    return NULL;
+  }
+  return runner;
+}
+
+static void RunnerRelease(TaskRunner* const runner) {
+  if (runner->pooled) {
+    runner->worker = NULL;
+    PoolLock();
+    runner->in_use = 0;
+    PoolUnlock();
+    return;
+  }
+  runner->worker = NULL;
+  TaskSemGive(&runner->work);
+  TaskSemTake(&runner->done);
+  TaskThreadJoin(&runner->thread);
+  TaskSemDestroy(&runner->work);
+  TaskSemDestroy(&runner->done);
+  WebPSafeFree(runner);
+}
+
+static void Init(WebPWorker* const worker) {
+  WEBP_UNSAFE_MEMSET(worker, 0, sizeof(*worker));
+  worker->status = NOT_OK;
+}
+
+static int Sync(WebPWorker* const worker) {
+  TaskRunner* const runner = (TaskRunner*)worker->impl;
+  if (runner != NULL && runner->busy) {
+    TaskSemTake(&runner->done);
+    runner->busy = 0;
+  }
+  assert(worker->status <= OK);
+  return !worker->had_error;
+}
+
+static int Reset(WebPWorker* const worker) {
+  int ok = 1;
+  worker->had_error = 0;
+  if (worker->status < OK) {
+    TaskRunner* const runner = RunnerAcquire();
+    if (runner == NULL) return 0;
+    runner->worker = worker;
+    runner->busy = 0;
+    worker->impl = (void*)runner;
+    worker->status = OK;
+  } else if (worker->status > OK) {
+    ok = Sync(worker);
+  }
+  assert(!ok || (worker->status == OK));
+  return ok;
+}
+
+static void Execute(WebPWorker* const worker) {
+  if (worker->hook != NULL) {
+    worker->had_error |= !worker->hook(worker->data1, worker->data2);
+  }
+}
+
+static void Launch(WebPWorker* const worker) {
+  TaskRunner* const runner = (TaskRunner*)worker->impl;
+  if (runner == NULL) return;
+  Sync(worker);
+  worker->status = WORK;
+  runner->busy = 1;
+  TaskSemGive(&runner->work);
+}
+
+static void End(WebPWorker* const worker) {
+  TaskRunner* const runner = (TaskRunner*)worker->impl;
+  if (runner != NULL) {
+    Sync(worker);
+    RunnerRelease(runner);
+    worker->impl = NULL;
+  }
+  worker->status = NOT_OK;
+}
+
+//------------------------------------------------------------------------------
+
+int WebPInitTaskWorker(void) {
+  static const WebPWorkerInterface kTaskWorkerInterface = {
+      Init, Reset, Sync, Launch, Execute, End};
+  return WebPSetWorkerInterface(&kTaskWorkerInterface);
+}
@@ -16,10 +16,8 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>  // for memcpy()
-#ifdef ESP_PLATFORM
-#include "esp_heap_caps.h"
-#endif
 
+#include "decmem.h"  // ESP32 port: DRAM/PSRAM placement
 #include "src/utils/bounds_safety.h"
 #include "src/utils/palette.h"
 #include "src/webp/encode.h"
@@ -204,42 +202,50 @@ static int CheckSizeArgumentsOverflow(uint64_t nmemb, size_t size) {
   return 1;
 }
 
+static decmem_hint_t DecMemHint(WebPMemHint hint) {
+  return (hint == WEBP_MEM_HOT)    ? DECMEM_HOT
+         : (hint == WEBP_MEM_BULK) ? DECMEM_BULK
+                                   : DECMEM_AUTO;
+}
+
 void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
-    WebPSafeMalloc(uint64_t nmemb, size_t size) {
+    WebPSafeMallocHint(uint64_t nmemb, size_t size, WebPMemHint hint) {
   void* ptr;
   Increment(&num_malloc_calls);
   if (!CheckSizeArgumentsOverflow(nmemb, size)) return NULL;
   assert(nmemb * size > 0);
-#ifdef ESP_PLATFORM
-  ptr = heap_caps_malloc((size_t)(nmemb * size), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-#else
-  ptr = malloc((size_t)(nmemb * size));
-#endif
+  ptr = decmem_malloc((size_t)(nmemb * size), DecMemHint(hint));
   AddMem(ptr, (size_t)(nmemb * size));
   return WEBP_UNSAFE_FORGE_BIDI_INDEXABLE(void*, ptr, (size_t)(nmemb * size));
 }
 
 void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
-    WebPSafeCalloc(uint64_t nmemb, size_t size) {
+    WebPSafeCallocHint(uint64_t nmemb, size_t size, WebPMemHint hint) {
   void* ptr;
   Increment(&num_calloc_calls);
   if (!CheckSizeArgumentsOverflow(nmemb, size)) return NULL;
   assert(nmemb * size > 0);
-#ifdef ESP_PLATFORM
-  ptr = heap_caps_calloc((size_t)nmemb, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-#else
-  ptr = calloc((size_t)nmemb, size);
-#endif
+  ptr = decmem_calloc((size_t)nmemb, size, DecMemHint(hint));
   AddMem(ptr, (size_t)(nmemb * size));
   return WEBP_UNSAFE_FORGE_BIDI_INDEXABLE(void*, ptr, (size_t)(nmemb * size));
 }
 
+void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
+    WebPSafeMalloc(uint64_t nmemb, size_t size) {
+  return WebPSafeMallocHint(nmemb, size, WEBP_MEM_AUTO);
+}
+
+void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
+    WebPSafeCalloc(uint64_t nmemb, size_t size) {
+  return WebPSafeCallocHint(nmemb, size, WEBP_MEM_AUTO);
+}
+
 void WebPSafeFree(void* const ptr) {
   if (ptr != NULL) {
     Increment(&num_free_calls);
     SubMem(ptr);
   }
-  free(ptr);
+  decmem_free(ptr);
 }
 
 // Public API functions.
@@ -61,6 +61,20 @@ WEBP_EXTERN void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
 WEBP_EXTERN void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
     WebPSafeCalloc(uint64_t nmemb, size_t size);
 
+// ESP32 port: placement hints for callers that know better than the
+// size-based default of the functions above (see lib/decmem). WEBP_MEM_HOT is
+// for small tables read for every macroblock or pixel, which are worth
+// keeping in internal DRAM, WEBP_MEM_BULK for pixel buffers (PSRAM).
+typedef enum {
+  WEBP_MEM_AUTO = 0,
+  WEBP_MEM_HOT,
+  WEBP_MEM_BULK
+} WebPMemHint;
+WEBP_EXTERN void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
+    WebPSafeMallocHint(uint64_t nmemb, size_t size, WebPMemHint hint);
+WEBP_EXTERN void* WEBP_SIZED_BY_OR_NULL(nmemb* size)
+    WebPSafeCallocHint(uint64_t nmemb, size_t size, WebPMemHint hint);
+
 // Companion deallocation function to the above allocations.
 WEBP_EXTERN void WebPSafeFree(void* const ptr);
 
@@ -486,8 +486,19 @@ struct WebPDecoderOptions {
   int dithering_strength;           // dithering strength (0=Off, 100=full)
   int flip;                         // if true, flip output vertically
   int alpha_dithering_strength;     // alpha dithering strength in [0..100]
-
-  uint32_t pad[5];  // padding for later use
+  int use_dc_only;                  // if true and the scaled output is at
+                                    // most 1/16 of the (cropped) lossy
+                                    // picture, only reconstruct the DC of
+                                    // each macroblock (approximate, faster)
+  int use_bgcolor;                  // if true, MODE_RGB_565 output of images
+                                    // with alpha is blended over 'bgcolor'
+  uint32_t bgcolor;                 // background color, as 0xRRGGBB
+  int use_box_scaling;              // if true, the crop area may shrink by a
+                                    // few pixels (keeping its center) so
+                                    // that it is an integer multiple of the
+                                    // scaled size: exact box-filter rescaling
+
+  uint32_t pad[1];  // padding for later use
 };
 
 // Main object storing the configuration for advanced decoding.
@@ -537,6 +548,16 @@ WEBP_EXTERN VP8StatusCode WebPDecode(const uint8_t* WEBP_COUNTED_BY(data_size)
                                      size_t data_size,
                                      WebPDecoderConfig* config);
 
+//------------------------------------------------------------------------------
+// ESP32 port extensions
+
+// Installs a WebPWorker implementation that runs each decoder worker on its own
+// task: a FreeRTOS task pinned to the other core on ESP32, a pthread elsewhere.
+// This is what makes 'options.use_threads' overlap filtering and output with
+// macroblock parsing. Must be called before the first decode.
+// Returns false in case of error.
+WEBP_EXTERN int WebPInitTaskWorker(void);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
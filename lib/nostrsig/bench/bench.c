@@ -0,0 +1,105 @@
+/*
+ * bench.c
+ *
+ * Host check and benchmark for nostrsig:
+ *
+ *   python3 gen_vectors.py > vectors.h
+ *   cc -O2 -I.. bench.c ../nostrsig.c ../secp256k1.c -o bench && ./bench
+ *
+ * Checks the event ids and signatures in vectors.h (and that tampered ones
+ * fail), then reports single and batch verifications per second.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "nostrsig.h"
+#include "vectors.h"
+
+#define NSIG (sizeof(sig_vectors) / sizeof(sig_vectors[0]))
+#define NEVENT (sizeof(event_vectors) / sizeof(event_vectors[0]))
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void) {
+  const uint8_t* pubkeys[NSIG];
+  const uint8_t* msgs[NSIG];
+  const uint8_t* sigs[NSIG];
+  uint8_t bad[64];
+  uint8_t id[32];
+  int failed = 0;
+  size_t i;
+  double t;
+  int rounds;
+
+  for (i = 0; i < NEVENT; ++i) {
+    const char* tags = event_vectors[i].tags;
+    const char* content = event_vectors[i].content;
+    if (!nostrsig_event_id(event_vectors[i].pubkey, event_vectors[i].created_at,
+                           event_vectors[i].kind, tags, strlen(tags), content,
+                           strlen(content), id) ||
+        memcmp(id, event_vectors[i].id, 32) != 0) {
+      printf("event %zu: id mismatch\n", i);
+      failed = 1;
+    }
+  }
+
+  for (i = 0; i < NSIG; ++i) {
+    pubkeys[i] = sig_vectors[i].pubkey;
+    msgs[i] = sig_vectors[i].msg;
+    sigs[i] = sig_vectors[i].sig;
+    if (!nostrsig_verify(pubkeys[i], msgs[i], sigs[i])) {
+      printf("signature %zu: rejected\n", i);
+      failed = 1;
+    }
+    memcpy(bad, sigs[i], 64);
+    bad[63] ^= 1;
+    if (nostrsig_verify(pubkeys[i], msgs[i], bad)) {
+      printf("signature %zu: tampered s accepted\n", i);
+      failed = 1;
+    }
+    bad[63] ^= 1;
+    bad[0] ^= 1;
+    if (nostrsig_verify(pubkeys[i], msgs[i], bad)) {
+      printf("signature %zu: tampered r accepted\n", i);
+      failed = 1;
+    }
+  }
+  if (!nostrsig_verify_batch(NSIG, pubkeys, msgs, sigs)) {
+    printf("batch: rejected\n");
+    failed = 1;
+  }
+  memcpy(bad, sigs[NSIG - 1], 64);
+  bad[40] ^= 0x80;
+  sigs[NSIG - 1] = bad;
+  if (nostrsig_verify_batch(NSIG, pubkeys, msgs, sigs)) {
+    printf("batch: tampered signature accepted\n");
+    failed = 1;
+  }
+  sigs[NSIG - 1] = sig_vectors[NSIG - 1].sig;
+  if (failed) return 1;
+  printf("vectors ok\n");
+
+  rounds = 0;
+  t = now();
+  do {
+    for (i = 0; i < NSIG; ++i) nostrsig_verify(pubkeys[i], msgs[i], sigs[i]);
+    rounds += NSIG;
+  } while (now() - t < 1.0);
+  printf("single: %.0f verifications/s\n", rounds / (now() - t));
+
+  rounds = 0;
+  t = now();
+  do {
+    nostrsig_verify_batch(NOSTRSIG_BATCH_MAX, pubkeys, msgs, sigs);
+    rounds += NOSTRSIG_BATCH_MAX;
+  } while (now() - t < 1.0);
+  printf("batch of %d: %.0f verifications/s\n", NOSTRSIG_BATCH_MAX,
+         rounds / (now() - t));
+  return 0;
+}
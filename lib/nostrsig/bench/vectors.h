@@ -0,0 +1,67 @@
+/* Generated by gen_vectors.py, do not edit. */
+static const struct { uint8_t pubkey[32], msg[32], sig[64]; } sig_vectors[16] = {
+  {{0xf9, 0x30, 0x8a, 0x01, 0x92, 0x58, 0xc3, 0x10, 0x49, 0x34, 0x4f, 0x85, 0xf8, 0x9d, 0x52, 0x29, 0xb5, 0x31, 0xc8, 0x45, 0x83, 0x6f, 0x99, 0xb0, 0x86, 0x01, 0xf1, 0x13, 0xbc, 0xe0, 0x36, 0xf9},
+   {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+   {0xe9, 0x07, 0x83, 0x1f, 0x80, 0x84, 0x8d, 0x10, 0x69, 0xa5, 0x37, 0x1b, 0x40, 0x24, 0x10, 0x36, 0x4b, 0xdf, 0x1c, 0x5f, 0x83, 0x07, 0xb0, 0x08, 0x4c, 0x55, 0xf1, 0xce, 0x2d, 0xca, 0x82, 0x15, 0x25, 0xf6, 0x6a, 0x4a, 0x85, 0xea, 0x8b, 0x71, 0xe4, 0x82, 0xa7, 0x4f, 0x38, 0x2d, 0x2c, 0xe5, 0xeb, 0xee, 0xe8, 0xfd, 0xb2, 0x17, 0x2f, 0x47, 0x7d, 0xf4, 0x90, 0x0d, 0x31, 0x05, 0x36, 0xc0}},
+  {{0xb7, 0x10, 0x82, 0x2b, 0xda, 0x38, 0x39, 0x78, 0x37, 0xd2, 0x47, 0xd4, 0x44, 0x8e, 0xf7, 0x74, 0xaa, 0x0b, 0x7a, 0x71, 0x3f, 0x5e, 0xef, 0x3d, 0xe1, 0x9d, 0xf6, 0x86, 0x47, 0xd7, 0xd5, 0xd0},
+   {0xfb, 0x10, 0x64, 0x56, 0x9d, 0x97, 0x53, 0x5c, 0xc0, 0x30, 0x7e, 0xec, 0x28, 0x3d, 0xaa, 0x06, 0x70, 0x01, 0xfb, 0x04, 0x45, 0xdb, 0xec, 0xb8, 0xfe, 0x9d, 0x38, 0x4c, 0xa2, 0xd1, 0xf8, 0x94},
+   {0x2b, 0x0a, 0x62, 0x3a, 0x41, 0x79, 0xfe, 0x69, 0x0f, 0x24, 0x33, 0x8c, 0xc1, 0x22, 0xd5, 0x75, 0xc4, 0xee, 0x9f, 0x2c, 0x50, 0x30, 0xd3, 0x27, 0x7f, 0x47, 0x62, 0xba, 0x8e, 0xc3, 0x4f, 0x03, 0x30, 0x80, 0x54, 0x37, 0x69, 0xf8, 0xb8, 0x6b, 0x7e, 0x82, 0xc8, 0x56, 0xa0, 0xd4, 0x23, 0x61, 0x4b, 0x0c, 0xba, 0x4a, 0xbb, 0x1f, 0x3c, 0xc2, 0x46, 0x11, 0xd5, 0xa9, 0x76, 0x2b, 0x99, 0x9a}},
+  {{0x0f, 0x41, 0x66, 0xff, 0x59, 0xdc, 0x62, 0x19, 0xa0, 0xdd, 0x70, 0x33, 0x0c, 0x15, 0x7b, 0x63, 0xd3, 0x2a, 0x48, 0xf3, 0xef, 0x84, 0x24, 0x04, 0xa7, 0x68, 0x31, 0x4c, 0xdb, 0xad, 0x86, 0x98},
+   {0x00, 0x8b, 0xb2, 0xc2, 0x5b, 0x1a, 0xea, 0x80, 0x60, 0x8b, 0x8c, 0x3b, 0xae, 0x84, 0xc0, 0x71, 0xa0, 0x28, 0xcc, 0x71, 0x45, 0xaf, 0xaa, 0x68, 0x20, 0x06, 0x55, 0x96, 0x70, 0xab, 0xca, 0xaf},
+   {0xcb, 0x1e, 0xf2, 0xef, 0xcf, 0xf1, 0x26, 0x34, 0x5a, 0x30, 0x5a, 0x5d, 0xb8, 0x5f, 0xbb, 0x8c, 0x0d, 0x0e, 0x4c, 0x37, 0x5e, 0x6d, 0x3b, 0xdc, 0x5e, 0x09, 0x54, 0x1b, 0x35, 0x55, 0xc7, 0xd0, 0x8a, 0x91, 0xa9, 0x85, 0x53, 0x42, 0x71, 0x62, 0xc7, 0xf5, 0xbd, 0x00, 0x74, 0xfd, 0x1c, 0x76, 0xde, 0xc6, 0xd6, 0x7a, 0x2a, 0xb4, 0x20, 0x3c, 0xec, 0x03, 0xd1, 0xca, 0x7a, 0x7b, 0x1b, 0xf3}},
+  {{0x73, 0x0b, 0x40, 0x47, 0x5d, 0x04, 0xc2, 0x5c, 0xf7, 0xee, 0x1d, 0xe6, 0x4f, 0x73, 0xdb, 0x69, 0xe7, 0x8c, 0x04, 0xfd, 0x34, 0xfa, 0x1f, 0xab, 0xeb, 0xac, 0xd8, 0x06, 0xd5, 0x7a, 0x47, 0x66},
+   {0x40, 0x11, 0xdb, 0x1a, 0x95, 0x81, 0x18, 0xa4, 0xa1, 0xf2, 0xaa, 0x90, 0xbd, 0xa2, 0xe8, 0xd3, 0x67, 0xe1, 0x7b, 0x76, 0xa9, 0xa5, 0x30, 0x97, 0xd3, 0x8e, 0x74, 0x2a, 0x41, 0x2a, 0x00, 0xe8},
+   {0xfb, 0xcb, 0x2b, 0x66, 0x78, 0xd7, 0x91, 0x2b, 0xd1, 0xa2, 0xd9, 0x86, 0x1d, 0x73, 0xc8, 0xc3, 0xb3, 0x0c, 0xa7, 0x19, 0xb0, 0x4f, 0x68, 0x93, 0x6d, 0x88, 0x4a, 0xe8, 0x3c, 0x05, 0x6b, 0x8b, 0x96, 0x93, 0xed, 0xd6, 0x06, 0xe3, 0x36, 0x48, 0x96, 0xcd, 0x2f, 0xff, 0x07, 0xe6, 0xa6, 0xcb, 0x14, 0x62, 0xe2, 0x59, 0x3e, 0xaa, 0x47, 0x5d, 0xc0, 0xd5, 0xf2, 0x52, 0x54, 0x2f, 0x32, 0x9a}},
+  {{0x11, 0x56, 0x61, 0xec, 0x83, 0xd6, 0x6e, 0x8d, 0x34, 0xf4, 0xb0, 0xb2, 0xd5, 0xaa, 0x52, 0x1b, 0x20, 0xac, 0xcd, 0xca, 0x66, 0x63, 0xcb, 0x1a, 0xfa, 0x46, 0x45, 0x43, 0x4e, 0xa1, 0x14, 0xc4},
+   {0xc2, 0xbf, 0x02, 0x0b, 0x72, 0xa0, 0x85, 0x91, 0xe6, 0xa8, 0x14, 0x2e, 0x04, 0xa6, 0x08, 0x9b, 0xe4, 0xfe, 0xa8, 0xa3, 0xba, 0x78, 0xa1, 0x33, 0xb2, 0xec, 0xc6, 0xd6, 0x93, 0x61, 0x2c, 0x4a},
+   {0x39, 0x53, 0xbe, 0xd7, 0x61, 0x72, 0xb9, 0xf4, 0x5f, 0x74, 0xa5, 0x37, 0x0a, 0x3c, 0x56, 0xda, 0x13, 0x64, 0xce, 0xfb, 0x2e, 0x0f, 0x8e, 0xf1, 0x2a, 0x55, 0x3a, 0xdc, 0xf5, 0x29, 0xc8, 0x5b, 0xfc, 0x15, 0x51, 0x1a, 0x92, 0xd7, 0x52, 0x53, 0x1a, 0xeb, 0xde, 0xa5, 0xa5, 0x42, 0xe9, 0x67, 0x1d, 0x4c, 0x45, 0x95, 0x27, 0x69, 0x2d, 0x02, 0x4c, 0xb6, 0x9b, 0x6e, 0x00, 0x22, 0x14, 0xb1}},
+  {{0xce, 0x75, 0x56, 0x25, 0x15, 0x61, 0xbf, 0x38, 0x5e, 0x9c, 0xa9, 0xbd, 0xb4, 0x54, 0xb5, 0x0f, 0xe2, 0x02, 0x05, 0xe6, 0x89, 0x4e, 0x8a, 0x8c, 0x8f, 0x37, 0xdf, 0x6d, 0x0e, 0x32, 0x41, 0x06},
+   {0x61, 0x96, 0x1f, 0x93, 0x4c, 0xfe, 0x30, 0xc1, 0xfc, 0x03, 0x89, 0x3d, 0x78, 0x06, 0x80, 0x6e, 0x18, 0x7a, 0xce, 0x89, 0xc3, 0x7e, 0x7b, 0xd4, 0x8a, 0xf2, 0xb3, 0xac, 0x66, 0x03, 0x45, 0x6c},
+   {0x10, 0xad, 0x20, 0xd5, 0x46, 0x1a, 0xa0, 0x02, 0x92, 0xe1, 0x61, 0x96, 0x64, 0x57, 0x73, 0x61, 0x46, 0x34, 0x35, 0x80, 0xc8, 0x79, 0x60, 0x56, 0x2e, 0xc1, 0x92, 0x3d, 0x60, 0x82, 0x77, 0x84, 0xe2, 0x0e, 0x77, 0x65, 0x3e, 0xa7, 0xea, 0xda, 0x4f, 0x91, 0xd5, 0x68, 0xd9, 0xbf, 0x11, 0x8e, 0xe5, 0x1b, 0x57, 0x2e, 0xfa, 0x39, 0x19, 0x43, 0x9e, 0xaa, 0x43, 0xe9, 0x8f, 0x47, 0x4c, 0x08}},
+  {{0x3d, 0x8d, 0x69, 0xa4, 0x44, 0x77, 0x61, 0x94, 0xe9, 0xec, 0x05, 0xb8, 0x06, 0xe3, 0x01, 0xd5, 0x96, 0x3d, 0x30, 0x04, 0x74, 0x89, 0xb2, 0x4d, 0x0c, 0x39, 0x3c, 0x3b, 0xed, 0xc2, 0x94, 0x3f},
+   {0x6b, 0x44, 0xdc, 0x2d, 0x32, 0xc5, 0x9a, 0x83, 0x26, 0x6a, 0xc2, 0x27, 0x7f, 0xb9, 0xad, 0x70, 0xd9, 0x4f, 0x9d, 0x82, 0x22, 0xc6, 0x99, 0xd1, 0x39, 0x34, 0x7d, 0xa3, 0xf2, 0x5a, 0xfc, 0x88},
+   {0x58, 0xa9, 0x07, 0x5e, 0x44, 0x85, 0xad, 0xd1, 0xc9, 0x32, 0x31, 0x18, 0xe7, 0x17, 0x21, 0xa7, 0x3a, 0x89, 0x54, 0xac, 0xb0, 0x76, 0xe2, 0x08, 0xdf, 0x29, 0x76, 0x3f, 0x80, 0xb3, 0xbe, 0x74, 0xc2, 0x7b, 0x1f, 0x02, 0x51, 0x9c, 0x3e, 0xd0, 0xd2, 0x20, 0x71, 0xf3, 0x85, 0x87, 0x51, 0x43, 0x68, 0x23, 0xdf, 0xb4, 0x8a, 0x42, 0xc1, 0x48, 0x3c, 0xf7, 0x79, 0x2b, 0xb6, 0xe3, 0x35, 0x8d}},
+  {{0xd7, 0x2b, 0x52, 0x38, 0xf3, 0x3a, 0x1c, 0xf0, 0x98, 0xb2, 0x3b, 0xd2, 0x2d, 0x0e, 0xfc, 0x9c, 0xde, 0x0d, 0x10, 0x52, 0xdd, 0xc4, 0x0c, 0x61, 0x24, 0x2c, 0x9d, 0x95, 0x7b, 0x97, 0x3c, 0xd2},
+   {0x27, 0xb6, 0xb3, 0x35, 0x0f, 0x9a, 0x03, 0x53, 0x39, 0xf8, 0x0b, 0xf9, 0xfe, 0x38, 0x62, 0x40, 0x4f, 0x0b, 0xf7, 0x62, 0xee, 0xcc, 0xcc, 0x17, 0x4f, 0x3a, 0xf4, 0x50, 0x9e, 0x6b, 0xe9, 0x43},
+   {0x9c, 0x39, 0xf0, 0x66, 0x88, 0x09, 0xd2, 0x98, 0xec, 0x99, 0x17, 0x5c, 0x2b, 0x5e, 0xb0, 0x89, 0x19, 0x15, 0xca, 0x04, 0x27, 0x53, 0x97, 0xfa, 0x13, 0x2e, 0xdb, 0x3f, 0xe2, 0xbd, 0x0e, 0x38, 0x8c, 0x5a, 0x87, 0x24, 0x13, 0x35, 0x98, 0xac, 0x4a, 0x53, 0x39, 0x17, 0x3e, 0x96, 0x5f, 0x4c, 0x7e, 0x0b, 0x98, 0xa5, 0x2b, 0x3c, 0x6f, 0x65, 0x44, 0xc2, 0x57, 0x0b, 0x9e, 0x57, 0x94, 0x88}},
+  {{0x10, 0x8a, 0x13, 0xfc, 0x04, 0xe1, 0x1b, 0xb7, 0x82, 0xd8, 0x0b, 0xa4, 0xfa, 0x7c, 0x2d, 0xed, 0x0a, 0xb7, 0x14, 0x35, 0x65, 0x4f, 0xf4, 0xc1, 0xf3, 0x44, 0x81, 0x50, 0xe8, 0xbf, 0xa4, 0x6a},
+   {0x7b, 0x55, 0x93, 0x0c, 0x29, 0x77, 0x39, 0x9c, 0x7f, 0xf1, 0x0b, 0x0e, 0x79, 0xd2, 0x0e, 0xd7, 0x27, 0xd8, 0xf5, 0xcb, 0x4a, 0xe5, 0xd7, 0xf4, 0x95, 0x1f, 0x58, 0x93, 0xf9, 0x05, 0x51, 0x8e},
+   {0x56, 0xce, 0x29, 0xd4, 0x41, 0x03, 0x07, 0x8a, 0x9e, 0xca, 0xfe, 0x8e, 0x4e, 0x44, 0x72, 0xe7, 0x63, 0x7c, 0xa3, 0xa4, 0xd7, 0xde, 0x4f, 0x88, 0x9b, 0x60, 0x9e, 0x1c, 0x1d, 0xb2, 0xf3, 0xc7, 0x8e, 0x55, 0x6c, 0x8e, 0x58, 0x7b, 0x28, 0x82, 0x30, 0x9d, 0xfc, 0x15, 0x3d, 0x82, 0xa2, 0x8f, 0xaf, 0x43, 0x06, 0x32, 0x79, 0x2a, 0xea, 0xb7, 0x47, 0x6e, 0x05, 0x8d, 0x7f, 0xcf, 0x5c, 0x09}},
+  {{0x4d, 0x77, 0xc7, 0xfd, 0xd4, 0x08, 0xb0, 0xf0, 0x41, 0xa2, 0x63, 0x57, 0x25, 0x1b, 0x4a, 0x62, 0x48, 0x5b, 0x5d, 0xf7, 0xf6, 0x3a, 0x1f, 0xbf, 0xdf, 0x34, 0x69, 0x09, 0x82, 0x01, 0xf2, 0xf1},
+   {0x9d, 0x67, 0x4c, 0x34, 0x54, 0x16, 0x66, 0xa3, 0xf9, 0xa4, 0x04, 0x47, 0x35, 0xce, 0xfa, 0xc6, 0xae, 0xe8, 0xab, 0xc8, 0x6d, 0x7c, 0x77, 0x10, 0xd5, 0x2c, 0x8b, 0x92, 0x92, 0x1d, 0x51, 0x1a},
+   {0x48, 0x16, 0x96, 0xaf, 0x60, 0xbb, 0xec, 0x8a, 0xf7, 0x81, 0xc7, 0x57, 0xeb, 0x1e, 0xff, 0xf0, 0xc7, 0xa2, 0x3f, 0x27, 0x89, 0x7d, 0xda, 0xbe, 0x26, 0x2b, 0xcd, 0x3c, 0xc9, 0x07, 0x52, 0x88, 0x9c, 0x46, 0xb5, 0x3b, 0xdf, 0x14, 0xfb, 0xb4, 0xf7, 0xc5, 0xb1, 0xa5, 0x44, 0x43, 0x62, 0x1f, 0x6c, 0x7a, 0xe2, 0x09, 0x24, 0xdb, 0x85, 0x05, 0x9a, 0x51, 0x5b, 0x2c, 0xf1, 0xf9, 0x8e, 0xb0}},
+  {{0x6d, 0x56, 0xbd, 0x8a, 0x56, 0x8c, 0x38, 0xda, 0x58, 0x94, 0x73, 0x48, 0xef, 0xcb, 0xc4, 0x6d, 0x69, 0x97, 0x40, 0x82, 0xd9, 0x2b, 0x7e, 0xea, 0xb1, 0x69, 0xee, 0xd1, 0x79, 0x52, 0x11, 0x34},
+   {0x9e, 0x73, 0x20, 0x74, 0x18, 0x57, 0x95, 0xcb, 0xc3, 0x6e, 0x8c, 0x75, 0xbb, 0x32, 0xc2, 0x0b, 0xf3, 0x20, 0x1d, 0x09, 0x9d, 0x89, 0x89, 0x02, 0x8c, 0xc0, 0x0f, 0xe5, 0xf9, 0x97, 0xe9, 0x84},
+   {0xec, 0xb2, 0x98, 0x55, 0xfa, 0xf6, 0x02, 0x61, 0xac, 0xc8, 0x16, 0xde, 0x13, 0x9d, 0x16, 0xe4, 0x5e, 0xe6, 0xe5, 0x93, 0xdd, 0x9c, 0x19, 0x6f, 0x5b, 0x4f, 0x46, 0xb4, 0x96, 0xb2, 0x2b, 0x72, 0xdf, 0x56, 0x01, 0xa9, 0x7e, 0xa5, 0x57, 0x3f, 0x27, 0xcd, 0x66, 0x4b, 0x6b, 0xdd, 0x66, 0x5b, 0xca, 0xa5, 0x19, 0x0f, 0x80, 0x00, 0xda, 0x57, 0xe4, 0x8f, 0x05, 0x36, 0xa3, 0xd5, 0x16, 0x47}},
+  {{0x75, 0xb8, 0x38, 0x31, 0xf1, 0xb3, 0x7d, 0x29, 0x9d, 0x1a, 0x77, 0x98, 0xb7, 0x3b, 0xf3, 0x0a, 0xa6, 0x70, 0x92, 0x82, 0xc8, 0x91, 0x20, 0x4c, 0x0e, 0x7b, 0x7f, 0xe7, 0xc4, 0xb6, 0xe9, 0x9d},
+   {0xf6, 0x0d, 0xa4, 0xdc, 0xa9, 0x9d, 0x3a, 0xb7, 0x52, 0x08, 0xb0, 0x6c, 0x2e, 0x2f, 0xc5, 0x95, 0xea, 0x8a, 0x06, 0x50, 0xec, 0x83, 0x8b, 0xdd, 0xed, 0x13, 0x0f, 0xb1, 0xbb, 0x93, 0x5b, 0xfa},
+   {0x3f, 0x9d, 0xd3, 0x69, 0x09, 0x07, 0xd5, 0xa3, 0x65, 0x5e, 0x3c, 0xea, 0xf2, 0x96, 0x88, 0x67, 0x5b, 0x2d, 0xb6, 0x75, 0x75, 0x79, 0x82, 0xdd, 0x98, 0x87, 0x9f, 0x09, 0xcd, 0x43, 0x61, 0xa9, 0xb5, 0x82, 0xfc, 0x6d, 0x1c, 0xec, 0xcf, 0x82, 0x61, 0x8d, 0x1e, 0x9a, 0x40, 0xa4, 0x48, 0x46, 0x23, 0xbe, 0x3f, 0x4b, 0x3c, 0x2e, 0x53, 0x27, 0x49, 0xa2, 0x18, 0x7c, 0x41, 0x07, 0xd7, 0xcc}},
+  {{0x86, 0x5b, 0x02, 0xf8, 0xff, 0xf3, 0x20, 0xaa, 0x0d, 0x39, 0x48, 0xf4, 0x6c, 0xa4, 0xfb, 0x4a, 0xef, 0x0e, 0x00, 0x16, 0x4d, 0xab, 0xcf, 0xc9, 0x4d, 0x74, 0xac, 0x19, 0x9b, 0x42, 0x10, 0xd1},
+   {0x53, 0xee, 0xc2, 0xc9, 0x87, 0x42, 0x51, 0x77, 0x52, 0x4c, 0x4d, 0x14, 0x97, 0x5b, 0x38, 0xa5, 0xf4, 0x3e, 0xb9, 0xce, 0x03, 0xdf, 0x89, 0x6f, 0x02, 0x36, 0x05, 0x23, 0x31, 0xe2, 0xa0, 0xd4},
+   {0x49, 0xa2, 0x0a, 0xc6, 0x34, 0xf3, 0x90, 0x7d, 0x7d, 0x51, 0x16, 0x6b, 0xe6, 0xd3, 0xce, 0x95, 0x09, 0xeb, 0x42, 0xd6, 0x19, 0xc5, 0x20, 0x49, 0xe2, 0xc2, 0x5b, 0x26, 0xb9, 0x5a, 0xde, 0x1f, 0xe7, 0xd2, 0xc3, 0x2f, 0x31, 0x6c, 0xda, 0xbf, 0x16, 0xa6, 0xca, 0x00, 0x73, 0xc1, 0x26, 0x54, 0x12, 0xdf, 0xe0, 0xec, 0x1f, 0xd4, 0xb7, 0x6c, 0xe0, 0x13, 0x6f, 0x5e, 0xd2, 0x21, 0xb8, 0x70}},
+  {{0x17, 0x26, 0x7d, 0x43, 0x8a, 0x1b, 0xfd, 0x58, 0x7e, 0x9d, 0xa7, 0xda, 0xdd, 0x05, 0x1a, 0xed, 0x7d, 0x44, 0x65, 0x88, 0x07, 0x5a, 0x33, 0x58, 0x02, 0xab, 0xae, 0x35, 0xcf, 0x2c, 0x44, 0xfa},
+   {0xe7, 0xad, 0x95, 0xec, 0x63, 0xbb, 0x03, 0xd9, 0x8a, 0x6b, 0xd9, 0xf6, 0x55, 0x93, 0x40, 0x71, 0xa7, 0x70, 0xf1, 0x19, 0x4f, 0xa6, 0x91, 0x45, 0x87, 0x76, 0xef, 0xfe, 0x88, 0xe6, 0xdf, 0x58},
+   {0xb2, 0x42, 0x88, 0x95, 0x61, 0x01, 0x75, 0x6e, 0x6b, 0x53, 0xb5, 0x35, 0x83, 0x9d, 0x0c, 0xb5, 0x42, 0xa6, 0xcc, 0x79, 0x07, 0xdb, 0xa4, 0xb7, 0xa7, 0x8f, 0xb6, 0xa0, 0x71, 0x6b, 0x1c, 0x63, 0x04, 0x7a, 0xa0, 0x48, 0x0d, 0x5c, 0x3d, 0xdc, 0x7c, 0xc0, 0x9f, 0x47, 0xe6, 0xed, 0xd8, 0xed, 0xb4, 0xfd, 0x10, 0xfd, 0xcc, 0xa5, 0x90, 0xb6, 0x6c, 0x44, 0xf2, 0x26, 0x58, 0x11, 0x39, 0x24}},
+  {{0x11, 0xd5, 0x61, 0x92, 0x44, 0x59, 0xe7, 0x39, 0x75, 0x1c, 0x68, 0x36, 0x43, 0xf5, 0xca, 0x3e, 0x07, 0xc3, 0x5c, 0x4c, 0x55, 0x9a, 0x44, 0xd7, 0x6e, 0xb8, 0x61, 0x43, 0x0c, 0x53, 0xc8, 0xde},
+   {0x5a, 0x75, 0xc3, 0x65, 0xb0, 0x0f, 0xbb, 0xb6, 0xe7, 0x18, 0x8c, 0xb6, 0x89, 0x34, 0x9f, 0x34, 0xd3, 0x82, 0xd9, 0xb3, 0x3e, 0x61, 0x68, 0xce, 0xb2, 0x6c, 0x99, 0x7e, 0x52, 0xe3, 0x74, 0x3c},
+   {0xa9, 0xde, 0x43, 0x85, 0xee, 0x6a, 0xfa, 0x9d, 0x44, 0x88, 0xfd, 0xa7, 0x44, 0x2c, 0x5d, 0x42, 0x69, 0x43, 0x33, 0x6e, 0x41, 0x8a, 0x9e, 0x51, 0x84, 0x50, 0x78, 0x13, 0xf8, 0x84, 0x43, 0x79, 0x11, 0xca, 0xb2, 0xa0, 0xc3, 0x43, 0x2f, 0xf8, 0x94, 0x21, 0x85, 0xf1, 0x7e, 0x5a, 0xb6, 0xc1, 0x6a, 0x1c, 0xeb, 0x39, 0x47, 0x39, 0x95, 0x1c, 0xf8, 0x76, 0xc8, 0x2c, 0xc8, 0x09, 0x2c, 0xff}},
+  {{0xe2, 0xeb, 0x88, 0x37, 0x58, 0x56, 0x9c, 0x24, 0x4d, 0xe1, 0xa7, 0x68, 0x08, 0x8f, 0x6e, 0xe0, 0xd2, 0x8a, 0x4c, 0x1d, 0x39, 0x57, 0xd2, 0xa4, 0x8f, 0x93, 0x00, 0x75, 0x06, 0x22, 0x74, 0x4b},
+   {0xe4, 0x1b, 0xed, 0xd1, 0x33, 0x8a, 0xf7, 0x16, 0xc6, 0x32, 0xb5, 0x78, 0x76, 0x6b, 0x32, 0xce, 0x20, 0x1d, 0xa2, 0x4a, 0x39, 0xf1, 0x2e, 0xd3, 0x02, 0xa4, 0xe5, 0x15, 0x86, 0x04, 0xc2, 0x1b},
+   {0x6b, 0x5b, 0x6a, 0xc4, 0xf9, 0x09, 0xb5, 0xe5, 0x75, 0x3e, 0x4e, 0xcd, 0x18, 0x62, 0xf0, 0x3d, 0x21, 0x42, 0x63, 0x56, 0x05, 0x8c, 0x18, 0x79, 0xe3, 0xf9, 0x49, 0x97, 0xc1, 0x4d, 0x78, 0xf3, 0x7c, 0x68, 0xf7, 0xf9, 0xb6, 0x0b, 0x14, 0xad, 0x80, 0x1a, 0xd6, 0xa3, 0xd4, 0x64, 0x61, 0xae, 0x2e, 0x9e, 0x8a, 0xa7, 0xeb, 0x37, 0x08, 0x83, 0x21, 0xfa, 0xfa, 0xcd, 0xc0, 0xa7, 0x6d, 0xc6}},
+};
+static const struct {
+  uint32_t created_at;
+  int kind;
+  const char* tags;
+  const char* content;
+  uint8_t pubkey[32], id[32];
+} event_vectors[2] = {
+  {1700000000, 1, " [ ] ",
+   "hello",
+   {0xb7, 0x10, 0x82, 0x2b, 0xda, 0x38, 0x39, 0x78, 0x37, 0xd2, 0x47, 0xd4, 0x44, 0x8e, 0xf7, 0x74, 0xaa, 0x0b, 0x7a, 0x71, 0x3f, 0x5e, 0xef, 0x3d, 0xe1, 0x9d, 0xf6, 0x86, 0x47, 0xd7, 0xd5, 0xd0},
+   {0x27, 0x0f, 0x4c, 0xad, 0xbd, 0x18, 0x9f, 0x9f, 0x19, 0x01, 0x34, 0x61, 0xb5, 0x16, 0x52, 0x88, 0x27, 0xad, 0xaa, 0xd3, 0xbe, 0xc5, 0x4a, 0xc5, 0x88, 0x88, 0x8d, 0xb6, 0x0f, 0x81, 0x4f, 0x30}},
+  {1700000001, 1, "[[\042e\042, \0425c83da77af1dec6d7289834998ad7aafbd9e2191396d75ec3cc27f5a77226f36\042, \042wss://r.example/\134u0041\042], [\042t\042,\042\134u3066\134u3059\134u3068\042], [\042emoji\042,\042\134ud83d\134ude00\042,\042a\134/b\134n\042]]",
+   "line\012break \042quoted\042 back\134slash\011tab \343\201\223\343\202\223\343\201\253\343\201\241\343\201\257 \360\237\230\200",
+   {0xb7, 0x10, 0x82, 0x2b, 0xda, 0x38, 0x39, 0x78, 0x37, 0xd2, 0x47, 0xd4, 0x44, 0x8e, 0xf7, 0x74, 0xaa, 0x0b, 0x7a, 0x71, 0x3f, 0x5e, 0xef, 0x3d, 0xe1, 0x9d, 0xf6, 0x86, 0x47, 0xd7, 0xd5, 0xd0},
+   {0x67, 0x12, 0x25, 0x33, 0xf4, 0xb5, 0xd7, 0x81, 0x9f, 0x93, 0xd8, 0xc9, 0x3e, 0x90, 0xc5, 0xc7, 0x19, 0x36, 0x42, 0x89, 0xc6, 0x7b, 0x0f, 0xee, 0x51, 0x2b, 0xda, 0x34, 0xd9, 0x0a, 0x3a, 0x4a}},
+};
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+"""Generates secp256k1_gtable.h: j * 16^w * G for w = 0..63, j = 1..15.
+
+    python3 gen_gtable.py > secp256k1_gtable.h
+"""
+
+P = 2**256 - 2**32 - 977
+G = (0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798,
+     0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8)
+
+
+def add(a, b):
+    if a is None:
+        return b
+    if a[0] == b[0]:
+        if (a[1] + b[1]) % P == 0:
+            return None
+        lam = 3 * a[0] * a[0] * pow(2 * a[1], P - 2, P) % P
+    else:
+        lam = (b[1] - a[1]) * pow(b[0] - a[0], P - 2, P) % P
+    x = (lam * lam - a[0] - b[0]) % P
+    return (x, (lam * (a[0] - x) - a[1]) % P)
+
+
+def limbs(v):
+    return ", ".join("0x%08Xu" % ((v >> (32 * i)) & 0xFFFFFFFF) for i in range(8))
+
+
+def main():
+    print("/* Generated by gen_gtable.py, do not edit. */")
+    print("static const secp_ge secp_gtable[64][SECP_WINDOW_SIZE] = {")
+    base = G
+    for w in range(64):
+        print("  { /* 16^%d */" % w)
+        point = None
+        for j in range(1, 16):
+            point = add(point, base)
+            print("    {{{%s}}, {{%s}}}," % (limbs(point[0]), limbs(point[1])))
+        print("  },")
+        base = add(point, base)  # 16 * base
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
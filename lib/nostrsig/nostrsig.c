@@ -0,0 +1,459 @@
+/*
+ * nostrsig.c
+ *
+ * Event ids and BIP-340 verification, see nostrsig.h.
+ */
+
+#include "nostrsig.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "secp256k1.h"
+
+/* ------------------------------------------------------------------------- */
+/* SHA-256 */
+
+#ifdef ESP_PLATFORM
+
+#include "mbedtls/version.h"
+
+#if MBEDTLS_VERSION_MAJOR >= 3
+#define SHA256_STARTS mbedtls_sha256_starts
+#define SHA256_UPDATE mbedtls_sha256_update
+#define SHA256_FINISH mbedtls_sha256_finish
+#else
+#define SHA256_STARTS mbedtls_sha256_starts_ret
+#define SHA256_UPDATE mbedtls_sha256_update_ret
+#define SHA256_FINISH mbedtls_sha256_finish_ret
+#endif
+
+void nostrsig_sha256_init(nostrsig_sha256_t* ctx) {
+  mbedtls_sha256_init(ctx);
+  SHA256_STARTS(ctx, 0);
+}
+
+void nostrsig_sha256_update(nostrsig_sha256_t* ctx, const void* data, size_t len) {
+  SHA256_UPDATE(ctx, (const unsigned char*)data, len);
+}
+
+void nostrsig_sha256_final(nostrsig_sha256_t* ctx, uint8_t out[32]) {
+  SHA256_FINISH(ctx, out);
+  mbedtls_sha256_free(ctx);
+}
+
+#else  /* !ESP_PLATFORM */
+
+static const uint32_t sha256_k[64] = {
+  0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu, 0x59f111f1u,
+  0x923f82a4u, 0xab1c5ed5u, 0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u,
+  0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u, 0xe49b69c1u, 0xefbe4786u,
+  0x0fc19dc6u, 0x240ca1ccu, 0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau,
+  0x983e5152u, 0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u,
+  0x06ca6351u, 0x14292967u, 0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u,
+  0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u, 0xa2bfe8a1u, 0xa81a664bu,
+  0xc24b8b70u, 0xc76c51a3u, 0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u,
+  0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au,
+  0x5b9cca4fu, 0x682e6ff3u, 0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u,
+  0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u};
+
+#define ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_block(uint32_t* s, const uint8_t* p) {
+  uint32_t w[64], a, b, c, d, e, f, g, h;
+  int i;
+  for (i = 0; i < 16; ++i) {
+    w[i] = ((uint32_t)p[4 * i] << 24) | ((uint32_t)p[4 * i + 1] << 16) |
+           ((uint32_t)p[4 * i + 2] << 8) | p[4 * i + 3];
+  }
+  for (i = 16; i < 64; ++i) {
+    const uint32_t s0 = ROR(w[i - 15], 7) ^ ROR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    const uint32_t s1 = ROR(w[i - 2], 17) ^ ROR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+  a = s[0]; b = s[1]; c = s[2]; d = s[3];
+  e = s[4]; f = s[5]; g = s[6]; h = s[7];
+  for (i = 0; i < 64; ++i) {
+    const uint32_t t1 = h + (ROR(e, 6) ^ ROR(e, 11) ^ ROR(e, 25)) +
+                        ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+    const uint32_t t2 = (ROR(a, 2) ^ ROR(a, 13) ^ ROR(a, 22)) +
+                        ((a & b) ^ (a & c) ^ (b & c));
+    h = g; g = f; f = e; e = d + t1;
+    d = c; c = b; b = a; a = t1 + t2;
+  }
+  s[0] += a; s[1] += b; s[2] += c; s[3] += d;
+  s[4] += e; s[5] += f; s[6] += g; s[7] += h;
+}
+
+void nostrsig_sha256_init(nostrsig_sha256_t* ctx) {
+  static const uint32_t iv[8] = {0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+                                 0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u};
+  memcpy(ctx->state, iv, sizeof(iv));
+  ctx->length = 0;
+}
+
+void nostrsig_sha256_update(nostrsig_sha256_t* ctx, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  size_t used = (size_t)(ctx->length & 63);
+  ctx->length += len;
+  if (used) {
+    const size_t n = (len < 64 - used) ? len : 64 - used;
+    memcpy(ctx->block + used, p, n);
+    p += n;
+    len -= n;
+    if (used + n < 64) return;
+    sha256_block(ctx->state, ctx->block);
+  }
+  for (; len >= 64; p += 64, len -= 64) sha256_block(ctx->state, p);
+  memcpy(ctx->block, p, len);
+}
+
+void nostrsig_sha256_final(nostrsig_sha256_t* ctx, uint8_t out[32]) {
+  const uint64_t bits = ctx->length * 8;
+  size_t used = (size_t)(ctx->length & 63);
+  int i;
+  ctx->block[used++] = 0x80;
+  if (used > 56) {
+    memset(ctx->block + used, 0, 64 - used);
+    sha256_block(ctx->state, ctx->block);
+    used = 0;
+  }
+  memset(ctx->block + used, 0, 56 - used);
+  for (i = 0; i < 8; ++i) ctx->block[56 + i] = (uint8_t)(bits >> (56 - 8 * i));
+  sha256_block(ctx->state, ctx->block);
+  for (i = 0; i < 8; ++i) {
+    out[4 * i] = (uint8_t)(ctx->state[i] >> 24);
+    out[4 * i + 1] = (uint8_t)(ctx->state[i] >> 16);
+    out[4 * i + 2] = (uint8_t)(ctx->state[i] >> 8);
+    out[4 * i + 3] = (uint8_t)ctx->state[i];
+  }
+}
+
+#endif  /* ESP_PLATFORM */
+
+/* ------------------------------------------------------------------------- */
+/* Event id */
+
+/* Buffers the serialization so that the hash (the accelerator on ESP32) is
+ * fed whole blocks rather than single characters. */
+typedef struct {
+  nostrsig_sha256_t sha;
+  uint8_t buf[64];
+  size_t used;
+} id_writer_t;
+
+static void put(id_writer_t* w, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  while (len) {
+    size_t n = sizeof(w->buf) - w->used;
+    if (n > len) n = len;
+    memcpy(w->buf + w->used, p, n);
+    w->used += n;
+    p += n;
+    len -= n;
+    if (w->used == sizeof(w->buf)) {
+      nostrsig_sha256_update(&w->sha, w->buf, w->used);
+      w->used = 0;
+    }
+  }
+}
+
+static void put_char(id_writer_t* w, char c) {
+  w->buf[w->used++] = (uint8_t)c;
+  if (w->used == sizeof(w->buf)) {
+    nostrsig_sha256_update(&w->sha, w->buf, w->used);
+    w->used = 0;
+  }
+}
+
+static void put_uint(id_writer_t* w, uint32_t v) {
+  char tmp[10];
+  int n = 0;
+  do {
+    tmp[n++] = (char)('0' + v % 10);
+    v /= 10;
+  } while (v);
+  while (n) put_char(w, tmp[--n]);
+}
+
+/* One byte of a string value, escaped as NIP-01 says: these seven
+ * characters get a backslash escape, everything else is written as is. */
+static void put_escaped(id_writer_t* w, uint8_t c) {
+  char e;
+  switch (c) {
+    case '\n': e = 'n'; break;
+    case '"': e = '"'; break;
+    case '\\': e = '\\'; break;
+    case '\r': e = 'r'; break;
+    case '\t': e = 't'; break;
+    case '\b': e = 'b'; break;
+    case '\f': e = 'f'; break;
+    default: put_char(w, (char)c); return;
+  }
+  put_char(w, '\\');
+  put_char(w, e);
+}
+
+static int hex_digit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static int read_hex4(const char* p, const char* end, uint32_t* v) {
+  int i;
+  if (end - p < 4) return 0;
+  *v = 0;
+  for (i = 0; i < 4; ++i) {
+    const int d = hex_digit(p[i]);
+    if (d < 0) return 0;
+    *v = (*v << 4) | (uint32_t)d;
+  }
+  return 1;
+}
+
+static void put_utf8(id_writer_t* w, uint32_t cp) {
+  if (cp < 0x80) {
+    put_escaped(w, (uint8_t)cp);
+  } else if (cp < 0x800) {
+    put_char(w, (char)(0xC0 | (cp >> 6)));
+    put_char(w, (char)(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    put_char(w, (char)(0xE0 | (cp >> 12)));
+    put_char(w, (char)(0x80 | ((cp >> 6) & 0x3F)));
+    put_char(w, (char)(0x80 | (cp & 0x3F)));
+  } else {
+    put_char(w, (char)(0xF0 | (cp >> 18)));
+    put_char(w, (char)(0x80 | ((cp >> 12) & 0x3F)));
+    put_char(w, (char)(0x80 | ((cp >> 6) & 0x3F)));
+    put_char(w, (char)(0x80 | (cp & 0x3F)));
+  }
+}
+
+/* Re-serializes raw JSON (the tags array) canonically: no whitespace, and
+ * strings unescaped and escaped again the NIP-01 way. */
+static int put_canonical_json(id_writer_t* w, const char* p, const char* end) {
+  while (p < end) {
+    const char c = *p++;
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n') continue;
+    put_char(w, c);
+    if (c != '"') continue;
+    for (;;) {
+      uint32_t cp;
+      if (p >= end) return 0;
+      if (*p == '"') break;
+      if (*p != '\\') {
+        put_escaped(w, (uint8_t)*p++);
+        continue;
+      }
+      if (++p >= end) return 0;
+      switch (*p++) {
+        case '"': cp = '"'; break;
+        case '\\': cp = '\\'; break;
+        case '/': cp = '/'; break;
+        case 'b': cp = '\b'; break;
+        case 'f': cp = '\f'; break;
+        case 'n': cp = '\n'; break;
+        case 'r': cp = '\r'; break;
+        case 't': cp = '\t'; break;
+        case 'u':
+          if (!read_hex4(p, end, &cp)) return 0;
+          p += 4;
+          if (cp >= 0xD800 && cp < 0xDC00 && end - p >= 6 && p[0] == '\\' &&
+              p[1] == 'u') {
+            uint32_t lo;
+            if (read_hex4(p + 2, end, &lo) && lo >= 0xDC00 && lo < 0xE000) {
+              cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+              p += 6;
+            }
+          }
+          break;
+        default:
+          return 0;
+      }
+      put_utf8(w, cp);
+    }
+    put_char(w, *p++);  /* closing quote */
+  }
+  return 1;
+}
+
+int nostrsig_event_id(const uint8_t pubkey[32], uint32_t created_at, int kind,
+                      const char* tags, size_t tags_len, const char* content,
+                      size_t content_len, uint8_t id[32]) {
+  static const char hex[] = "0123456789abcdef";
+  id_writer_t w;
+  size_t i;
+  w.used = 0;
+  nostrsig_sha256_init(&w.sha);
+  put(&w, "[0,\"", 4);
+  for (i = 0; i < 32; ++i) {
+    put_char(&w, hex[pubkey[i] >> 4]);
+    put_char(&w, hex[pubkey[i] & 15]);
+  }
+  put(&w, "\",", 2);
+  put_uint(&w, created_at);
+  put_char(&w, ',');
+  put_uint(&w, (uint32_t)kind);
+  put_char(&w, ',');
+  if (tags && tags_len) {
+    if (!put_canonical_json(&w, tags, tags + tags_len)) {
+      uint8_t discard[32];
+      nostrsig_sha256_final(&w.sha, discard);
+      return 0;
+    }
+  } else {
+    put(&w, "[]", 2);
+  }
+  put(&w, ",\"", 2);
+  for (i = 0; i < content_len; ++i) put_escaped(&w, (uint8_t)content[i]);
+  put(&w, "\"]", 2);
+  nostrsig_sha256_update(&w.sha, w.buf, w.used);
+  nostrsig_sha256_final(&w.sha, id);
+  return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+/* BIP-340 */
+
+/* e = int(SHA256(SHA256(tag) || SHA256(tag) || r || pubkey || msg)) mod n */
+static void challenge(secp_sc* e, const uint8_t r[32], const uint8_t pubkey[32],
+                      const uint8_t msg[32]) {
+  /* SHA256("BIP0340/challenge") */
+  static const uint8_t tag[32] = {
+    0x7b, 0xb5, 0x2d, 0x7a, 0x9f, 0xef, 0x58, 0x32, 0x3e, 0xb1, 0xbf,
+    0x7a, 0x40, 0x7d, 0xb3, 0x82, 0xd2, 0xf3, 0xf2, 0xd8, 0x1b, 0xb1,
+    0x22, 0x4f, 0x49, 0xfe, 0x51, 0x8f, 0x6d, 0x48, 0xd3, 0x7c};
+  nostrsig_sha256_t sha;
+  uint8_t h[32];
+  nostrsig_sha256_init(&sha);
+  nostrsig_sha256_update(&sha, tag, 32);
+  nostrsig_sha256_update(&sha, tag, 32);
+  nostrsig_sha256_update(&sha, r, 32);
+  nostrsig_sha256_update(&sha, pubkey, 32);
+  nostrsig_sha256_update(&sha, msg, 32);
+  nostrsig_sha256_final(&sha, h);
+  secp_sc_set_bytes(e, h, NULL);
+}
+
+int nostrsig_verify(const uint8_t pubkey[32], const uint8_t msg[32],
+                    const uint8_t sig[64]) {
+  secp_gej table[SECP_WINDOW_SIZE];
+  secp_gej rj;
+  secp_ge p, r;
+  secp_fe rx;
+  secp_sc s, e;
+  int overflow;
+  if (!secp_ge_lift_x(&p, pubkey)) return 0;
+  if (!secp_fe_set_bytes(&rx, sig)) return 0;
+  secp_sc_set_bytes(&s, sig + 32, &overflow);
+  if (overflow) return 0;
+  challenge(&e, sig, pubkey, msg);
+  /* R = s*G - e*P */
+  secp_ge_negate(&p, &p);
+  secp_ecmult(&rj, &s, 1, &p, &e, table);
+  if (!secp_gej_to_ge(&r, &rj)) return 0;
+  if (r.y.n[0] & 1) return 0;
+  return secp_fe_equal(&r.x, &rx);
+}
+
+static int verify_each(size_t n, const uint8_t* const pubkeys[],
+                       const uint8_t* const msgs[], const uint8_t* const sigs[]) {
+  size_t i;
+  for (i = 0; i < n; ++i) {
+    if (!nostrsig_verify(pubkeys[i], msgs[i], sigs[i])) return 0;
+  }
+  return 1;
+}
+
+/* sum(a_i * s_i) * G - sum(a_i * R_i) - sum(a_i * e_i * P_i) == infinity,
+ * with a_0 = 1 and the other a_i 128-bit weights from a hash of all inputs
+ * (so a forger cannot pick signatures that cancel out). */
+static int verify_batch(size_t n, const uint8_t* const pubkeys[],
+                        const uint8_t* const msgs[], const uint8_t* const sigs[]) {
+  const size_t points = 2 * n;
+  uint8_t* scratch;
+  secp_ge* p;
+  secp_sc* k;
+  secp_gej* table;
+  secp_gej q;
+  secp_sc gsum, s, e, a;
+  uint8_t seed[32];
+  nostrsig_sha256_t sha;
+  size_t i;
+  int ok = 1;
+
+  scratch = (uint8_t*)malloc(points * (sizeof(secp_ge) + sizeof(secp_sc) +
+                                       SECP_WINDOW_SIZE * sizeof(secp_gej)));
+  if (!scratch) return verify_each(n, pubkeys, msgs, sigs);
+  table = (secp_gej*)scratch;
+  p = (secp_ge*)(table + points * SECP_WINDOW_SIZE);
+  k = (secp_sc*)(p + points);
+
+  nostrsig_sha256_init(&sha);
+  for (i = 0; i < n; ++i) {
+    nostrsig_sha256_update(&sha, pubkeys[i], 32);
+    nostrsig_sha256_update(&sha, msgs[i], 32);
+    nostrsig_sha256_update(&sha, sigs[i], 64);
+  }
+  nostrsig_sha256_final(&sha, seed);
+
+  memset(&gsum, 0, sizeof(gsum));
+  for (i = 0; i < n && ok; ++i) {
+    secp_ge* const r = &p[2 * i];
+    secp_ge* const pk = &p[2 * i + 1];
+    int overflow;
+    if (!secp_ge_lift_x(pk, pubkeys[i]) || !secp_ge_lift_x(r, sigs[i])) {
+      ok = 0;
+      break;
+    }
+    secp_sc_set_bytes(&s, sigs[i] + 32, &overflow);
+    if (overflow) {
+      ok = 0;
+      break;
+    }
+    challenge(&e, sigs[i], pubkeys[i], msgs[i]);
+    memset(&a, 0, sizeof(a));
+    if (i == 0) {
+      a.n[0] = 1;
+    } else {
+      uint8_t h[32];
+      uint8_t idx[4] = {(uint8_t)(i >> 24), (uint8_t)(i >> 16), (uint8_t)(i >> 8),
+                        (uint8_t)i};
+      nostrsig_sha256_init(&sha);
+      nostrsig_sha256_update(&sha, seed, 32);
+      nostrsig_sha256_update(&sha, idx, 4);
+      nostrsig_sha256_final(&sha, h);
+      memset(h, 0, 16);
+      h[31] |= 1;
+      secp_sc_set_bytes(&a, h, NULL);
+    }
+    secp_sc_mul(&s, &a, &s);
+    secp_sc_add(&gsum, &gsum, &s);
+    secp_ge_negate(r, r);
+    k[2 * i] = a;
+    secp_ge_negate(pk, pk);
+    secp_sc_mul(&k[2 * i + 1], &a, &e);
+  }
+  if (ok) {
+    secp_ecmult(&q, &gsum, points, p, k, table);
+    ok = q.inf;
+  }
+  free(scratch);
+  return ok;
+}
+
+int nostrsig_verify_batch(size_t n, const uint8_t* const pubkeys[],
+                          const uint8_t* const msgs[],
+                          const uint8_t* const sigs[]) {
+  while (n > NOSTRSIG_BATCH_MAX) {
+    if (!verify_batch(NOSTRSIG_BATCH_MAX, pubkeys, msgs, sigs)) return 0;
+    pubkeys += NOSTRSIG_BATCH_MAX;
+    msgs += NOSTRSIG_BATCH_MAX;
+    sigs += NOSTRSIG_BATCH_MAX;
+    n -= NOSTRSIG_BATCH_MAX;
+  }
+  if (n < 2) return n == 0 || nostrsig_verify(pubkeys[0], msgs[0], sigs[0]);
+  return verify_batch(n, pubkeys, msgs, sigs);
+}
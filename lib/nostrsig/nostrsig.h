@@ -0,0 +1,75 @@
+/*
+ * nostrsig.h
+ *
+ * Nostr event authentication: the event id (SHA-256 of the NIP-01
+ * serialization) and BIP-340 Schnorr signature verification on secp256k1.
+ *
+ * SHA-256 goes through mbedtls on ESP32, which ESP-IDF backs with the SHA
+ * accelerator; host builds use a plain C implementation.
+ *
+ * Verification is variable time (all inputs are public) and needs no heap
+ * for a single signature. Batch verification checks a whole burst with one
+ * shared chain of doublings (BIP-340 "batch verification", random weights
+ * derived from a hash of the inputs); its scratch, about 3 KB per
+ * signature, comes from malloc().
+ */
+
+#ifndef NOSTRSIG_H
+#define NOSTRSIG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "mbedtls/sha256.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Largest burst nostrsig_verify_batch() checks in one go; longer ones are
+ * split. */
+#ifndef NOSTRSIG_BATCH_MAX
+#define NOSTRSIG_BATCH_MAX 8
+#endif
+
+#ifdef ESP_PLATFORM
+typedef mbedtls_sha256_context nostrsig_sha256_t;
+#else
+typedef struct {
+  uint32_t state[8];
+  uint64_t length; /* bytes hashed so far */
+  uint8_t block[64];
+} nostrsig_sha256_t;
+#endif
+
+void nostrsig_sha256_init(nostrsig_sha256_t* ctx);
+void nostrsig_sha256_update(nostrsig_sha256_t* ctx, const void* data, size_t len);
+void nostrsig_sha256_final(nostrsig_sha256_t* ctx, uint8_t out[32]);
+
+/* The event id: SHA-256 of [0,"<pubkey>",<created_at>,<kind>,<tags>,"<content>"].
+ * 'tags' is the raw JSON of the tags array as received (any whitespace or
+ * escaping; it is re-serialized canonically), 'content' the unescaped
+ * content. Returns 0 if 'tags' is not valid JSON. */
+int nostrsig_event_id(const uint8_t pubkey[32], uint32_t created_at, int kind,
+                      const char* tags, size_t tags_len, const char* content,
+                      size_t content_len, uint8_t id[32]);
+
+/* BIP-340 verification of 'sig' over the 32-byte message 'msg' (the event
+ * id) by the x-only public key 'pubkey'. Returns 1 if valid. */
+int nostrsig_verify(const uint8_t pubkey[32], const uint8_t msg[32],
+                    const uint8_t sig[64]);
+
+/* Verifies n signatures at once. Returns 1 only if all are valid; on 0 the
+ * caller checks them one by one to find the bad ones. Falls back to single
+ * verification if the scratch cannot be allocated. */
+int nostrsig_verify_batch(size_t n, const uint8_t* const pubkeys[],
+                          const uint8_t* const msgs[],
+                          const uint8_t* const sigs[]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NOSTRSIG_H */
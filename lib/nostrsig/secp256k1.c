@@ -0,0 +1,480 @@
+/*
+ * secp256k1.c
+ *
+ * Field, scalar and group arithmetic for BIP-340 verification, see
+ * secp256k1.h.
+ */
+
+#include "secp256k1.h"
+
+#include <string.h>
+
+/* p = 2^256 - SECP_P_C */
+#define SECP_P_C 0x1000003D1ull
+
+static const secp_fe fe_p = {{0xFFFFFC2Fu, 0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+                              0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu}};
+
+/* n and 2^256 - n */
+static const uint32_t sc_n[8] = {0xD0364141u, 0xBFD25E8Cu, 0xAF48A03Bu, 0xBAAEDCE6u,
+                                 0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu};
+static const uint32_t sc_c[5] = {0x2FC9BEBFu, 0x402DA173u, 0x50B75FC4u, 0x45512319u, 1u};
+
+/* j * 16^w * G for w = 0..63, j = 1..15, affine (61KB, in flash on ESP32). */
+#include "secp256k1_gtable.h"
+
+/* ------------------------------------------------------------------------- */
+/* 256-bit helpers */
+
+static int u256_cmp(const uint32_t* a, const uint32_t* b) {
+  int i;
+  for (i = 7; i >= 0; --i) {
+    if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+/* r = a - b, returns the borrow. */
+static uint32_t u256_sub(uint32_t* r, const uint32_t* a, const uint32_t* b) {
+  uint64_t borrow = 0;
+  int i;
+  for (i = 0; i < 8; ++i) {
+    const uint64_t d = (uint64_t)a[i] - b[i] - borrow;
+    r[i] = (uint32_t)d;
+    borrow = (d >> 32) & 1;
+  }
+  return (uint32_t)borrow;
+}
+
+static void u256_from_bytes(uint32_t* r, const uint8_t in[32]) {
+  int i;
+  for (i = 0; i < 8; ++i) {
+    const uint8_t* b = in + 28 - 4 * i;
+    r[i] = ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) |
+           ((uint32_t)b[2] << 8) | b[3];
+  }
+}
+
+/* ------------------------------------------------------------------------- */
+/* Field */
+
+/* Adds c * (2^256 - p) for a carry c out of the top limb. */
+static void fe_fold(secp_fe* r, uint64_t c) {
+  while (c) {
+    const uint64_t m = c * (SECP_P_C & 0xFFFFFFFFu);
+    uint64_t acc = (uint64_t)r->n[0] + (uint32_t)m;
+    int i;
+    r->n[0] = (uint32_t)acc;
+    acc = (acc >> 32) + r->n[1] + (m >> 32) + (uint32_t)c;
+    r->n[1] = (uint32_t)acc;
+    acc = (acc >> 32) + r->n[2] + (c >> 32);
+    r->n[2] = (uint32_t)acc;
+    acc >>= 32;
+    for (i = 3; i < 8; ++i) {
+      acc += r->n[i];
+      r->n[i] = (uint32_t)acc;
+      acc >>= 32;
+    }
+    c = acc;
+  }
+}
+
+void secp_fe_normalize(secp_fe* a) {
+  if (u256_cmp(a->n, fe_p.n) >= 0) u256_sub(a->n, a->n, fe_p.n);
+}
+
+static void fe_add(secp_fe* r, const secp_fe* a, const secp_fe* b) {
+  uint64_t acc = 0;
+  int i;
+  for (i = 0; i < 8; ++i) {
+    acc += (uint64_t)a->n[i] + b->n[i];
+    r->n[i] = (uint32_t)acc;
+    acc >>= 32;
+  }
+  fe_fold(r, acc);
+}
+
+static void fe_sub(secp_fe* r, const secp_fe* a, const secp_fe* b) {
+  /* A borrow means we computed a - b + 2^256; take 2^256 - p back off
+   * (twice at most, when a - b < -p). */
+  uint32_t borrow = u256_sub(r->n, a->n, b->n);
+  while (borrow) {
+    static const uint32_t c[8] = {(uint32_t)SECP_P_C, (uint32_t)(SECP_P_C >> 32)};
+    borrow = u256_sub(r->n, r->n, c);
+  }
+}
+
+static void fe_mul(secp_fe* r, const secp_fe* a, const secp_fe* b) {
+  uint32_t t[16];
+  uint64_t acc;
+  int i, j;
+  memset(t, 0, sizeof(t));
+  for (i = 0; i < 8; ++i) {
+    uint64_t c = 0;
+    for (j = 0; j < 8; ++j) {
+      const uint64_t uv = (uint64_t)a->n[i] * b->n[j] + t[i + j] + c;
+      t[i + j] = (uint32_t)uv;
+      c = uv >> 32;
+    }
+    t[i + 8] = (uint32_t)c;
+  }
+  /* t = h * 2^256 + l = l + h * 0x3D1 + (h << 32) mod p */
+  acc = 0;
+  for (i = 0; i < 8; ++i) {
+    acc += (uint64_t)t[i] + (uint64_t)t[i + 8] * 0x3D1u;
+    if (i > 0) acc += t[i + 7];
+    r->n[i] = (uint32_t)acc;
+    acc >>= 32;
+  }
+  fe_fold(r, acc + t[15]);
+}
+
+static void fe_sqr(secp_fe* r, const secp_fe* a) { fe_mul(r, a, a); }
+
+static void fe_sqr_n(secp_fe* r, const secp_fe* a, int n) {
+  *r = *a;
+  while (n--) fe_sqr(r, r);
+}
+
+static int fe_is_zero(const secp_fe* a) {
+  secp_fe t = *a;
+  int i;
+  secp_fe_normalize(&t);
+  for (i = 0; i < 8; ++i) {
+    if (t.n[i]) return 0;
+  }
+  return 1;
+}
+
+int secp_fe_equal(const secp_fe* a, const secp_fe* b) {
+  secp_fe t;
+  fe_sub(&t, a, b);
+  return fe_is_zero(&t);
+}
+
+static void fe_negate(secp_fe* r, const secp_fe* a) {
+  static const secp_fe zero = {{0}};
+  fe_sub(r, &zero, a);
+}
+
+/* a^(2^223 - 1) and the shorter runs of ones the exponents below need
+ * (the addition chain of libsecp256k1). */
+static void fe_pow_223(secp_fe* x223, secp_fe* x22, secp_fe* x2, secp_fe* x3,
+                       const secp_fe* a) {
+  secp_fe x6, x9, x11, x44, x88, x176, x220, t;
+  fe_sqr(x2, a);
+  fe_mul(x2, x2, a);
+  fe_sqr(x3, x2);
+  fe_mul(x3, x3, a);
+  fe_sqr_n(&t, x3, 3);
+  fe_mul(&x6, &t, x3);
+  fe_sqr_n(&t, &x6, 3);
+  fe_mul(&x9, &t, x3);
+  fe_sqr_n(&t, &x9, 2);
+  fe_mul(&x11, &t, x2);
+  fe_sqr_n(&t, &x11, 11);
+  fe_mul(x22, &t, &x11);
+  fe_sqr_n(&t, x22, 22);
+  fe_mul(&x44, &t, x22);
+  fe_sqr_n(&t, &x44, 44);
+  fe_mul(&x88, &t, &x44);
+  fe_sqr_n(&t, &x88, 88);
+  fe_mul(&x176, &t, &x88);
+  fe_sqr_n(&t, &x176, 44);
+  fe_mul(&x220, &t, &x44);
+  fe_sqr_n(&t, &x220, 3);
+  fe_mul(x223, &t, x3);
+}
+
+/* a^(p-2) */
+static void fe_inv(secp_fe* r, const secp_fe* a) {
+  secp_fe x223, x22, x2, x3, t;
+  fe_pow_223(&x223, &x22, &x2, &x3, a);
+  fe_sqr_n(&t, &x223, 23);
+  fe_mul(&t, &t, &x22);
+  fe_sqr_n(&t, &t, 5);
+  fe_mul(&t, &t, a);
+  fe_sqr_n(&t, &t, 3);
+  fe_mul(&t, &t, &x2);
+  fe_sqr_n(&t, &t, 2);
+  fe_mul(r, &t, a);
+}
+
+/* a^((p+1)/4); returns 0 if a has no square root. */
+static int fe_sqrt(secp_fe* r, const secp_fe* a) {
+  secp_fe x223, x22, x2, x3, t, check;
+  fe_pow_223(&x223, &x22, &x2, &x3, a);
+  fe_sqr_n(&t, &x223, 23);
+  fe_mul(&t, &t, &x22);
+  fe_sqr_n(&t, &t, 6);
+  fe_mul(&t, &t, &x2);
+  fe_sqr_n(r, &t, 2);
+  fe_sqr(&check, r);
+  return secp_fe_equal(&check, a);
+}
+
+int secp_fe_set_bytes(secp_fe* r, const uint8_t in[32]) {
+  u256_from_bytes(r->n, in);
+  return u256_cmp(r->n, fe_p.n) < 0;
+}
+
+void secp_fe_get_bytes(uint8_t out[32], const secp_fe* a) {
+  secp_fe t = *a;
+  int i;
+  secp_fe_normalize(&t);
+  for (i = 0; i < 8; ++i) {
+    uint8_t* b = out + 28 - 4 * i;
+    b[0] = (uint8_t)(t.n[i] >> 24);
+    b[1] = (uint8_t)(t.n[i] >> 16);
+    b[2] = (uint8_t)(t.n[i] >> 8);
+    b[3] = (uint8_t)t.n[i];
+  }
+}
+
+/* ------------------------------------------------------------------------- */
+/* Scalars */
+
+/* Reduces a 512-bit number mod n by folding the high half back in as
+ * h * (2^256 - n), which is 129 bits: three rounds bring it under 2^256. */
+static void sc_reduce(secp_sc* r, uint32_t t[16]) {
+  for (;;) {
+    uint32_t h[8];
+    int i, j, top = 0;
+    for (i = 8; i < 16; ++i) {
+      if (t[i]) top = 1;
+    }
+    if (!top) break;
+    memcpy(h, t + 8, sizeof(h));
+    memset(t + 8, 0, sizeof(h));
+    for (i = 0; i < 8; ++i) {
+      uint64_t c = 0;
+      if (!h[i]) continue;
+      for (j = 0; j < 5; ++j) {
+        const uint64_t uv = (uint64_t)h[i] * sc_c[j] + t[i + j] + c;
+        t[i + j] = (uint32_t)uv;
+        c = uv >> 32;
+      }
+      for (j = i + 5; c && j < 16; ++j) {
+        const uint64_t uv = (uint64_t)t[j] + c;
+        t[j] = (uint32_t)uv;
+        c = uv >> 32;
+      }
+    }
+  }
+  memcpy(r->n, t, sizeof(r->n));
+  while (u256_cmp(r->n, sc_n) >= 0) u256_sub(r->n, r->n, sc_n);
+}
+
+void secp_sc_set_bytes(secp_sc* r, const uint8_t in[32], int* overflow) {
+  u256_from_bytes(r->n, in);
+  if (overflow) *overflow = u256_cmp(r->n, sc_n) >= 0;
+  if (u256_cmp(r->n, sc_n) >= 0) u256_sub(r->n, r->n, sc_n);
+}
+
+void secp_sc_add(secp_sc* r, const secp_sc* a, const secp_sc* b) {
+  uint32_t t[16];
+  uint64_t acc = 0;
+  int i;
+  memset(t, 0, sizeof(t));
+  for (i = 0; i < 8; ++i) {
+    acc += (uint64_t)a->n[i] + b->n[i];
+    t[i] = (uint32_t)acc;
+    acc >>= 32;
+  }
+  t[8] = (uint32_t)acc;
+  sc_reduce(r, t);
+}
+
+void secp_sc_mul(secp_sc* r, const secp_sc* a, const secp_sc* b) {
+  uint32_t t[16];
+  int i, j;
+  memset(t, 0, sizeof(t));
+  for (i = 0; i < 8; ++i) {
+    uint64_t c = 0;
+    for (j = 0; j < 8; ++j) {
+      const uint64_t uv = (uint64_t)a->n[i] * b->n[j] + t[i + j] + c;
+      t[i + j] = (uint32_t)uv;
+      c = uv >> 32;
+    }
+    t[i + 8] = (uint32_t)c;
+  }
+  sc_reduce(r, t);
+}
+
+int secp_sc_is_zero(const secp_sc* a) {
+  int i;
+  for (i = 0; i < 8; ++i) {
+    if (a->n[i]) return 0;
+  }
+  return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+/* Group */
+
+int secp_ge_lift_x(secp_ge* r, const uint8_t x[32]) {
+  static const secp_fe seven = {{7}};
+  secp_fe c;
+  if (!secp_fe_set_bytes(&r->x, x)) return 0;
+  fe_sqr(&c, &r->x);
+  fe_mul(&c, &c, &r->x);
+  fe_add(&c, &c, &seven);
+  if (!fe_sqrt(&r->y, &c)) return 0;
+  secp_fe_normalize(&r->y);
+  if (r->y.n[0] & 1) fe_negate(&r->y, &r->y);
+  return 1;
+}
+
+void secp_ge_negate(secp_ge* r, const secp_ge* a) {
+  r->x = a->x;
+  fe_negate(&r->y, &a->y);
+}
+
+int secp_gej_to_ge(secp_ge* r, const secp_gej* a) {
+  secp_fe zi, zi2;
+  if (a->inf) return 0;
+  fe_inv(&zi, &a->z);
+  fe_sqr(&zi2, &zi);
+  fe_mul(&r->x, &a->x, &zi2);
+  fe_mul(&zi2, &zi2, &zi);
+  fe_mul(&r->y, &a->y, &zi2);
+  secp_fe_normalize(&r->x);
+  secp_fe_normalize(&r->y);
+  return 1;
+}
+
+static void gej_set_ge(secp_gej* r, const secp_ge* a) {
+  static const secp_fe one = {{1}};
+  r->x = a->x;
+  r->y = a->y;
+  r->z = one;
+  r->inf = 0;
+}
+
+/* r = 2a (a = 0 curve: S = 4xy^2, M = 3x^2) */
+static void gej_double(secp_gej* r, const secp_gej* a) {
+  secp_fe y2, s, m, t;
+  if (a->inf) {
+    r->inf = 1;
+    return;
+  }
+  fe_sqr(&y2, &a->y);
+  fe_mul(&s, &a->x, &y2);
+  fe_add(&s, &s, &s);
+  fe_add(&s, &s, &s);
+  fe_sqr(&m, &a->x);
+  fe_add(&t, &m, &m);
+  fe_add(&m, &m, &t);
+  fe_mul(&r->z, &a->y, &a->z);
+  fe_add(&r->z, &r->z, &r->z);
+  fe_sqr(&t, &m);
+  fe_sub(&t, &t, &s);
+  fe_sub(&r->x, &t, &s);
+  fe_sub(&t, &s, &r->x);
+  fe_mul(&t, &m, &t);
+  fe_sqr(&y2, &y2);
+  fe_add(&y2, &y2, &y2);
+  fe_add(&y2, &y2, &y2);
+  fe_add(&y2, &y2, &y2);
+  fe_sub(&r->y, &t, &y2);
+  r->inf = 0;
+}
+
+/* r = a + b, with u1/s1 = a's x/y over b's z and u2/s2 the other way round.
+ * Shared tail of the Jacobian and mixed additions. */
+static void gej_add_tail(secp_gej* r, const secp_gej* a, const secp_fe* u1,
+                         const secp_fe* u2, const secp_fe* s1,
+                         const secp_fe* s2, const secp_fe* z) {
+  secp_fe h, rr, h2, h3, v, t;
+  fe_sub(&h, u2, u1);
+  fe_sub(&rr, s2, s1);
+  if (fe_is_zero(&h)) {
+    if (fe_is_zero(&rr)) {
+      gej_double(r, a);
+    } else {
+      r->inf = 1;
+    }
+    return;
+  }
+  fe_sqr(&h2, &h);
+  fe_mul(&h3, &h2, &h);
+  fe_mul(&v, u1, &h2);
+  fe_mul(&r->z, z, &h);
+  fe_sqr(&t, &rr);
+  fe_sub(&t, &t, &h3);
+  fe_sub(&t, &t, &v);
+  fe_sub(&r->x, &t, &v);
+  fe_sub(&t, &v, &r->x);
+  fe_mul(&t, &rr, &t);
+  fe_mul(&h3, s1, &h3);
+  fe_sub(&r->y, &t, &h3);
+  r->inf = 0;
+}
+
+static void gej_add(secp_gej* r, const secp_gej* a, const secp_gej* b) {
+  secp_fe z1z1, z2z2, u1, u2, s1, s2, z;
+  if (a->inf) {
+    *r = *b;
+    return;
+  }
+  if (b->inf) {
+    *r = *a;
+    return;
+  }
+  fe_sqr(&z1z1, &a->z);
+  fe_sqr(&z2z2, &b->z);
+  fe_mul(&u1, &a->x, &z2z2);
+  fe_mul(&u2, &b->x, &z1z1);
+  fe_mul(&s1, &a->y, &z2z2);
+  fe_mul(&s1, &s1, &b->z);
+  fe_mul(&s2, &b->y, &z1z1);
+  fe_mul(&s2, &s2, &a->z);
+  fe_mul(&z, &a->z, &b->z);
+  gej_add_tail(r, a, &u1, &u2, &s1, &s2, &z);
+}
+
+/* r = a + b with b affine */
+static void gej_add_ge(secp_gej* r, const secp_gej* a, const secp_ge* b) {
+  secp_fe z1z1, u2, s2, z;
+  if (a->inf) {
+    gej_set_ge(r, b);
+    return;
+  }
+  fe_sqr(&z1z1, &a->z);
+  fe_mul(&u2, &b->x, &z1z1);
+  fe_mul(&s2, &b->y, &z1z1);
+  fe_mul(&s2, &s2, &a->z);
+  z = a->z;
+  gej_add_tail(r, a, &a->x, &u2, &a->y, &s2, &z);
+}
+
+static int sc_digit(const secp_sc* k, int w) {
+  return (int)((k->n[w >> 3] >> ((w & 7) * 4)) & 15);
+}
+
+/* Strauss: the variable points share one chain of doublings, 4-bit windows,
+ * and the generator part is one table lookup per window with no doublings. */
+void secp_ecmult(secp_gej* r, const secp_sc* g, size_t n, const secp_ge* p,
+                 const secp_sc* k, secp_gej* table) {
+  size_t i;
+  int w, j;
+  for (i = 0; i < n; ++i) {
+    secp_gej* t = table + i * SECP_WINDOW_SIZE;
+    gej_set_ge(&t[0], &p[i]);
+    for (j = 1; j < SECP_WINDOW_SIZE; ++j) gej_add_ge(&t[j], &t[j - 1], &p[i]);
+  }
+  r->inf = 1;
+  for (w = 63; w >= 0; --w) {
+    for (j = 0; j < 4; ++j) gej_double(r, r);
+    for (i = 0; i < n; ++i) {
+      const int d = sc_digit(&k[i], w);
+      if (d) gej_add(r, r, &table[i * SECP_WINDOW_SIZE + d - 1]);
+    }
+  }
+  if (g) {
+    for (w = 0; w < 64; ++w) {
+      const int d = sc_digit(g, w);
+      if (d) gej_add_ge(r, r, &secp_gtable[w][d - 1]);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+/*
+ * secp256k1.h
+ *
+ * The parts of secp256k1 that BIP-340 verification needs: field and scalar
+ * arithmetic, point decompression and a multi-scalar multiplication with a
+ * precomputed generator table. Internal to nostrsig.
+ *
+ * Numbers are eight 32-bit limbs, least significant first, so every product
+ * fits in a uint64_t on the ESP32 (which has 32x32->64 multiplies but no
+ * wider ones). Nothing here is constant time: verification only handles
+ * public data.
+ */
+
+#ifndef NOSTRSIG_SECP256K1_H
+#define NOSTRSIG_SECP256K1_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Field element mod p. Kept below 2^256 but not necessarily below p;
+ * secp_fe_normalize() makes it canonical. */
+typedef struct {
+  uint32_t n[8];
+} secp_fe;
+
+/* Scalar mod n, always fully reduced. */
+typedef struct {
+  uint32_t n[8];
+} secp_sc;
+
+/* Affine point. */
+typedef struct {
+  secp_fe x, y;
+} secp_ge;
+
+/* Jacobian point (x/z^2, y/z^3). */
+typedef struct {
+  secp_fe x, y, z;
+  int inf;
+} secp_gej;
+
+/* Window width of the multiplications: one table entry per 4-bit digit. */
+#define SECP_WINDOW_SIZE 15
+
+/* Big-endian bytes to a field element. Returns 0 if the value is >= p. */
+int secp_fe_set_bytes(secp_fe* r, const uint8_t in[32]);
+void secp_fe_get_bytes(uint8_t out[32], const secp_fe* a);
+void secp_fe_normalize(secp_fe* a);
+int secp_fe_equal(const secp_fe* a, const secp_fe* b);
+
+/* Big-endian bytes to a scalar, reduced mod n. '*overflow' (if given) is
+ * set when the input was >= n. */
+void secp_sc_set_bytes(secp_sc* r, const uint8_t in[32], int* overflow);
+void secp_sc_add(secp_sc* r, const secp_sc* a, const secp_sc* b);
+void secp_sc_mul(secp_sc* r, const secp_sc* a, const secp_sc* b);
+int secp_sc_is_zero(const secp_sc* a);
+
+/* The point with x coordinate 'x' and an even y (BIP-340 lift_x). Returns
+ * 0 if x >= p or x is not on the curve. */
+int secp_ge_lift_x(secp_ge* r, const uint8_t x[32]);
+void secp_ge_negate(secp_ge* r, const secp_ge* a);
+/* Returns 0 for the point at infinity. */
+int secp_gej_to_ge(secp_ge* r, const secp_gej* a);
+
+/* r = g*G + sum(k[i]*p[i]). 'table' holds SECP_WINDOW_SIZE * n entries. */
+void secp_ecmult(secp_gej* r, const secp_sc* g, size_t n, const secp_ge* p,
+                 const secp_sc* k, secp_gej* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NOSTRSIG_SECP256K1_H */
@@ -0,0 +1,1091 @@
+/* Generated by gen_gtable.py, do not edit. */
+static const secp_ge secp_gtable[64][SECP_WINDOW_SIZE] = {
+  { /* 16^0 */
+    {{{0x16F81798u, 0x59F2815Bu, 0x2DCE28D9u, 0x029BFCDBu, 0xCE870B07u, 0x55A06295u, 0xF9DCBBACu, 0x79BE667Eu}}, {{0xFB10D4B8u, 0x9C47D08Fu, 0xA6855419u, 0xFD17B448u, 0x0E1108A8u, 0x5DA4FBFCu, 0x26A3C465u, 0x483ADA77u}}},
+    {{{0x5C709EE5u, 0xABAC09B9u, 0x8CEF3CA7u, 0x5C778E4Bu, 0x95C07CD8u, 0x3045406Eu, 0x41ED7D6Du, 0xC6047F94u}}, {{0x50CFE52Au, 0x236431A9u, 0x3266D0E1u, 0xF7F63265u, 0x466CEAEEu, 0xA3C58419u, 0xA63DC339u, 0x1AE168FEu}}},
+    {{{0xBCE036F9u, 0x8601F113u, 0x836F99B0u, 0xB531C845u, 0xF89D5229u, 0x49344F85u, 0x9258C310u, 0xF9308A01u}}, {{0x84B8E672u, 0x6CB9FD75u, 0x34C2231Bu, 0x6500A999u, 0x2A37F356u, 0x0FE337E6u, 0x632DE814u, 0x388F7B0Fu}}},
+    {{{0xE8C4CD13u, 0x74FA94ABu, 0x0EE07584u, 0xCC6C1390u, 0x930B1404u, 0x581E4904u, 0xC10D80F3u, 0xE493DBF1u}}, {{0x47739922u, 0xCFE97BDCu, 0xBFBDFE40u, 0xD967AE33u, 0x8EA51448u, 0x5642E209u, 0xA0D455B7u, 0x51ED993Eu}}},
+    {{{0xB240EFE4u, 0xCBA8D569u, 0xDC619AB7u, 0xE88B84BDu, 0x0A5C5128u, 0x55B4A725u, 0x1A072093u, 0x2F8BDE4Du}}, {{0xA6AC62D6u, 0xDCA87D3Au, 0xAB0D6840u, 0xF788271Bu, 0xA6C9C426u, 0xD4DBA9DDu, 0x36E5E3D6u, 0xD8AC2226u}}},
+    {{{0x60297556u, 0x2F057A14u, 0x8568A18Bu, 0x82F6472Fu, 0x355235D3u, 0x20453A14u, 0x755EEEA4u, 0xFFF97BD5u}}, {{0xB075F297u, 0x3C870C36u, 0x518FE4A0u, 0xDE80F0F6u, 0x7F45C560u, 0xF3BE9601u, 0xACFBB620u, 0xAE12777Au}}},
+    {{{0xCAC4F9BCu, 0xE92BDDEDu, 0x0330E39Cu, 0x3D419B7Eu, 0xF2EA7A0Eu, 0xA398F365u, 0x6E5DB4EAu, 0x5CBDF064u}}, {{0x087264DAu, 0xA5082628u, 0x13FDE7B5u, 0xA813D0B8u, 0x861A54DBu, 0xA3178D6Du, 0xBA255960u, 0x6AEBCA40u}}},
+    {{{0xE10A2A01u, 0x67784EF3u, 0xE5AF888Au, 0x0A1BDD05u, 0xB70F3C2Fu, 0xAFF3843Fu, 0x5CCA351Du, 0x2F01E5E1u}}, {{0x6CBDE904u, 0xB5DA2CB7u, 0xBA5B7617u, 0xC2E213D6u, 0x132D13B4u, 0x293D082Au, 0x41539949u, 0x5C4DA8A7u}}},
+    {{{0xFC27CCBEu, 0xC35F110Du, 0x4C57E714u, 0xE0979697u, 0x9F559ABDu, 0x09AD178Au, 0xF0C7F653u, 0xACD484E2u}}, {{0xC64F9C37u, 0x05CC262Au, 0x375F8E0Fu, 0xADD888A4u, 0x763B61E9u, 0x64380971u, 0xB0A7D9FDu, 0xCC338921u}}},
+    {{{0x47E247C7u, 0x52A68E2Au, 0x1943C2B7u, 0x3442D49Bu, 0x1AE6AE5Du, 0x35477C7Bu, 0x47F3C862u, 0xA0434D9Eu}}, {{0x037368D7u, 0x3CBEE53Bu, 0xD877A159u, 0x6F794C2Eu, 0x93A24C69u, 0xA3B6C7E6u, 0x5419BC27u, 0x893ABA42u}}},
+    {{{0x5DA008CBu, 0xBBEC1789u, 0xE5C17891u, 0x5649980Bu, 0x70C65AACu, 0x5EF4246Bu, 0x58A9411Eu, 0x774AE7F8u}}, {{0xC953C61Bu, 0x301D74C9u, 0xDFF9D6A8u, 0x372DB1E2u, 0xD7B7B365u, 0x0243DD56u, 0xEB6B5E19u, 0xD984A032u}}},
+    {{{0x70AFE85Au, 0xC5B0F470u, 0x9620095Bu, 0x687CF441u, 0x4D734633u, 0x15C38F00u, 0x48E7561Bu, 0xD01115D5u}}, {{0xF4062327u, 0x6B051B13u, 0xD9A86D52u, 0x79238C5Du, 0xE17BD815u, 0xA8B64537u, 0xC815E0D7u, 0xA9F34FFDu}}},
+    {{{0x19405AA8u, 0xDEEDDF8Fu, 0x610E58CDu, 0xB075FBC6u, 0xC3748651u, 0xC7D1D205u, 0xD975288Bu, 0xF28773C2u}}, {{0xDB03ED81u, 0x29B5CB52u, 0x521FA91Fu, 0x3A1A06DAu, 0x65CDAF47u, 0x758212EBu, 0x8D880A89u, 0x0AB0902Eu}}},
+    {{{0x60E823E4u, 0xE49B241Au, 0x678949E6u, 0x26AA7B63u, 0x07D38E32u, 0xFD64E67Fu, 0x895E719Cu, 0x499FDF9Eu}}, {{0x03A13F5Bu, 0xC65F40D4u, 0x7A3F95BCu, 0x464279C2u, 0xA7B3D464u, 0x90F044E4u, 0xB54E8551u, 0xCAC2F6C4u}}},
+    {{{0xE27E080Eu, 0x44ADBCF8u, 0x3C85F79Eu, 0x31E5946Fu, 0x095FF411u, 0x5A465AE3u, 0x7D43EA96u, 0xD7924D4Fu}}, {{0xF6A26B58u, 0xC504DC9Fu, 0xD896D3A5u, 0xEA40AF2Bu, 0x28CC6DEFu, 0x83842EC2u, 0xA86C72A6u, 0x581E2872u}}},
+  },
+  { /* 16^1 */
+    {{{0x2A6DEC0Au, 0xC44EE89Eu, 0xB87A5AE9u, 0xB2A31369u, 0x21C23E97u, 0x3011AABCu, 0xB59E9EC5u, 0xE60FCE93u}}, {{0x69616821u, 0xE1F32CCEu, 0x44D23F0Bu, 0x1296891Eu, 0xF5793710u, 0x9DB99F34u, 0x99E59592u, 0xF7E35073u}}},
+    {{{0x07143E65u, 0x75D0DBD4u, 0x9904A61Du, 0xDACFFCB8u, 0xE2F378CEu, 0x47B6E054u, 0x4FB5A22Du, 0xD30199D7u}}, {{0x24106AB9u, 0x05B3FF1Fu, 0x64ED8196u, 0x1F760CC3u, 0xE9838065u, 0xB3D6DEC9u, 0x0AE3D5C3u, 0x95038D9Du}}},
+    {{{0x1118E5C3u, 0x9BD870AAu, 0x452BEBC1u, 0xFC579B27u, 0xF4E65B4Bu, 0xB441656Eu, 0x9645307Du, 0x6ECA335Du}}, {{0x05A08668u, 0x498A2F78u, 0x3BF8EC34u, 0x3A496A3Au, 0x74B875A0u, 0x592F5790u, 0x7A7A0710u, 0xD50123B5u}}},
+    {{{0xF874EF8Bu, 0xE37918E6u, 0xCDBAFD81u, 0xFC4C6F1Du, 0xF832823Cu, 0x0B1051EAu, 0x2D16EAB7u, 0xBF23C154u}}, {{0x66831D9Fu, 0x4DC37EFEu, 0x811E2F78u, 0xC522FC54u, 0xBA5392E4u, 0x7AD928A0u, 0xC3300373u, 0x5CB3866Fu}}},
+    {{{0x4F87F62Eu, 0x0ECD31E1u, 0x63716127u, 0x10E6E638u, 0xD34659F0u, 0x0D7C744Eu, 0xF1BF90ECu, 0xE9623BBEu}}, {{0xA44EE737u, 0x53013EAFu, 0xDD68844Eu, 0xFE6043C9u, 0x8EDAA929u, 0xE0FE953Au, 0x4BC299E9u, 0x38A9743Bu}}},
+    {{{0x7F8CB0E3u, 0x43933ACAu, 0xE1EFE3A4u, 0xA22EB53Fu, 0x4B2EB72Eu, 0x8FA64E04u, 0x74456D8Fu, 0x3F0E80E5u}}, {{0xEA5F404Fu, 0xCB0289E2u, 0xA65B53A4u, 0x9501253Au, 0x485D01B3u, 0xE90B9C08u, 0x296CBC91u, 0xCB66D7D7u}}},
+    {{{0x2A8D733Cu, 0xEB0AADF8u, 0x62FCA8F9u, 0xFFC274BFu, 0x2080D682u, 0x0884A36Fu, 0xE5161DBAu, 0xBC82DD73u}}, {{0xF47797F0u, 0x1E786104u, 0xE7389730u, 0xAE93A0BAu, 0x719F02DFu, 0x54A9B4BFu, 0x044B1CACu, 0xE5F28C3Au}}},
+    {{{0x6769A24Eu, 0x64707745u, 0x00535655u, 0xBCF55CD7u, 0xF7D1671Cu, 0x696C3D09u, 0x033F7A06u, 0x34FF3BE4u}}, {{0x73CC2F1Au, 0x8491067Au, 0xE8F8B681u, 0x55DF16C3u, 0x9832098Cu, 0x3F6619D8u, 0x3A236C55u, 0x5D9D1162u}}},
+    {{{0x5FBC7671u, 0xD7EFE231u, 0x52858E32u, 0x743F1BC8u, 0x1798F490u, 0xD20291CEu, 0xC7657211u, 0x8E3D1248u}}, {{0x18717DECu, 0x7EF1DC64u, 0xA63E144Au, 0xB9352BAAu, 0x9393E90Eu, 0xF64480E1u, 0x0ECFCB81u, 0x099A48E1u}}},
+    {{{0x51B03F6Cu, 0x05EC32ADu, 0x2A9B184Bu, 0xA4D04712u, 0x8F73F576u, 0x2BC77683u, 0x7A52D922u, 0x308913A2u}}, {{0xE8FE4C67u, 0x60AB5EFCu, 0x82BD1F12u, 0xA8333FEAu, 0x66C0375Du, 0x91E3531Fu, 0x43FEBE5Fu, 0xF4A5B095u}}},
+    {{{0xBEB31DB2u, 0xF3287432u, 0x88F506A0u, 0x8FCAE827u, 0xD088A2B6u, 0x896A193Eu, 0x2234A498u, 0x78A891AAu}}, {{0xB9FA4343u, 0x3069D623u, 0xD800B82Du, 0x54379BCDu, 0x27302DF6u, 0xFCF5F255u, 0xEB5035CBu, 0x6912A35Bu}}},
+    {{{0x33CE1752u, 0xC7B750F7u, 0xD7CD204Eu, 0xE783C797u, 0xD99C9AEAu, 0x812DDF64u, 0xD01DC635u, 0xD7A0DA58u}}, {{0x0762CEF4u, 0xBBC02738u, 0xC062B742u, 0x0BE040A8u, 0x40E28465u, 0xF6F29283u, 0x68008032u, 0x912770E0u}}},
+    {{{0x8DB0E595u, 0x65348F77u, 0xFBA082BBu, 0xA7163CB9u, 0x816076EBu, 0xD7CE3765u, 0x55DB1B17u, 0x7D867818u}}, {{0xBC733DE8u, 0x99951E3Au, 0x0E25D532u, 0x2937844Eu, 0xED4F8838u, 0x2E562E2Bu, 0xEC86F877u, 0xE2B99ADFu}}},
+    {{{0x6CE6B514u, 0x609C4570u, 0x9B357322u, 0x890905C7u, 0x00844D49u, 0x8885C356u, 0xF919ED15u, 0x08BC89C2u}}, {{0xA8C95157u, 0x6F63F4CEu, 0x112776F0u, 0x172D3056u, 0x3B5892C1u, 0xDE776FECu, 0xD7CDCC16u, 0xD313F3CDu}}},
+    {{{0x16060DFCu, 0x008FEF85u, 0x205E6A2Au, 0x76545F84u, 0xC41AB086u, 0x48494B9Du, 0x00582AC8u, 0xDDC5310Fu}}, {{0xE7820CA8u, 0xFB5F8AB6u, 0xABD04730u, 0x41DBAFC6u, 0xCC8F0E90u, 0x0191AB6Du, 0xF20D9692u, 0xBA0D2F3Au}}},
+  },
+  { /* 16^2 */
+    {{{0xD5F51508u, 0x0646E23Fu, 0xD5AC1CA1u, 0xD8C39CABu, 0x172DE238u, 0xEA2A6E3Eu, 0x12C609D9u, 0x82822632u}}, {{0xF6E26CAFu, 0xD31B6EAFu, 0x2F7B17BEu, 0x62D613ACu, 0x30B60ACEu, 0x5E8256E8u, 0x8557DFE4u, 0x11F8A809u}}},
+    {{{0xEF34A24Du, 0x926E2C00u, 0xD9E159D0u, 0x0ADBC968u, 0x9CF918D5u, 0x905A857Au, 0x87A79FF3u, 0x465370B2u}}, {{0xB33887F4u, 0xA2F8FB20u, 0x15D37A10u, 0x588E09B2u, 0xFDEEC2C1u, 0xA4AF8BDAu, 0x8368C082u, 0x35E531B3u}}},
+    {{{0xE57E8DFAu, 0xFCFC0CB9u, 0xA3C7E184u, 0x09809191u, 0xACA98CA0u, 0x0D9A30F8u, 0xF0799C4Cu, 0x8262CF2Fu}}, {{0xFBAC376Au, 0x35CFF8D8u, 0x2B14C478u, 0x57B6ED33u, 0xC5B34F34u, 0x66FEE22Eu, 0x09109E4Eu, 0x83FD95E2u}}},
+    {{{0xE285131Fu, 0xD5B901B2u, 0xC813B088u, 0xAAEC6ECDu, 0x66AD6240u, 0xD664A18Fu, 0xE23CBD77u, 0x241FEBB8u}}, {{0x2750026Du, 0xABB3E66Fu, 0xBD0CB5AFu, 0xCD50FD0Fu, 0x13981DF8u, 0xD6C420BDu, 0xFF94F8D3u, 0x513378D9u}}},
+    {{{0x026BDB6Fu, 0x9052E48Bu, 0x7B734B94u, 0x7CA41BD4u, 0x4CE99C87u, 0x168105B2u, 0x1DA0DDD5u, 0x19825C8Bu}}, {{0xC49CFC9Bu, 0xB5DF7084u, 0x8CF6D3A6u, 0xEBE9EECCu, 0x94F59F6Cu, 0x320261CCu, 0x0D4C878Fu, 0x6294310Fu}}},
+    {{{0x7C70620Cu, 0xD17CC1F2u, 0xABC288D9u, 0x4998C4BEu, 0x2B671780u, 0xC60DD31Au, 0x8D2C236Du, 0x1653A8A4u}}, {{0x315B32CDu, 0x6CA2E81Du, 0xDFD3DC52u, 0x012AF748u, 0x4EFA701Cu, 0xEAFA9947u, 0x35AF7F7Au, 0x03382909u}}},
+    {{{0x3D82824Cu, 0x50ED0952u, 0x5E1534E6u, 0xDFA58E34u, 0xC6C2999Eu, 0x43C5F56Eu, 0x11601914u, 0x6F12D86Cu}}, {{0x06EB34D0u, 0x8579C348u, 0x0854BC5Bu, 0x391C9241u, 0xFD623769u, 0x875994F3u, 0x4AB3BFA0u, 0x5C4FF7F4u}}},
+    {{{0x9B920471u, 0xEDCB6306u, 0xF423DE0Du, 0xFC318B85u, 0x83D8F8D9u, 0xFCE4CC29u, 0xA172FA79u, 0x5D1BDB4Eu}}, {{0xF7B83103u, 0x70330666u, 0x96C56E7Bu, 0x79EB1E99u, 0x38A22656u, 0x794BB994u, 0x79379E2Eu, 0x28438267u}}},
+    {{{0xDB453629u, 0x076DDC02u, 0x0F59E603u, 0x45CFDCDCu, 0xA23ABEF6u, 0x14262716u, 0x9A0AAA5Du, 0x203A8C6Fu}}, {{0x3FF89F84u, 0x5971C785u, 0xC5285ED4u, 0x686DEB25u, 0x5F410612u, 0x36CC76D1u, 0xDE5DD9B9u, 0x3B0F0B53u}}},
+    {{{0xB147F3D6u, 0xB9446557u, 0x7AB8CB45u, 0x55319921u, 0x24655103u, 0x19E6A363u, 0xC294B1E1u, 0x474A4732u}}, {{0x28628BA4u, 0xDCEE8528u, 0x010E1300u, 0x11FA7F17u, 0xC3A48AA3u, 0xED2CC30Cu, 0x1206F04Eu, 0x94625E23u}}},
+    {{{0xE46C7ECBu, 0x783130DDu, 0xE5BB4CE9u, 0x9D3AED3Fu, 0x4866E1ECu, 0xC81EF733u, 0x3D034181u, 0x6E2ACAEBu}}, {{0xEEBC8720u, 0x8449201Eu, 0x1B67512Cu, 0xFAC706B9u, 0xF0FB643Au, 0x9D80C4DAu, 0x97EFEE14u, 0x9E61A467u}}},
+    {{{0xE71DABCDu, 0x47D42BA6u, 0x89E5CB4Fu, 0x54D3FE49u, 0x60B5373Fu, 0x6098AE32u, 0x6B63F43Cu, 0xD49EE4FBu}}, {{0x016603C2u, 0xE66A90CFu, 0x12FF7031u, 0x129C5093u, 0xA61BF356u, 0xD7C87EA7u, 0x09A5490Du, 0x0531E392u}}},
+    {{{0xF0A4147Eu, 0xEB7018F3u, 0xF775F201u, 0x2747DD8Bu, 0x8A490A58u, 0xAF61717Eu, 0xE9E9156Bu, 0xD5A70492u}}, {{0x33FB65FFu, 0x8E4B3CB8u, 0x7967F57Fu, 0xF4C4D984u, 0x765E0532u, 0xFC490990u, 0xDBAB89C6u, 0x9DB526F5u}}},
+    {{{0xB43841C6u, 0x63DA8F68u, 0xD343EFBDu, 0x12AA3CC0u, 0xDCEBF4C2u, 0x49BB6B52u, 0x03DF0899u, 0x6CC1109Eu}}, {{0xB954E94Du, 0xB9733A46u, 0x2D906CF5u, 0xD79B433Eu, 0x0A29FFECu, 0x0FFD3D6Bu, 0x9C094B76u, 0xAF561AFEu}}},
+    {{{0xD8EDCEC6u, 0x4EDDB46Bu, 0xD3634F45u, 0xA1061CC2u, 0x302CDAC6u, 0x0523EFC6u, 0xABE18BA8u, 0x38C5119Au}}, {{0x1933DB08u, 0x456E0BFBu, 0x2B5530A6u, 0x28A16C82u, 0x275F282Fu, 0x668CB2DAu, 0x85D9732Au, 0xE649DD22u}}},
+  },
+  { /* 16^3 */
+    {{{0x51E5B739u, 0x73FCE5B5u, 0xFD2222EDu, 0xE0B93833u, 0xC6FC846Du, 0x72F99CC6u, 0x728B865Au, 0x175E159Fu}}, {{0xE9FED695u, 0x6EFA6FFEu, 0xDD24345Cu, 0xACB5955Au, 0x1FF71F5Eu, 0xA4EF97A5u, 0x9E3C79EBu, 0xD3506E0Du}}},
+    {{{0x46BC47D6u, 0xCE78049Eu, 0xC6DA121Bu, 0x30FDFEB5u, 0xE139C621u, 0xA5FFBCC8u, 0x03FF32D7u, 0x423A013Fu}}, {{0x8B548A34u, 0xD1236E6Du, 0x524F009Eu, 0x720D8EC3u, 0xBAF6B3C7u, 0xA1179F7Bu, 0xE1E1D970u, 0xB91AE00Fu}}},
+    {{{0xC5041216u, 0x65B7F8F1u, 0x842B836Au, 0x3F7335F6u, 0xDC2FED52u, 0x128B59EFu, 0x21F7ACF4u, 0xDA75317Bu}}, {{0x6E708572u, 0xDAED3298u, 0xE77ACEDAu, 0xE9AAC07Au, 0x342D7FC6u, 0xDF19E21Bu, 0xBF72D5F0u, 0x73F8A046u}}},
+    {{{0x8416824Au, 0x302DF6F7u, 0x3B3E2741u, 0x49DF662Fu, 0xBCD68776u, 0x08907A7Au, 0xAC1FB905u, 0x111D6A45u}}, {{0x2108E9D0u, 0xA9A111D4u, 0x96DACA4Cu, 0xF0700089u, 0xFF065952u, 0xB90D48DBu, 0x478EAFFBu, 0x0696911Cu}}},
+    {{{0xE465A930u, 0xB0143E71u, 0x6B1352FDu, 0x2587F1C1u, 0x4A82EB1Eu, 0x0573C58Cu, 0x8E9749D7u, 0x1C71C5B4u}}, {{0xC34638B5u, 0x1D873F6Cu, 0xB7174D47u, 0x79345E3Fu, 0x824BB68Cu, 0x2713F1F2u, 0xE8F5FA0Cu, 0x4A91C334u}}},
+    {{{0x3C62BAC0u, 0x9505324Fu, 0x51F0AB06u, 0x19150DDFu, 0xC3E8B70Eu, 0x1364B7D2u, 0x023F469Cu, 0x9530F0F9u}}, {{0x7618E309u, 0x478ABDA9u, 0x2F1FDC68u, 0xE25B3285u, 0x59B333E0u, 0x34DD2F7Fu, 0x8F9F21E2u, 0x8F3C305Au}}},
+    {{{0xBADB6EE7u, 0xE318DAE5u, 0x2744A077u, 0x7850DD43u, 0x909B4C9Cu, 0x936E837Au, 0x1F31A566u, 0xD84E4AFCu}}, {{0xD42EBED2u, 0x82D556E6u, 0x4AA3E649u, 0xFDD8AC97u, 0xF565DE4Du, 0x12A38D58u, 0x7C7B79CEu, 0xE525809Au}}},
+    {{{0x1BCED775u, 0xAB5EDDE0u, 0x5EF74E56u, 0x7290B68Au, 0xBCB9DCFFu, 0xAD795DBEu, 0x7AC7C8B8u, 0x4A4A6DC9u}}, {{0xA78DD66Du, 0xB2BF8F68u, 0x424742ACu, 0x1DE90CDBu, 0x39C0F457u, 0x943EF9F7u, 0x16631E72u, 0x529911B0u}}},
+    {{{0xA49E6D10u, 0x394E9ECFu, 0xAEAC99D2u, 0xF60ADFF3u, 0x85FF6ED3u, 0x41B22B92u, 0xDE66814Du, 0xF3D4444Bu}}, {{0x5347DA3Fu, 0x0A038CC0u, 0xCE9D6C63u, 0xFC1ADA50u, 0x198A4B5Bu, 0x4BAB95ACu, 0xA6F0163Du, 0x0A4324DFu}}},
+    {{{0xA547B4B3u, 0xF5E91B77u, 0xFD665411u, 0x356929D1u, 0xE099522Cu, 0x1DF82EFEu, 0x1D8E4F75u, 0xF006C42Fu}}, {{0xA86AA74Bu, 0xB5EF449Fu, 0xD6BE7AE1u, 0x75C933EEu, 0x4E4F7D16u, 0x5C47848Au, 0xA666520Au, 0xF68154D4u}}},
+    {{{0xE9D33A07u, 0x48CB3406u, 0xAA39BCABu, 0x4E72EE08u, 0xCDBDF404u, 0xF9085520u, 0x9D9C1D89u, 0xAE30652Cu}}, {{0x60A0B2A6u, 0x74870C0Fu, 0xDFD7E95Cu, 0x1C9C37F5u, 0x3DB8D5CFu, 0xEFCCE7D3u, 0x8D63FE57u, 0x6CB9D9C3u}}},
+    {{{0xDC3C9C8Fu, 0x06704385u, 0x3E4367B2u, 0xF2816FEEu, 0xAAA332B0u, 0x6F09FF43u, 0xBE4298FDu, 0x67BE02DCu}}, {{0x593652D9u, 0x55384998u, 0x0B88C2BEu, 0xCD993BF6u, 0x08291693u, 0xA2C945B6u, 0x3E4DEF84u, 0x7A9B55A7u}}},
+    {{{0x0C28CACAu, 0x759654B9u, 0xCC8281DAu, 0x1869C7BBu, 0x83388C9Au, 0x15E17E75u, 0x5BD5E1C8u, 0xD8DC1B2Au}}, {{0x23B3EC7Au, 0xCDB676EAu, 0xEC8128F6u, 0x7D315D2Cu, 0x20247D94u, 0x8C6D8DA4u, 0x27CEC7D5u, 0x8CEC0AD9u}}},
+    {{{0x518B01B5u, 0xC5C2F974u, 0x8710BADAu, 0xDDCCC88Bu, 0x352405B1u, 0xC1A50C45u, 0x403DE885u, 0x0E69B346u}}, {{0x78D965C5u, 0x418EE368u, 0x3D00683Eu, 0xCEDF595Fu, 0xB7D7DD37u, 0x61DED70Au, 0xFCD7E452u, 0x0B4EFAC5u}}},
+    {{{0x3BC4416Fu, 0x8921FB66u, 0xF30B0402u, 0xA7AEFD23u, 0xD032F31Du, 0xD59425A8u, 0xC5F84ECCu, 0x2749E292u}}, {{0xFC6BBD8Eu, 0x7E98BDE2u, 0x5EE96105u, 0xF59E9FB6u, 0x0FCADB3Eu, 0x403D9499u, 0x37672BC4u, 0x50CC2D4Eu}}},
+  },
+  { /* 16^4 */
+    {{{0x83FF4640u, 0x526BAD8Fu, 0x55552FFEu, 0x53441C7Eu, 0xB6262EE0u, 0x99CEAC05u, 0x47B00C9Cu, 0x363D90D4u}}, {{0x3BEE9DE9u, 0x62003C7Fu, 0x08199ECBu, 0x45B9A890u, 0x97F33631u, 0x953B4453u, 0xFC732221u, 0x04E273ADu}}},
+    {{{0xAF92C541u, 0xD2712A5Cu, 0x2EDFB59Du, 0x0B62FB01u, 0xC93B02BFu, 0x553973C6u, 0xED9A7E9Bu, 0x4C1B9866u}}, {{0xC68FE020u, 0x72C4F3FDu, 0xE43EB1ADu, 0xC652EAD7u, 0xCE56E69Cu, 0x7FBCB753u, 0x20BE8A0Fu, 0xC1F792D3u}}},
+    {{{0xF6E55DC8u, 0x4B891216u, 0xEACA0439u, 0x6FF95AB6u, 0xC0509442u, 0xBA84A440u, 0x90C5FFB2u, 0x44314047u}}, {{0xDBE323B3u, 0x31D944AEu, 0x9EAA2E50u, 0xA66A29B7u, 0x5642FED7u, 0xFE99837Fu, 0xE65366F8u, 0x96B0C142u}}},
+    {{{0xBEAAF3D1u, 0xE0C8F28Cu, 0x1A28F135u, 0x3233EDBCu, 0x0780B54Eu, 0x529A2F3Cu, 0xBA83B12Bu, 0xA4083877u}}, {{0xF0B254B9u, 0xB12B534Du, 0x6ED1EF90u, 0x2001E757u, 0x9361B3E2u, 0xB8BF83D6u, 0xFEEFBC79u, 0x40E9F612u}}},
+    {{{0x701B23A8u, 0xDFE9485Du, 0x0A87EE0Au, 0xAB7B7D47u, 0xB921089Du, 0x126243D5u, 0x866CA87Cu, 0x9E22FE8Du}}, {{0x0884EDAEu, 0xF7A413C5u, 0xFB511CECu, 0xC0F7C949u, 0x099C1533u, 0x177F3F02u, 0xCA122D10u, 0xFD2FF0E9u}}},
+    {{{0x33F0E9AAu, 0x3EB5E196u, 0xB11BD34Bu, 0x68112776u, 0xD58138D2u, 0xB7924AE0u, 0x575F26ADu, 0xE5380FE8u}}, {{0x4082720Fu, 0xC4BA4136u, 0xF468318Eu, 0x6FB94E5Du, 0x924C8E01u, 0x5B691363u, 0x9087B41Du, 0xB97FD873u}}},
+    {{{0x071A70E4u, 0xDD7408BFu, 0x5F5CF475u, 0xCD5EE51Fu, 0x4705306Du, 0x2EDD69E6u, 0x03CE2A8Du, 0x508DF6D5u}}, {{0x29950984u, 0xDF2E5BF7u, 0xEE8AADFEu, 0x4EC03228u, 0x733E49C5u, 0x777304AAu, 0x933BC42Du, 0x154C439Bu}}},
+    {{{0x7940D33Au, 0x8CD3DB5Au, 0x454203B9u, 0x6E0D880Au, 0x2F56C86Fu, 0x3A4E3E1Au, 0xD28CC0B5u, 0xA804C641u}}, {{0x6D46967Au, 0x43CE95FAu, 0x9CF736A9u, 0x1AF18CA8u, 0xC16047E8u, 0x3DEC2842u, 0x2B2FA6D0u, 0x95BE8325u}}},
+    {{{0xCE1ABE11u, 0x6EAFDA76u, 0x59CB220Fu, 0xDAB921C2u, 0x930125B2u, 0x338DF581u, 0x55109763u, 0xE3DBFF84u}}, {{0x9FA8DE63u, 0x4B49AD54u, 0x3C6B5C41u, 0xD3C97D90u, 0xDB8A8EF3u, 0x6438FA75u, 0x9A341421u, 0x06F2F909u}}},
+    {{{0xB63968B6u, 0xE6929378u, 0xED9E3AB2u, 0xF4026165u, 0x0890893Au, 0x43C5A960u, 0xFC6579FBu, 0xF7A4BE3Du}}, {{0xD0C34882u, 0x494DDA32u, 0xD110105Eu, 0x99702FB8u, 0x38CA52D2u, 0x21D29030u, 0xE823C615u, 0xD6DDEF6Cu}}},
+    {{{0x03593449u, 0xDCF1B236u, 0xE42A46FFu, 0xF61B7C12u, 0xA07D014Au, 0x878D9C13u, 0xC7DE940Du, 0x19ACE064u}}, {{0xADF83631u, 0x3A414B93u, 0x4084068Au, 0xAC710B9Fu, 0xD9402C46u, 0xBFEBD739u, 0x5268A333u, 0xE3799203u}}},
+    {{{0xEEBC61D6u, 0x1AED361Bu, 0xD9FF42DEu, 0x8A8FD3A7u, 0x5D6B1F51u, 0xC395F0D1u, 0xA3ED9AF0u, 0x939FF3E4u}}, {{0xA3F5CB70u, 0xE75EA466u, 0xB78C7F82u, 0x980BF26Eu, 0xEF016C04u, 0x9D46FC4Eu, 0x08B7A90Eu, 0xDEAB3BCFu}}},
+    {{{0xCCBA6B63u, 0xEE3E9892u, 0xFD0B3BB5u, 0x0A0FE674u, 0x8EA88E31u, 0x108C3322u, 0x20F87DAAu, 0xD8740CECu}}, {{0x6934C5F3u, 0xBEEA36C0u, 0xC381694Au, 0x40104F5Cu, 0x903AC37Du, 0x378A6EE9u, 0xC6B932BFu, 0x6472C133u}}},
+    {{{0x8A8FF2CFu, 0xA34ED6E8u, 0x7B062094u, 0x38EA755Cu, 0xA24051A4u, 0x797A98DBu, 0x1C4CAE30u, 0x019A9E5Fu}}, {{0xDB0E4352u, 0x3A77E766u, 0x88486D35u, 0x0CE7EBEEu, 0x5012B730u, 0xFA906292u, 0xEA85AF5Eu, 0x1E661C67u}}},
+    {{{0x1B3EC038u, 0x6194FF2Cu, 0xE60C6B27u, 0xD9FD516Au, 0x2F290A50u, 0x64883E76u, 0x1B506083u, 0x58AC3339u}}, {{0x10246279u, 0x16EAA3F1u, 0x0B4FBBCAu, 0x0219043Cu, 0xE991FE97u, 0x78779249u, 0xD55C92D9u, 0x9163D706u}}},
+  },
+  { /* 16^5 */
+    {{{0xDFFDF80Cu, 0x69F79A55u, 0xA15BCD1Bu, 0x43E4A781u, 0xB7456388u, 0x8C6244B5u, 0x5DF3C2BEu, 0x8B4B5F16u}}, {{0x5FD4FD36u, 0xB3EFF0C6u, 0x6162EE56u, 0xF9E33654u, 0x3AB0DA04u, 0xB3FBD781u, 0x68D308B4u, 0x4AAD0A6Fu}}},
+    {{{0x4755E4BEu, 0xBB3F2671u, 0x417C997Au, 0x71AF64EEu, 0xC83C6110u, 0x8CE17C7Eu, 0xE1329171u, 0xED0C5CE4u}}, {{0xA07BF42Fu, 0x63F9FA6Eu, 0x763DDAB1u, 0x49D93925u, 0x5A7EA680u, 0xBF3DAD7Fu, 0xBC2345BDu, 0x221A9FC7u}}},
+    {{{0xF55812DDu, 0xA0A2A582u, 0x552D30E2u, 0x3D446723u, 0xC058F78Eu, 0x0B6ABED6u, 0x92FF352Fu, 0x7029BD7Au}}, {{0x1A2D2927u, 0x721CC66Bu, 0x43B2C73Cu, 0x47DAE842u, 0xE30683ACu, 0x7DD6544Au, 0xFDE8B3D2u, 0xB0EEFADAu}}},
+    {{{0x07CEC8ABu, 0xD4B6E6C8u, 0x6E0552CEu, 0xE5325456u, 0x83F1FAE8u, 0xB3B15C3Fu, 0xC44CE694u, 0xFAECB013u}}, {{0xAB155070u, 0x8981DFD9u, 0xB85E2E2Eu, 0x9C32B286u, 0xEC2FB13Du, 0xFC2E02C6u, 0x0E9ECB57u, 0xCC09B5E9u}}},
+    {{{0xBD486ED1u, 0x49CE5683u, 0x49565B6Au, 0x5745BEBAu, 0xD8CF7560u, 0x009D4109u, 0xEAE65C99u, 0x9CCFEDCAu}}, {{0x75E95D8Du, 0x4F6D59EDu, 0x69592AA2u, 0x24216759u, 0x200B3411u, 0xB6122481u, 0x3D6A32CFu, 0x7C2F4D71u}}},
+    {{{0xB181FDC2u, 0xDCDABFF9u, 0x5CC62364u, 0xDD2F62BBu, 0x18A34E7Eu, 0x4AA264B8u, 0xF47E6E47u, 0xF42C102Au}}, {{0xA485D7FDu, 0x81F00093u, 0x9A2ACF26u, 0x4C15502Du, 0xB86FE22Au, 0x78FAD05Cu, 0x6CFE806Cu, 0x57503AB4u}}},
+    {{{0x5BD0EACAu, 0xA206B1A7u, 0xBA2D4AB7u, 0xD0C74576u, 0x3CA4DF19u, 0x35A8FDE3u, 0x63414143u, 0xCD9A4B87u}}, {{0xABFF4ACCu, 0x6E6FAFB5u, 0xED6F634Fu, 0x0127B38Eu, 0x933EA08Bu, 0x815488AEu, 0xA1E8F23Eu, 0xF0455879u}}},
+    {{{0x9AD1B1F7u, 0x07F64EAEu, 0x4F23CD3Eu, 0xB3B2DD82u, 0x37CBCAFDu, 0xC8731A0Bu, 0x2DCAD2F2u, 0x09BB8A13u}}, {{0xC3811C80u, 0x64130627u, 0xF4752D53u, 0x0F54A840u, 0x4F863E85u, 0xB6F9DD28u, 0xAFEEE3B9u, 0x945BB2B2u}}},
+    {{{0xC7BC57C6u, 0xF20953A3u, 0x3EB276CBu, 0x4903D7A2u, 0x93D63094u, 0x884F2D2Eu, 0x88ED9BEAu, 0xAD09882Fu}}, {{0xAE4A0AB8u, 0xCA32C0EDu, 0x3590E2D3u, 0x7B311D37u, 0x29DABE5Fu, 0xA28186C7u, 0x42FBA52Bu, 0x7243C08Cu}}},
+    {{{0x4F927DC7u, 0x9E2DAB64u, 0x63D418A4u, 0x37A7A40Du, 0x366A1423u, 0xE669ED95u, 0x082BA6BBu, 0xE260A0CCu}}, {{0x46AEF35Du, 0xA45F36F4u, 0x462CB82Du, 0xEDBCC0B4u, 0x725BF440u, 0xF073CB3Du, 0xB0DA9D67u, 0x37EE6744u}}},
+    {{{0xABA56302u, 0xEA830C72u, 0xAF0F1862u, 0xF506A937u, 0xA9FAD2E0u, 0x1EADA2D2u, 0xEB3CA41Fu, 0xD9D1290Au}}, {{0x88291C29u, 0xEAADDAFAu, 0x9FA74F2Au, 0x1739AECDu, 0x726386E4u, 0x029715C6u, 0xEC2D3EEDu, 0x7EB53113u}}},
+    {{{0xEEDD7DD6u, 0x3866D47Du, 0x65E1968Cu, 0x49376FE2u, 0xEE7CFDECu, 0xCA5A7840u, 0x24C7524Bu, 0x32CFCF6Au}}, {{0xFE08E330u, 0x25FD44AEu, 0x0349A08Bu, 0x7A0D8CD2u, 0x409F561Eu, 0x6208096Au, 0x976A7748u, 0x21846A34u}}},
+    {{{0xF4D1243Au, 0xBACD3704u, 0x3F54A5FDu, 0x02B12602u, 0x063F5584u, 0x91CD21ACu, 0x539D6CEFu, 0xBC5079DEu}}, {{0x855DB68Au, 0xF5C95168u, 0xB1F47169u, 0x5F7EE4F5u, 0x4DFFC8D7u, 0x8EEC72B9u, 0x3A705CBBu, 0x65062A3Bu}}},
+    {{{0xF6ABF83Du, 0x696D03FDu, 0xFB2D0596u, 0xB8F94058u, 0x10D22C02u, 0x3ECBE68Fu, 0xE85AC49Fu, 0x235CAADDu}}, {{0x0D33E191u, 0x7F4EC9E9u, 0x323610AEu, 0x3F0518D6u, 0xBC93AD89u, 0xEE4232A5u, 0x45FD47EBu, 0xDC12F9C7u}}},
+    {{{0xB74A3F9Fu, 0x08D244E6u, 0xDC098169u, 0xC287A665u, 0x7DB2625Au, 0x913DEAAEu, 0x505FC7E8u, 0x4D31A77Eu}}, {{0x301E0BA7u, 0x4FCB0241u, 0xB6E00A75u, 0xCBF6FB51u, 0xC7802753u, 0x06B18F38u, 0x6098575Bu, 0x22241EC9u}}},
+  },
+  { /* 16^6 */
+    {{{0x5232FCDAu, 0xCB611592u, 0xA6C0E77Bu, 0xB700DBFFu, 0x0BD548C7u, 0x6BF771C0u, 0xE5DB996Du, 0x723CBAA6u}}, {{0x9EB39F5Fu, 0x01DC069Du, 0x37794948u, 0x2660A065u, 0x88824D6Eu, 0xA9211374u, 0x595CC498u, 0x96E867B5u}}},
+    {{{0x0CA030D5u, 0x1FD383D6u, 0x07984907u, 0x2D240A43u, 0x5773A3C6u, 0x343D7DC4u, 0x437B744Du, 0x57EFA786u}}, {{0x74B02F9Eu, 0xB07AB442u, 0xE5E9974Au, 0x689B6D2Au, 0x28DE03ECu, 0x893627C9u, 0xD1B48518u, 0xD712DB0Bu}}},
+    {{{0x80633CB1u, 0x2567E09Eu, 0x69D02113u, 0x575A224Bu, 0x12181FCBu, 0x00C62732u, 0x17AACAD4u, 0x6DDE9CF3u}}, {{0x67CE6B34u, 0x57DD49AAu, 0xCF859EF3u, 0x80B27FDAu, 0xA1BA66A8u, 0x5C99EF86u, 0xA707E41Du, 0x9188FBE7u}}},
+    {{{0x0C584DD5u, 0x7FAFC777u, 0x327B012Au, 0x1080577Eu, 0xD5226CB9u, 0xA2DF7E9Cu, 0x6A28BC42u, 0x264BBD43u}}, {{0x7704AB11u, 0xE6122793u, 0x717B8D8Du, 0x6A118243u, 0x4C33BE22u, 0xD4F75CE2u, 0x4EE093B4u, 0xD87C6FA9u}}},
+    {{{0x2933F3C5u, 0x419A518Du, 0x15F12522u, 0x085A0F71u, 0x8E47B850u, 0x13C4BB7Fu, 0xD5B5CDE8u, 0x486FA72Cu}}, {{0xCAFB0F53u, 0x9AD4A71Au, 0xCF0F23B7u, 0x62D9B783u, 0xECC8F19Fu, 0xE48C48BAu, 0xF56BDD43u, 0x62E12319u}}},
+    {{{0x44E5467Du, 0x4D0BD76Au, 0x19BBFACEu, 0x40908AB8u, 0x0EC970E9u, 0x2C21F62Eu, 0xFC69A122u, 0x97D064F0u}}, {{0x1E9CB3FAu, 0x797300FDu, 0x54F17CCDu, 0xDA5FB3B8u, 0xA850861Fu, 0x03F7C66Fu, 0xD33402CCu, 0x89974F2Eu}}},
+    {{{0x5E99F728u, 0xEBD59422u, 0xE6F12204u, 0x677375FBu, 0xB76A5303u, 0xB664FF27u, 0xA894AF4Fu, 0x24796974u}}, {{0xEBAAEBFFu, 0x37A00516u, 0x9575A2D8u, 0x5ADBF3C0u, 0x7D8D664Au, 0xEC52E87Eu, 0x688F3001u, 0xE3D78D44u}}},
+    {{{0x4B2438E8u, 0x2BF26BD8u, 0xD5BDEC9Du, 0xA78BC61Fu, 0x6236A79Du, 0xDAC85C05u, 0xBD40D2BBu, 0xA94C6524u}}, {{0xF18661F4u, 0xC2E2C8DBu, 0xA0E39B2Bu, 0x7E5D3C60u, 0x05019E3Au, 0xFD792195u, 0x92F96280u, 0xB5201FD9u}}},
+    {{{0x2FB0079Au, 0xC9E0C6D4u, 0x23926049u, 0x916F9EF7u, 0x76B38324u, 0x631A59EEu, 0xA3D55FF0u, 0x2F39CBDAu}}, {{0x2C5690BAu, 0xFE229730u, 0x882A0230u, 0x9BFB3FBCu, 0x278DA58Bu, 0x4DA936D0u, 0x13863983u, 0xABEADBDEu}}},
+    {{{0xB98086C8u, 0x5F46F289u, 0xB62663FFu, 0x40C10E34u, 0x0AA8E6FCu, 0x289263B7u, 0xAA802BDDu, 0x3E842E5Bu}}, {{0x8EE939A9u, 0xF994B513u, 0xB75E7D4Eu, 0x37B8E576u, 0x31B077C0u, 0x1B937046u, 0xFC92E72Eu, 0x89F24FF5u}}},
+    {{{0xE4F7AB73u, 0x793300B2u, 0x9D4443A7u, 0x62E3D4EAu, 0xC534AED2u, 0x56A39E86u, 0x327D61BAu, 0xE5A31D6Cu}}, {{0x70561F42u, 0x3913A3FCu, 0xA80CBA21u, 0xBF8C4449u, 0x7A4ECE5Du, 0x0C118A97u, 0x8D1E9D7Au, 0x37788C3Du}}},
+    {{{0x13613BECu, 0xCCA81CB9u, 0x101CFE67u, 0x8BB5FC9Du, 0xC74F972Au, 0xEDF1B33Du, 0xC93937BDu, 0x2DCFCAB8u}}, {{0x9A039215u, 0x3E730924u, 0xD33F5F38u, 0x3732CFBAu, 0xD6F6C6F4u, 0x65F088B7u, 0x9474A412u, 0x46DBC4DDu}}},
+    {{{0xC14DCD86u, 0x88F929A3u, 0x96BF71B5u, 0x1FC5D420u, 0x2051DCF1u, 0xDF50DD98u, 0x0D153447u, 0xCC389D4Au}}, {{0xC8F0A873u, 0x68EB6DD9u, 0xFE7E7874u, 0x05C57E18u, 0xBEA910CAu, 0x9B568BDBu, 0x60F6BBEDu, 0x93AE4FD6u}}},
+    {{{0xDFB4F6BEu, 0x8443D764u, 0x4FA3EB64u, 0xB567D5FFu, 0x28F0E8B6u, 0x8EC4BB04u, 0xAE758228u, 0xA2AE53D1u}}, {{0x4AEEB9A2u, 0xC0422567u, 0xC3D40436u, 0x4C0EFA67u, 0x7C1B547Cu, 0x7C95679Cu, 0x44B3A098u, 0x6933594Du}}},
+    {{{0x78819311u, 0x24F9C6EBu, 0x10877147u, 0x0B3E1EE2u, 0x0CF5ED1Fu, 0x3750A17Eu, 0x9D71E902u, 0x7F9291C8u}}, {{0xAC2EB125u, 0xAA9F9B57u, 0x9C86A174u, 0x120AAA40u, 0x452415B6u, 0xF5D0DE8Cu, 0x63EC3EF0u, 0x9DA00D10u}}},
+  },
+  { /* 16^7 */
+    {{{0x0E7DD7FAu, 0x9A533ECAu, 0x37A91983u, 0x09479612u, 0x12C2D3B5u, 0xBA5FEEC8u, 0x93BEBF98u, 0xEEBFA4D4u}}, {{0xE1DE8999u, 0xDDFD4FDAu, 0xA711F712u, 0x9AE4CDC3u, 0xF178089Du, 0x69EE7EDAu, 0x970EF0F2u, 0x5D9A8CA3u}}},
+    {{{0x47D297FDu, 0x76BEE908u, 0x8F6766D6u, 0xC4EA4BC0u, 0xC118495Fu, 0xA61C6031u, 0xA7A97BFDu, 0x381C4AD7u}}, {{0x7D493FC5u, 0x93ACE318u, 0xDB939C00u, 0xF0451032u, 0x09915ECCu, 0x8F3E5FA7u, 0x238EEEE4u, 0x936AF53Bu}}},
+    {{{0xBB7CECEBu, 0xF3F678FFu, 0x8897FAF0u, 0x73A59F93u, 0x6F6E6814u, 0x36FFB812u, 0x4276D450u, 0x437A8620u}}, {{0x56C181E1u, 0x7363BCC3u, 0xDC8F9782u, 0x87220FCFu, 0x99D297FFu, 0x69B8FEB6u, 0x3EEAC32Fu, 0x0B916BA1u}}},
+    {{{0x2EDE454Cu, 0x448D7042u, 0xEFDD08B2u, 0x9CF1D05Fu, 0xD9538C47u, 0xCCE10831u, 0x05ADC63Bu, 0xE1EFB9CDu}}, {{0xA8913797u, 0xAD9FD233u, 0xA7A2D4C6u, 0x464E3244u, 0xFE477123u, 0xB0154C1Fu, 0xD8AF9BE7u, 0x0ECB4530u}}},
+    {{{0x097F96F2u, 0xD58D729Eu, 0xD2C8735Cu, 0x35823529u, 0x9A3CC273u, 0x83CB7E3Bu, 0xE2A489BCu, 0xA9EF9F13u}}, {{0x56C04BE4u, 0xC03D55B0u, 0x5A9B4702u, 0xB74F89AFu, 0x0EBB613Du, 0xD956EE16u, 0x94559D7Cu, 0xE814CCE5u}}},
+    {{{0xDCBF00EBu, 0x4C9D9D87u, 0xC18D0227u, 0x41B4E98Bu, 0xA1A30BC2u, 0x49BE16F6u, 0x96EAD4DCu, 0xB89070AEu}}, {{0x1B0E664Eu, 0x1B7F1BCDu, 0xB6B96A67u, 0xCB0D8B06u, 0xC1C4A766u, 0x472294E4u, 0xC8A2D88Fu, 0x6F24C8C2u}}},
+    {{{0x350CF77Eu, 0xBC0AB5A1u, 0x54A8AB0Du, 0x07DBF574u, 0x9FAA0642u, 0x553827D6u, 0xEE1D35BEu, 0x66D80541u}}, {{0xA0EAA3A6u, 0x2A5F97AFu, 0xB7B1B76Du, 0x9444B43Au, 0x535613F6u, 0xC3F1D420u, 0x32FFFB42u, 0x51CFDFE7u}}},
+    {{{0x29EB99A4u, 0xD33FEEB3u, 0x33D47B18u, 0xC7E5419Fu, 0x9AF475A8u, 0xC5AC235Eu, 0xA2697010u, 0x5318F9B1u}}, {{0xFE91F92Du, 0x2C726EEEu, 0xD1E3EC65u, 0xA41F2B40u, 0xEBB405E8u, 0x5772D93Au, 0x4BEDA419u, 0xF44CCFEBu}}},
+    {{{0x87213A5Au, 0x93548628u, 0x785FA62Bu, 0x0B73204Au, 0xC64CC3C8u, 0xBF3508A1u, 0x36503FA2u, 0x62AC05E1u}}, {{0xF46A9E45u, 0xC10D21C0u, 0x817994EFu, 0xE5590901u, 0x07A92579u, 0xD395E79Eu, 0xA0D1A6E4u, 0x236FBDF3u}}},
+    {{{0xEFC76AC1u, 0xD6B21B3Cu, 0xCA422C05u, 0x6124C395u, 0x7D53E899u, 0x37E1859Au, 0xAB103784u, 0x188EF3BFu}}, {{0x528F00BCu, 0x3516032Au, 0x3C763875u, 0xE4D66DE8u, 0xCF398E38u, 0xD005FB18u, 0x052FBA99u, 0xE6FC997Au}}},
+    {{{0x67BAD12Bu, 0xC30FD498u, 0xEAF66E1Eu, 0x85D5EA00u, 0x5C6F2DB3u, 0x5BF613AFu, 0x72448F5Bu, 0xCA13C449u}}, {{0x9723B0F2u, 0x89699F46u, 0x11A57566u, 0x6370AB71u, 0xEAADA3D6u, 0xAC15FA64u, 0x61C287C8u, 0x83AA0983u}}},
+    {{{0xB6FBE7B2u, 0xB9D6FF9Au, 0x458D65A3u, 0x5EADEDC1u, 0xB2A88460u, 0xF336BBB1u, 0x9CB441F8u, 0x26488766u}}, {{0x21BC2A34u, 0x932A78BCu, 0x6A0EB603u, 0x5638D981u, 0xD02DDF18u, 0x8F2F2DCAu, 0xB2014498u, 0x9E15DAB4u}}},
+    {{{0x5C80414Eu, 0xDDAEE5F9u, 0x2D66CF7Fu, 0x14EF8A86u, 0x44609E49u, 0x5AC11C4Fu, 0xA7052AE8u, 0x1CECB101u}}, {{0xD2169A3Bu, 0xDCAE9492u, 0x447231D0u, 0x907557E5u, 0x35EDAD16u, 0x4E5AA328u, 0x96097CFBu, 0xF3436066u}}},
+    {{{0x8B20907Du, 0x50D1E4D1u, 0x1607851Cu, 0x3B15B2D6u, 0x94850FF4u, 0xB002F458u, 0x3E54C227u, 0xF98B5DBCu}}, {{0x5CC926AFu, 0x8351319Bu, 0x25A90E35u, 0x41FCD9E0u, 0x6BA9CC9Eu, 0x42939B70u, 0x4F4A13FAu, 0xE2D508BDu}}},
+    {{{0x4ED810A9u, 0xC4F5BC8Cu, 0x3C700155u, 0x4F889D3Fu, 0xF1DF2392u, 0xC950DAF5u, 0x04D78F9Cu, 0x2A699075u}}, {{0xFA9B4728u, 0xCF86B388u, 0x7EC145C7u, 0x667D47E9u, 0x54FB04FCu, 0xC3EC5869u, 0x6C3DFFDAu, 0x54F9039Bu}}},
+  },
+  { /* 16^8 */
+    {{{0x39A48DB0u, 0xEFD7835Bu, 0x9B3C03BFu, 0x9F1215A2u, 0x9B7BDE45u, 0x2791D0A0u, 0x696E7167u, 0x100F44DAu}}, {{0x2BC65A09u, 0x0FBD5CD6u, 0xFF5195ACu, 0xB7FF4A18u, 0x0C090666u, 0x2EC8F330u, 0x92A00B77u, 0xCDD9E131u}}},
+    {{{0x1E4DF706u, 0x4B05284Fu, 0x237D0808u, 0xD8D9C8F9u, 0x2B4C4199u, 0xA8415DFFu, 0xCEB5C771u, 0x8C0989F2u}}, {{0x5D72FA98u, 0x736AC5A3u, 0x156511AAu, 0x60DE6BF5u, 0xB9DC966Cu, 0xFFD2172Cu, 0x4F432034u, 0xFB4DBD04u}}},
+    {{{0x95BC15B4u, 0x9CB9A134u, 0x465A2EE6u, 0x9275028Eu, 0xCED7CA8Du, 0xED858EE9u, 0x51EEADC9u, 0x10E90E2Eu}}, {{0x58AA258Du, 0x34EBE609u, 0x02BB6A88u, 0x4CA58963u, 0x16AD1F75u, 0x4D57A8C6u, 0x80D5E042u, 0xC68A3703u}}},
+    {{{0xDC47BFFDu, 0xB1E63C33u, 0xBC95BC1Bu, 0x9C528539u, 0x3262C025u, 0xC4A48174u, 0x5E266704u, 0xFB8F153Cu}}, {{0xD949B095u, 0x090A45DDu, 0xAC542613u, 0x1DDE1389u, 0xB4BCCD53u, 0x16FA11D9u, 0xC5E06218u, 0x6CA27A9Du}}},
+    {{{0x3FE75269u, 0x2DD3FC30u, 0x053D3318u, 0xA377A3CCu, 0x714B7DCDu, 0x4575B90Bu, 0xDA541638u, 0xF7422F42u}}, {{0x17E49BD5u, 0x18980E87u, 0xF4A398E0u, 0x7FB3A237u, 0xB9F63597u, 0xD18CE7DCu, 0x3313093Fu, 0x406C2F1Au}}},
+    {{{0x7A1C0A80u, 0x0F62ABC8u, 0xC65A9C74u, 0x4D625158u, 0x002FF9C3u, 0xB17C9BE7u, 0xA614CCA5u, 0xB6B15A68u}}, {{0x41CE0A03u, 0xB6CD0110u, 0x082E16EEu, 0x9C9A12B3u, 0xEF6536D4u, 0xA54E223Eu, 0xD6CDB61Eu, 0xFAE62E14u}}},
+    {{{0xF5A7175Fu, 0x653B6696u, 0xD31CF42Au, 0xEDB8E771u, 0x82D5DEBBu, 0x72879A55u, 0x17D43CFFu, 0x2D8CAD04u}}, {{0xBB9D592Au, 0xCF37BB91u, 0x9CB5E5E0u, 0x7A846BFDu, 0x612C9D37u, 0x7BB232FAu, 0x318CA94Au, 0xC73F3B83u}}},
+    {{{0x4BB2629Au, 0xB8FA1B8Bu, 0x7737A7B8u, 0x65A02C58u, 0xA7287084u, 0x5A0CC9F0u, 0xD75D5175u, 0xE747333Fu}}, {{0x6946F6D6u, 0x9F8D961Au, 0x6E1A969Au, 0xC88376AAu, 0x804C2581u, 0x4CC43603u, 0x45070C11u, 0xF2AFFE01u}}},
+    {{{0x94B51045u, 0xE34C9BC3u, 0xF31C25B3u, 0xBBC6C896u, 0xB1E8CF73u, 0x8AE73D4Eu, 0xB98A6EA5u, 0x1ECBFD1Du}}, {{0x02C70026u, 0x53A67101u, 0xB436422Du, 0xB1900646u, 0x849A9B38u, 0x447D0BB1u, 0x8B99C3A6u, 0x1CF6E230u}}},
+    {{{0x6413E439u, 0x4A35B56Cu, 0xDDD5EF67u, 0xF92F69EFu, 0xB7EDB64Au, 0xAF8B1BFEu, 0xB477E296u, 0x99741BB8u}}, {{0x6832CD5Bu, 0x3E657D82u, 0x697466E4u, 0xB17C15C9u, 0x258E3E7Au, 0xE735AA56u, 0x7BD9C9A5u, 0xDE47E9B0u}}},
+    {{{0xE9358533u, 0xF7ACD766u, 0xD4FB4B9Du, 0x10A933F9u, 0x91D32A8Cu, 0x83E955A2u, 0xFE577528u, 0x9A0894C5u}}, {{0xC360BA08u, 0xFB3E1C5Du, 0xBB80DDADu, 0x65A6E5BDu, 0x954FC321u, 0x1F917D5Fu, 0x201B8FC3u, 0xA79883C4u}}},
+    {{{0x92B062D4u, 0xA7CAA50Au, 0x9BB6A141u, 0x7A5CE7E5u, 0x83EA227Au, 0x06FB1712u, 0x3256EACAu, 0x35963EA4u}}, {{0xBBB25302u, 0xA10AA4D1u, 0x64DE59B1u, 0xD04082B9u, 0xF9C08A96u, 0xBFCCE196u, 0x4951E5C9u, 0xF65BE145u}}},
+    {{{0x198EF7F6u, 0x694405D6u, 0x7A078F9Fu, 0x5923F3F7u, 0x73B8AEA6u, 0x5BD9C852u, 0xDB4FD2E3u, 0x664DD849u}}, {{0x5D1EAC94u, 0xE7496FF3u, 0x1B8E6ECEu, 0xFC3D3AB3u, 0xDD0458CFu, 0xA1448CE5u, 0x17F27932u, 0xAD512017u}}},
+    {{{0x119334F0u, 0x0D0B66F3u, 0x3A0AD1B6u, 0x74728EFBu, 0x85C29E41u, 0xC6A0E824u, 0x02CFC321u, 0xCEBB7B7Bu}}, {{0x51E45191u, 0x16750BD2u, 0xB9E036CBu, 0x4765A29Du, 0x4DD2E370u, 0xBA1EC0F7u, 0x633B4A32u, 0xFE3DF243u}}},
+    {{{0xC3C934B3u, 0xE0C0A6B7u, 0x5B0AE2C4u, 0x2B31F580u, 0x9811A702u, 0x8231D966u, 0x77D0B863u, 0x82113A93u}}, {{0xC42C6A0Fu, 0x77E5E62Au, 0x9A446803u, 0xAA1F7C26u, 0xB5A0C628u, 0x08466CF2u, 0xC9AE3666u, 0x8DA1B8DAu}}},
+  },
+  { /* 16^9 */
+    {{{0xE534FD2Du, 0x2C8ACDE6u, 0x64F3B385u, 0xA77F8D44u, 0x4A04C017u, 0x1DC9227Au, 0x62C7ED1Bu, 0xE1031BE2u}}, {{0x9456A00Du, 0xA44F18F2u, 0x9E1CED79u, 0xF292DD41u, 0x6597535Au, 0x6BB6A417u, 0x8940405Eu, 0x9D706192u}}},
+    {{{0xA95C8356u, 0x84E27E36u, 0xDE94D857u, 0x028A6AC5u, 0x0F29B2C9u, 0xB9F95DCDu, 0x4C8089EAu, 0xF4B93F22u}}, {{0xBE001FD3u, 0xBD5861B9u, 0x4915609Au, 0xC37EF134u, 0xA40EEE90u, 0xB0E5F6A7u, 0x062962DFu, 0xA67A92ECu}}},
+    {{{0xEF028D83u, 0x579623AEu, 0xBA743961u, 0x6195926Du, 0x15DE69DBu, 0x6A5ABE5Au, 0xE3C785ECu, 0xA7EBF7C4u}}, {{0x99D0BED1u, 0x9640392Bu, 0x4B053919u, 0x47A38927u, 0x7044804Bu, 0xCFD9C737u, 0xBFE362D5u, 0x6205152Fu}}},
+    {{{0x7B160E8Au, 0x20D62FE1u, 0xF97E696Cu, 0xD51E8512u, 0x025B08B0u, 0xB19622EAu, 0xFCE55236u, 0x09D1ACA1u}}, {{0x7CA04C44u, 0x34E050C5u, 0x9212B5E5u, 0x6FE9E0EEu, 0xE0D8C27Eu, 0x3E56692Cu, 0x5101F0C6u, 0x1153188Fu}}},
+    {{{0x27DD5CFAu, 0xBAE0E402u, 0x7F09D4B5u, 0x6A89C513u, 0x42634633u, 0x1CDC6A53u, 0xCB024F4Cu, 0x5B5CA08Du}}, {{0x9E48E98Cu, 0xE664A6F9u, 0xAF3269D3u, 0xBFD067CCu, 0xA8869094u, 0xE991F0CEu, 0x0AA15825u, 0x3ECCB6F7u}}},
+    {{{0x7BB61EE5u, 0xF2884413u, 0xFB1F0C13u, 0xDA4F04E2u, 0x8974AE6Eu, 0x662638CDu, 0xCC8721B8u, 0xD4933230u}}, {{0xE5D694A8u, 0x662DA4D0u, 0x5A438DDCu, 0x1AD12C8Cu, 0x1ECAFB5Eu, 0xEDCC5E9Du, 0xF51A9D23u, 0x021C09ABu}}},
+    {{{0x23531F82u, 0x2B9528E3u, 0xB10C2C9Fu, 0xFF51326Bu, 0x89C22C29u, 0xCCEF3E74u, 0xC1114BB5u, 0x046F26ACu}}, {{0x0BCEDA07u, 0xA505FC8Bu, 0xDAB55C7Fu, 0xD025945Cu, 0x2FC32579u, 0xCE2370ACu, 0x635B82EAu, 0x6B804B31u}}},
+    {{{0x75BA7FC2u, 0xE97D7D04u, 0xBFC39562u, 0x518B3A93u, 0x3821CDE7u, 0x18A2AD79u, 0x454C2B9Eu, 0xC66C59CCu}}, {{0xF75F5956u, 0x7EC3C69Cu, 0xB1595597u, 0xF00A60DDu, 0xAAC10CB2u, 0xBEA4F3CEu, 0xBFB30FCFu, 0xD9592FE2u}}},
+    {{{0x10432711u, 0x60B15437u, 0xDD916B90u, 0xCF140B2Fu, 0x0899645Au, 0x35F96F0Fu, 0x31E0EFB5u, 0xC11926D9u}}, {{0xEFE2610Cu, 0xE49261E2u, 0xA0F34055u, 0x83AB922Cu, 0x86CCC6CFu, 0x18494BF1u, 0x7D25B689u, 0x8BE1F8CCu}}},
+    {{{0x22BE316Cu, 0xF836C6CDu, 0x278E7AD0u, 0x6BF4043Fu, 0xB25EF5F1u, 0x2B17CEF5u, 0x4A0B37B3u, 0x559CD5AAu}}, {{0x9FE04013u, 0x1A6AB9C9u, 0x360780E7u, 0x8A389A1Du, 0x874C692Fu, 0xF2DBA929u, 0x08D44076u, 0xAAD5449Cu}}},
+    {{{0xA1257963u, 0xC179874Fu, 0xC34AA861u, 0x5B018D52u, 0x538979C4u, 0x6CDBB54Bu, 0xEB688F2Eu, 0x690846E9u}}, {{0x466F9835u, 0x3A576599u, 0x21C92B25u, 0x6CBC3CA8u, 0xF92FBB7Fu, 0xB4017024u, 0x7F3FEBC5u, 0xE2485FCBu}}},
+    {{{0xEC04554Au, 0x530DDCBCu, 0x4688CFFEu, 0xAADCFFBBu, 0x7A10A2ECu, 0x474652C2u, 0x9873D1A0u, 0x896F37C8u}}, {{0x929138DFu, 0xD68F9FE1u, 0xACC417DCu, 0xE6085B61u, 0x4E811BF1u, 0xDA622BB0u, 0x224AC4ACu, 0x380423E7u}}},
+    {{{0xDEE23ACEu, 0x2D11394Bu, 0xB54DD2FDu, 0xDEC87C65u, 0xF4A32915u, 0xBBA7552Du, 0x8C9220BAu, 0xFB3DF7FBu}}, {{0x9722E8DEu, 0xE09DEF4Cu, 0xFED27F5Eu, 0x9E727142u, 0x0DBAB58Au, 0x52A25154u, 0x11C73C56u, 0x510E29BCu}}},
+    {{{0x5CD36F89u, 0x5F90F130u, 0xE700CB92u, 0x1E4754C6u, 0x72900EE3u, 0x651D68B8u, 0x69155239u, 0x482B6F17u}}, {{0x70A4F423u, 0x467CA372u, 0x42D49A68u, 0x19EE0734u, 0x6D7FE92Eu, 0xCB18C23Eu, 0xF9A5CC5Au, 0xE8C3C11Du}}},
+    {{{0x50272351u, 0x8607CFEFu, 0xF99FF109u, 0x70734B3Du, 0x3AB1CD41u, 0x3EB8A3EBu, 0x4F5C518Bu, 0x6DD85EC2u}}, {{0x7FC7664Bu, 0x9B07FA2Bu, 0xC3E0817Cu, 0x877C6FF7u, 0xAF5C41B7u, 0x09D407F9u, 0x121F427Eu, 0x16EA67F4u}}},
+  },
+  { /* 16^10 */
+    {{{0x9094696Du, 0x2D5E688Du, 0xA41D6AF5u, 0x5CF8B266u, 0x143BD7ECu, 0x0AC2839Fu, 0x46D55B53u, 0xFEEA6CAEu}}, {{0x18090088u, 0x3155DEBFu, 0xCC41442Du, 0x981C8957u, 0xBF3ECD5Cu, 0xB06E4E12u, 0x97DCE1BAu, 0xE57C6B6Cu}}},
+    {{{0xEE752B08u, 0x0AA4040Au, 0xB331A187u, 0x141ECAE0u, 0x9DB2E179u, 0xC53261AFu, 0x1ADB87E1u, 0x4D000B62u}}, {{0x48302CEAu, 0x3E72851Fu, 0x19C7293Au, 0xCB7DF5F1u, 0x82D972CCu, 0xCB6D8255u, 0x18E0D255u, 0x6A0D5B8Fu}}},
+    {{{0x48DFD587u, 0x079361BBu, 0xC9B02656u, 0x5EC4BA38u, 0x2CF5A12Du, 0x34867AAAu, 0xACF4508Bu, 0x5084B41Bu}}, {{0x91470E89u, 0x6E79E97Fu, 0x6891F560u, 0x5DB6F560u, 0x55292747u, 0x619AA6C8u, 0x1D980D31u, 0x34A9631Au}}},
+    {{{0x475C58EFu, 0xF89962FDu, 0x3E1F1B77u, 0xD657A040u, 0x14717128u, 0xD6AA2621u, 0x203DA05Du, 0x71F570CAu}}, {{0xD35D420Eu, 0xF8649A72u, 0xC3363E7Du, 0xF2445D00u, 0x5BC95B8Du, 0xD2555734u, 0x95DC880Du, 0xEB42415Bu}}},
+    {{{0x7AB34CC6u, 0xD0823261u, 0x7CF30A12u, 0xC80C2976u, 0xD18D7128u, 0x53FB3F1Fu, 0x0642D5EAu, 0x4F14C03Eu}}, {{0x987E681Fu, 0x25EC252Fu, 0x8E81DD02u, 0xB9DE3CCEu, 0x43A62540u, 0xC653A70Fu, 0xCAA4E894u, 0x7B53D0A8u}}},
+    {{{0x6C953FA9u, 0x4D05956Du, 0xF0B8C3DBu, 0x28AB2629u, 0x4BD18C06u, 0x3A5F485Du, 0xAAAB9323u, 0xA49ED10Eu}}, {{0x46FB4C72u, 0x67B2BD22u, 0x968E181Bu, 0x5AE87534u, 0xA0DFDDFBu, 0xE03476C0u, 0x660F5398u, 0xCC72B894u}}},
+    {{{0x1241D90Du, 0x34277101u, 0xDB2444F8u, 0xE81CF141u, 0x5EDDD363u, 0xD4143609u, 0x49C79ED1u, 0xA74DB87Eu}}, {{0x3F7ADAD4u, 0xF32518B8u, 0x44A0A313u, 0xA9EE5093u, 0x588171C8u, 0x27FDD08Au, 0xAF23EEF3u, 0xF78691CDu}}},
+    {{{0x43FF8359u, 0x6048B060u, 0xC65E7651u, 0x46B4821Du, 0xC21DA014u, 0xB7D282B5u, 0x9F7BD253u, 0xA2B7B362u}}, {{0xFE86FEC2u, 0xA2397FECu, 0x046F3835u, 0x10D10835u, 0xF71E29C9u, 0x57A937A3u, 0x1695122Du, 0x69303894u}}},
+    {{{0x31C1AE1Fu, 0xA5ECCA22u, 0x8ACD40B2u, 0x456E58C6u, 0xEBA35658u, 0x9ACDCD44u, 0x44BAA2CFu, 0x6901FA57u}}, {{0xD22838B0u, 0x0F833065u, 0xE5C77A93u, 0xD79F3BA5u, 0xC29C900Du, 0x461B5380u, 0x2273C212u, 0x35DE5C88u}}},
+    {{{0x99F1F366u, 0x34F09013u, 0x3D0076BEu, 0x4A79057Au, 0xB4994D90u, 0xA495F216u, 0x5DA47F7Bu, 0x5D134E5Cu}}, {{0xC4990F2Cu, 0xE2B0D3E9u, 0x20A88B39u, 0xCF02D616u, 0xE3A82B73u, 0x2DBE2A4Au, 0x3E084504u, 0x03B1EF4Du}}},
+    {{{0xB27A4BDBu, 0x4B031081u, 0x35494CACu, 0x046A6D04u, 0xF1BBA35Du, 0xA244B643u, 0x1D438127u, 0x8D3CD82Du}}, {{0xE69A8A2Cu, 0xC3D34C7Cu, 0x370AD296u, 0xD4E3807Du, 0x0076236Eu, 0x70CFBF9Du, 0x80EE41F4u, 0x9BD42561u}}},
+    {{{0xE7A1D916u, 0x3C096D3Fu, 0x5D1F1F3Au, 0x315B0A39u, 0x65DBB070u, 0xBAC6158Au, 0xB6D59D0Cu, 0x650EF9ACu}}, {{0x7068387Bu, 0x85849CA6u, 0xA76C26BAu, 0x58BB4608u, 0x279B82C5u, 0x70E9C0B9u, 0x1162B118u, 0x085D11F2u}}},
+    {{{0xB4EC1D2Du, 0x440CD3C6u, 0x6E7D8F45u, 0xD9099F5Cu, 0x967B691Fu, 0xAFE9D672u, 0xD6064739u, 0xEAF98363u}}, {{0x4C838452u, 0xFCFE7560u, 0x57E84B53u, 0xA9F52D54u, 0xE6B199AAu, 0x775228A0u, 0x7FE78D22u, 0xE518183Au}}},
+    {{{0x8BD98EE1u, 0xD42C8E80u, 0x908992BEu, 0x579DF37Au, 0xA8FBA197u, 0xFEA7C924u, 0x0CEB2183u, 0x1D770ACEu}}, {{0x1D38FFCAu, 0xF9FB8179u, 0x0E3D57ECu, 0x37F61CA4u, 0xB6552A86u, 0x78963038u, 0xF46EF5DEu, 0x278F8805u}}},
+    {{{0x045AE767u, 0xBCB35BF7u, 0x9E89771Cu, 0xC273A9CBu, 0x2C06E5D8u, 0x66F40E05u, 0x3AEDB634u, 0xFB95BD16u}}, {{0xFBBF0E11u, 0x1853EA0Au, 0x8A59F134u, 0xB816F471u, 0x3682275Bu, 0x52004D9Du, 0x11A8DDBCu, 0x664C14D8u}}},
+  },
+  { /* 16^11 */
+    {{{0xC1EC6CB1u, 0x33FA978Bu, 0x808583DEu, 0xFEED657Du, 0xE6FFCA3Cu, 0xB367BE4Bu, 0x91049CDCu, 0xDA67A91Du}}, {{0x7A68BE1Du, 0x7E9EA8E2u, 0x08F740A1u, 0xDEC7ADC5u, 0xEC9780E5u, 0x41F463F7u, 0x481642BCu, 0x9BACAA35u}}},
+    {{{0x1FE741C9u, 0x5EE3CC82u, 0xCCEA5A83u, 0x8BBD9F35u, 0xAF00D871u, 0x7C0C0CFAu, 0x5FA1EF58u, 0x4DBACD36u}}, {{0x338EB623u, 0x60BE10F8u, 0x9FC0535Fu, 0x0CC384A0u, 0xE838299Du, 0x7FDCFD59u, 0x8A51892Eu, 0x16C3540Eu}}},
+    {{{0x15BC8A44u, 0x9EFDD065u, 0xCBE151A1u, 0x68410177u, 0xBA5A5FC7u, 0xD38565A4u, 0x3CFCEDA3u, 0x4D018058u}}, {{0x1ADBC09Eu, 0x2F1F94C9u, 0x8582DA36u, 0x96942046u, 0x07D63813u, 0x67E9BA80u, 0x8CB4F5D3u, 0x3A33C6C1u}}},
+    {{{0xB4E218DAu, 0x87EDA8BAu, 0x52686050u, 0x0F4C85F1u, 0xFF41C259u, 0xE68F17D8u, 0x81509BEEu, 0x13D1FFC4u}}, {{0xDB191C19u, 0xE0DB419Du, 0x6D5BD127u, 0xA4AD0120u, 0xB1B758BDu, 0xCECB9337u, 0xA991961Du, 0x6008391Fu}}},
+    {{{0x65DAEB00u, 0xBC1AB528u, 0xCE645F76u, 0x5923EB24u, 0x73B6E9D1u, 0x082CB6A2u, 0xDF5CF957u, 0x2F661507u}}, {{0x833992C0u, 0x12276789u, 0x195D308Cu, 0x6ECDEE27u, 0x8200ADD0u, 0x6EF9537Au, 0x6F52B33Fu, 0xFD5C1213u}}},
+    {{{0x935B4EB8u, 0xF52213E4u, 0xAB8B5A3Cu, 0x07F557F1u, 0xCCAF2DCEu, 0xF0FF54A3u, 0x3ADF2256u, 0xC11968E4u}}, {{0x6F911ADDu, 0x7044996Du, 0x12A7149Bu, 0x42F8B494u, 0xE6766F82u, 0x8379D81Fu, 0x7786458Fu, 0xBFF5E693u}}},
+    {{{0x916AA6D9u, 0x182A90A0u, 0x47702DCFu, 0x3662C8B6u, 0xA1835A38u, 0x254F174Du, 0x05FE47D2u, 0xF594117Du}}, {{0xBF2E50CFu, 0xC7D0696Eu, 0x3E6B5B86u, 0x7A927788u, 0xB094BCEBu, 0xCF65DBDAu, 0x6E971B12u, 0xCAA761A5u}}},
+    {{{0xA2E96DB8u, 0x133B40CAu, 0xCE29DBFFu, 0x3CC9D916u, 0x45B0533Bu, 0x7659C79Cu, 0xEF6C6000u, 0x219B4F9Cu}}, {{0x8D3B6BC7u, 0x27DF01A7u, 0x3E905765u, 0x394F8AC5u, 0xC0372A6Eu, 0xF5A44180u, 0xD959EFEAu, 0x24D9C605u}}},
+    {{{0x7AC6F4C0u, 0xCAAE0395u, 0xCC4BDC4Cu, 0xDA4E8DE8u, 0xE696711Du, 0xC4E1C38Bu, 0x1F4D9CDEu, 0x0F2D4D7Fu}}, {{0x72339B58u, 0xE7E7BBADu, 0x90242656u, 0x8F6A10A7u, 0xF381E71Eu, 0x17FB27FDu, 0x7E93DE4Du, 0x3EC89F85u}}},
+    {{{0xF4284327u, 0xC56D1F9Au, 0x383A6FACu, 0xAC4020B0u, 0x806A3417u, 0xDD43EBDDu, 0xCD64B45Cu, 0x0F6840BDu}}, {{0x45E2AB72u, 0x400D275Au, 0x712B9EB7u, 0xB68DABA7u, 0x4B6114AFu, 0x495E8BFFu, 0x100F1A77u, 0xF304D37Fu}}},
+    {{{0xDF428CB2u, 0xD855053Fu, 0x66A22B55u, 0x233822FDu, 0x5958D0F1u, 0x1EB7A181u, 0xE2A14BBDu, 0x1D5DCEC2u}}, {{0x895B189Bu, 0x1E5ED100u, 0x876044A5u, 0xBD3E912Fu, 0x486F0B88u, 0x0D078782u, 0xB142C8C5u, 0x6E5C4083u}}},
+    {{{0x59DFFC96u, 0x295BA109u, 0xAFAC5857u, 0x9228CDA5u, 0xC817EB01u, 0xF6F9B395u, 0xE1483DEAu, 0x161C6CBEu}}, {{0x1B492DE4u, 0xC93BCF61u, 0x2EAF8621u, 0x9B9634C9u, 0x1CB18305u, 0x5BD25939u, 0xA6B9FF98u, 0x8A26CA92u}}},
+    {{{0xA8381273u, 0xFB0EA88Fu, 0x0693DAE5u, 0xD8437696u, 0xCC4126CEu, 0x9FDEA9B2u, 0x30096743u, 0x89D9A2FDu}}, {{0xD309773Du, 0xA03EB3EEu, 0xAD127324u, 0x8F61D680u, 0x76CF62F5u, 0x377AAF20u, 0x51D66F50u, 0xDFCA25B4u}}},
+    {{{0x810A683Fu, 0x4CF6155Fu, 0xBF6EB1BEu, 0x5248BD31u, 0xF189AA8Cu, 0xFE6C7285u, 0x3F64D4A0u, 0x783D0ECCu}}, {{0xE0F54C4Cu, 0xDFD66CE2u, 0x72395EE9u, 0xB5DE9288u, 0x27F2D51Eu, 0x016B7457u, 0x9073F4A3u, 0x200A6D02u}}},
+    {{{0xB5C71D91u, 0x1CC32B2Cu, 0x2A894FD2u, 0x23945E2Eu, 0x115AFECEu, 0xC52A1C13u, 0x83A50AE1u, 0x83191B87u}}, {{0xE2148A61u, 0x70B9EC08u, 0x750445EEu, 0x17A11F51u, 0xD17CAE8Au, 0x9E06DE13u, 0x73801B70u, 0xE0AC7F15u}}},
+  },
+  { /* 16^12 */
+    {{{0x1A37B7C0u, 0x57545CCCu, 0xBB11069Fu, 0xEC08D0F7u, 0x5EF22151u, 0xA6E00093u, 0x0B334CDDu, 0x53904FAAu}}, {{0x022771C8u, 0x9DCB096Bu, 0xE1443469u, 0x13999981u, 0xC20D3C1Cu, 0x88C9ECCAu, 0xBC80106Du, 0x5BC087D0u}}},
+    {{{0x38A47CA9u, 0x57CD0F1Fu, 0xAD0F85ADu, 0x2A6EE7AAu, 0x6316995Du, 0x3CF99119u, 0x9D414675u, 0x01A575AFu}}, {{0x77EBCDB7u, 0x67C5DF2Eu, 0x9F4D7EA6u, 0xBDB93C5Du, 0xE1BB8698u, 0xCC55FC52u, 0x8AB20DC3u, 0x3038F1CBu}}},
+    {{{0x48A2050Eu, 0x71AC42FEu, 0x615F8A67u, 0x742EF557u, 0x6E479B89u, 0x96B769CCu, 0x24BC7318u, 0x673724FDu}}, {{0x061D3D70u, 0xB90C9A49u, 0x43349CC2u, 0xBE6BACFDu, 0x9A886B6Du, 0x203482C0u, 0x896A4A20u, 0xE4CF8257u}}},
+    {{{0xE315565Bu, 0xE309D755u, 0xD3C20C6Eu, 0xD3A61A83u, 0xB76155D6u, 0xCA71F5C1u, 0x7621D439u, 0xF5F0E043u}}, {{0xDD2ECC82u, 0x678430AFu, 0x3ED7E40Au, 0xA5BF61BFu, 0x0DF7101Au, 0xF6218916u, 0xBE5A052Bu, 0x6B9F4E62u}}},
+    {{{0x82DE63BFu, 0xCBF6E483u, 0x87261C66u, 0xE03AF532u, 0x1F6166A8u, 0x9E598A63u, 0x72DF4C30u, 0x4366EFA4u}}, {{0xE17924CDu, 0x02C6A408u, 0x5AAA6D6Bu, 0xF33B0C52u, 0x130268EAu, 0x2EE2537Eu, 0xBEE2D7CEu, 0x2E7DD909u}}},
+    {{{0xA9A78179u, 0x34CF601Fu, 0x260D6AFEu, 0x6B50E905u, 0x6209ED9Fu, 0x905A4733u, 0x7081B8DCu, 0x995CA7F3u}}, {{0xAFEC1F47u, 0x931FBB4Cu, 0x9AB64E52u, 0xBBCC8556u, 0x0492863Au, 0xB5E34D88u, 0x5553573Au, 0xD9A059E9u}}},
+    {{{0x06F96190u, 0xF10527FFu, 0x07C9525Eu, 0xD1F02DE9u, 0x667AA75Fu, 0x97BE5569u, 0x7991AB1Fu, 0x7BD75362u}}, {{0xABDA00F6u, 0xA3D17204u, 0x1E0EA695u, 0xCE0FCC5Cu, 0x943827D6u, 0xD5ED6474u, 0xDBBA6309u, 0x8336F2B3u}}},
+    {{{0xF5362D33u, 0xCBE781D9u, 0x46227642u, 0x47CBC921u, 0x970CA4E3u, 0x57A7F36Du, 0x6C0B6E9Au, 0x8F506F0Bu}}, {{0x87FA243Fu, 0x30487D0Cu, 0x43BB8EAFu, 0x48CF925Du, 0x4F1C3368u, 0x9530C542u, 0x2AFA6171u, 0x469F955Du}}},
+    {{{0x56AD41EDu, 0x33B15315u, 0xF4F03524u, 0x0308AC35u, 0x8918DC92u, 0xAFA3419Eu, 0xDDAAD5C1u, 0x4F7E927Bu}}, {{0x7E642D57u, 0xDF435786u, 0x4EAF775Bu, 0x2E731471u, 0x53A8F6A6u, 0x552980DFu, 0x56A88B10u, 0xDFE77451u}}},
+    {{{0x3E5E6618u, 0xC1843A1Au, 0x9D8FFCB4u, 0x166D65F5u, 0x1E412463u, 0x87E01714u, 0x38B97DBFu, 0xFBC21073u}}, {{0x2230C860u, 0x0ED54DA0u, 0x1DCBCCF2u, 0x7F3C4F3Fu, 0x6F39B11Du, 0xB4960C1Au, 0x185C9414u, 0x9F9B0859u}}},
+    {{{0x67748690u, 0xCFA60512u, 0xD8630B01u, 0x7D57904Du, 0xEDD33D00u, 0x94B452B1u, 0x7D291CCCu, 0x2355CB86u}}, {{0x4C89582Bu, 0x47C47531u, 0xCD1C9391u, 0x58286858u, 0x15AA7C58u, 0xF55B85ECu, 0x5A71E1F8u, 0x21C2F18Au}}},
+    {{{0x849135D3u, 0x13D8D85Du, 0x12E431FCu, 0x74203CD0u, 0x4130B16Au, 0x65C13429u, 0xEF82A85Au, 0x05940BC7u}}, {{0x962255D2u, 0xD02D7451u, 0xC9902391u, 0xF1286328u, 0xAAB6687Au, 0x2F75B0C7u, 0xEB4FAB61u, 0x90537985u}}},
+    {{{0x0ADE7F16u, 0x6DAEA216u, 0x3CBE028Cu, 0xAE9CBAE9u, 0x6C275D24u, 0x013592ABu, 0x9B3DA56Cu, 0x0B66825Bu}}, {{0x48C56217u, 0xD9444268u, 0xF3E7CD2Bu, 0xB7243C0Du, 0x8B57A97Fu, 0xEF3A76BAu, 0x18E09B3Fu, 0xA1FBA0B8u}}},
+    {{{0x64D2374Du, 0xC6330701u, 0x84CFEB2Bu, 0xDCF38A96u, 0x1B3FF6A4u, 0x5DA5A9F7u, 0xB5E5C9D2u, 0x16EE8ED8u}}, {{0xFC865998u, 0x80E5BCB4u, 0xE6D4DDD9u, 0x0755130Eu, 0xE5B6FF62u, 0x8A26B843u, 0x546FF110u, 0xF500E7F0u}}},
+    {{{0x99060D5Bu, 0x2906B022u, 0x1C3A3A7Cu, 0x904613B1u, 0xD9F951CBu, 0xB6109B2Fu, 0xF0BD022Cu, 0xF602043Cu}}, {{0x1AF88F13u, 0x76F6F50Bu, 0xB7DD1A3Fu, 0x37AA56D2u, 0xAC4F7BEAu, 0x881A8F64u, 0xC1F0CF19u, 0xF036B706u}}},
+  },
+  { /* 16^13 */
+    {{{0x3AD86047u, 0xEFF959F4u, 0x3A9B8BCAu, 0x79B53A04u, 0x64CA9067u, 0x719CCA77u, 0xD35983A7u, 0x8E7BCD0Bu}}, {{0x8460372Au, 0xEA10047Eu, 0x47FD68B3u, 0x79E88E2Eu, 0x0CA95145u, 0x94031042u, 0x2A3DA4B3u, 0x10B7770Bu}}},
+    {{{0xF13F0351u, 0x77D2808Bu, 0x3D0389E7u, 0x3BC15B8Du, 0x996950DFu, 0xC350F319u, 0x195E729Du, 0x33B35BAAu}}, {{0xCB8D7418u, 0x2BC503CCu, 0xBC889B70u, 0xAA6560EFu, 0x248D52BCu, 0xF9464036u, 0x640ABF87u, 0xA58A0185u}}},
+    {{{0x041EAD4Bu, 0xFFE8879Au, 0x691B03C1u, 0x3A75EDFBu, 0xFAFE76BEu, 0xC714734Eu, 0x8C8F337Eu, 0xBFC90C0Cu}}, {{0x86FEDAEDu, 0x7452C6F0u, 0x32E0AE3Eu, 0xFB468EFFu, 0xD5042D36u, 0x4DBA718Du, 0xE09CDED2u, 0x7A9481B1u}}},
+    {{{0x4414BB36u, 0xD71DC7B2u, 0xCAD7BCA6u, 0x56F6E109u, 0x071F7E22u, 0x5CB83AD2u, 0x22C93F95u, 0x374DEEAEu}}, {{0x8DAF734Au, 0x7875BEA9u, 0x00E54321u, 0x3828D663u, 0xF806F729u, 0x16032C06u, 0x4FCD4F99u, 0x171165B6u}}},
+    {{{0x75BB3B3Eu, 0x26E7BD07u, 0xEF9F73CBu, 0x50753617u, 0x8C2D3F5Bu, 0xDCA5993Eu, 0xBE3FAAA4u, 0x732DF11Cu}}, {{0xD7366693u, 0xCC577E1Eu, 0x64C58436u, 0xE69DAD6Du, 0x40253916u, 0xCB7E2558u, 0xDE8F9977u, 0x7F41903Eu}}},
+    {{{0xE5B7AD0Du, 0x694C856Eu, 0xA9D0D1D3u, 0x76EE767Cu, 0x96D16C44u, 0xC2D0D8A4u, 0xABB5E00Du, 0x3A55690Du}}, {{0xB2E8C407u, 0xD6C98790u, 0xCAC31218u, 0x01CACB8Au, 0x97EF99F3u, 0xFB21FBACu, 0x75A0657Bu, 0xC3E28E19u}}},
+    {{{0x888DC3B9u, 0xC5F5B3C1u, 0xE9774C99u, 0x19A66924u, 0xCC97EF60u, 0x28DA8840u, 0x603947B4u, 0x4CE094B9u}}, {{0xE5C0DE52u, 0x2C14F7B6u, 0xC9EA0650u, 0x16205B20u, 0xCA76ACA2u, 0xD57B4D80u, 0xBF1A9B3Eu, 0x05390FBAu}}},
+    {{{0x6AE7D616u, 0x5E8A64ADu, 0xB62A9F0Cu, 0x944DBAF2u, 0x95AEB0DCu, 0x7C46E073u, 0x7F3AEAE5u, 0x2380C09Cu}}, {{0x161BBC1Au, 0x0099BE48u, 0x8F846756u, 0x93AF9214u, 0xD509B09Au, 0xF1598AEFu, 0x3464956Au, 0x6F8E8619u}}},
+    {{{0x0AAAFE5Au, 0x4C375E0Bu, 0xA509AEDDu, 0xE25470B3u, 0x5B023FD0u, 0x96D8A6A9u, 0x6FC667DEu, 0x9A968EB7u}}, {{0x4ED975C0u, 0xCE6BFD42u, 0x65E70CC0u, 0xE7B5880Au, 0x3D861D0Eu, 0x54FC66D0u, 0xA6D3BA29u, 0xABF6FB07u}}},
+    {{{0xEFA32402u, 0x8D962D14u, 0x3C66A534u, 0x5E659C61u, 0xB038034Eu, 0xE0F7DB3Bu, 0xD74CEAABu, 0x180A4ECEu}}, {{0xC4894B4Eu, 0x3203780Du, 0x7FDCD18Bu, 0xA602C593u, 0x24FEBE85u, 0xADBBFC2Fu, 0x47BAD7E2u, 0x498A4D57u}}},
+    {{{0xF34C6397u, 0x3751CBF9u, 0x0074CD09u, 0x07DD3DB5u, 0x2536B221u, 0x4F0AEF80u, 0x01716195u, 0xD3C6FBEDu}}, {{0x68CB3F9Cu, 0xB1FC8D05u, 0x905E0E00u, 0x8A0C7708u, 0x92EAB646u, 0x9458394Du, 0x5E5E2AF1u, 0x4A0DD2C5u}}},
+    {{{0x99B2DF82u, 0x927A47B0u, 0x47104FB1u, 0xEC5E7A16u, 0xCCE32C04u, 0xCC92D18Eu, 0x62BFB92Cu, 0x405A645Cu}}, {{0x09307DBFu, 0x5DA2834Au, 0xCEDC462Bu, 0x2FFA9DB2u, 0xE237E712u, 0xF5CACA61u, 0xF44D96E0u, 0xBC3CB414u}}},
+    {{{0x0AC3137Eu, 0x19B82593u, 0xA5AF6446u, 0xFE925B62u, 0x6AAB3953u, 0xE02F06A7u, 0x129243B8u, 0x4CBDE398u}}, {{0xEEC02FE6u, 0xC008F15Cu, 0x588EAD60u, 0xD193A7AEu, 0x4B94C370u, 0x50092A13u, 0x8F136159u, 0x6CE55460u}}},
+    {{{0xE50CE56Eu, 0xC7119E23u, 0xD77914A3u, 0xC8293AF0u, 0xACBE7816u, 0xE68590FCu, 0xCE531AF3u, 0xAA6DC4D3u}}, {{0x7DEDD739u, 0xB9DF3A34u, 0xF8F710A8u, 0xC11984DAu, 0x5E65E663u, 0x6E1F6EDCu, 0xA241E529u, 0xEBC7998Fu}}},
+    {{{0xE0FBF84Bu, 0x47A2306Cu, 0xBC3F0B8Au, 0x03C48FCBu, 0x0C14CEBBu, 0xB8BD9C73u, 0x82B16247u, 0x4B9D333Cu}}, {{0xA36C3C48u, 0x239EE4B4u, 0xE2F5B5E6u, 0x6766D543u, 0x2679B7EBu, 0x55313D98u, 0xE24CC152u, 0xFD7FC7FBu}}},
+  },
+  { /* 16^14 */
+    {{{0x99C43862u, 0x0A841E15u, 0x8397E669u, 0x71A7F4F1u, 0x89B81BDEu, 0xE6D08186u, 0xC1CDFF21u, 0x385EED34u}}, {{0x542E5453u, 0xC0458FE5u, 0x2086DC8Cu, 0x6B304EECu, 0xE9EBF457u, 0x6701DE19u, 0xE8EA23F5u, 0x283BEBC3u}}},
+    {{{0x78F2827Cu, 0xDC83A270u, 0xBEFC1CE2u, 0x47C82642u, 0x4D5F67D1u, 0x0456BE13u, 0x3DAF5480u, 0xF6F62208u}}, {{0x20AAA102u, 0xD15B20B5u, 0x48321BF6u, 0xE657CA74u, 0xB367CEE7u, 0xAF2C5715u, 0x7DE73A0Fu, 0x1BCD4E81u}}},
+    {{{0xB6E2D9B3u, 0x14BD306Au, 0x1B38D635u, 0x41DB9283u, 0x39CF8456u, 0x5E12EA61u, 0x97C705E7u, 0x19A314F3u}}, {{0xCBAAAF33u, 0xD552EE25u, 0x2404BE56u, 0xA5021D1Du, 0x87F528B3u, 0x234965F8u, 0xDAC728DDu, 0x6CACD8F5u}}},
+    {{{0x715ADCB6u, 0x9D893209u, 0x7D8C6F36u, 0xCD91C3CEu, 0x3D1FC255u, 0xBD70CB3Cu, 0x8F953DE2u, 0xFB26E518u}}, {{0x58BA68F3u, 0x49DBCA3Bu, 0xB8B7AB54u, 0x16D2CB31u, 0x19D01769u, 0x58E846A7u, 0x1012A34Du, 0xF3E12881u}}},
+    {{{0x12F00480u, 0x7D8587EBu, 0xA100DCEEu, 0x20358804u, 0x64F67219u, 0x55DC9863u, 0x95A8DAA3u, 0x5840ED4Bu}}, {{0xBE22CF9Eu, 0x1592D5E2u, 0x52AE3872u, 0xBA752254u, 0xA15DD8DAu, 0x07968DEAu, 0x220BF141u, 0x670CDA6Bu}}},
+    {{{0x63A52264u, 0x52E737D9u, 0x15400B37u, 0xD0ADFC03u, 0xAAE51CFFu, 0xA806E2A9u, 0xE8187FE9u, 0x85FFDC0Du}}, {{0x82DA2082u, 0x98C7D29Au, 0x2B179D04u, 0x678182C9u, 0x0554706Cu, 0x0BE568F5u, 0x7AE2948Du, 0x3FEE3018u}}},
+    {{{0x23F54C42u, 0xE484DEE8u, 0x269A3DC8u, 0x45DC1A3Cu, 0x4ECE5325u, 0x1DC58C1Fu, 0x346918FBu, 0x9F5701A5u}}, {{0x2FEB6A21u, 0x860E1C49u, 0xB219E527u, 0x89EE784Au, 0x5729BFDDu, 0xBFB95B6Bu, 0x801D9E57u, 0xCE7B8FB8u}}},
+    {{{0x60788C1Eu, 0xED44DB75u, 0x0E8BD1D7u, 0xD18C3706u, 0x763CEAB7u, 0x28F5C6BCu, 0x11B9132Du, 0x89912259u}}, {{0x8E8F0EF1u, 0x635C4222u, 0xFDEF9E11u, 0x36969C84u, 0x59B136FAu, 0x27B87635u, 0x7CC9AC9Bu, 0xDA8B4D98u}}},
+    {{{0x9522461Au, 0x7E941332u, 0x5BC71832u, 0xBCB30A26u, 0x067EF9A0u, 0x01BB8701u, 0x235A8CFCu, 0x27F61169u}}, {{0xC7301A2Du, 0x6AA4CAF9u, 0xDA863944u, 0xE4981B20u, 0x27428EE8u, 0xEA48C561u, 0x900A6AD2u, 0xE512F1A9u}}},
+    {{{0xE6DDD3ACu, 0x6DBD9895u, 0xA2F00651u, 0x7BF8F633u, 0x6CE2D5A3u, 0x5852D90Du, 0x732A2E09u, 0x96EE53E6u}}, {{0x729B6FDEu, 0xFBF25B36u, 0x6C66DC06u, 0xEF0D0797u, 0x1EBF1E0Eu, 0xD8C4C971u, 0xE4B629F2u, 0x39B9CAEAu}}},
+    {{{0xD14F36B9u, 0xCCE2C9B2u, 0x63B9F390u, 0x2598CABBu, 0x35F4A981u, 0x261BF2F4u, 0x6CEEF941u, 0x64077985u}}, {{0xE4B4B50Au, 0x894B1EE9u, 0x499CEEB2u, 0x8CDA0870u, 0xD85A7B6Cu, 0xEF90D75Fu, 0x44E56EFAu, 0xDA61928Fu}}},
+    {{{0xB6A88C9Cu, 0x9C1FF5A4u, 0x3149DF06u, 0xA37B6866u, 0x972CAA2Au, 0x8B21D9ACu, 0xE5479139u, 0x78659081u}}, {{0x75A7D19Bu, 0x5E059345u, 0x03AB6A15u, 0x12CF919Bu, 0x25E81961u, 0x69E8FA72u, 0x92A30D2Bu, 0x59A23077u}}},
+    {{{0x94D6B76Fu, 0xCEF63DF9u, 0xB4C815DBu, 0x7FE5A9FBu, 0xC09DFEAEu, 0x452F708Bu, 0x1C85669Fu, 0xA23750E3u}}, {{0x8DCCA8DAu, 0x41D92CCCu, 0xFDB848D1u, 0xE7707C11u, 0x4D411113u, 0xAC32FA3Eu, 0xA6E7DE6Du, 0xF7339B14u}}},
+    {{{0xD0C13079u, 0xD4FCDB13u, 0x54DD1688u, 0x6F3E5A01u, 0xEDAF3016u, 0x809FEA76u, 0x6E1F0EBBu, 0x5E52B50Bu}}, {{0x70E1296Fu, 0xC103C48Eu, 0x3D63CE1Cu, 0x4A3829D1u, 0x34A03EACu, 0x9B698785u, 0x3A354B0Cu, 0x199EDEE7u}}},
+    {{{0xFCEEE475u, 0x12EE9C64u, 0x40ED782Bu, 0xAB6AC828u, 0xF3CAFF41u, 0x5ED3C021u, 0xA3F2378Du, 0xBBF1AC07u}}, {{0x87FE5067u, 0x84622A00u, 0x438B41D6u, 0x24EB9D89u, 0x36B15FE3u, 0x10883CC8u, 0xEAD460E6u, 0xB4BFB8DEu}}},
+  },
+  { /* 16^15 */
+    {{{0xC3FAC3A7u, 0xC606ED86u, 0x5947FBC9u, 0x0FDDF84Au, 0x413DFA18u, 0x637C73A4u, 0x03ECF191u, 0x06F9D9B8u}}, {{0x3A842160u, 0xD8689060u, 0x5C281002u, 0x7EA4DD2Fu, 0x0E45C4D4u, 0x69B8E2A3u, 0x603059BAu, 0x7C80C68Eu}}},
+    {{{0x4B7FD72Du, 0x5C9D2274u, 0xA7E4DA17u, 0xDA1745E5u, 0x84482939u, 0x1CDC36C2u, 0x252B411Cu, 0xAE86EEEAu}}, {{0x4EEE38BCu, 0x2334CB7Au, 0x1472F728u, 0x8D921155u, 0x589FF0E9u, 0x62AB0ACEu, 0x707302F9u, 0x19E993C9u}}},
+    {{{0xD21CE204u, 0x24ED75E8u, 0x426763D5u, 0xB2A7258Eu, 0x9CA6F72Fu, 0xB8374D85u, 0x62B3C64Fu, 0x43CA41D1u}}, {{0x934A8F6Bu, 0xE525044Eu, 0x3EA4A468u, 0x9AB6C7B3u, 0x18DBA31Fu, 0x1C650F92u, 0xE37023FAu, 0xDCEA5A82u}}},
+    {{{0x7C169290u, 0x7A147426u, 0xCF36F2EEu, 0x8718BE75u, 0x56DC2C48u, 0xE61D2F8Cu, 0x0BBFFF55u, 0x2248C9F9u}}, {{0x883EA257u, 0x369D8A12u, 0x35DA2BE2u, 0xE1637502u, 0xB435BA18u, 0xA506BB55u, 0x2D21EED7u, 0xFA059469u}}},
+    {{{0xEBE6EFDAu, 0x64FCE92Cu, 0xF8728059u, 0x922D4FF3u, 0x785A506Du, 0xB666F723u, 0x22892BF5u, 0x9C3E06EFu}}, {{0xA7AEFC7Du, 0xDF140F32u, 0x7B36FDF7u, 0xD43BC868u, 0x4CE26FD5u, 0x8AF0B2D4u, 0xE762923Du, 0xA7B709E5u}}},
+    {{{0x14978583u, 0x5B3A4320u, 0xF061613Fu, 0xCDD6E9AEu, 0x90F92214u, 0x49784199u, 0x9CF23137u, 0x30ABF89Bu}}, {{0x1DC75777u, 0x44618035u, 0x3BB584ACu, 0x63120EA2u, 0xD0E1AB80u, 0xCDF7B4F2u, 0x477F7498u, 0x4B035115u}}},
+    {{{0xC6C88BE2u, 0x79127AB5u, 0xD06EE5E2u, 0xEA2C7820u, 0xD830775Bu, 0x3BB72759u, 0x13E20F03u, 0x5D6F8AA3u}}, {{0x0D7AD75Du, 0x892E553Fu, 0xA6BF92C2u, 0xEDAB6F8Eu, 0xAB08BC20u, 0xC71AAF33u, 0x8D56D4E8u, 0xADC4B18Du}}},
+    {{{0xB50964E3u, 0xFD0DAC4Bu, 0xDD1C6F76u, 0xA99F0877u, 0xD94085D0u, 0x4AC11B48u, 0xE05C4407u, 0xE11A6E16u}}, {{0x0682BFC8u, 0x767FBF8Bu, 0x38318C6Fu, 0x17ADC6E1u, 0x96F0AF24u, 0xE1AD5E25u, 0x87A2D430u, 0x87D6065Bu}}},
+    {{{0x92D1B844u, 0xF289351Bu, 0xC173E484u, 0xC69C0382u, 0xC1388BC5u, 0xC86B15C3u, 0x04A60D5Fu, 0xF57D35C3u}}, {{0x61266837u, 0x464BABBDu, 0x30915C6Au, 0x70069720u, 0xA9E4634Cu, 0x7904D3F5u, 0xA98EF4D9u, 0x707F3D9Eu}}},
+    {{{0xB21F51D3u, 0x73971647u, 0x2C39FDF8u, 0x11F80D46u, 0x9DA10BA8u, 0xCE8D419Bu, 0x6726A955u, 0x6A73FB21u}}, {{0xA5224B17u, 0x01824DD9u, 0x8B60B774u, 0x2DB48246u, 0x49721132u, 0x7FEA7D29u, 0xA1EDF3C2u, 0x4F3CEEFCu}}},
+    {{{0x3CC7CB09u, 0x234D007Fu, 0xA1D1B435u, 0x3BC7EB68u, 0xE3D87146u, 0xF596E1FEu, 0x3A6594A5u, 0x13E7607Au}}, {{0x08079160u, 0x1BE75A8Au, 0x66B57641u, 0x65EAE2BBu, 0x5B34299Du, 0xE325FDD8u, 0xE8FBB8B1u, 0x284DC88Du}}},
+    {{{0xEC288015u, 0x39A37E63u, 0xEEDC99CCu, 0x4673F853u, 0xA05B6AA6u, 0x681FAC61u, 0xD936DE6Fu, 0xAA014EAAu}}, {{0x46C1006Fu, 0xDF814E66u, 0x43CECAD9u, 0xEF4B9B07u, 0x3F7B0F63u, 0xC3F2A7E4u, 0x4636BE9Au, 0x3DE913C0u}}},
+    {{{0x58CDEE05u, 0x0060CE12u, 0x172EC3B9u, 0xA8761FB2u, 0x1B06901Du, 0x2400250Bu, 0x568182E6u, 0x29BEA322u}}, {{0xA62651C8u, 0x9E4A0359u, 0xC8C698E3u, 0xF9FC31B6u, 0xB8705EC7u, 0xA9009B3Fu, 0x690E9A0Eu, 0x7C40D9A2u}}},
+    {{{0xF11D45F9u, 0x4CF85578u, 0x6C796614u, 0xBA4C1CDEu, 0x77DB796Eu, 0x4EA2EF2Cu, 0x5337512Bu, 0x36AEE3D3u}}, {{0x7CFEBAD4u, 0x9D3BAB3Fu, 0xAC473606u, 0x004B35D0u, 0x07C98F54u, 0x79CB9547u, 0xCD69609Cu, 0xCAADDA35u}}},
+    {{{0x12F18ADAu, 0x11B6C756u, 0xBBDBDBCCu, 0xD460BD93u, 0xF33D4A59u, 0xD9C36FAFu, 0x238288E7u, 0xF521786Du}}, {{0x23953516u, 0x1DD68AFDu, 0x6C5BF098u, 0xAA5EF4A3u, 0xBCD1D1D6u, 0xECC26102u, 0x6038DB57u, 0xE0686FBFu}}},
+  },
+  { /* 16^16 */
+    {{{0x42D0E6BDu, 0x13B7E0E7u, 0xDB0F5E53u, 0xF774D163u, 0x104D6ECBu, 0x82A2147Cu, 0x243C4E25u, 0x3322D401u}}, {{0x6C28B2A0u, 0x24F3A2E9u, 0xA2873AF6u, 0x2805F63Eu, 0x4DDAF9B7u, 0xBFB019BCu, 0xE9664EF5u, 0x56E70797u}}},
+    {{{0xC0ADE462u, 0xFC696D32u, 0xEADBCF29u, 0x0D4CDDC8u, 0x04C80CD5u, 0x120EF31Bu, 0x50CEBDAEu, 0x8D262002u}}, {{0x0F26470Cu, 0xD8E0A8B9u, 0x72678B3Au, 0x1D4AFB4Eu, 0xC3EE36BAu, 0xD31F6F2Du, 0x715BF437u, 0xEBED3BB4u}}},
+    {{{0x059AB499u, 0xABD9D3F2u, 0x6E73C330u, 0x0B13299Cu, 0xC67F01BCu, 0x5D2196B3u, 0x015C05BAu, 0x78BAAFF3u}}, {{0xFEE097FDu, 0x681D2318u, 0x8D125199u, 0x91632EEEu, 0xED82082Eu, 0xAFCA84E0u, 0xDB06C0AFu, 0xAD4BDCDBu}}},
+    {{{0x1516E633u, 0x9164643Eu, 0x072D9C8Bu, 0x8ED4930Du, 0xF594D03Bu, 0xCE4068A1u, 0x6EAEBEA9u, 0x1238C076u}}, {{0xC77B7805u, 0x05CDB728u, 0xCC740228u, 0x0946252Du, 0xD1C3DC17u, 0xD6C979E2u, 0xBB271359u, 0x8A9DB02Du}}},
+    {{{0xFD06ACE6u, 0x4493E16Cu, 0xF83A20CAu, 0x23709B36u, 0x4929AB1Au, 0xC20B8498u, 0xA14AE3D4u, 0x6F70F211u}}, {{0xB602D5DEu, 0x048BED34u, 0xBE5AC5EEu, 0x75329566u, 0x47B99F50u, 0x6F95D8F3u, 0x94027B73u, 0x791E8A30u}}},
+    {{{0xA5CD5379u, 0xC3063330u, 0x5870BCADu, 0x2DB79438u, 0x8AA4D223u, 0xA782481Bu, 0x6BDD1382u, 0x17C072D5u}}, {{0xB108CD25u, 0xF7CAE051u, 0x265BAD0Du, 0x8959AC76u, 0xAF1D034Fu, 0xE77C1247u, 0x283DA064u, 0xD901BDF4u}}},
+    {{{0x60EE1B40u, 0xDC8EE3EEu, 0x71E96247u, 0x8CED485Bu, 0x9103CCD4u, 0xF80949F1u, 0x9D6AA415u, 0xE1599DB2u}}, {{0xD78F93A6u, 0xE1D6265Eu, 0xBC32999Du, 0xA6363A74u, 0xAA2FC7CFu, 0xEFAF894Au, 0x2A81D4A0u, 0x79336223u}}},
+    {{{0x788E7A66u, 0x19B01552u, 0x2B0EC216u, 0xCDDCD728u, 0x8A6A11B9u, 0xE7B2EA75u, 0x70CB9C15u, 0x271D5B07u}}, {{0xE03C9727u, 0x7A8D7258u, 0x508A824Eu, 0xE2A065E3u, 0x49AC877Fu, 0xE457D099u, 0x34E7F491u, 0x5D3AA458u}}},
+    {{{0x49C00C3Eu, 0xF81DFA28u, 0xC91208E2u, 0xF00E8F03u, 0x3D451859u, 0x436562D3u, 0x04406956u, 0xBB0B0497u}}, {{0x11955A35u, 0x799A982Du, 0x905DC90Au, 0xFE67044Eu, 0x7AB1B052u, 0x655D2FA1u, 0x53AF9F63u, 0x4067E458u}}},
+    {{{0xA8A923B7u, 0xDA1E87D8u, 0xD81C5B30u, 0xAEF650EEu, 0x68338266u, 0x540708ABu, 0x21999A70u, 0xAC2ACB9Bu}}, {{0xD7CD20A6u, 0xA2DC124Au, 0x12D27A4Fu, 0x60B0D0BFu, 0xF13D9EB3u, 0x1C9AFA0Du, 0x11C1724Du, 0x76844285u}}},
+    {{{0x05DD32E6u, 0xE0E75B9Cu, 0xB53E5EE7u, 0xC663B551u, 0x075A5FBFu, 0x9B649DBEu, 0x4195789Eu, 0xDC5A4155u}}, {{0x754A99B9u, 0x80E7DB7Au, 0x76E49BCFu, 0x2FF2EE90u, 0x01BF5944u, 0x6DCEA5E2u, 0x3F9F67A7u, 0x4AF3A8A6u}}},
+    {{{0xCA2D8DAEu, 0x5793C018u, 0x1FD25EA9u, 0xAC32A5F9u, 0x9CB2256Eu, 0xBA6B25EFu, 0x621192F9u, 0x88271C02u}}, {{0x3E1E77D9u, 0xFB426C0Fu, 0xC717D099u, 0xC300876Du, 0xE5ABF5ACu, 0x401C8B3Au, 0x507176AAu, 0xD719DD53u}}},
+    {{{0x4544E7CBu, 0x9ED45BACu, 0xB5296035u, 0xA1064225u, 0x71014E99u, 0xBE3354A5u, 0x39873B9Du, 0x156E1970u}}, {{0xAD250A37u, 0x6D5392C0u, 0x5EB439CDu, 0x9496D58Du, 0x63834BE8u, 0xA939572Au, 0x8F31907Du, 0x6BC08D9Fu}}},
+    {{{0x9C89240Fu, 0x8F5BADC9u, 0xFA2E7B85u, 0x74F8C4BAu, 0x97E0E176u, 0xE18EE091u, 0x652D7338u, 0x15B8390Du}}, {{0xE326F04Au, 0x2E2F9EF8u, 0x5C1A3335u, 0xB30367ABu, 0xC7A59F99u, 0x3ABDD7CCu, 0x8EFE8D08u, 0x786CF20Cu}}},
+    {{{0xC59853CAu, 0xDBFBC29Cu, 0x9F19BF54u, 0x48E9626Bu, 0x28E71613u, 0x6BCA76A2u, 0xCB684382u, 0x4269BCCEu}}, {{0x35B8D367u, 0xDA958EF5u, 0xF9E5A8A3u, 0xFD3940A5u, 0xC431A409u, 0x23C84CA9u, 0x82C016B7u, 0xED2B1C1Au}}},
+  },
+  { /* 16^17 */
+    {{{0x8134AB83u, 0x721D74D2u, 0xF7643397u, 0x741B3F9Au, 0x89665868u, 0x2BD1770Du, 0x2DE0B7DAu, 0x85672C7Du}}, {{0x790313A6u, 0xC8E3094Fu, 0xC5298F44u, 0xE77F17FCu, 0xFA62C2E5u, 0x6374049Bu, 0x5B43B2EBu, 0x7C481B9Bu}}},
+    {{{0x1F17FC25u, 0x998B90BCu, 0xDF2E6D96u, 0x3B89EA46u, 0x15C8A61Fu, 0x36C18612u, 0x740F9EC0u, 0x534CCF6Bu}}, {{0xCFE86E76u, 0xD71C7F6Eu, 0xBFDD28DDu, 0x0AE3D277u, 0x32D54355u, 0x462AE3DDu, 0x9C8B2DDBu, 0xD5715CB0u}}},
+    {{{0x83BA9000u, 0xFDF0723Au, 0x6825E8B6u, 0xC4872F9Cu, 0x5840143Du, 0x68487607u, 0xFFF1D8C1u, 0xAC3874F9u}}, {{0x6F10CF0Au, 0x4DA3C7D9u, 0x7F66E9FAu, 0x085E350Du, 0x94117F93u, 0xB862DDE8u, 0x08A1C069u, 0xAA65E923u}}},
+    {{{0xE8BEE8B6u, 0xC7170923u, 0xECFBC8D2u, 0x79020D47u, 0x18F8AAEDu, 0x081E1420u, 0xEE87B7F3u, 0xA91D1F5Cu}}, {{0x410644C1u, 0x003D16AAu, 0x628CB225u, 0xF800569Fu, 0xDDDAD3B2u, 0x5A7189C8u, 0xE2DF8EE1u, 0x748A324Eu}}},
+    {{{0xED06DBD4u, 0x1A606F66u, 0x78A20D08u, 0xEC0E3F85u, 0xE9A3E729u, 0x9AD14075u, 0xAA687013u, 0x570D5CE7u}}, {{0xBD1ED495u, 0x5A65BECEu, 0xC6460BEDu, 0xB683A36Du, 0x11D01BBBu, 0x05B66E67u, 0x420E02F6u, 0xA6AE5349u}}},
+    {{{0x17BA402Eu, 0xAE5D630Bu, 0x2D042989u, 0xC3B81A5Cu, 0x4848E3C3u, 0x58BEAD0Cu, 0xD18FA02Au, 0x8E891B5Cu}}, {{0xC4FAD9E0u, 0x8E1B6279u, 0x2157A7EEu, 0xAF650C24u, 0x04F2A306u, 0x0B38D0E4u, 0x6A9EC668u, 0xE5D30E0Eu}}},
+    {{{0x092D230Eu, 0x434C1F92u, 0xD2933928u, 0xDAEE32A0u, 0xE0366EF5u, 0xF87C229Eu, 0x28268BB6u, 0x75B5F870u}}, {{0xD51570B8u, 0x037CBDFBu, 0x0511F8FBu, 0x0267A4B0u, 0x54DDFA8Eu, 0x63D78745u, 0xE3A78523u, 0x527CCE21u}}},
+    {{{0x5984CF74u, 0xAA1A1C25u, 0xBEF61F10u, 0x0735AE45u, 0xE2D4383Cu, 0xC1A214DDu, 0xD90C8E35u, 0xC15C8C23u}}, {{0x39CCB000u, 0xC4A48CD8u, 0x50B015A2u, 0x47BF772Du, 0xE25FD7BAu, 0xC8DC6F45u, 0x28522235u, 0x2BA954D8u}}},
+    {{{0xC34FCC0Eu, 0x47B6BF6Au, 0x2BE3884Cu, 0x927F10A4u, 0x27D259C8u, 0xB0A5B80Eu, 0xE1EDDEC2u, 0x44FC8EFAu}}, {{0x719C420Au, 0x9CFF031Eu, 0xBCD0489Du, 0x720E94A4u, 0x8833D3D7u, 0xE49267E7u, 0xBA9B1367u, 0xD2C7DE94u}}},
+    {{{0x8942DEA9u, 0x58413F0Eu, 0xB8B7F130u, 0xAB35A98Cu, 0xA60A87FEu, 0x7946AD8Bu, 0x34285DB6u, 0x15668613u}}, {{0x367BE3DFu, 0xF92546F0u, 0x8B23EDCBu, 0xDE482868u, 0xFB20FD22u, 0x04E894EFu, 0x0E82F051u, 0x4F3597AAu}}},
+    {{{0x8BB69991u, 0xD5A481FCu, 0xC3307175u, 0xFFFB3FA2u, 0x0E02F535u, 0x866A1662u, 0xBACE7BC6u, 0xDEA2BA47u}}, {{0xF16FE2DFu, 0x706742A9u, 0x621ED9BCu, 0x229DCDB3u, 0x84F7B9E7u, 0xAC5CBFECu, 0xD90C28E4u, 0xAE28BFD6u}}},
+    {{{0x536BCFE8u, 0xE61ED61Eu, 0xD69B7BB3u, 0x0E0C179Eu, 0x306B319Au, 0x472CA8F2u, 0x1CC6999Bu, 0x1332F8BCu}}, {{0xDAE78402u, 0x51B0DD2Cu, 0xD5A8C214u, 0xBA93B424u, 0x35DC0681u, 0x13F67C45u, 0x29602ED7u, 0xC39DC7EEu}}},
+    {{{0x514FC9CCu, 0x8C240D02u, 0x29A46165u, 0x26D00ABCu, 0xC4B8A836u, 0xEFC1CF6Cu, 0xA6E168D6u, 0x3968FC98u}}, {{0x5FAD37DDu, 0x01939489u, 0xFF88F334u, 0x1A146576u, 0x1AAD32C9u, 0x1237982Du, 0xDB4B5928u, 0x789CBBD0u}}},
+    {{{0x14CC84BFu, 0xC023AF3Eu, 0xEEBA1F27u, 0x80BF1D6Du, 0x9C2A4953u, 0x830E3715u, 0x4E540816u, 0xB5DD6936u}}, {{0xE374750Cu, 0xC785217Cu, 0xDD6B1A90u, 0x353110DEu, 0xC58D4145u, 0x6BD18733u, 0x53C7CB6Bu, 0x4B36EC58u}}},
+    {{{0xAE0C85F1u, 0x0AEC2191u, 0x603A3A25u, 0xA6A52E53u, 0x957945D5u, 0x26B25DF0u, 0x98E06A29u, 0x68969106u}}, {{0x2DC1DE21u, 0x2C748233u, 0xA0D50392u, 0x1F40C19Du, 0xD845D72Du, 0x56F305C1u, 0xB38C9792u, 0xAEFD3FB4u}}},
+  },
+  { /* 16^18 */
+    {{{0x60C82A0Au, 0xFFD959AFu, 0x0F668832u, 0x0F9226C6u, 0x919413B1u, 0x6B06C9F1u, 0x9B1988A4u, 0x0948BF80u}}, {{0xD8C8E589u, 0xD4CB7F88u, 0xC97CD2BEu, 0x6D4DFF08u, 0xD1C3418Cu, 0xDC6B74C5u, 0x6DCB6646u, 0x53A56285u}}},
+    {{{0x7E8B000Au, 0x396EB045u, 0x1E825E51u, 0xEF16C133u, 0x6291F0B6u, 0x0D5CE4C6u, 0x372E5936u, 0x26952C7Fu}}, {{0x05EF705Au, 0x8C3D401Fu, 0x653D6731u, 0xDEBE398Fu, 0x2D688422u, 0x62BC893Du, 0x5800A688u, 0xF513EA4Cu}}},
+    {{{0xB8C8AC7Fu, 0x7282FE5Fu, 0x65E2AA52u, 0x641242EEu, 0x2056F849u, 0xB5C3396Du, 0xE3822BBCu, 0x9945B2FBu}}, {{0x69AEA3B0u, 0x96D943A1u, 0xEEDACDFAu, 0x282F7A23u, 0xFB28EFF5u, 0x607DB44Fu, 0x4B0F282Du, 0x3EEFED82u}}},
+    {{{0x76134F96u, 0xF1025889u, 0x72D6B0E9u, 0xF5211965u, 0x131FF243u, 0xBEF2BE8Bu, 0xFC23C5BDu, 0xC62E58E6u}}, {{0xD14CF97Eu, 0x82277ED4u, 0x63731C3Eu, 0xBCFB8535u, 0x53141FC5u, 0x8C3D6767u, 0x45B1A167u, 0x4397827Du}}},
+    {{{0x969E353Au, 0xED1D79E3u, 0x52BBE1F6u, 0x10A04408u, 0x7107D5FEu, 0x235F8222u, 0x205870E6u, 0x2A314C6Bu}}, {{0xE5746067u, 0xC25926E1u, 0xDB2658BFu, 0x138A54AAu, 0x6BAA1BA0u, 0x1A463E47u, 0xF35A27ACu, 0x15A4AC0Bu}}},
+    {{{0x92FCCF64u, 0x3BAA4998u, 0x2581318Eu, 0x3BD278DEu, 0x77C95DBFu, 0xB068772Cu, 0x0EB4637Du, 0x0C7D115Cu}}, {{0x2878FEE0u, 0x53F6D3B3u, 0x959AE68Du, 0x48785D83u, 0x478AF145u, 0x7AA424B8u, 0x1925B044u, 0x4AA8747Bu}}},
+    {{{0xE9B84966u, 0x89E2F49Eu, 0xDD7F3FF9u, 0x1B4F4106u, 0x3A6B6C91u, 0x498B6FAFu, 0xB703FC2Du, 0x5959A500u}}, {{0x87473A6Au, 0x40A66321u, 0x8CFE2426u, 0x9100DCC0u, 0x0DC82A70u, 0xF9431282u, 0x1F5CA897u, 0x0370E674u}}},
+    {{{0x0B188CBBu, 0x3686F880u, 0x0807DE97u, 0xB81C0320u, 0x716622B0u, 0x1683329Au, 0x0EEC5C74u, 0x10746052u}}, {{0x1F272124u, 0x01D7B636u, 0x8DCE3DA6u, 0x242E0D74u, 0x9CF54A11u, 0x35326B9Bu, 0x9A21598Cu, 0xABE5D4C0u}}},
+    {{{0x2BC6B173u, 0x3B0C9B92u, 0x7EED3FEBu, 0x7DD8623Cu, 0x305B5F9Du, 0xE1160C46u, 0x37222FE8u, 0x9EEB3139u}}, {{0x9723A71Du, 0x9539620Du, 0xD0E70C4Bu, 0x0EA71ABEu, 0xBBBA1AE3u, 0x952AABFDu, 0x110ED58Du, 0xE121F1E0u}}},
+    {{{0x2AD2CF25u, 0x457E9BC9u, 0xBC927A94u, 0x7BA49B4Du, 0xA27B3C2Fu, 0x18D1E80Bu, 0xF3DAA9CBu, 0x520D9A9Bu}}, {{0xA285181Fu, 0x610B6C83u, 0x11BF70C7u, 0x2BAB0B65u, 0xB4BA9706u, 0x48F0AE71u, 0x10271EAEu, 0xE526F49Bu}}},
+    {{{0x7EC805F3u, 0x5772443Fu, 0x09D99591u, 0x7DE40F75u, 0x806E9788u, 0x16EBB238u, 0xC7F718F5u, 0x39CC4FE4u}}, {{0x3A3C48D3u, 0xD191A0C1u, 0x3FC912E4u, 0xBBB95737u, 0xCF42DE7Du, 0x151E6693u, 0x5A46F8F3u, 0xECB1472Cu}}},
+    {{{0x548D5622u, 0x8B5AEBACu, 0x7A51BD2Eu, 0xE1DB07EFu, 0x1BF3381Bu, 0xA39586A8u, 0x61689535u, 0x5FC6C11Eu}}, {{0x01AC1683u, 0x0D0D8401u, 0xE6C7BF30u, 0x0E05AD08u, 0xB0367ACBu, 0x9C19BA2Du, 0x9AA1D9DBu, 0x10E80E54u}}},
+    {{{0xCE22580Eu, 0x93D62FB5u, 0xD2D6F887u, 0xC7132896u, 0x64DBD4D2u, 0x6892FFDEu, 0x66ECDC69u, 0xF94C8074u}}, {{0x7127DB82u, 0x81E523F6u, 0x32371D4Eu, 0x9887EC45u, 0xAB5A81F6u, 0x9194BFF6u, 0x6785225Au, 0x5E9C7FDCu}}},
+    {{{0xC0A3D8A5u, 0x123AB607u, 0x4573EF99u, 0x26D77D68u, 0x33ED09ADu, 0x3431274Au, 0xD872D6E9u, 0x5AA433E5u}}, {{0x6D3C2BA7u, 0xFB5F7EF7u, 0x2D9D6EF4u, 0x16475CF5u, 0xC728A561u, 0x19A394AEu, 0x682AE79Au, 0xDDCEA1FCu}}},
+    {{{0x10C4F21Fu, 0x6BE40BADu, 0x4D03DA7Au, 0x5024A959u, 0xDB1999D2u, 0xFCC02068u, 0x6AD5D162u, 0x8CCCB86Cu}}, {{0x729DFEA0u, 0xF7F126EAu, 0x8264BE28u, 0x4B92DCACu, 0x9C8758A5u, 0x699BEF54u, 0x62751C43u, 0x57F89658u}}},
+  },
+  { /* 16^19 */
+    {{{0xF38FD8E8u, 0xCCECD819u, 0xFC69752Au, 0xF1B0E44Du, 0xF02873A8u, 0x4F067CE0u, 0x461801C3u, 0x6260CE7Fu}}, {{0xB2B4AE17u, 0xC1A84E95u, 0x8051C198u, 0xECD29223u, 0x776A1EF7u, 0xA7F09049u, 0x6FA5B571u, 0xBC2DA82Bu}}},
+    {{{0x3D477C2Du, 0x0766746Fu, 0x96AAD27Eu, 0x16E65C51u, 0xE84F1A13u, 0xDEC8409Bu, 0x48AD1A73u, 0x85D8DA47u}}, {{0xC7D1DD70u, 0x2079816Fu, 0x33C4D5A6u, 0x94B0A020u, 0x31EFC7BCu, 0x586B5365u, 0x665C6690u, 0x58948B53u}}},
+    {{{0x41136602u, 0xBB0BA465u, 0x0D9E3A5Bu, 0x38C46F48u, 0xF2333B3Du, 0x3D058937u, 0x0482DFC3u, 0x87D12728u}}, {{0xD8AF6AACu, 0x4F683C41u, 0x6FD3BF7Cu, 0x87A88474u, 0xFF677453u, 0x926A276Cu, 0x0A5A03DEu, 0x71CE2487u}}},
+    {{{0x6C0B80D9u, 0x4850312Du, 0x0FDC47F0u, 0x4D1E7E10u, 0xCC3EE3EEu, 0x8C0892E9u, 0xE7EC4B96u, 0x8E2A7166u}}, {{0xD6B29F50u, 0x49C61F2Au, 0xD706349Au, 0x5297B688u, 0x716A9D48u, 0x2CEDD29Bu, 0xAE2CBE59u, 0xEADB0BA9u}}},
+    {{{0x48C5A916u, 0x5B205D73u, 0x535610F2u, 0x3F5C440Du, 0xDAB54AA1u, 0x6B0ACC63u, 0xE261E974u, 0xFD5D7D3Fu}}, {{0x7ADB8BDAu, 0xB14B37B0u, 0xBDCF6FAAu, 0xE5D73814u, 0x79C7B52Fu, 0xD2B43CA6u, 0xEEB55B07u, 0x0DD83ED0u}}},
+    {{{0xB0E74459u, 0x674A35C8u, 0x87DDB6DDu, 0xFEF23763u, 0x713C8A91u, 0x590F4658u, 0x4EC05680u, 0x28DF781Du}}, {{0xEF5E656Fu, 0x8DE07CC0u, 0x01AE6F0Au, 0xA3795BA5u, 0x90F22794u, 0xCB0DB178u, 0x6A130F17u, 0xF1499EA6u}}},
+    {{{0x35F7529Cu, 0x45D99096u, 0xB5BD51DDu, 0x38765B98u, 0x2D344381u, 0x2BA453C3u, 0x981C2612u, 0xDE0DD410u}}, {{0xE4CD88FEu, 0x63C20C02u, 0x889B7740u, 0x178924C6u, 0x2D7A3570u, 0x9B210982u, 0x10A2145Fu, 0xD70A6E9Du}}},
+    {{{0x2C4561BEu, 0x9921FA3Du, 0x1359D90Fu, 0xEE4AB2E8u, 0xD78F8950u, 0xDC8366ECu, 0x42BFF58Eu, 0x769BC758u}}, {{0xB0D9685Fu, 0xD5920BFFu, 0x7B7873ADu, 0x41A17776u, 0xF73F5D47u, 0xC8DCE4CEu, 0x2FE783BAu, 0x4BF81736u}}},
+    {{{0x38F76D11u, 0x3C82F48Du, 0xBF851557u, 0x1511000Fu, 0x39C292A2u, 0x69C5BEFCu, 0xDA4CF44Eu, 0xB26C208Au}}, {{0xE3B7356Bu, 0xDC1C00B1u, 0x9D82624Bu, 0x05003065u, 0x90CD6433u, 0xF0C4E87Du, 0x0949D33Cu, 0x1F1CF882u}}},
+    {{{0x948E129Eu, 0x31239DA0u, 0xC0289B10u, 0x2BD1DFB2u, 0x8E53C2DFu, 0xAF0F8DE2u, 0xB7B24CF7u, 0x66E3FCEFu}}, {{0x2EE7BBEAu, 0x72BBC360u, 0xD1A53B51u, 0x5FD7D99Eu, 0x4CDF80CBu, 0x598B5BF3u, 0xB770C0F6u, 0x20BF8B4Fu}}},
+    {{{0x669E22DBu, 0xF94E3B06u, 0x9F9C8933u, 0xAC993FF5u, 0x018C294Eu, 0xA7E3BD29u, 0xFC7FF523u, 0xFCEB14B8u}}, {{0x5C2260A1u, 0xBF572DB2u, 0x3A4EBE4Cu, 0xAD550E79u, 0x525F0924u, 0xFCD8A5A7u, 0x40D6B8D1u, 0x64AA6B3Au}}},
+    {{{0x29C71143u, 0x346D9DC5u, 0x44F057EAu, 0x2E7EADACu, 0x0023FA35u, 0x3CA7CCF9u, 0x22BBEA10u, 0x0EB45F96u}}, {{0x0B70B136u, 0xC8A8CDA2u, 0x6A2B1BF4u, 0xD65969EAu, 0x901E2857u, 0x573601F5u, 0x5838BD0Fu, 0x52C42F58u}}},
+    {{{0xA38A2755u, 0x6F084179u, 0x6549C550u, 0x53721A71u, 0x4B507FAAu, 0x55C17577u, 0x3CCD5CACu, 0x4E909A62u}}, {{0x23CCA3DEu, 0xAF7A49F6u, 0xD229800Cu, 0xB6CD5394u, 0x507559DBu, 0xCEF246DDu, 0x8CCE35AEu, 0xAE56DA87u}}},
+    {{{0x3C07D7C8u, 0x00CD148Du, 0xF829E32Fu, 0xE0F19675u, 0xBF3D4899u, 0x68470411u, 0xB230B73Du, 0x3CF9208Au}}, {{0xDA4CEE08u, 0x0C4A91DAu, 0xD5B8C59Cu, 0x9D4684C8u, 0x65C16720u, 0x51ECE6CAu, 0x15AF865Du, 0xDE03C64Cu}}},
+    {{{0x983BA64Du, 0xA8258959u, 0x88C595A3u, 0xBDE60F77u, 0xEB8E40E2u, 0xBFB0A145u, 0x22E04C03u, 0xC367455Cu}}, {{0x6A2181FDu, 0x614CC8F9u, 0xA1778F14u, 0x42626AACu, 0x84D964C7u, 0x080E0E6Eu, 0x69CB6033u, 0x3A520AD0u}}},
+  },
+  { /* 16^20 */
+    {{{0x2037FA2Du, 0x2953CC8Du, 0x75BFDC43u, 0x043EC8F5u, 0x4BBF4103u, 0x3D834841u, 0xAFC1D8D4u, 0xE5037DE0u}}, {{0x1D755BDAu, 0xE0E5DC84u, 0xEC481F10u, 0xBD5F5B03u, 0xFB990BDDu, 0xF9F98D09u, 0xAA94D3B5u, 0x4571534Bu}}},
+    {{{0x9E3D34EFu, 0x8C63C8C7u, 0x792A2DDBu, 0xC3AB217Cu, 0xD2D61B3Eu, 0xF40B6CF7u, 0x67FD5494u, 0xA5E00DA4u}}, {{0x2F7ADB4Cu, 0xB855C5CEu, 0x790900ACu, 0x5B60DCFEu, 0x99BF43D2u, 0x421726FEu, 0xE5608555u, 0x098FE5F5u}}},
+    {{{0x177E7775u, 0x388A8A6Eu, 0x88ED95F6u, 0xB5E15593u, 0xCF5291AEu, 0xE58543BAu, 0xFF9633CEu, 0x9D896A3Au}}, {{0xBA056691u, 0xEFCF6D3Au, 0xE299253Bu, 0xE899CD7Eu, 0x7250927Du, 0x94E964EDu, 0x3F49BF0Bu, 0xDD91A9E4u}}},
+    {{{0xD7B91252u, 0xE6737160u, 0x4477572Au, 0x6D4AFD2Eu, 0x1C9BFBC4u, 0x3519F4BBu, 0xEF3A2B40u, 0xA99415F5u}}, {{0x4BEDC264u, 0x73A377ACu, 0x590F4DDDu, 0x899A16ADu, 0x24F6F6B6u, 0xB9E2F10Fu, 0xAE81F84Bu, 0x82D0E64Cu}}},
+    {{{0x3C2A3293u, 0x5FDE04DEu, 0xE903476Cu, 0x5688B86Eu, 0x3282F4CDu, 0xD0EB0A57u, 0x71163792u, 0x8327B8EEu}}, {{0x8E0DF9BDu, 0x6BC854E1u, 0xEE326A41u, 0x96AFDAB4u, 0x62797084u, 0x18BB3EA6u, 0x6EE0A98Eu, 0x04997E26u}}},
+    {{{0x8C904ED3u, 0x15957F1Eu, 0x90585784u, 0xDF2A7458u, 0x31272384u, 0xF97F8E64u, 0x2DB818DFu, 0x00CF8C2Du}}, {{0x796F77C1u, 0xB009963Bu, 0xD32F6827u, 0x22991D79u, 0xD51BD811u, 0x19DD5C1Bu, 0xA781D441u, 0xAAAD000Eu}}},
+    {{{0x4562C042u, 0x2421B26Cu, 0x4B8DFB1Au, 0x092D2323u, 0x8F9A8ED6u, 0x97D6661Du, 0x2A6DB168u, 0x5AE42AAAu}}, {{0x8F79269Cu, 0xF905CCDFu, 0x107CD8DBu, 0x94E0DB95u, 0x60389D4Au, 0xAB5C1DDCu, 0x05FF051Eu, 0x99D93A7Cu}}},
+    {{{0x6A540F17u, 0xD8C465B6u, 0x5F0C132Bu, 0x4C750D70u, 0x98F935F8u, 0x7D8EDDE0u, 0x9E4FD1FCu, 0xB56F4E9Fu}}, {{0x0200102Du, 0x46A2FCAEu, 0xCBCCA854u, 0x21D42963u, 0xF0582D1Du, 0xD3DC11ADu, 0x29CCA856u, 0x32E8E534u}}},
+    {{{0x5E85AF61u, 0xB3488128u, 0xDD4AE766u, 0x4E8ED722u, 0xF6C21B0Fu, 0x59AEB68Fu, 0x26A1C8EBu, 0x92C23AE4u}}, {{0xC36A2B09u, 0x4E723669u, 0xB6286FEDu, 0x2D23AD82u, 0xC738D579u, 0x09F217D5u, 0x01551BB4u, 0x414CF88Fu}}},
+    {{{0x59E5D1B3u, 0x280AA482u, 0xFD6CAA3Eu, 0x48C9B789u, 0xF0FCDB30u, 0xD1E7E4C6u, 0xCAF6483Bu, 0x3ABA5151u}}, {{0x42F30087u, 0xA85B678Du, 0xD2DE6EE6u, 0xE1846359u, 0x47D72CC9u, 0x9064EC80u, 0xBFF251D0u, 0x8C1E7223u}}},
+    {{{0xC7B5EBA8u, 0xCE2AF1B2u, 0xF918EA36u, 0x2DABEDC7u, 0x6AF8DF42u, 0x88D0F417u, 0x76AFDF10u, 0xFEE5608Cu}}, {{0x8D0B9B5Cu, 0x3F515D36u, 0xBF905479u, 0xE380FF42u, 0x9287C14Eu, 0xB11402F9u, 0x34FE58AFu, 0x38075991u}}},
+    {{{0x8CF8CFFDu, 0x1B2B5988u, 0xB7A45AE6u, 0x432E6B15u, 0xF79BDD89u, 0xD45AFB88u, 0x1FE78C1Bu, 0x00809B7Fu}}, {{0x8DB5F32Fu, 0xD91D45A1u, 0xD92B9F93u, 0x12A340FAu, 0xDE52FDC9u, 0x0288C836u, 0xBF41A863u, 0xF817E022u}}},
+    {{{0x3C63CAF4u, 0x81E3BA4Bu, 0x28F53D52u, 0xA28FF3ABu, 0xC62A6AFCu, 0x20A113B4u, 0x92E667E6u, 0x42E544EBu}}, {{0x969C29C8u, 0x187AEC09u, 0x6BEFC5F1u, 0x73A50E7Bu, 0x17415E78u, 0xF71F220Cu, 0xF91CC671u, 0x9FF854E0u}}},
+    {{{0xF7ED9EF9u, 0x6C61905Eu, 0x0EF0C63Du, 0xAD2BA5A0u, 0x47FC192Au, 0x41DF7849u, 0xD352D4A7u, 0x32DDE6DDu}}, {{0x031FB871u, 0x1ABB8468u, 0x9C98F4B2u, 0x59EC1B37u, 0x4D58C1F4u, 0xE236A4F9u, 0x342067BCu, 0x41D17BDCu}}},
+    {{{0x5E0F09A1u, 0x80A2BD98u, 0xB9403283u, 0xF0A109F1u, 0xA4700EFEu, 0x83996ED2u, 0x65532CE3u, 0x7AED83B6u}}, {{0x85857D73u, 0x045D8CDEu, 0x0F3F4A54u, 0xD88B2F30u, 0xB1032D8Eu, 0x7DDAFD0Au, 0x9A31EF7Cu, 0xF5B8545Fu}}},
+  },
+  { /* 16^21 */
+    {{{0xE4FCE725u, 0x25866A0Au, 0xC6A6C5B7u, 0xE7E8DBD1u, 0x8F1771B4u, 0xF5EA905Eu, 0xF4A207ADu, 0xE06372B0u}}, {{0x4EEE31DDu, 0xB27034F9u, 0x87104870u, 0xD7484A77u, 0xAD5A488Cu, 0x12A27BB2u, 0xBCE18CFEu, 0x7A908974u}}},
+    {{{0x3ED2FF3Eu, 0xFE09AEE4u, 0x4EC6ED3Cu, 0x045EBFDBu, 0x4FAD3F3Cu, 0x9C8DBD30u, 0xA2046B8Fu, 0x0EAC134Cu}}, {{0x7D210988u, 0xE1720620u, 0xB7F21376u, 0xAC19F696u, 0xF2B11799u, 0x45BF103Bu, 0x79359B42u, 0x49630DBEu}}},
+    {{{0xDA328D6Au, 0xDBAA8188u, 0x95ADC18Bu, 0xB24D773Au, 0x85B08FA7u, 0xA3468991u, 0xA6234E00u, 0xC663C05Bu}}, {{0xBEC9B8C0u, 0x23B0BB6Au, 0x512BF9CCu, 0xDD8551EAu, 0x27571317u, 0xD39AFDCFu, 0x5F721C38u, 0x3331E98Du}}},
+    {{{0xDFBFA4DCu, 0x476706E4u, 0x04C85B17u, 0xF5948A78u, 0x7ADBB41Fu, 0x8392119Du, 0x731FEA19u, 0xD6788590u}}, {{0xBD3B5406u, 0xCA7BCD6Bu, 0xDDC9A07Cu, 0x6206F1C4u, 0xD21C13AAu, 0x940EF5C6u, 0x9D5063C4u, 0x28EAA8C8u}}},
+    {{{0x3996DE2Fu, 0xBC91C848u, 0xE0B25114u, 0x77CEDF2Eu, 0xEA0FE4E9u, 0x9CEB30DEu, 0xDFB86A45u, 0xD3FC2682u}}, {{0xD4526F8Cu, 0x8C492241u, 0xDF7ABF16u, 0x4E59B498u, 0xD4F781DAu, 0xF68B4754u, 0xA45F0A18u, 0xC4F0DF99u}}},
+    {{{0x62143FB0u, 0x6DC35A65u, 0x0BC205DDu, 0xA9FB9283u, 0x94799597u, 0x0CFAFF33u, 0x33AF8379u, 0x292ADC1Cu}}, {{0xE36AD01Cu, 0x8A9DB63Cu, 0x735E9D4Du, 0xD83E662Du, 0x0CC4ECF6u, 0xF3F1968Au, 0xCEE0B647u, 0xA072661Bu}}},
+    {{{0x03E697EAu, 0x5C6C48D1u, 0x985F83E8u, 0x9CE678FBu, 0x9A3FABD1u, 0x7DCA1FECu, 0xFEB2C023u, 0xC17A4B43u}}, {{0xDEDC6C87u, 0x0EE3B87Du, 0x7F9F02ABu, 0x96E1A1B5u, 0x19601FAEu, 0xCAE178F7u, 0x55AB5954u, 0x39355C2Du}}},
+    {{{0xE48FF9B3u, 0x7275FB40u, 0x5599B01Au, 0xC7B1A620u, 0x12B71D4Bu, 0x4ABF210Fu, 0xD9A04097u, 0x6930FCCBu}}, {{0x8EE96A4Eu, 0xCFDDAB5Fu, 0xE4ACC51Au, 0x090F9B13u, 0x875F6D78u, 0xDA30FCDBu, 0xB94701EAu, 0x7F02AE94u}}},
+    {{{0x3163DA1Bu, 0x82D2C302u, 0x0F93A311u, 0x9A0EDEE6u, 0x7FC11FDEu, 0x68C9349Du, 0xA26790B4u, 0x8F618B7Cu}}, {{0x03BDD76Eu, 0xC7F31211u, 0x3249B6E7u, 0x6450C66Au, 0xD7AC5A42u, 0xB5FBDA74u, 0xF08BEB6Eu, 0x78233F25u}}},
+    {{{0x4D0CEC10u, 0x84FB09B5u, 0xAADED6B0u, 0xBA25F0FCu, 0xB2D3CE72u, 0xAEAB0E61u, 0xA3321E69u, 0x4D952A9Cu}}, {{0xBBD06932u, 0x8EE36B13u, 0xC84F54DAu, 0xBA4AA2DFu, 0x87B5CB4Eu, 0x4542AEC7u, 0x66DD279Eu, 0xB178184Au}}},
+    {{{0x0EC8AE90u, 0xEE8590FEu, 0xE8BBC5DEu, 0xCFB26B92u, 0xAC83F1B8u, 0xB86D5B8Du, 0x5B7A1E6Eu, 0x9798C0F1u}}, {{0xE52844D3u, 0x7A9AC2EAu, 0xD03188E2u, 0xE2E4965Bu, 0x4F9C73BEu, 0xDD2EC949u, 0x75A42ED3u, 0xBA40E2AAu}}},
+    {{{0x30B90E0Bu, 0x89EC1E6Cu, 0xFB094A45u, 0xD6FF1D39u, 0x59C675B3u, 0xFEDC804Au, 0xAD5467D3u, 0xA43507F9u}}, {{0x3A1FDC20u, 0x3F000B99u, 0x53599B5Au, 0xDC2A2036u, 0xB40BE8C0u, 0x142D07CCu, 0x4C3FD71Au, 0x7C8F2DC9u}}},
+    {{{0x11D66B7Fu, 0x05A1978Fu, 0x5187DC81u, 0x7AA69250u, 0xB8928475u, 0x47CF1B90u, 0xFB5A2D67u, 0xFDFA6EE3u}}, {{0x78E5178Bu, 0xDAA8F806u, 0x13D78DE9u, 0xD846F9DDu, 0xA3DA18C4u, 0x93C0C1C9u, 0x224998DBu, 0x4D9CF31Eu}}},
+    {{{0x59C0D7ADu, 0xB836B586u, 0x7A2B493Au, 0x1DDB64DBu, 0xA749E671u, 0xEFE11CA1u, 0x4B7BFBBAu, 0x72B04ECDu}}, {{0x6723CD97u, 0x2EFE6FF4u, 0x1DC6F4FBu, 0x96265D68u, 0x6D934D01u, 0xCEDD452Du, 0x0E64A358u, 0x6865B3EAu}}},
+    {{{0x9265BCF0u, 0xB8075784u, 0x411C7D30u, 0x69CE2B78u, 0x61CF220Eu, 0xADDEA9A4u, 0xDE229E43u, 0xFD58CE38u}}, {{0xEB996292u, 0xF33E7A9Cu, 0x28F1CD1Du, 0x87261BFEu, 0xA485E4FBu, 0xD5382AB9u, 0x3763215Bu, 0xFFE0A5E5u}}},
+  },
+  { /* 16^22 */
+    {{{0xD0559754u, 0x40AD6908u, 0xE2A3F585u, 0x04B10BDDu, 0xDC0CE022u, 0x58D0BBF9u, 0x5CD5D453u, 0x213C7A71u}}, {{0x34B458F2u, 0xDFF2C275u, 0xF36A7EEDu, 0xBB4850F5u, 0x245BA190u, 0x7013AD06u, 0x5AE46250u, 0x4B6DAD0Bu}}},
+    {{{0x0EC87FACu, 0x8993895Eu, 0x622E7CF0u, 0x0D1AB974u, 0x8323480Eu, 0x66AE9FEDu, 0x32B49A7Fu, 0x1C5E5481u}}, {{0x5FC2D4EFu, 0x555D7B3Du, 0x26FE324Cu, 0xA3DEACEBu, 0x1D4C2AD3u, 0x2BB959FAu, 0x837F468Fu, 0x4FFCF60Fu}}},
+    {{{0x9E05DCCCu, 0x532D8011u, 0x4C19A93Eu, 0xAE3FA3EDu, 0xB953D172u, 0x9546E096u, 0x753DA030u, 0xB8CEF6E1u}}, {{0xCC6D5750u, 0x3014A0CFu, 0x6A6B6813u, 0xDF757FC3u, 0xE4D2BD99u, 0x6A4D4A74u, 0xA6CC9BBFu, 0x302B8A60u}}},
+    {{{0xD4531DBCu, 0xE20FCBA1u, 0xFED5C970u, 0x1F901C19u, 0x10BBC7CEu, 0xDEF6E942u, 0x02C5668Du, 0x46276D06u}}, {{0x9686B8E2u, 0xAF873009u, 0xFFE1BC99u, 0x498BADFBu, 0x570DED99u, 0x4A292287u, 0xD44C75B8u, 0x0E0F7F24u}}},
+    {{{0x373BB31Au, 0x85BDFEE1u, 0x5FDB97B4u, 0x701F7B6Bu, 0x2EBB5F49u, 0xE02A0BDEu, 0x79B47385u, 0x03FB33E7u}}, {{0x7D215C9Eu, 0xE34CBE69u, 0xC47640D4u, 0xC65A7C76u, 0xABBB572Bu, 0x1E0C161Au, 0x548EFE28u, 0xF36AD952u}}},
+    {{{0x686DF50Du, 0x0C4EED01u, 0x1C6F92BDu, 0xCD5E792Au, 0x2C082060u, 0xD6FD8744u, 0x935C1F02u, 0x3A571630u}}, {{0xE859679Bu, 0xD2158B28u, 0xBB781A11u, 0xE0AAF81Eu, 0xE570A0DDu, 0x516F3FF2u, 0xB599F32Fu, 0x85E13873u}}},
+    {{{0xDD9A4AB4u, 0xA5B515EBu, 0x855BB7C0u, 0x717C36C1u, 0x4D0F7A36u, 0x61F16F7Bu, 0x09EC3E11u, 0x4B177CD1u}}, {{0x635AB6F7u, 0x8AADDFE4u, 0xF1741F55u, 0x6E37E255u, 0x93626B48u, 0xFDA8F672u, 0xA5E2FA65u, 0x3EC966E9u}}},
+    {{{0x522F001Du, 0x6114EF13u, 0xDC78D899u, 0x6850E0ACu, 0x1C319163u, 0x4E65EB21u, 0xA7A6C24Fu, 0xEFEA68ECu}}, {{0x73BC4415u, 0xC128419Fu, 0xB3848771u, 0xE413959Fu, 0xA3719A17u, 0xDA150307u, 0x9D583C14u, 0xAAB84786u}}},
+    {{{0xB01C23A4u, 0x6F46FB29u, 0x47A49CF5u, 0xC22A4158u, 0xB9B9CD75u, 0xC2A03829u, 0x06A27A06u, 0x5E870352u}}, {{0x10D986F9u, 0x1217996Bu, 0x4A4CCFDAu, 0xA2171D87u, 0xAE2C6E2Du, 0xE71755D1u, 0xFB9C9221u, 0x5B96644Eu}}},
+    {{{0xC291DC6Eu, 0x8B41EF22u, 0x4DF29FBDu, 0x661FA8A9u, 0x3A3E38F2u, 0x5C7136C2u, 0xA3F15B24u, 0xCF0BDF47u}}, {{0xDB7A8196u, 0x9C73C144u, 0x2BB5F2A9u, 0xB4FC6CFDu, 0xE57918F6u, 0xA4C523B4u, 0x6E61F511u, 0x38C2E01Cu}}},
+    {{{0x007B0C66u, 0x1F3F35D2u, 0x656C86FBu, 0x34A7FEE4u, 0x60ACEB74u, 0x4472244Fu, 0x930D680Au, 0xE545C301u}}, {{0x71F2D470u, 0xD87F57D2u, 0x1B5A239Du, 0x97E5828Eu, 0x3959BCBFu, 0x7E5C6FDAu, 0x8C62955Eu, 0xE06A340Eu}}},
+    {{{0xF88F7E09u, 0xE2AA2B67u, 0xBA7D92CDu, 0xB3A03779u, 0xA45DC0BEu, 0xBD8E12E5u, 0x4F205FCBu, 0x5E6A863Du}}, {{0x48DFCA97u, 0xBBD62867u, 0x23B4CFE3u, 0xA68E5037u, 0xF6940234u, 0xC444A8D1u, 0x8A388EDFu, 0xC2571A07u}}},
+    {{{0x83648BBAu, 0x4A58190Bu, 0x69C3C744u, 0x82A0F0B0u, 0x5F01B398u, 0xA133EE22u, 0x7A54F580u, 0xB2A44215u}}, {{0x00FB6452u, 0x246FAB4Au, 0x1C9C17BBu, 0xC0D85515u, 0x8FBD7E31u, 0x9E9FBC97u, 0xB6936661u, 0xFE4F5FC2u}}},
+    {{{0xB304AB91u, 0x679E75E2u, 0x42451557u, 0x25A40C19u, 0x3B7811C3u, 0x8A638306u, 0x8FE5114Bu, 0x07A1FFEAu}}, {{0x6797E554u, 0x35AF463Bu, 0x19009D9Du, 0x287E5DEAu, 0x4344A595u, 0x6910437Cu, 0xB0FD7C54u, 0xE10C0421u}}},
+    {{{0xEBAB27D0u, 0xCF6DD22Eu, 0x2C45103Fu, 0xF70B41FAu, 0x18D97007u, 0x1BA97019u, 0x3D453865u, 0x1B908E0Fu}}, {{0x40D3D110u, 0x71E8675Eu, 0x587E51B5u, 0xB5BBCA93u, 0x817C4B9Au, 0x6F357C91u, 0xEC466B5Eu, 0x9B6D625Eu}}},
+  },
+  { /* 16^23 */
+    {{{0x08FBD53Cu, 0xF0CC3A3Bu, 0xADC62CDDu, 0xE2838C70u, 0xA5419A87u, 0x8DBB9352u, 0x7AF4B34Eu, 0x4E7C272Au}}, {{0x17DCAAE6u, 0xE0B39418u, 0xBFF7DD33u, 0x530B9614u, 0x6DEF681Bu, 0xE16FD09Fu, 0x6C9D0B18u, 0x17749C76u}}},
+    {{{0x7C6E1B4Du, 0xE2821E6Eu, 0x1BEF8790u, 0x9B11F25Au, 0x4E385D9Cu, 0x268A269Fu, 0x2696888Fu, 0x899017B0u}}, {{0xD814AB2Bu, 0x009AEBDAu, 0xF932B212u, 0xE4E51BC0u, 0x36358BFAu, 0xBB457983u, 0xB5B334F0u, 0x43AE2CDAu}}},
+    {{{0xE521B3FFu, 0xEE298464u, 0xE9AA750Cu, 0x233C0717u, 0xE9AE24A5u, 0x75E44D2Bu, 0x10C9455Cu, 0x02484E30u}}, {{0x0269DA7Eu, 0xCC1AE4B9u, 0x923AC8BBu, 0xAD7006DEu, 0x2B2D0EEBu, 0x07EC2B3Cu, 0xAA23E30Du, 0x9619D0A0u}}},
+    {{{0x7E5F712Fu, 0xAF2635A1u, 0x91B583A8u, 0x2831F5BFu, 0x63227F0Eu, 0xA8F4728Eu, 0x6E905FD4u, 0x67F644F7u}}, {{0x707160E5u, 0xD68ACB5Eu, 0xF7D36198u, 0x5E0E1488u, 0xB586CF78u, 0xF05ADEB7u, 0x66445D04u, 0xB833D68Fu}}},
+    {{{0x804BA7B9u, 0xF96B79FAu, 0x30741751u, 0x20D6A470u, 0x672C954Eu, 0xEF79B70Du, 0xCFB6CE57u, 0x16C1C526u}}, {{0x1C5BD741u, 0x475BE3A5u, 0xBDC9A9CCu, 0xEC755C01u, 0x9C8A94DEu, 0x06262745u, 0x34031439u, 0xDB157F7Cu}}},
+    {{{0x40692FD1u, 0x2B260961u, 0xCBD90DFEu, 0xDCF43C6Cu, 0x4B1F190Eu, 0x0E0AADEFu, 0x9901FF80u, 0x4E53C8B4u}}, {{0x328625E0u, 0x934930E7u, 0x57FC9753u, 0xA87A50DAu, 0xA7219DA1u, 0x186CD709u, 0x4D41A01Eu, 0xDD6E3E4Fu}}},
+    {{{0xA36683FAu, 0xE836487Au, 0x80EC0825u, 0x95821B53u, 0x74527B66u, 0x87A89CE7u, 0x53F931AFu, 0x03973CD7u}}, {{0x7F4A577Fu, 0xDF5FB2B7u, 0x8FE981DEu, 0xD77884E1u, 0x32B5A26Cu, 0x643E12B6u, 0xC30CA3A3u, 0x38CF5A2Cu}}},
+    {{{0x3B89A762u, 0xC10263EDu, 0x12EE6B8Du, 0x930DC930u, 0x968B4712u, 0xFA80A054u, 0x93652555u, 0x327F876Cu}}, {{0xB9203301u, 0x9C9FD959u, 0xFEBD7DFEu, 0x75535070u, 0x5E1997B9u, 0xB0996925u, 0xB3524026u, 0xB2D404EAu}}},
+    {{{0xC0BF6F06u, 0x180B3999u, 0x25043B57u, 0x713C1332u, 0xB0205765u, 0x1C2C04F4u, 0x72ECF151u, 0xBA6A9BBAu}}, {{0x781DB551u, 0xE32BEF70u, 0xAC697AAFu, 0x9E5D14F7u, 0xE558BD8Eu, 0x32020BF2u, 0xB34A11B0u, 0x13771E38u}}},
+    {{{0x55637B39u, 0x799F1199u, 0x5EC75FA2u, 0x6C52B998u, 0x6C03016Au, 0xC3D5B928u, 0x6B99AC5Cu, 0x0CF3C5DAu}}, {{0xA2852A40u, 0xD247A3D7u, 0x23C25C3Cu, 0x37ACD305u, 0xC18024A5u, 0x134671ADu, 0xD9F39B64u, 0x02CFB52Fu}}},
+    {{{0x71231A43u, 0xFD1EF9F0u, 0x65AD43B9u, 0x44D514D6u, 0x64DE442Fu, 0xD8AED950u, 0x27CC4DD2u, 0x35C5BCCCu}}, {{0x1620C8F6u, 0x7DB72E45u, 0x063CF0AEu, 0x4CF7A4CCu, 0xB6FA589Du, 0x734E5820u, 0x3B9746CEu, 0x0E367572u}}},
+    {{{0xB549827Bu, 0x48CE357Du, 0xE121BD61u, 0xFCC4F7F3u, 0xDE2CE311u, 0xA8212E06u, 0xE0D375F3u, 0xCE47D0F5u}}, {{0xEFAED097u, 0x43CC9A5Fu, 0xF05769DFu, 0x29E6592Fu, 0xE5B9AD0Fu, 0xD589139Fu, 0x99630D49u, 0x15C698FBu}}},
+    {{{0xFDD40609u, 0xBF40BC56u, 0x0D81CD76u, 0xC7419098u, 0xC588356Au, 0xA122F12Fu, 0x5C5586BCu, 0xFD479C24u}}, {{0x6A64CA53u, 0x9DE2F136u, 0x261CA473u, 0x9113AED7u, 0x3C9841FDu, 0xF2CAD7A4u, 0x2694AFEFu, 0x3069CFB5u}}},
+    {{{0x7D48BE00u, 0xB38FE715u, 0x1698FE13u, 0xF60682EAu, 0x7F9543C7u, 0x4EB0E220u, 0x4A8E42F3u, 0x931BF8BDu}}, {{0x1F44F452u, 0x1586A913u, 0xB333DDF5u, 0x6A43EE6Au, 0x1140EBEEu, 0xD1B388E6u, 0x489C2083u, 0xF1153BF0u}}},
+    {{{0x2B799A7Fu, 0x4DB702F5u, 0x53B8E842u, 0x4F18B6CDu, 0xAF2C7D54u, 0xBDED8EB9u, 0x3ACCD864u, 0x6C40002Au}}, {{0xD3C81E32u, 0x8B5CC82Cu, 0x820483F6u, 0xC07ABD4Cu, 0x0E1DDCBDu, 0x690B836Au, 0x30B635BEu, 0x95C2DC15u}}},
+  },
+  { /* 16^24 */
+    {{{0x40FB27B6u, 0x32427E28u, 0xBE430576u, 0xC76E3DB2u, 0x61686AA5u, 0x10F238ADu, 0xBE778B1Bu, 0xFEA74E3Du}}, {{0xF23CB96Fu, 0x701D3DB7u, 0x973F7B77u, 0x126B596Bu, 0xCCB6AF93u, 0x7CF674DEu, 0x9B0B1329u, 0x6E0568DBu}}},
+    {{{0x1F9756E4u, 0x8FD97C96u, 0xDE373048u, 0xBB570EE5u, 0x50E8CD0Eu, 0x180E03D8u, 0x304280FFu, 0xED9441C8u}}, {{0x3F3ABFAEu, 0xFF0E09F9u, 0xFE4DE98Bu, 0x09F23774u, 0x8B13911Eu, 0xAFA17612u, 0xFE8BFA19u, 0x3DBE9E9Eu}}},
+    {{{0xBE889756u, 0x5DD81AE9u, 0x7B004BB2u, 0xF27B6499u, 0x271899F3u, 0x226CD97Bu, 0x3211FEA8u, 0x762E8BC3u}}, {{0x7CA6B774u, 0x25E259E0u, 0x4884FA5Eu, 0x1972DB31u, 0x4982E347u, 0x3C7CC4F1u, 0x0AF3E97Cu, 0xC0289426u}}},
+    {{{0xD51CF119u, 0x15BAD033u, 0x4FAB4D30u, 0x5B10BDD8u, 0x24B48751u, 0xC9FED3F6u, 0xE67A7C3Fu, 0x29D9698Eu}}, {{0x75056339u, 0x3C887405u, 0x93A7C296u, 0xB89C940Eu, 0x04F1C96Fu, 0x277A1254u, 0x7DC82B45u, 0x7FD02C51u}}},
+    {{{0x0975D2EAu, 0x26F75E97u, 0x1014E8EAu, 0x1E52ACFAu, 0x2308F4A9u, 0x8E19BDBBu, 0xDF609534u, 0xDF077D47u}}, {{0x31936F95u, 0xAA3C2D9Eu, 0x4FBDD277u, 0x8A1EC5B8u, 0x98A2527Cu, 0x24C8425Cu, 0x00EF7F44u, 0xF8617A88u}}},
+    {{{0xA6714560u, 0x875580A5u, 0x7E56C6C2u, 0x247F2102u, 0xF1A5A85Cu, 0x9D47EF64u, 0x579AD36Bu, 0x38B82A75u}}, {{0xA774299Eu, 0xADA87334u, 0xEF716284u, 0x7D94F23Bu, 0x61643459u, 0x28BF5634u, 0x6F261EF4u, 0xF9D8A697u}}},
+    {{{0xBC4C92D7u, 0x5B8491FBu, 0xE54391B4u, 0x35DB4D6Eu, 0x334B1429u, 0x2E17DEA8u, 0x8BD3DA03u, 0x9F3E7D75u}}, {{0xB14906DDu, 0x6CBBBFCFu, 0xD694E118u, 0x452A2303u, 0xCBAB1502u, 0x58862B21u, 0xA77D466Bu, 0xECD2841Eu}}},
+    {{{0x7F422491u, 0x467C4453u, 0x86060CFFu, 0xFD453E4Au, 0x33580A31u, 0x6F3FB7BDu, 0x5013936Du, 0x126B57D0u}}, {{0x9DA3EF84u, 0xAFA31F19u, 0x0BF39347u, 0xE148BAC3u, 0xA2BF3FB0u, 0xE3C4A3EBu, 0x061662C2u, 0xC1A7DC13u}}},
+    {{{0xB2A8C483u, 0x5AE0D732u, 0xC5040AC3u, 0x174B0C88u, 0x2EF95281u, 0xDC38C3D2u, 0x7B5CCF9Eu, 0xA0CC795Du}}, {{0x92CC6BA9u, 0x50967455u, 0xDF693605u, 0x6B348F1Bu, 0x7231DF78u, 0xE2374FC9u, 0xF8B3873Eu, 0xABC30122u}}},
+    {{{0x3AFAF403u, 0x0515623Au, 0x97AD7576u, 0x38A0AEFBu, 0xC8A0B5BFu, 0x70CFAFFAu, 0xB9E81F56u, 0x1A241179u}}, {{0xE4D79A16u, 0x590B6E40u, 0x178DF60Du, 0x2C8177F4u, 0x3905B76Cu, 0xC4BF2749u, 0xA86740C2u, 0x8E1CA0C0u}}},
+    {{{0xC5DD3AEEu, 0x170F1B6Bu, 0x8F96D2F2u, 0x13153A8Au, 0xC6A976CAu, 0xE0E22A9Au, 0x1553C7CCu, 0x6D1C50A5u}}, {{0xFDF597F7u, 0xFEE354E4u, 0xA8ED53ADu, 0x851E310Au, 0x2287D474u, 0x97727200u, 0x06ABDFDCu, 0xAFFF148Eu}}},
+    {{{0x9B720B26u, 0x7622EB04u, 0x98CCFCD0u, 0x26F2835Fu, 0x41390620u, 0x1F46BBEDu, 0x9AC968EEu, 0x3E10C5AEu}}, {{0xADD92DB5u, 0x346E98C7u, 0xDBE09E43u, 0xE2FF79A4u, 0x87215E28u, 0x5A8665B2u, 0xFE428891u, 0xC735C6CFu}}},
+    {{{0xE4A6D0BBu, 0x678CA9B7u, 0xF5A1AFDCu, 0x659D3122u, 0xA8A6418Fu, 0xF311A6D8u, 0x8B97F9F3u, 0x5E5F1D61u}}, {{0x1033EAF9u, 0x16838479u, 0x506F653Au, 0x72555F2Eu, 0x04E721DAu, 0x358F6BCDu, 0x06A7E6F7u, 0xD7B1502Bu}}},
+    {{{0x65543CB4u, 0xE0083A7Du, 0xC22D0299u, 0x3C4529B6u, 0x580EA8A0u, 0x8AB684D0u, 0x9734854Au, 0x73F87BAEu}}, {{0xC4856CDDu, 0x3D2DD872u, 0x357F2D7Au, 0x9D5C42F5u, 0x1A140289u, 0xEEBFBFC1u, 0x3A87F86Fu, 0x37C66CF0u}}},
+    {{{0x4F005E3Fu, 0xDDA9B5E4u, 0xBEC39BD2u, 0x5AF68E31u, 0xCE01A149u, 0xFFD3CB9Au, 0x3C16427Fu, 0xF8138A6Bu}}, {{0x2F357EB7u, 0x42D7E020u, 0x554BE213u, 0xF4EC41BDu, 0x7AA5CB51u, 0xF9D015E5u, 0xEFB4EBD9u, 0xCA758F3Bu}}},
+  },
+  { /* 16^25 */
+    {{{0x17BDDE39u, 0x52C02A44u, 0xB7604329u, 0x1544E179u, 0x599968D3u, 0x10A2570Du, 0xF677CF0Eu, 0x76E64113u}}, {{0x1901AC01u, 0xB4B1752Du, 0xB56D2032u, 0x5E2A33D2u, 0x0681F0D3u, 0x577066D7u, 0xEE4E95CFu, 0xC90DDF8Du}}},
+    {{{0x3A1187A5u, 0x1CF999A8u, 0x2C29AE69u, 0x005D5762u, 0x8161C810u, 0xEE87C9D8u, 0x9E52C73Bu, 0x708A530Eu}}, {{0x473DB9C0u, 0x58A4F19Bu, 0x6D353E8Au, 0x3ECDA73Cu, 0xBB6D3828u, 0xFA9656DCu, 0xE1F9A897u, 0x9B884811u}}},
+    {{{0xC078EE8Du, 0x2F05091Cu, 0x50691944u, 0x4EBF20CEu, 0xAA9B4FF6u, 0x25FF7263u, 0x859DA9BEu, 0xD08E57ADu}}, {{0x2DA63E86u, 0xE997F4DCu, 0x9422ED9Du, 0x123EF7CFu, 0x757E6DF4u, 0x2D6172EEu, 0x4AB488D7u, 0x852E9798u}}},
+    {{{0xCDE4F5BEu, 0x2E1B16C6u, 0x86B2B59Eu, 0x9F374B6Du, 0x95E462CFu, 0x19BD6483u, 0xC48B3BE2u, 0x19CF034Fu}}, {{0x6F321AF2u, 0x0A91532Bu, 0x3F0F1C0Cu, 0xEF91D1C9u, 0xAB181947u, 0xC3B4BE68u, 0xA15AB466u, 0x28E32B06u}}},
+    {{{0x429129ECu, 0x15914670u, 0x1E482548u, 0x0CAE3ACFu, 0xECD31D08u, 0x5F58BE80u, 0xE4D44D27u, 0x7DA6C085u}}, {{0xACD9FF0Eu, 0xEB50AEE2u, 0x54CA586Au, 0x0448C086u, 0x491627BFu, 0x511D0207u, 0xB9F41857u, 0xF498146Bu}}},
+    {{{0x0E9C22BCu, 0xD43AE543u, 0x91BCC42Fu, 0x01DA67D6u, 0xD9BC7BE6u, 0x765B3444u, 0xE99EEB23u, 0x5335CEA5u}}, {{0xCBDACB60u, 0x3C2C2672u, 0x6CA1F19Bu, 0xC8C30C23u, 0xF0CEB86Au, 0xA067F080u, 0x769C5224u, 0x3BF8D020u}}},
+    {{{0x51654F22u, 0x4F83D495u, 0x231AAEE9u, 0xB2F7F394u, 0xBE69D94Fu, 0x21BE9001u, 0xF5C1BE6Eu, 0x90D090CFu}}, {{0x601A43E1u, 0x0F5DE057u, 0x3DA3F874u, 0x6DD63565u, 0x06BF7033u, 0x953F021Eu, 0x2BACF61Au, 0xCD569A1Du}}},
+    {{{0xD17CF3E8u, 0xE3ABC209u, 0x4BEA2219u, 0xEE93BD03u, 0x8397F576u, 0x7C719C2Fu, 0x78CB5F0Du, 0xAF6C44A0u}}, {{0x1751BAEAu, 0xB8ADD060u, 0x7CA0D435u, 0xEC362AEAu, 0x3CB246DFu, 0xAF9E7315u, 0xE85D4B30u, 0x0784096Fu}}},
+    {{{0xC76B19FAu, 0x1B6EF651u, 0x068819D7u, 0xD9D6E06Du, 0x0821292Eu, 0xC7322C31u, 0x7CF1D1ECu, 0xDA479858u}}, {{0x326F5AF7u, 0x6AA26EEBu, 0x9553FC20u, 0xA67BD13Eu, 0x7E16569Eu, 0xD1736907u, 0x9BCCAF01u, 0xEBB1D778u}}},
+    {{{0xD6569044u, 0x6D2F91EDu, 0xFA0CEEF9u, 0x33C0396Cu, 0x95C58F30u, 0x9D42BAFEu, 0x6F7D6253u, 0xAA21C60Du}}, {{0xC2F37766u, 0xC1924C41u, 0x13928334u, 0xEE5ABAC1u, 0xD41ADF4Eu, 0x6D1D26ADu, 0xFC4E6AEAu, 0xB2AE6886u}}},
+    {{{0xB9135DBDu, 0xCD92FB65u, 0x39D8631Eu, 0xF0C087AFu, 0x82E9897Cu, 0xD817AAF5u, 0xA8DDEE6Au, 0xE3E47504u}}, {{0x4748045Du, 0x6906AF3Eu, 0x5EC95DA9u, 0xA5A202FFu, 0x52B83FFEu, 0x0B98C819u, 0x09CBC6C4u, 0x930A5BF8u}}},
+    {{{0x4FF4DE54u, 0x5BC1E621u, 0xE9D3C2BEu, 0xA5CABD91u, 0xF14A2858u, 0xC3B4031Cu, 0x5DF202A2u, 0x5716DC35u}}, {{0x50100FA5u, 0xD3EA4FD5u, 0xD047E417u, 0xEBF3FECCu, 0xA99324C5u, 0x91EAA661u, 0x0A5B83F3u, 0x985F6C40u}}},
+    {{{0xCDEE455Fu, 0xCBF0B9E5u, 0xE8CE4075u, 0xFF67FFE6u, 0xF80BDB4Au, 0xA4745338u, 0xE870A9B0u, 0x7E8C656Fu}}, {{0x171B9CBAu, 0x173DE998u, 0x46F46627u, 0x4AA2D167u, 0x4803A53Bu, 0x2A3F760Fu, 0xCA30740Fu, 0xBDDDC632u}}},
+    {{{0x9769B57Cu, 0x1E61500Du, 0x39E2FC7Bu, 0xDA5033BCu, 0x5BE3F04Du, 0x5348F192u, 0x592D282Bu, 0x030651CBu}}, {{0xF33236E3u, 0x7FF3A505u, 0x739F7805u, 0x192A4D18u, 0xE85682C3u, 0xAC4E2423u, 0xBB7AC098u, 0x25208833u}}},
+    {{{0x6698B59Eu, 0x37796B9Bu, 0x893447A4u, 0x0A335925u, 0xB3E3C726u, 0x5BEB035Au, 0x91A95EB1u, 0x3DF841F8u}}, {{0x6B92BAF5u, 0xBCF8E679u, 0x214949F8u, 0x7BFC867Bu, 0xF11CF386u, 0xDA02BAE8u, 0x98B090C1u, 0xB38FE6DFu}}},
+  },
+  { /* 16^26 */
+    {{{0x2BCBB891u, 0x3AB15024u, 0xDF26CBEEu, 0x8F7CC643u, 0x743F8F9Au, 0xE8281BAAu, 0x03B2ABE1u, 0xC738C56Bu}}, {{0x699A84C3u, 0x17E735D9u, 0x7880CFE9u, 0x82314EEFu, 0xACBFBBBBu, 0x7F718F2Eu, 0x951AD253u, 0x893FB578u}}},
+    {{{0x4662AB1Bu, 0xDDAAB078u, 0x49B8C9E4u, 0x647197EAu, 0x92E7AA94u, 0x35B32A69u, 0xCD7C0374u, 0x5578845Eu}}, {{0x056F3511u, 0x316D18F3u, 0x6A5D64DEu, 0xF653A774u, 0x1D2A4053u, 0xCEA6D0A5u, 0x8B6DE2C3u, 0xE61D0797u}}},
+    {{{0x8761D58Du, 0x34BAAF33u, 0x08D60E2Fu, 0xCA4C9BE4u, 0x5720DF7Au, 0x10A240A3u, 0x823F6146u, 0xB8C46127u}}, {{0x9D1051A4u, 0x638EA0BAu, 0x5E107C5Bu, 0x3F750478u, 0x97F3C505u, 0x14A458F6u, 0x5170E37Du, 0x8F9ED96Cu}}},
+    {{{0x948B6C29u, 0x94F869B8u, 0xFCE39960u, 0x22F12354u, 0x1D0CECCDu, 0x4ABFA3BCu, 0x88A364CCu, 0x47F33838u}}, {{0x0E537EF9u, 0x1EDEE112u, 0x88F994A8u, 0x18BB4995u, 0x5B416C71u, 0x190E4867u, 0x0F032937u, 0x48CA9A8Du}}},
+    {{{0x050B0040u, 0x2DB0B304u, 0xF0134ADCu, 0xF3F47DB9u, 0xFE9A3671u, 0xA350C993u, 0x710271F7u, 0x08D56E9Fu}}, {{0x5B3FD0A1u, 0xB58E267Au, 0x0E1782BEu, 0xF6D7C472u, 0x8D79B285u, 0x1FFD150Au, 0xBD0A9AA2u, 0xA12185AEu}}},
+    {{{0x1166FF40u, 0xA14DEA1Au, 0x41FFF36Du, 0xCAEEBF4Au, 0x8E480A2Eu, 0x7C78125Du, 0x18818D2Bu, 0x6B004033u}}, {{0x9D71B847u, 0xEB74130Eu, 0xE7F3EDE9u, 0x076883F6u, 0x590BF2F0u, 0x968943A0u, 0xE8AAFAC9u, 0x41CD1B3Au}}},
+    {{{0x13573B7Fu, 0xF56563DFu, 0xD30B6270u, 0x889A1C5Eu, 0x7BE65A37u, 0x41E20F97u, 0xD42FCE63u, 0xDC13F232u}}, {{0x4C1F2BA6u, 0x42ACD228u, 0x17404B1Cu, 0x70455470u, 0x84A90A76u, 0x3C7410DAu, 0x429E340Cu, 0xC909BA80u}}},
+    {{{0x05FF4ADBu, 0xA81A6C8Fu, 0xFCBEF768u, 0x14F570D6u, 0xC6A5D5F6u, 0xE466B4C9u, 0xAE41B8CFu, 0xC0C01F34u}}, {{0xAC351065u, 0xFC4EFF73u, 0x70D15B85u, 0xCDBC43D1u, 0x4075B8CEu, 0x7C937A0Bu, 0xE4357F5Cu, 0x0B84F5BEu}}},
+    {{{0x87AE9CEBu, 0xB02F590Bu, 0x70EF2D14u, 0x226C21EAu, 0xDB2119A8u, 0x3AF19565u, 0x01DF7F07u, 0x25C02DE6u}}, {{0x4BC6E275u, 0x47090D13u, 0x0A658726u, 0x37C641DFu, 0xCFAD11D5u, 0x0C884E0Du, 0xC812383Cu, 0x8A9FEAD2u}}},
+    {{{0x932C1A1Cu, 0x365019D7u, 0x022BDD6Eu, 0xA2F32B1Au, 0x00B63B93u, 0x3D229EA4u, 0x468ECBDBu, 0x3A932FBCu}}, {{0x7D343540u, 0x84AA9269u, 0x749A28B6u, 0xC0417E15u, 0x4DC81D0Au, 0x01C9547Du, 0x0F3457A8u, 0xAD3D8054u}}},
+    {{{0xEC5A3C34u, 0x1F8098F6u, 0x295949FEu, 0xAECE82C0u, 0xA7AE3E58u, 0xE8AB9F4Cu, 0x2CF8E49Cu, 0xFEDD9D1Bu}}, {{0xE13D7714u, 0x62B54BF4u, 0x99BF8297u, 0xADAEB546u, 0x2C8F4B00u, 0xB0BE8531u, 0x1853B8E0u, 0xA52E24C3u}}},
+    {{{0x80D6BF1Fu, 0x0452106Bu, 0x9824FCBBu, 0x46BD033Eu, 0x76B346B9u, 0xA3521E92u, 0x451CB83Cu, 0xC3337343u}}, {{0x3CB01F48u, 0xF95E5842u, 0x0E266162u, 0x98BA3642u, 0xF72C3155u, 0x13DFF31Au, 0x1B812CDAu, 0x2EEFE939u}}},
+    {{{0xAAB6A396u, 0x9B4E54D1u, 0xA1136076u, 0x73021B91u, 0x5E8488B3u, 0x2DEE2D7Fu, 0xBC6EA48Cu, 0x3E0E3286u}}, {{0xD980E27Eu, 0x2EB31E48u, 0xF3468F6Au, 0x6AB01041u, 0xEB453FC6u, 0x4F31FE1Du, 0xFA3B3796u, 0xCA448172u}}},
+    {{{0xDAF027E9u, 0x27BF4C48u, 0xEE54677Eu, 0xD7CA75DBu, 0x37ED6D17u, 0x3C3C7CD5u, 0x3EA83E25u, 0x5A62873Du}}, {{0x844C68B4u, 0x3199D905u, 0x9CA675FBu, 0x988AF430u, 0xEEC57A43u, 0xA76409CFu, 0xA5BF6AFDu, 0xF6D94479u}}},
+    {{{0x341023ECu, 0xAAF35862u, 0x6FECF570u, 0x5645D8F7u, 0x0982B9AFu, 0x4982E020u, 0x80C32D28u, 0x344AB930u}}, {{0x1E1EEB87u, 0x04F89829u, 0xFC3995D7u, 0xFC4E976Au, 0xEA514C5Fu, 0x73F8F2D1u, 0x2B24462Au, 0x6E1C2B04u}}},
+  },
+  { /* 16^27 */
+    {{{0x88F6C14Bu, 0x372E9F65u, 0x3A925014u, 0xD1D72E5Fu, 0x7C972877u, 0xE264C763u, 0x48B65B81u, 0xD8956265u}}, {{0x5D7D991Fu, 0x79363ED7u, 0x2BB067E1u, 0x03428D63u, 0x18C340EBu, 0x728EC608u, 0xF2BC7EAEu, 0xFEBFAA38u}}},
+    {{{0x77078424u, 0xBA5B594Bu, 0x0EC40C3Fu, 0x03ECAF7Au, 0x2003A267u, 0x8A3A4362u, 0x8971044Eu, 0xFD136EEFu}}, {{0xC671DDF1u, 0xCD61EEEFu, 0x8A2ADFA8u, 0x7CF2B1F7u, 0xB5C5EFA5u, 0x67A1D191u, 0xF3C652CCu, 0x218DA834u}}},
+    {{{0x6127B756u, 0x80BA87FFu, 0xABA09704u, 0x03428BE4u, 0x5060B416u, 0x72D362DAu, 0x716DF126u, 0x6D8C782Fu}}, {{0xBF172571u, 0x6551F74Au, 0x2D7CDCCAu, 0x4E3AA6DAu, 0x36D34DAFu, 0x1459A82Du, 0x96FDB911u, 0x99AEDF08u}}},
+    {{{0x8DB1CB3Cu, 0x5F1D84ECu, 0xD43F024Au, 0x1B7003A0u, 0x67519F86u, 0x0E9CCA53u, 0xD9638D14u, 0xD99E8E9Du}}, {{0x6B8637A7u, 0xD88A29E3u, 0xFFC8765Cu, 0x6286FEF8u, 0x1BCEBA6Eu, 0xA945BB32u, 0x1CC0A3A7u, 0x36DC19ADu}}},
+    {{{0x758CF17Au, 0x4DEE1A73u, 0xA5882352u, 0xF1F85DCBu, 0x1B4097F8u, 0x8D059AEFu, 0x95BF7ACAu, 0xEBCABEDDu}}, {{0x5CAA0CCDu, 0x446CDC5Fu, 0xD0ACE95Cu, 0x10FAD212u, 0x67C32E6Bu, 0x02C00A1Bu, 0x8F22B9CBu, 0x47D3CE0Fu}}},
+    {{{0x51A3C43Cu, 0xE4C4B2C5u, 0x8ECEE258u, 0x0DF701CAu, 0x4AAE6714u, 0x48CC1F2Bu, 0x67CACD5Bu, 0x56C9DA94u}}, {{0x20D7C9EDu, 0x824D8B7Du, 0x32EDCAA1u, 0x41D40FF9u, 0xDDCB6852u, 0xF33C7964u, 0x42C79EC2u, 0x38D46ACBu}}},
+    {{{0xAC855C5Bu, 0xBCEEE515u, 0x017C8AFBu, 0x1185621Au, 0x9E17FC28u, 0x45331A36u, 0x4BD4CE24u, 0xE8DF4D2Eu}}, {{0x2E465650u, 0x59D5E72Cu, 0x1E1E4D7Du, 0x9663B55Fu, 0x59EF32C5u, 0x4444DB4Fu, 0xC47F9B26u, 0x6C57FD70u}}},
+    {{{0x3C385172u, 0xFD46F68Du, 0x0440E636u, 0xD203351Eu, 0xE5B09191u, 0xA1BD8A54u, 0x9A198317u, 0x03FDF161u}}, {{0xFCCB9794u, 0x79AC67F0u, 0x90E7232Bu, 0x5B9B929Eu, 0x3C857375u, 0xFE470C7Du, 0x6E5C12C3u, 0x408D02C0u}}},
+    {{{0x52E7E454u, 0xD08F5BDAu, 0x0F0E6150u, 0xFE32EFEFu, 0x3A981662u, 0x91248602u, 0x18ECA832u, 0x4068D3D7u}}, {{0xD8EF191Eu, 0x779ACDE5u, 0x13C37332u, 0x988D21EDu, 0x7D9D38D1u, 0xB9EC1459u, 0x254A47AAu, 0x8CD853B7u}}},
+    {{{0x35D8247Eu, 0x400C1FF5u, 0x511691EBu, 0xCD4780C2u, 0xAFA0B7A0u, 0x56E101F9u, 0xA2C355CEu, 0x33EAC9BBu}}, {{0xAF3DA9BFu, 0x37216AB0u, 0xB7EA407Fu, 0x84F8CF37u, 0xFD15EF2Du, 0xD4461F2Au, 0xE4E17C41u, 0x35973173u}}},
+    {{{0x46C5D939u, 0x0857ADF8u, 0x7BA933DEu, 0xA475A287u, 0x60CA027Eu, 0xB55BF32Eu, 0xB1D825E0u, 0x12550ECDu}}, {{0x59E757C9u, 0x92A74FC5u, 0xECD8D431u, 0x838B741Fu, 0x17724A72u, 0x5448E43Cu, 0xF872D7A7u, 0x7B8F8334u}}},
+    {{{0x2DF771C8u, 0xB9E249D0u, 0xEE094C87u, 0x335A5211u, 0xC01F8750u, 0x9D32C2B3u, 0x922DC902u, 0xB71E546Du}}, {{0x93F48C51u, 0x2453A26Fu, 0x55BBA286u, 0x26BD522Bu, 0xCCE288F4u, 0x78912A4Cu, 0xCEC9F900u, 0xE7CCEFA8u}}},
+    {{{0x56C8A56Fu, 0x38D0AAC6u, 0x34F37421u, 0x85093C54u, 0x3AFAD08Fu, 0xC69BB7B5u, 0xC3B585D4u, 0x944D671Au}}, {{0xDA7BE289u, 0xB9F4DC65u, 0xDD06517Eu, 0x67D4C174u, 0x133AC619u, 0x4C143936u, 0x7B501FFFu, 0xA7106597u}}},
+    {{{0xD3194444u, 0x68F73092u, 0xBAA7FEA2u, 0x850FEA94u, 0x6D87A19Eu, 0x61223966u, 0xBA1526B8u, 0xFACF5D96u}}, {{0x44BAD676u, 0x552BF488u, 0xB947D00Bu, 0xBE72B245u, 0x392DDAC6u, 0x935B7756u, 0xB8AD44F6u, 0x7CEB907Bu}}},
+    {{{0xAE08F15Au, 0xAEEB8A18u, 0xC812900Bu, 0xFD69E56Du, 0x5AD3C305u, 0xFE6B0365u, 0xCD099A0Cu, 0x86A54E91u}}, {{0xC1388308u, 0x3524D1E7u, 0x5B35254Du, 0x77129D12u, 0x6D756867u, 0x3A72A8D0u, 0x37A78460u, 0xCFEE6148u}}},
+  },
+  { /* 16^28 */
+    {{{0x4F676E03u, 0x49150A56u, 0x93E84EDDu, 0xCEFFC736u, 0x571E8761u, 0xEB0F6433u, 0x2A957518u, 0xB8DA9403u}}, {{0x4EFDF6E7u, 0x1488E4E7u, 0x95FF3B51u, 0x92CC584Du, 0x762808B0u, 0xD7C99CC9u, 0x4805A1E4u, 0x2804DFA4u}}},
+    {{{0xC5AF726Au, 0xD413F414u, 0xB25BF6E6u, 0x469A3E5Cu, 0x8AB620F9u, 0x53F2CB69u, 0xED8CC5CEu, 0x6D36D105u}}, {{0x13F9FC7Du, 0xC570491Au, 0xB4108A35u, 0xDCC59936u, 0x95C50029u, 0x72D8C66Cu, 0xE377669Eu, 0xE4BA5C34u}}},
+    {{{0xC6E1346Bu, 0xEA19849Du, 0x385AF1C5u, 0x5ABE7B10u, 0x14D152C0u, 0xE54C761Fu, 0x0982D10Bu, 0x069068FFu}}, {{0xD7226C13u, 0x7BB58A54u, 0x94C6026Eu, 0xA4F68939u, 0xD086442Au, 0xDA85DB2Bu, 0x90BFDE26u, 0xB863E3E0u}}},
+    {{{0xA540DB99u, 0x86E2A30Cu, 0x534B8122u, 0xEB1309C0u, 0x66F0B0E3u, 0xD06883FAu, 0x0CD3AC0Cu, 0x3AB6BDE1u}}, {{0x1BDA78A3u, 0xE6873FE3u, 0xE369C043u, 0x38D137B0u, 0x6A13E99Cu, 0xFC3117A9u, 0x9BE871D7u, 0xBACA6207u}}},
+    {{{0xDCA1F6A1u, 0x30E691FCu, 0x348CFF1Au, 0x068CBD14u, 0xB1E86CE1u, 0x5286DC5Cu, 0xCB259761u, 0x898C3493u}}, {{0x164F647Cu, 0xA4ADC20Fu, 0x9F2BD79Cu, 0xB2A7CF97u, 0x52AC6E93u, 0x9D845424u, 0xAB56A554u, 0x75F75986u}}},
+    {{{0x7235C795u, 0x584E2BBCu, 0xEBD541D7u, 0x0B0D8958u, 0x7D1C89D7u, 0x393B05B3u, 0x35EF974Bu, 0x063C4624u}}, {{0x5B110258u, 0x3F32DC09u, 0xFA49A9BDu, 0x9E4ACBACu, 0x931C85B6u, 0x431F660Du, 0x13038404u, 0xE27F9BB9u}}},
+    {{{0x3D1E3998u, 0xAA69E03Cu, 0x17A04328u, 0x5E56C8B9u, 0x022A274Eu, 0x1A5299D7u, 0xD2918BF0u, 0xB213E2FEu}}, {{0x325FB81Eu, 0xEC2CBDC6u, 0xEBDED175u, 0xD534165Bu, 0x83A43BC3u, 0xC3D61EBFu, 0x0F2D3C12u, 0x229F8EC2u}}},
+    {{{0x9F1048DAu, 0x7777BF27u, 0x73DDD3BAu, 0xBA2FD4F3u, 0x9D07BCE2u, 0xFDBA069Du, 0xF1AD56F0u, 0x796634E3u}}, {{0xA106CF01u, 0xE8F9BE24u, 0xCFD74862u, 0x532576D8u, 0x5A7927F2u, 0x56DE7473u, 0xCFB20B89u, 0x4D8EE2B6u}}},
+    {{{0xA25BE234u, 0x00BE1FECu, 0x0DDF3507u, 0x0E83E3E7u, 0x91606E06u, 0x5D1D0BA6u, 0x16C7F93Eu, 0x4B3B3AD8u}}, {{0x920E8362u, 0x063B7E03u, 0xCF211B84u, 0x41E7FD92u, 0xFD8CC04Cu, 0x7875E96Du, 0x85DABC9Cu, 0x5EEC023Bu}}},
+    {{{0xC05201E1u, 0xAB209AC9u, 0xE836B77Du, 0xD264CB5Au, 0xDEA35F99u, 0x852BD55Cu, 0x6E6C78AEu, 0xC299C6B0u}}, {{0x50F51BA3u, 0xADD3313Au, 0x83AC2AE9u, 0xBD74DCF5u, 0xFD774CD7u, 0x38884F24u, 0x3611805Bu, 0x5AA73992u}}},
+    {{{0xE289F55Eu, 0xB96634A7u, 0xE2C76707u, 0x2976B0F0u, 0x278965BEu, 0x020251B0u, 0xDDB04F96u, 0x9F7B88B6u}}, {{0xFE1E4BDEu, 0xB3CD3B65u, 0xEB10A2B1u, 0xC0E536E0u, 0x298FC71Fu, 0xBE3146B4u, 0xC70410F7u, 0x32F9F784u}}},
+    {{{0x6C1CBAABu, 0xFD37A7F1u, 0x033D564Cu, 0x1ACAB879u, 0x8A70635Cu, 0x598AB6C1u, 0xFB356071u, 0xD031AE98u}}, {{0x85116B26u, 0x4C39047Fu, 0xDBD65FDCu, 0x6DFB4A4Fu, 0xADCB4DCFu, 0x8E6E4C06u, 0xE954584Eu, 0x415196B4u}}},
+    {{{0x1DFE1D2Bu, 0x16549C8Cu, 0xE56878E5u, 0xC493F509u, 0xD3FB73A4u, 0xE76CCADFu, 0xCB7448E3u, 0xD58A43E9u}}, {{0x8CD50922u, 0xFCF2795Bu, 0x5CBD6FBFu, 0x54D9BA21u, 0x2828276Bu, 0x10A72913u, 0xA05883CFu, 0xFC17866Bu}}},
+    {{{0x447996C0u, 0x626FBD58u, 0x76BA269Au, 0x6E2EED72u, 0x7BEDD0E9u, 0x39B97957u, 0x6A953564u, 0x16E85AD8u}}, {{0xB8151D48u, 0x4888BC64u, 0x9C569D54u, 0x21B642ADu, 0xE00ED55Au, 0xFB217E5Cu, 0xB424493Eu, 0x7408B0AEu}}},
+    {{{0x249C795Eu, 0x124151BEu, 0x99CE805Eu, 0xED4406AAu, 0x3C27EA4Eu, 0xCD6D969Cu, 0x71118310u, 0x21D27139u}}, {{0x99208ECEu, 0xB0012EC3u, 0x4ADFB761u, 0xD671944Au, 0x522BB4C3u, 0x17735B85u, 0xB075ACEAu, 0x94C5F9B4u}}},
+  },
+  { /* 16^29 */
+    {{{0xE3C0DF5Du, 0xF1A11778u, 0x5156A792u, 0x2019EFFBu, 0x475D7FABu, 0x7D8ADAB9u, 0x441FB33Au, 0xE80FEA14u}}, {{0x6AC9EC78u, 0xFCB4291Bu, 0xAF322EA9u, 0x2D155E80u, 0xA3CA9447u, 0x1E89768Cu, 0x638E0077u, 0xEED1DE7Fu}}},
+    {{{0x0F83CD58u, 0x2DB0E78Bu, 0x77D2F916u, 0x122DCC38u, 0x1EFE7A37u, 0x981AC4EDu, 0x8EA41265u, 0x440CA1F0u}}, {{0xB88A3F4Bu, 0xB07BC069u, 0x69C0A260u, 0xA21E4D42u, 0x9D4E2F02u, 0xAF8954DCu, 0xCD5EE122u, 0xA6C8B0D2u}}},
+    {{{0xD7592D55u, 0x2C0359ECu, 0x40E35019u, 0x06D5B947u, 0x633CE3B1u, 0x08AFEF69u, 0xC4A10526u, 0x5D2EC6DBu}}, {{0xAF5183A7u, 0x266E5D0Eu, 0xAD115174u, 0x0E2A7BCDu, 0x268CD695u, 0x58F710FAu, 0x9C6E45EBu, 0x0A92CDF8u}}},
+    {{{0x12998B10u, 0xE81BDA27u, 0xC1B229D9u, 0x9BC70EBCu, 0xD3A90781u, 0xC5F7F829u, 0x2B966C1Cu, 0xF694CBAFu}}, {{0x00F05E51u, 0xF6788B17u, 0x183C2A47u, 0xEB6C64C3u, 0xCC46D82Au, 0x633C5FFAu, 0x61BEF03Du, 0x40A63EBAu}}},
+    {{{0xFE8F9F5Cu, 0x991F4B49u, 0x59880A51u, 0x7361F1E1u, 0x215F404Du, 0xFE2CAE34u, 0xB11BF742u, 0xAC371DC3u}}, {{0x325A503Cu, 0x17A83FF3u, 0xEE751E1Du, 0x22953458u, 0x3254E735u, 0xFF2101E7u, 0x8709A477u, 0xC51616C1u}}},
+    {{{0xE55BF84Cu, 0xA744B8F8u, 0x570D9027u, 0xD964C6EDu, 0x223CAE4Fu, 0xE5DD3C25u, 0xCEB96CC8u, 0x62782899u}}, {{0x5F15FA2Au, 0x6F51CFABu, 0xDDD176EDu, 0x9A020DE7u, 0x29726783u, 0x01C54972u, 0x0911A289u, 0xD670ACA4u}}},
+    {{{0x19E33446u, 0xF4A1C8D5u, 0x52AF385Du, 0x40893BC4u, 0x0222A17Au, 0x9348C0BDu, 0x14F1840Cu, 0x8942003Au}}, {{0xE6387689u, 0x40D38A00u, 0x79E74F98u, 0x6BFD7736u, 0x0EFDE4E0u, 0x4D8B2D6Du, 0x95A5077Au, 0xA9FD0395u}}},
+    {{{0x8DD553FDu, 0xF95A1335u, 0xC08B6414u, 0x47ABF695u, 0x39A25950u, 0x50B6D4F4u, 0x35566848u, 0x8B6E862Au}}, {{0x3E9BE5EDu, 0xD803DAD3u, 0x183383D0u, 0x24AC3C5Au, 0xF4EB9FA1u, 0x0D10BC2Du, 0x0ED11CB4u, 0xEA5E0891u}}},
+    {{{0xB913CB26u, 0x3D728C95u, 0x013BD6D0u, 0x99EB419Cu, 0xF5505C98u, 0xA2CDA44Fu, 0x30A342A8u, 0x2770266Bu}}, {{0xF348A7A2u, 0xBFE71733u, 0xCC815BEBu, 0xE940C91Bu, 0x07F2B324u, 0x5552D24Du, 0x79B0DB1Au, 0xF649BC5Eu}}},
+    {{{0xCF0C58BDu, 0x23F4244Au, 0xF64464CEu, 0x28D49F4Du, 0x56AAECF6u, 0x32D9E100u, 0x24844C09u, 0xD3ADF06Eu}}, {{0x37C89387u, 0xE52E4AB9u, 0xA4B98C9Cu, 0xAEE3869Fu, 0xCFF638BAu, 0xBDFB2FEBu, 0xFC2A6077u, 0x57E99DB4u}}},
+    {{{0x595E8247u, 0xF0AAA021u, 0x5686CD1Au, 0x97BFDC45u, 0x1CF8BA90u, 0x78E5E6E0u, 0x83CBED21u, 0x75E4D0D3u}}, {{0x59982D22u, 0xCA23FD9Du, 0xEA9AD893u, 0x7DDAB5B6u, 0xC7B726D4u, 0x741F970Eu, 0x75410990u, 0x1FCE42A1u}}},
+    {{{0xF39715C2u, 0x399471D0u, 0xF98A529Au, 0x69006521u, 0xEA33FEDDu, 0xB411F78Cu, 0xF19A3D85u, 0x2F189E88u}}, {{0x4171DFEAu, 0x66A63584u, 0xC36854F0u, 0xEB3333E2u, 0xED10F9F7u, 0xDF708475u, 0xF3C5D7CFu, 0xC91A39F8u}}},
+    {{{0xA6333323u, 0x7479F44Du, 0x68F4ABF4u, 0x9CBBBC1Cu, 0x5984DA84u, 0x3F020D60u, 0x3361BBF0u, 0x3ED1B638u}}, {{0xB5D61BA3u, 0x4B13FC48u, 0x0B78F729u, 0xA9B728A1u, 0x688F929Eu, 0x5D97C989u, 0x8B5B4EE7u, 0xD84F2DA4u}}},
+    {{{0xFA3EB3FCu, 0x87562EDCu, 0x4D90E398u, 0x77EE6894u, 0x888A6F7Eu, 0x77E46B40u, 0x0A1B6BB7u, 0xD2CDC8BBu}}, {{0xDED37564u, 0x44287DB3u, 0x310B4927u, 0xC1F217B9u, 0x2CF926EEu, 0x6DDE9536u, 0xE5C56104u, 0xC5538AF9u}}},
+    {{{0xB33980BFu, 0xF25057D4u, 0x50DD00BAu, 0x68A3702Eu, 0x2348DD43u, 0xB846FD77u, 0x6A758181u, 0x70FDD2F0u}}, {{0xA0B75785u, 0x12EEA8CEu, 0x85D74A56u, 0x0A103583u, 0x11EE596Bu, 0x957A410Du, 0xD0D58696u, 0x5EDFCAC0u}}},
+  },
+  { /* 16^30 */
+    {{{0xC4E16070u, 0xDDC07BBCu, 0x1EFD6915u, 0xF2A18203u, 0x1D567543u, 0x13BA48E5u, 0xDFCD7043u, 0xA301697Bu}}, {{0x1E177EA1u, 0x0C0D1A04u, 0xC0A11A13u, 0x1735DBF7u, 0x25D40F9Bu, 0x081809FAu, 0xFB67E4F5u, 0x7370F91Cu}}},
+    {{{0xF24BA5AEu, 0x11420316u, 0x4C34B5D8u, 0xB4396500u, 0x9E0BFF74u, 0xF3E8D241u, 0xFF79F049u, 0x27E1E59Cu}}, {{0x883A45B3u, 0x84A5BFEEu, 0x9AFA63F7u, 0xDF48A1A6u, 0xFC79DF05u, 0xEE1B5E3Cu, 0xC804E209u, 0x310B26A6u}}},
+    {{{0x138011FCu, 0x67012700u, 0xAD728562u, 0x83596A67u, 0x82200A4Du, 0x156B1330u, 0x0815EB11u, 0x6E8313A3u}}, {{0x3F15AB7Du, 0x6ACB69FAu, 0xE9C51F9Au, 0x26AF915Au, 0x01DAC304u, 0xC1A12DB2u, 0xDC24F204u, 0xC147818Bu}}},
+    {{{0x9CAED7AEu, 0x9969175Cu, 0x84FBFB4Fu, 0x5A39ADDEu, 0x892D7E4Fu, 0x16588EC3u, 0xF6864AEEu, 0xC712E7A5u}}, {{0x46156294u, 0x84D148AAu, 0x4B0CE637u, 0x380D8E54u, 0x311DD9E5u, 0x65ED4B82u, 0x516363B3u, 0x49644107u}}},
+    {{{0xD00E6BA7u, 0x53A749B8u, 0x44916F7Fu, 0x3D36EC5Bu, 0xA4D9E1B4u, 0x2BD1E038u, 0x9784851Fu, 0xF952A909u}}, {{0x0175E4C1u, 0x8DBAEEE5u, 0x4C62A2B9u, 0x5557167Bu, 0xE27FA0F6u, 0x861376A2u, 0x08ABCEBFu, 0xD8A93A5Bu}}},
+    {{{0x595B6F7Eu, 0xF9549F5Cu, 0xD38B2021u, 0xBEB32B53u, 0xD09876CDu, 0x83A053AAu, 0x04CDA30Cu, 0xA5AC7D1Du}}, {{0x8AB19C84u, 0x48DBB730u, 0xF5818A48u, 0x99E39160u, 0x47D9EE1Bu, 0x36CC3C92u, 0xB540F55Bu, 0xDF0B8A0Au}}},
+    {{{0x83AA0E93u, 0x690065A2u, 0xAEFB1F62u, 0x8F2E3943u, 0x9D9E893Au, 0x504031A1u, 0x31D3FEE7u, 0x94016D5Eu}}, {{0x87ADDAC2u, 0x38EED268u, 0xAA57B07Au, 0xF484373Bu, 0x4EEE6FD7u, 0x40355D35u, 0x5C454D96u, 0x675032EEu}}},
+    {{{0x44A6DB03u, 0x1B43E1FEu, 0x58275D79u, 0xB2C85D6Fu, 0x6B8675FCu, 0x065C0D42u, 0xA4B3235Du, 0x0BFC0504u}}, {{0x464B8542u, 0x58AC8D1Au, 0x345D4F05u, 0x37427197u, 0x94A6C992u, 0x3FB8EC7Fu, 0x6C34F345u, 0x1955467Au}}},
+    {{{0x0266B17Bu, 0xB0F4862Eu, 0x0262BB32u, 0x023568A2u, 0x6A9F09C2u, 0x1BB97884u, 0xD59FB289u, 0xEF22D174u}}, {{0x79DAC83Eu, 0x32A6E043u, 0x71C341B7u, 0x3EE7276Fu, 0xAE34A107u, 0x68F9CCC3u, 0x7AB24C75u, 0xBC5784C9u}}},
+    {{{0xEB4318B5u, 0x57F2C542u, 0x2F5B8456u, 0x72ED5C81u, 0xDF2057EEu, 0x55788A38u, 0xE1948D0Fu, 0x9885F5FBu}}, {{0x1599175Cu, 0x2FE54254u, 0x676904AFu, 0x7C82ADEDu, 0x768CEB8Eu, 0x96D2C467u, 0x9EF198F9u, 0x135FD6F6u}}},
+    {{{0x92D382A0u, 0x2313015Au, 0xE2ECD9AEu, 0xF28DCBBCu, 0x0B2DF927u, 0x39CACC78u, 0x4CEB892Du, 0xB5F7EFCEu}}, {{0xA5B4B532u, 0xBA2F0ABBu, 0x29ACF8C5u, 0x71FB096Du, 0xE0CBDDD3u, 0x3C0957C6u, 0x51C3F235u, 0x6843545Bu}}},
+    {{{0xCE81C1BCu, 0xB93A4AE4u, 0x8ABB5B33u, 0xD25365E5u, 0xD68CE767u, 0x5AD815B8u, 0x465C0463u, 0x03360F05u}}, {{0x566CBEDDu, 0x76DD2896u, 0x5C811501u, 0x231728EBu, 0x51306753u, 0x4FF69C42u, 0x0C575001u, 0x7E48B5F9u}}},
+    {{{0x412CFFA5u, 0x7E692464u, 0x668CC5C4u, 0x89ED4208u, 0xFBD46243u, 0x408754D8u, 0xB2E71076u, 0x1CDDC3D2u}}, {{0xD521954Eu, 0xADE6D89Cu, 0x6B36B528u, 0xC41C9842u, 0xF942B08Au, 0x3FDB126Bu, 0xB2F1F8A6u, 0x1E476A0Cu}}},
+    {{{0x048993F7u, 0x1509F734u, 0xF8273CE1u, 0x96255223u, 0xBC8BAE42u, 0x6334FBE1u, 0x56A38511u, 0x0875346Au}}, {{0x72B9DCC2u, 0x601C2C81u, 0xB126018Eu, 0xC9F4D4F1u, 0xE75FA287u, 0x10E994E6u, 0xA2EF8B03u, 0x064E6CA8u}}},
+    {{{0x34A9F22Fu, 0xD35FE439u, 0x217A8E2Au, 0xCC0819C5u, 0x948835B0u, 0xF21F8B8Bu, 0xF25CE939u, 0x2ACCB359u}}, {{0xB75C4927u, 0x7B75DCB3u, 0xC5BA550Bu, 0x154BD7BEu, 0xEDF0EDF1u, 0x19213A37u, 0x588AD2E5u, 0xD518A4E9u}}},
+  },
+  { /* 16^31 */
+    {{{0x3FB04ED4u, 0xAB7AC63Eu, 0x11307FFFu, 0x08CC330Bu, 0x12678DE2u, 0x463F9D05u, 0x89D6B936u, 0x90AD85B3u}}, {{0xCB6EF150u, 0x991D4D48u, 0x1582894Du, 0x39AEFABEu, 0x427222B8u, 0xAFFDCBD9u, 0x20A38261u, 0x0E507A36u}}},
+    {{{0xA7DC0151u, 0x2818B0EDu, 0x46707BADu, 0x7E125BE6u, 0x48425E3Du, 0xF44B1D15u, 0xF8C94077u, 0x7E2CD40Eu}}, {{0x20721EC7u, 0x9A3BC539u, 0xAEEE082Cu, 0x889BEE40u, 0x321EF95Du, 0x82A61A8Bu, 0x2ADCFAB3u, 0x905B7508u}}},
+    {{{0xB0B7B678u, 0x6275DB33u, 0xBCF63816u, 0xF13C4311u, 0x426B6C76u, 0xA1986BCAu, 0x34E4231Bu, 0x186E4973u}}, {{0xF8D91FC1u, 0xA7A076F2u, 0x449535DCu, 0x11077225u, 0xC0B7E67Eu, 0xAA7FC825u, 0x9807BD84u, 0xC0D460E4u}}},
+    {{{0x1345E597u, 0x0E103AE4u, 0xDB853CF9u, 0x9C636BF9u, 0xD1EF52A7u, 0x21C975BBu, 0x95BEDACEu, 0xA146F521u}}, {{0xF45A770Au, 0x7675676Au, 0x21F094B0u, 0xEA67A5B2u, 0xDBB31B40u, 0x9AE95DD2u, 0xB053FEB0u, 0xA5A99B0Au}}},
+    {{{0xB3421FB8u, 0xCF06E5CBu, 0xEF5A55D0u, 0x984971F2u, 0xC3B72412u, 0xE7E06B34u, 0x4F6DBF62u, 0x061C8D83u}}, {{0x4E3CCD80u, 0x995EF668u, 0x3A6FCDD2u, 0x8067134Bu, 0x0E05EB5Cu, 0xBA939259u, 0x9003B4B7u, 0x6DFC6AD9u}}},
+    {{{0x4BB9DC8Fu, 0xD08C89B8u, 0xF5EDD333u, 0xABA9E93Eu, 0x352787D1u, 0x248F7035u, 0xE1C26864u, 0xFD9941CEu}}, {{0xE59780D5u, 0x743EAE53u, 0xEEFE938Du, 0x7872B2FDu, 0x788859E6u, 0x6DE97E05u, 0xBD40E6F4u, 0x7A41EC75u}}},
+    {{{0xAF6B35A4u, 0x7124BE18u, 0xAB27FB48u, 0x889F37A6u, 0x733A68ADu, 0xB7363240u, 0x208EE513u, 0xF6A6B63Au}}, {{0x81F422A6u, 0xCAEB6FECu, 0x75EE1862u, 0x19D5756Eu, 0xF560186Fu, 0x1CAD3704u, 0x002D138Bu, 0x3DF7C8A8u}}},
+    {{{0x4CE45444u, 0x0CBB53FCu, 0xFECCC4E2u, 0xDBDE421Eu, 0xB25A8114u, 0xBCFBF9DAu, 0xCF1993B9u, 0xD24C75A1u}}, {{0x87DD4A57u, 0xCB932469u, 0x99F1E524u, 0xBF7593F4u, 0x10E5A78Au, 0xCFCB7D18u, 0xE84DC1D1u, 0x58FE1D2Du}}},
+    {{{0xA6954C11u, 0xB96823E8u, 0x1560D018u, 0x7FA8A43Cu, 0x150778FFu, 0x220D1B0Fu, 0xC286C376u, 0x87A2FC28u}}, {{0x272A8B45u, 0x756E332Eu, 0x2A78124Bu, 0xCC48933Fu, 0xA0D27532u, 0x97B1948Du, 0x45AAECEFu, 0x33AD518Bu}}},
+    {{{0x87A43DDCu, 0xEEB1AFE9u, 0xA9956E4Au, 0x24282CA1u, 0xEE7BDF55u, 0xA101EB85u, 0x4946AC6Du, 0xA8B08B86u}}, {{0xDFA2A6B8u, 0x87001C82u, 0x2B1076C3u, 0xA325B445u, 0xDF0E8EDCu, 0xF31591FFu, 0xC8A36A01u, 0x7F00FE8Bu}}},
+    {{{0xE2706AB6u, 0xAE47472Au, 0xD2E53C0Du, 0x3C0B341Du, 0xBC384CFEu, 0x84556EFCu, 0x6E7881A6u, 0xE1472E04u}}, {{0x9D58DE05u, 0x36E86A16u, 0x453CD275u, 0xAA589D55u, 0x8C8621F8u, 0x83F69197u, 0x47C58FC6u, 0x82CD92AAu}}},
+    {{{0x3B963645u, 0xE3E9432Cu, 0x7E71F1F8u, 0x2DCDB280u, 0x2E3132FBu, 0x6E74781Au, 0xB1B8A63Eu, 0xC5F0954Fu}}, {{0x008BE2DDu, 0xDBF8874Fu, 0x0047BE4Eu, 0xA330502Bu, 0x0260D7E6u, 0x18A3CB44u, 0x21B0B6FBu, 0xD552D310u}}},
+    {{{0x07A84FB6u, 0xEBFAE542u, 0x0FA15021u, 0xC4236875u, 0x1E48B9EBu, 0xDE8B4D60u, 0x04F8AEF5u, 0x1CAF92C8u}}, {{0x27149109u, 0x16B18190u, 0x6A2CE676u, 0xEC1CC169u, 0xFF101622u, 0x481A64F8u, 0xC976E53Au, 0xBC24B85Au}}},
+    {{{0xE9C8381Fu, 0x53A93123u, 0x383C11A7u, 0x0ED3D6D6u, 0x34FE1010u, 0x34EBEB46u, 0xBC6D97CEu, 0xDF3ACF55u}}, {{0x2347DE3Au, 0x1AFFD696u, 0x67E389E6u, 0xB101957Eu, 0xEDACD1EBu, 0xA6099C1Du, 0x51907A75u, 0x6B3DD8CAu}}},
+    {{{0x4A955911u, 0xB768CFE1u, 0x60DED52Du, 0x107E16A2u, 0xB3D78397u, 0x2589EFE9u, 0xAF09650Du, 0x705BFD69u}}, {{0xFFD200E4u, 0x8BB7C693u, 0x2A42E72Du, 0x297F3B52u, 0xF54051FAu, 0xA7E63D81u, 0x0B73F990u, 0xE14AA413u}}},
+  },
+  { /* 16^32 */
+    {{{0x9EC4C0DAu, 0x1B7B444Cu, 0x723EA335u, 0xE88C5678u, 0x981F162Eu, 0x9239C1ADu, 0xF63B5F33u, 0x8F68B9D2u}}, {{0x501FFF82u, 0xF23CBF79u, 0x95510BFDu, 0xBBEA2CFEu, 0xB6BE215Du, 0xDE1D90C2u, 0xBA063986u, 0x662A9F2Du}}},
+    {{{0x4CF27076u, 0xE6847DF8u, 0xE7627EAEu, 0xD89858ADu, 0x7FD9AF59u, 0xFCAFEBE7u, 0x784E8158u, 0x4D49AEFDu}}, {{0x03AA781Eu, 0x6B90B662u, 0x7DF4D846u, 0x6E0F2D1Au, 0x359CA6F0u, 0xE723F210u, 0xA10DD135u, 0xCD32FC59u}}},
+    {{{0xD23809FAu, 0x18E2B8EDu, 0x51D954BEu, 0xFD845CB3u, 0xF2451F08u, 0x8BA93363u, 0x2E509F22u, 0x38381DBEu}}, {{0x331FED52u, 0xBD707518u, 0x32D8F24Du, 0x3681FCCBu, 0x520EB1CCu, 0xB09405A5u, 0x0FB917DCu, 0xE4A32D0Au}}},
+    {{{0x29B62026u, 0xE8DBCB57u, 0x889D1D4Eu, 0x8D2A3DE0u, 0x1F5C5AA7u, 0x37D6619Eu, 0x85D56F85u, 0x7564539Eu}}, {{0xDACE0CF3u, 0x4172C8FAu, 0x54B79F33u, 0x684AACD9u, 0x4A722925u, 0x5231DF52u, 0x3749B3C6u, 0xC1D68541u}}},
+    {{{0x97C2A310u, 0x3EA42648u, 0x40122630u, 0xF186AEA5u, 0xAA4699A1u, 0xF6921B82u, 0xE4372AE6u, 0x49262724u}}, {{0x5E27DED0u, 0x0C41B681u, 0xA75FF8CEu, 0x6D163612u, 0x9714303Bu, 0x5A2CFA56u, 0xBCA7ABF9u, 0x1337E773u}}},
+    {{{0x03663DA4u, 0xF8166C19u, 0x9F5D0B81u, 0xA5A36291u, 0x7C44AA2Bu, 0x6808A6EDu, 0x6AA5705Eu, 0x6A664A35u}}, {{0x33FC22C4u, 0xC28313FBu, 0x7E6C04C9u, 0x08991612u, 0x96BF0CD5u, 0x29F86EC1u, 0x54FDE98Bu, 0x449A1259u}}},
+    {{{0xCEBD2D31u, 0x1384B079u, 0xFF06DB8Du, 0x4DCC1A56u, 0xE477E2F8u, 0xD5E253B3u, 0x1A240C90u, 0xE306568Cu}}, {{0x92546E44u, 0x692B4083u, 0xBE373826u, 0xFFBC8042u, 0x7F7D0DB6u, 0x888F2B10u, 0x78934260u, 0x0EAC6FE3u}}},
+    {{{0x57B4A278u, 0x5364DACDu, 0x1FF4082Bu, 0x78F61A5Fu, 0x1AD9CCC8u, 0x6746FF30u, 0xD9DF2779u, 0x210A917Au}}, {{0x0C7B2231u, 0x7F2713FDu, 0xAFF20BFCu, 0x3789E61Au, 0xF8D6737Du, 0x7A39BE81u, 0x50B5E57Bu, 0x670E1B54u}}},
+    {{{0x363136B0u, 0xC530C39Eu, 0xAAB41DD9u, 0x74EBF8D9u, 0x23FBD633u, 0x271B0E76u, 0x2428CEFCu, 0x3B9E100Eu}}, {{0x6CDBBC8Au, 0x953EC16Fu, 0x3AD31F81u, 0xA2AE28A3u, 0x8F475B26u, 0xDF1533EBu, 0x2D16BB71u, 0xFAFB9815u}}},
+    {{{0xDD90124Eu, 0xEA98EB53u, 0x5281C85Du, 0xC1E80268u, 0x6DB38156u, 0x77E9A194u, 0xC06C5541u, 0x7AEACA93u}}, {{0x22021E31u, 0x3F507810u, 0xB90A904Bu, 0x59BC1BF9u, 0x46C1D951u, 0x4FACAFF0u, 0x0C1390F0u, 0xDFB29B19u}}},
+    {{{0x2F485D3Fu, 0x9608F047u, 0x8107BEEEu, 0x17CA0768u, 0xF5DEDEF7u, 0x2B76CA80u, 0x712AC9A9u, 0xBB0AAD49u}}, {{0x3CA2F975u, 0xE7939250u, 0x31670BFFu, 0x895A5AFAu, 0x7297DA34u, 0x8ECD201Fu, 0xC5835479u, 0xEA699C53u}}},
+    {{{0x05ED815Eu, 0x70F702D5u, 0xC1C017B4u, 0x66F440ABu, 0x19547AD1u, 0xEBB5FAD2u, 0x79F74A32u, 0x5568DAC6u}}, {{0x00602DF0u, 0xD9BBF64Cu, 0xE2582151u, 0xEB05F7EEu, 0x1D073F2Bu, 0x580D6FE0u, 0x2788BA64u, 0x7A85F874u}}},
+    {{{0x36718DC9u, 0x4AEED33Au, 0xB01123DEu, 0xE1E58B4Du, 0x7AFE0113u, 0xD4E8EB19u, 0xE4EEFCC0u, 0x79090AC8u}}, {{0x1CFAE7C5u, 0x963322B1u, 0x0BA9008Bu, 0xDD36AFB7u, 0xCD9AAA56u, 0x13D816CBu, 0x91905B8Fu, 0xEAAB722Bu}}},
+    {{{0x2E44A0C8u, 0xABEC1BDCu, 0x2EE29932u, 0x2C9BE740u, 0x0C7436C3u, 0xBC9BAE60u, 0x4807943Cu, 0x601E9E88u}}, {{0xBA00E557u, 0x54793412u, 0x6B46E659u, 0x424E0C5Au, 0x9FFABBB1u, 0x714B8CFAu, 0x6FDC8ECCu, 0x5A7A22AAu}}},
+    {{{0x7F60C7D1u, 0xA269694Cu, 0xCD775AD2u, 0x8DD71DE7u, 0xE549BA66u, 0x1C03DBBCu, 0xE9F97B55u, 0xE77C81ADu}}, {{0x82D72449u, 0x4EC581F2u, 0x1C2986D3u, 0x631470F7u, 0x3EA81543u, 0xC5FC3B32u, 0xEEF81321u, 0x3ACF1478u}}},
+  },
+  { /* 16^33 */
+    {{{0x53231E11u, 0x6686FD50u, 0x03681E3Eu, 0x1F48E865u, 0x198C3609u, 0x5FF99FF9u, 0x76AF85D6u, 0xE4F3FB01u}}, {{0x6FEB73BCu, 0x822C3857u, 0xC951D1C9u, 0x6CC7E74Eu, 0xEA02B728u, 0x1661A6D0u, 0xD0EF4F1Cu, 0x1E63633Au}}},
+    {{{0x3BCDAF2Fu, 0x3BFEE223u, 0x5BA17295u, 0x88531A82u, 0xABDB362Fu, 0x1EC64110u, 0x686773E0u, 0x4B30CBB7u}}, {{0x3D26B5B7u, 0x68033D46u, 0xE4348575u, 0x1FDF3C81u, 0x77C3C4A9u, 0x6F9E2C57u, 0x65BB629Bu, 0x74C63502u}}},
+    {{{0x6BF05BD6u, 0x5399F04Eu, 0x212A9946u, 0xA2F56E03u, 0xEB470DECu, 0x0832F51Fu, 0xBEE44FE9u, 0x900C3241u}}, {{0xF00D358Bu, 0xDE52AD3Bu, 0x3C4EFB15u, 0xD6985358u, 0x570B2439u, 0xF95C7204u, 0xE8B1F0F5u, 0x6C31F9E8u}}},
+    {{{0xA673059Fu, 0x2FFE9C29u, 0x50E0FA19u, 0xEC117150u, 0x17464817u, 0xCD15B20Bu, 0x7AE1700Du, 0xCBB434AAu}}, {{0x227C070Cu, 0xB7DA9642u, 0x0AD5F845u, 0x41D45E4Fu, 0x38B5DFADu, 0x562D4923u, 0xB4DABD17u, 0x4A1A200Au}}},
+    {{{0x9F105C50u, 0x7A7C28CCu, 0x7B138525u, 0x82E0DEEFu, 0x03C233CDu, 0xD628CC34u, 0xAB0590AAu, 0x5A8D0362u}}, {{0x38A4CDE9u, 0x5C9B2018u, 0x66D013C3u, 0xA605F68Au, 0x4143FF74u, 0x936A6B72u, 0x13D4E536u, 0xC059EAB1u}}},
+    {{{0xA72E294Du, 0xBE6FB2F7u, 0xF00D0DD5u, 0xF158EBA3u, 0xEDF7EDC6u, 0x1A6289EAu, 0x5CD534B9u, 0x29DFE480u}}, {{0xEC469B52u, 0x44137260u, 0x3929EE69u, 0xD1F1961Cu, 0x88A05E4Du, 0x9B434E75u, 0xD00672E1u, 0xBF66D826u}}},
+    {{{0xB2D64FEBu, 0x647E18B9u, 0x9292292Cu, 0x3772F8A5u, 0x76CBA4E8u, 0x48EF3A57u, 0x1232F60Au, 0xD93F4D03u}}, {{0x34698359u, 0x7B0FBD59u, 0xEEC90DA3u, 0x93E0430Bu, 0x54DC8C4Du, 0xA237311Cu, 0x45CB2733u, 0x7925555Du}}},
+    {{{0x06DE12C0u, 0x4D4786E1u, 0x874610E9u, 0x6D9CDAC5u, 0x7557244Cu, 0xD06D7B1Eu, 0x9C102C1Cu, 0xF478056Du}}, {{0xCA5361FEu, 0x69A76CE6u, 0x09AB92D7u, 0x26C17EF6u, 0x1068694Cu, 0xE68095E0u, 0xF33E3946u, 0x7F09E610u}}},
+    {{{0x439FBC84u, 0x722204CDu, 0x6057A016u, 0x7E706291u, 0x662AC65Bu, 0x1B14E2BCu, 0xE36F2844u, 0x2F0769C6u}}, {{0x1C201BECu, 0x3FB902DEu, 0x4C4DD5D7u, 0xCCA79B6Au, 0x990E2149u, 0xFA5DF007u, 0x4D73BDDDu, 0xB434F372u}}},
+    {{{0xD026DEA2u, 0x928B2FD2u, 0x2C59C5D8u, 0x87C84C45u, 0xD9A6DD61u, 0xD71A1E26u, 0xD561BBFBu, 0x1DDCFA48u}}, {{0x183DE522u, 0x06F4873Du, 0x51C06734u, 0x666FD68Cu, 0x6402C020u, 0x41FEA34Du, 0xA9923A7Du, 0xC6FA401Fu}}},
+    {{{0x86A758EAu, 0xD537EACCu, 0x927F19C4u, 0x91188318u, 0x15416E39u, 0x9586895Au, 0x559E0309u, 0xFE7E6780u}}, {{0xDB7AB649u, 0xE4F22D95u, 0x443120D1u, 0x3B801707u, 0x9849251Fu, 0x88C08E16u, 0xA281DCB9u, 0x38AA6967u}}},
+    {{{0xC33773F7u, 0x3C7F0046u, 0x45B59995u, 0x50D44FD3u, 0x09E372A1u, 0x3E1410C0u, 0xF5DD236Du, 0x355B3226u}}, {{0x1887C182u, 0x0053C3FFu, 0xCCE25109u, 0x1E25DF78u, 0xDD21FCB8u, 0x49F10EEDu, 0x704703ADu, 0x08ECA480u}}},
+    {{{0x8CFFFEFAu, 0xDE715626u, 0x70651AFAu, 0x1018044Fu, 0x50C3AF85u, 0xD6DF6F91u, 0x75383127u, 0x91BAF5CAu}}, {{0xDF7F6FAFu, 0xC7D36F34u, 0xE6FD303Du, 0xF4BEF310u, 0x27DD3D92u, 0xE5D969F1u, 0x9347BCEBu, 0x04E5CF11u}}},
+    {{{0x90785491u, 0xDD3DF406u, 0x4AEAA5D1u, 0x5291DE5Eu, 0xB2F866B7u, 0x5619F43Cu, 0x7F260BAEu, 0x92B1E0F1u}}, {{0x58BE555Bu, 0x9C98D360u, 0xE2288D7Bu, 0x3985FB77u, 0x034E5AD0u, 0xE167C1D1u, 0x8D8D9E63u, 0x81EC4402u}}},
+    {{{0x8D33C546u, 0x2FC0917Eu, 0x285EDAF3u, 0x82575FB3u, 0xE0F5DDD7u, 0xCB2C5373u, 0xCB3F78A7u, 0x44584121u}}, {{0x000B4FD4u, 0x60A6D187u, 0xFB2CA736u, 0x852F0A3Cu, 0x391ADA20u, 0x77225EAEu, 0xF3F8753Au, 0x308D9377u}}},
+  },
+  { /* 16^34 */
+    {{{0x20EAE29Eu, 0x16FB6EAEu, 0x0D4E1D07u, 0xC7034F2Fu, 0xA45A4266u, 0xEB961537u, 0x18EBF331u, 0x8C00FA9Bu}}, {{0x6702414Bu, 0xE7D2A4C6u, 0x81E36C54u, 0xC2FADAFAu, 0x3736C974u, 0xA9DC343Au, 0xFEA521A1u, 0xEFA47267u}}},
+    {{{0xC18ADA5Fu, 0xE84C9AB0u, 0x29122FB3u, 0xFD7E297Fu, 0x636BE1EFu, 0xA8BB5BF9u, 0x6DA2B46Fu, 0x24CFC017u}}, {{0x978A586Bu, 0x68FA6139u, 0xA4F814F2u, 0xED959CA1u, 0x5DEDA927u, 0x9868714Du, 0x079C61A6u, 0xEBFF8FBBu}}},
+    {{{0xEBFD913Du, 0xC3F95603u, 0xEE54C9EAu, 0x50A680E6u, 0x4C2A8D20u, 0x74D07A08u, 0xE907DDF8u, 0x36362AA7u}}, {{0xC52E243Du, 0xC44F9AEAu, 0xD6B2FAAFu, 0xD830BB10u, 0x70DA2A82u, 0x34162443u, 0x6CB8AFD5u, 0x48F27867u}}},
+    {{{0x94679DA2u, 0xF1031895u, 0xC7F057EDu, 0x16DDD67Fu, 0xA1292EC6u, 0xEA2DED72u, 0xD4B9BC82u, 0x004A7D58u}}, {{0x779FFE26u, 0x4877F484u, 0x963FA28Au, 0x71C3B494u, 0x7EC71B3Bu, 0xE6B1D814u, 0x6702CB75u, 0xB98AC5B7u}}},
+    {{{0xAD132896u, 0x7CABABF9u, 0xB7BC6C96u, 0xFCB1E3BAu, 0x2DD9200Du, 0xF295AD96u, 0xF32A1E02u, 0x4487976Du}}, {{0xAF685248u, 0x48C01B12u, 0x6276AA7Au, 0x06B40D5Au, 0x74561A33u, 0xEFC9A907u, 0xD115AFE1u, 0x27BD5860u}}},
+    {{{0x775732C0u, 0x859864D3u, 0x233777AAu, 0x202FE5E7u, 0x7CB1096Eu, 0x624A5D1Bu, 0xF8B74B9Bu, 0x8F3CCF31u}}, {{0x65B9415Bu, 0xE73BDE5Eu, 0x54858825u, 0xA90E6877u, 0x97CE53D8u, 0x89EF46D9u, 0x2D39E531u, 0x67F1CD3Eu}}},
+    {{{0xBFA2670Cu, 0xE08156F6u, 0xA06273E6u, 0x7400F82Bu, 0x83350324u, 0x8B6A9CAAu, 0x8BCB8378u, 0x4A4D3AC2u}}, {{0xD6C1764Du, 0x808B9FFDu, 0xBF29BEEDu, 0x4930594Cu, 0xDEF02B9Du, 0x17E7711Du, 0x01845A4Fu, 0x70ABB91Cu}}},
+    {{{0xC87C4B65u, 0xCCF34EADu, 0x1E07B2A9u, 0x96F8808Au, 0xC066CE49u, 0xFC76C5E2u, 0xCBD001C7u, 0xEE7D69C4u}}, {{0xD136A95Au, 0x23E8F44Eu, 0xBAE942E5u, 0xC33E8999u, 0x030F2EE2u, 0x1A192ABFu, 0xC1A41382u, 0xECC8626Eu}}},
+    {{{0x4CB24AA7u, 0x0D96AFE2u, 0x39345C53u, 0x903108C6u, 0x9FF8FE18u, 0xC3AE6FD8u, 0x0AE91802u, 0x5F7B2D19u}}, {{0x4A693D7Du, 0x6D780743u, 0x93C81D0Cu, 0xCE8DEB70u, 0x3CE67C47u, 0x30A3F80Au, 0xC4FDF2B3u, 0x07703600u}}},
+    {{{0xFF004130u, 0x842632D7u, 0x81C36B09u, 0x49FD8633u, 0x254CB5AAu, 0x266A14E5u, 0xF72D186Bu, 0x50D775B5u}}, {{0xDF6E406Du, 0x456B8C64u, 0xEEF6A4C3u, 0x2975D945u, 0x6010063Fu, 0xC5172434u, 0x0F4EA557u, 0x3401EE3Bu}}},
+    {{{0x2F7FB8BDu, 0x4191BC5Fu, 0x5FE4090Au, 0x7BC464A1u, 0xD94886D8u, 0x2AEC24E6u, 0x339D90D0u, 0x51397451u}}, {{0x83908C0Fu, 0x8094AC2Du, 0xE3F98D5Au, 0xFAFC32D3u, 0xAE815C47u, 0x4B88FEFDu, 0x47643BF3u, 0xFCD7143Eu}}},
+    {{{0x34889F3Fu, 0xF2A1F839u, 0x45095DA7u, 0xC4FEB28Bu, 0xB169B0EBu, 0x21EA3469u, 0xF1B21196u, 0x87991026u}}, {{0xC3BB792Bu, 0x49E2DF9Bu, 0xF286037Bu, 0xE932F61Bu, 0x717F279Du, 0x2132F2CBu, 0xA5A91D96u, 0xDDEAB94Cu}}},
+    {{{0xEE36CA73u, 0xE2B74915u, 0x6BBBF3EDu, 0xEAC864D3u, 0xBF014887u, 0xAA429112u, 0x2BFBDFB8u, 0xCF8316D6u}}, {{0x2EC25534u, 0x5B492194u, 0xD88D710Fu, 0x1C961598u, 0x90DCCA68u, 0xE3844508u, 0xEB5D9D73u, 0x09FEB58Du}}},
+    {{{0xBD9C8F0Au, 0xAFCD9846u, 0x8BD84E64u, 0xAF3E9F2Cu, 0xBC03A87Cu, 0xC3926603u, 0x297BA44Fu, 0x6E2114EDu}}, {{0xD16A2C9Bu, 0xBD79148Du, 0xD0F9595Eu, 0x090BEC75u, 0x80C5D91Du, 0x7DA6D50Fu, 0xC26F06E2u, 0x05591A0Cu}}},
+    {{{0xB752F97Du, 0x3C8937D6u, 0x5F347661u, 0x5A2EFBC7u, 0x68CFA616u, 0xE539D286u, 0x4C4BB49Du, 0x8610DE9Au}}, {{0x1F1B1AF2u, 0x8057DCD4u, 0x545543E0u, 0x57AB4D9Fu, 0x2533F99Eu, 0x937CD99Bu, 0x2B630BBCu, 0xD31997A0u}}},
+  },
+  { /* 16^35 */
+    {{{0x60CB3E41u, 0x997FDDFCu, 0x308B92C0u, 0x143D084Fu, 0xA9E98ED3u, 0x3E10CEC0u, 0x9DD4829Fu, 0xE7A26CE6u}}, {{0xCF2CFD51u, 0x0E8A9421u, 0x420E83E2u, 0xD0A6B2C0u, 0x1AAFBB18u, 0x471B006Au, 0x0FA7984Bu, 0x2A758E30u}}},
+    {{{0x7B4AE861u, 0xD97E5B91u, 0xD6E32FA9u, 0x203C35E4u, 0x772089F5u, 0x0D38BFB6u, 0x036BF8D0u, 0xF5CAFABAu}}, {{0x0D82239Cu, 0xCC9C239Cu, 0x552F05F3u, 0x9B3B2A9Cu, 0x64083915u, 0x7BFF9904u, 0x022A6D81u, 0x19E83B8Au}}},
+    {{{0xFAEE42DBu, 0x70F9FD2Bu, 0x4730714Au, 0xD9BBBC5Bu, 0x91ECBFC1u, 0xFC7B6EDBu, 0xD9B59150u, 0xCC3427E7u}}, {{0x15D87BDBu, 0xC6229C01u, 0x8E72422Du, 0x10E5CBADu, 0xFB215200u, 0x885E3FD3u, 0xA521C6A1u, 0xEA249841u}}},
+    {{{0xBD2A9651u, 0x84FD4CD7u, 0x494C9820u, 0x8F9E509Cu, 0xD7E80542u, 0x12DF5156u, 0xCEB63F1Fu, 0xE9389024u}}, {{0x5E786824u, 0xFEFDE2B7u, 0xC6770BFEu, 0x8D7110CEu, 0xF671AAF1u, 0xF9287ABAu, 0x23726595u, 0x86486887u}}},
+    {{{0x7ED4A086u, 0xFF4366C6u, 0x8E9C410Eu, 0xB1D75C15u, 0xFBCB5CF4u, 0xEC83C585u, 0xCD98445Du, 0x948F05BAu}}, {{0x9E2BCA4Bu, 0xA2A1800Fu, 0x1C3FA2D1u, 0x1C2328A7u, 0x60113941u, 0x82F450A6u, 0xFB5A2A33u, 0x864CA89Fu}}},
+    {{{0x2E96E4F1u, 0xCB0A7165u, 0x0AE80030u, 0xFF5F0160u, 0x335EFCCAu, 0x20177708u, 0x0198197Eu, 0x56BB148Fu}}, {{0xEEB0582Eu, 0x5889F019u, 0x004AF0EBu, 0x7313D1D2u, 0xBE30EA9Fu, 0xBEB03ED8u, 0x61300A33u, 0xA09584A5u}}},
+    {{{0xB7542C21u, 0xC0CBEA6Cu, 0x8EA64C15u, 0xAE19F4D2u, 0x451D6D43u, 0x0656FC45u, 0x92919AC9u, 0x25841962u}}, {{0x672BFABFu, 0x3BEBE319u, 0xE4C2AD7Bu, 0xF3E3A186u, 0xCC7513D5u, 0x01E5DAA4u, 0x1CDB2448u, 0xFCB35B1Fu}}},
+    {{{0x7CDDAB8Bu, 0xCF2D41AEu, 0x53C68E6Fu, 0x9F0E4D12u, 0xD82D0C37u, 0xED116900u, 0x7829256Bu, 0x264559D8u}}, {{0x001DE473u, 0xC9F64B45u, 0x39CAF1E6u, 0x7A8631AFu, 0x034072D7u, 0xEF7BC637u, 0x26D3512Cu, 0x79E5BD19u}}},
+    {{{0x0C1ECBF8u, 0x43C461F4u, 0x9AEED7CAu, 0x6489F0DEu, 0xC1E8421Fu, 0x22A9754Cu, 0x1373C525u, 0x7E12CDC4u}}, {{0xB0BED615u, 0x9D45B8CDu, 0x8FE1D9F5u, 0xC969F61Du, 0xBE4D1259u, 0x143F94DAu, 0x888DC837u, 0x71284F88u}}},
+    {{{0x898A26C1u, 0xE2DA28FBu, 0x7393B04Au, 0x9A954FA1u, 0x9C26E1C5u, 0x6EA35157u, 0x373B52BBu, 0xB6A0C8FDu}}, {{0x8A78217Cu, 0xF5550EDAu, 0x58AB5A06u, 0xFC94A5E8u, 0xEBDA7FACu, 0x9A901E3Fu, 0xDA037494u, 0x5EF193BFu}}},
+    {{{0x14557D86u, 0x17E6651Cu, 0x8E667FF4u, 0x1CFEEC47u, 0x7A05A6CFu, 0x772B91CAu, 0x2A3742A6u, 0x4B8EC2FFu}}, {{0xB5167EB9u, 0xBDD9B191u, 0x0FC3F692u, 0x28D5F2EFu, 0xE527AC5Fu, 0x14A4072Du, 0x04C157ABu, 0xFDE6C3FFu}}},
+    {{{0x81F23D1Fu, 0xA4C57F59u, 0x20C036D8u, 0xB6B25FD7u, 0x1FD8A0A6u, 0xBD3D489Eu, 0x3D670BBBu, 0xB398E815u}}, {{0x832FF3FCu, 0x1583EBFFu, 0xD26156CDu, 0xEA791D8Au, 0xFB00BA52u, 0x07F7FEB2u, 0x572DF47Fu, 0x69F59C22u}}},
+    {{{0x4780763Cu, 0x52B82D3Bu, 0x9265691Du, 0x5F8A6D5Eu, 0x697AC07Eu, 0x532436DCu, 0x33963A42u, 0xFCD5C107u}}, {{0x38E851CBu, 0xB54E7420u, 0x716463A4u, 0xB119B22Eu, 0x5F72E38Cu, 0x3B720DB3u, 0xE5522C46u, 0x18DDABE2u}}},
+    {{{0x33E9FC8Du, 0x2B1C47A6u, 0x824F28ADu, 0x48B84809u, 0x54631A73u, 0xA6CD0B20u, 0xBB425DFFu, 0x634A0DC1u}}, {{0x273F87B6u, 0x9587F30Bu, 0x8ED5C616u, 0x519AD5A1u, 0x7DE4A9CFu, 0xAFE05A65u, 0xE75A4B6Cu, 0xD75BE21Fu}}},
+    {{{0x5D8EF686u, 0xBCE3BE30u, 0x02272E66u, 0xF68E48F4u, 0xF8266E53u, 0x2238A5DAu, 0x5843CBE5u, 0x900F2CEEu}}, {{0xE121A8CFu, 0x073A4967u, 0x3C9156D5u, 0x596CDFF4u, 0x1349D110u, 0xD61C551Bu, 0xEC60425Au, 0x732AC155u}}},
+  },
+  { /* 16^36 */
+    {{{0xDE6B80EFu, 0x3CF29EB3u, 0x7D79424Fu, 0x71CBCB96u, 0x23BCBDC5u, 0xD23540C2u, 0xE3662EC8u, 0xB6459E0Eu}}, {{0x1A71BA45u, 0xF30BF0B6u, 0x48E35B2Fu, 0xC4B3AE6Du, 0xE5661DB3u, 0xE1DADF16u, 0x06F3E06Du, 0x067C876Du}}},
+    {{{0x033EB51Fu, 0x253EF375u, 0xBE79C211u, 0xB6890576u, 0x01F41593u, 0xE4D36F73u, 0xD9823C88u, 0xE5D8E8F0u}}, {{0x5A62A2D9u, 0x79D5BD96u, 0xD9F0F549u, 0xE509DC46u, 0xD8FEEEF0u, 0xABB16A57u, 0x861E3E04u, 0x4DC1E9B7u}}},
+    {{{0x319888E9u, 0x439CF279u, 0xF2448A8Bu, 0x3D12BA6Bu, 0x29668167u, 0xDDE60D30u, 0x3AC3A6E2u, 0x1F90EA77u}}, {{0xEF113B79u, 0x56FDFC97u, 0xE59522E6u, 0x213751FEu, 0x71EB96A8u, 0x958153D2u, 0x15DAA10Eu, 0x89BE367Cu}}},
+    {{{0x0F155E64u, 0x37A67648u, 0xA8A30117u, 0xAB66BE4Fu, 0x21BAE0DDu, 0xC56B0F73u, 0x7DBC8C3Du, 0xA9CA27F7u}}, {{0x561B3297u, 0x1F3F333Cu, 0x1BCAF0AEu, 0x875D4182u, 0x6C02D004u, 0xD197D224u, 0x78FB14D4u, 0xF4BB3356u}}},
+    {{{0x3562222Cu, 0x085EFB6Fu, 0x91E6F2C6u, 0xDE034479u, 0x334B52BAu, 0x6E702BADu, 0xEDFFE0ADu, 0x13A4E54Du}}, {{0xA8200145u, 0x8CB1668Cu, 0xADC904C0u, 0xD4F9C577u, 0x1D609A52u, 0xB2CAC2F8u, 0x5816E813u, 0xC9D67D4Eu}}},
+    {{{0xC1BF6C42u, 0x93EAB3DDu, 0x11988753u, 0xF7793D9Bu, 0x16CEE74Eu, 0xEE746548u, 0xD6C105C7u, 0xD02E1B3Cu}}, {{0x87BC54CCu, 0x1336328Fu, 0x931B6AACu, 0xBCA5879Bu, 0xD0D24526u, 0x12732270u, 0xCA8E2258u, 0x9A0B74F3u}}},
+    {{{0xF43B46BBu, 0x437E4DC0u, 0xFAC92525u, 0x12ED3A63u, 0xD8455DBDu, 0x1D407C05u, 0x233CAADDu, 0x61991EBFu}}, {{0xCC20A848u, 0xF48F5901u, 0xA52ECD8Eu, 0x1CA8729Cu, 0x66FBADF1u, 0x952F3871u, 0xF3FDE492u, 0x01C5E308u}}},
+    {{{0xD6EE247Cu, 0x6D4BC629u, 0x7F51CEE0u, 0x1F478E84u, 0x11CFE759u, 0x5EBA1056u, 0x0686D7F2u, 0x68FB7180u}}, {{0x1A01865Du, 0xAE1F822Du, 0x04C73C9Du, 0x9A8D580Bu, 0x501B0C07u, 0x73735427u, 0x62DD9636u, 0xCD12D234u}}},
+    {{{0xD21ADD3Bu, 0x7E5BE3DDu, 0x45727D8Fu, 0x8B9A944Fu, 0x0D162611u, 0x49039CDBu, 0xB787D387u, 0xEA27AEA4u}}, {{0xB68CE7DDu, 0x1B5E291Du, 0x8E4E1BE7u, 0x78B212D6u, 0x325C2F62u, 0x5723CEB2u, 0xE42A17DEu, 0xC70FF1E6u}}},
+    {{{0xE2DA1F54u, 0x9345ABDBu, 0x231425DFu, 0x1B2B52C2u, 0x19345116u, 0x987550ABu, 0x3DF260EBu, 0x7137F7B2u}}, {{0xCDC3EDBCu, 0x4AF8D436u, 0x46CFDBB8u, 0xEBF081D5u, 0x7F2600A7u, 0xE5CDACB1u, 0x04358074u, 0x5FE78AD8u}}},
+    {{{0x611FF757u, 0x6E8AF8BBu, 0x1C4C226Eu, 0x9B4CE974u, 0xB6E2B6DAu, 0xBA9010F8u, 0x6B7FFD54u, 0x59465135u}}, {{0x894D031Au, 0x28A66ECAu, 0x7FBFFE3Bu, 0x961BBC7Bu, 0x15C406F9u, 0x042038D0u, 0xE5DF2750u, 0x3611360Cu}}},
+    {{{0x8F6C15C2u, 0xA1EF47F1u, 0xC8F38F1Cu, 0x3DE76414u, 0x39D14348u, 0xEA173981u, 0xBCA1757Fu, 0x8456A852u}}, {{0x8B174134u, 0xFF1EFC32u, 0x856FB671u, 0x4CC90F09u, 0x71079E7Fu, 0xFD349EC3u, 0xD4842CDEu, 0xE1B9DA46u}}},
+    {{{0x636160B5u, 0x676258A3u, 0x70E7EBC0u, 0xCCC53F24u, 0x70091EC0u, 0xE843AF79u, 0x15F73290u, 0x16B26E39u}}, {{0x58A1DC0Eu, 0x14625FBFu, 0x70BA3EF8u, 0xE1363AACu, 0x463654D4u, 0xB6364352u, 0x6302EF8Bu, 0x060F565Au}}},
+    {{{0x8E1B793Eu, 0x3D61DE93u, 0xB0D2E518u, 0xD36AEEA2u, 0x2CFAAE4Du, 0x5C02ECCFu, 0x98351CE6u, 0x4F15157Cu}}, {{0xC3BA9889u, 0xB4FCC1FDu, 0x354A47AAu, 0xC0DAFF4Bu, 0x9CD4A0CEu, 0xFC9DA9DBu, 0x079DB939u, 0xC094E366u}}},
+    {{{0x37B32DB8u, 0x3964D289u, 0xF647791Fu, 0xC91ED749u, 0x842CEA85u, 0x1BEA143Cu, 0xC4559F93u, 0x024B5295u}}, {{0xAA64F760u, 0x59454FAAu, 0x205B81A9u, 0x62AB6811u, 0xCC5E5BE8u, 0x7B6E2821u, 0x5BFF309Cu, 0x609FEF8Fu}}},
+  },
+  { /* 16^37 */
+    {{{0x496943E8u, 0xDEDA0F5Bu, 0x7E73C5A5u, 0x1D6F1FC6u, 0x118F0623u, 0x793234AAu, 0x280BB840u, 0xD68A80C8u}}, {{0x6B133120u, 0x294C8426u, 0x7845295Au, 0x5B0E7B8Fu, 0x77B0E28Bu, 0x0C4B1F91u, 0xF4B586D0u, 0xDB8BA9FFu}}},
+    {{{0xA412B6FDu, 0x8BDA222Cu, 0x6F702B82u, 0xACED053Cu, 0x3752373Cu, 0x402F8EFBu, 0x677A40BEu, 0xF16A409Cu}}, {{0xECA052DAu, 0x268DAE77u, 0x249EBCA4u, 0x16540659u, 0x74E30E4Eu, 0xD7A6A75Au, 0x14532799u, 0x2A413117u}}},
+    {{{0x8CA1C4F9u, 0x35B42AA1u, 0xCAB7E282u, 0x4F4EFE34u, 0xA61F16F4u, 0x4C40B83Du, 0x22BD728Cu, 0x7815F78Fu}}, {{0xB778BC15u, 0x9AB1EA36u, 0x1577D1E1u, 0x5CB42DE6u, 0x1458C35Du, 0x7DD93CF3u, 0xCD39AF6Au, 0xC1C601E8u}}},
+    {{{0x326DD4E4u, 0x5C1A0B6Eu, 0x6BED9832u, 0xB89F4F2Fu, 0x9976F84Du, 0xFBE37F69u, 0xAB766F42u, 0x4154B506u}}, {{0x075DED1Cu, 0x6C859295u, 0xD1E22DD4u, 0x414EA9D9u, 0x61025FF6u, 0x94C6E44Du, 0x43C59888u, 0x23AD0750u}}},
+    {{{0xEE8C8530u, 0x6D26E1C3u, 0xEF8F4D8Eu, 0x512DF681u, 0x016A6C6Du, 0x6E377C64u, 0xA0EC4017u, 0xC39273CDu}}, {{0x798446C7u, 0xC4030F0Fu, 0xA2EED715u, 0x50EDFCBDu, 0x41C31998u, 0x9D01D394u, 0x57433C8Eu, 0x8C41BE42u}}},
+    {{{0x43ED5996u, 0xBDE4CE8Bu, 0x9360AF53u, 0x6831FE59u, 0x3281B924u, 0x492FBC90u, 0xFE99A4EAu, 0x1A46B7E9u}}, {{0xE8C85CAEu, 0x2EE4ED11u, 0xEF52745Cu, 0x508794A9u, 0xA063EBF5u, 0x0E3EE084u, 0xA3F1DC57u, 0x683CE81Eu}}},
+    {{{0x237A26C1u, 0x31F240BBu, 0xC0DBF6A5u, 0x166C6E58u, 0xC1D03B25u, 0x27522431u, 0xF58411B0u, 0xDA317447u}}, {{0xECF74D6Fu, 0xF51836ECu, 0xD7A81525u, 0xD36836C5u, 0xC259D8B7u, 0xD2384167u, 0x7F5D8C69u, 0x753B97B8u}}},
+    {{{0x3F7F0246u, 0x4C51A7A6u, 0xFC727DDFu, 0x93E86E49u, 0x0B5956EAu, 0x080A8D4Du, 0x69CC95C1u, 0xB73C6527u}}, {{0xEA2A407Bu, 0x597E5164u, 0xC6E554E5u, 0x1A0D72E4u, 0xC5B6C1EAu, 0x4B535893u, 0x7174CA9Du, 0x9A67DB10u}}},
+    {{{0x3739DC49u, 0xD2B628A9u, 0x66F55603u, 0x239392DAu, 0x8BFF231Au, 0x1064AC50u, 0x02AF0E6Cu, 0x6A4BE6CBu}}, {{0xF2EDD5CFu, 0x3E6A2B9Du, 0xB14A4A4Du, 0xAB7E2B4Cu, 0x60FA8058u, 0x7DC166E3u, 0x2A890759u, 0xF15D8FAAu}}},
+    {{{0xD8F8FB8Cu, 0x8AD9BF9Du, 0xAA5BDE14u, 0x4CDC2B9Bu, 0x5C730111u, 0x9512FACBu, 0x60D8200Cu, 0x3659BA70u}}, {{0x7CC8A3D1u, 0x75E46B8Cu, 0xE44BB135u, 0x1E142ED4u, 0xEC74987Fu, 0x139725F8u, 0x06E01A17u, 0x4EE7A9E8u}}},
+    {{{0x46987FACu, 0x98BE8A0Cu, 0x40A86F67u, 0x8BC90F86u, 0x3EC98A3Cu, 0x44E98260u, 0x13AE7F13u, 0x01F7C69Fu}}, {{0x19174C68u, 0x3F91E738u, 0x19F6BC26u, 0xCB7F5DE2u, 0x329AB6F9u, 0xE5B1036Eu, 0x36FDA22Du, 0x9D4ECC3Fu}}},
+    {{{0xEE2E607Bu, 0x1F4D359Cu, 0x6C0F36AAu, 0x88AA1EECu, 0x657FDD2Bu, 0x20D111F5u, 0xFD31772Cu, 0x07733F67u}}, {{0xCC614763u, 0x6A2F311Du, 0x5BE017D2u, 0x89E3BDE0u, 0x5BB156F4u, 0xEAE63A8Cu, 0xAC178285u, 0xFD9FE8FBu}}},
+    {{{0x76DABA4Du, 0x1D33A1BDu, 0x20319626u, 0x9C65FB0Eu, 0xD8FA2BCBu, 0xCB7062EDu, 0x761FD381u, 0x557E9401u}}, {{0xB7A52316u, 0x51374A1Bu, 0xFA43590Au, 0xC5E9B8F5u, 0x15CCBC86u, 0x46D35CFAu, 0x601FA7E0u, 0x7A7E8F3Au}}},
+    {{{0x3C05FBDDu, 0x6E22D9CDu, 0x74E48139u, 0x79589D52u, 0xB6AFA032u, 0x38920654u, 0x00310C48u, 0xE3E4750Au}}, {{0x1535B883u, 0xCBA2231Du, 0xC5CFAFFBu, 0xB46587BFu, 0x961A1204u, 0x05235049u, 0xABAD2590u, 0x0FA79701u}}},
+    {{{0x29F5341Au, 0x038F52FFu, 0x669636B8u, 0x9CC7A32Cu, 0xA7B10141u, 0x3B29D40Eu, 0x199885A9u, 0x3ADADA82u}}, {{0x6586C6CCu, 0xB5158093u, 0xB45E8FBCu, 0xE9D6D2E5u, 0x36AB1017u, 0x552E35BFu, 0x8999369Fu, 0xBFEA1E22u}}},
+  },
+  { /* 16^38 */
+    {{{0xC28D3D5Du, 0x4095980Fu, 0x73449CEAu, 0x9612AEB9u, 0x907A30B0u, 0x52DC0270u, 0xF65C8042u, 0x324AED7Du}}, {{0x96AB7C84u, 0x967224AFu, 0x7E332843u, 0x19213B0Cu, 0x5AEC1F4Fu, 0xF130C0C3u, 0x74B61F2Fu, 0x648A3657u}}},
+    {{{0xB2919749u, 0xA8F38381u, 0x8DE0DB1Fu, 0xF72B3E4Au, 0x880D7203u, 0x28D32681u, 0xA26F4902u, 0x32C9331Eu}}, {{0xF290B5E3u, 0x631E97B0u, 0xAE39AB09u, 0x268A4ABDu, 0xB6F3DBB8u, 0x695A2F02u, 0x34209CB5u, 0xD7CD272Bu}}},
+    {{{0x2FD53ED3u, 0xF5C91758u, 0x9DA56CCEu, 0x163F74FBu, 0x31DF7C49u, 0x5B8F60B9u, 0x996772ADu, 0x20840BD5u}}, {{0x1A7A7132u, 0x87143FE5u, 0x94E70899u, 0x5487C473u, 0xA6BAFAC2u, 0x487BD476u, 0xCEC18243u, 0xF2993497u}}},
+    {{{0x7B9795E4u, 0x1E1C2252u, 0xE1846B8Eu, 0x69C161B6u, 0x0FEC6B1Cu, 0x4A02F6A7u, 0x3B983785u, 0xEB292F3Bu}}, {{0xAE53A0FEu, 0x5B7E9D2Fu, 0x09111C6Fu, 0x57131D75u, 0xF145835Bu, 0x1696634Au, 0x96EEBE80u, 0x8C43C25Au}}},
+    {{{0x88A35B35u, 0xDBD2CBB5u, 0x5C0A121Eu, 0x1AB5D88Au, 0xE588EBFDu, 0xBD13D029u, 0x0EB339BBu, 0xE6B6BFF6u}}, {{0x9C1007BDu, 0xC57293DBu, 0x3BE999C7u, 0xFE3B6C9Du, 0x835961DDu, 0x266F43E3u, 0x3300D2F3u, 0x1A5FF2BDu}}},
+    {{{0x2032F9A2u, 0xC48B8E29u, 0xFA1FC6CCu, 0xCE566F50u, 0x31FF8F63u, 0xED2374CBu, 0x9A6B2640u, 0x25AAC6BDu}}, {{0x2B51D4F0u, 0xE76230A1u, 0xC419F3D9u, 0x559883BBu, 0xF4F190F6u, 0x16F32F54u, 0xA644546Cu, 0xF5A6C63Bu}}},
+    {{{0xC0360DD3u, 0x0D4EF8D2u, 0xD850E209u, 0x47A8A836u, 0x6E0CE3BBu, 0x88B0B808u, 0x5BE499B2u, 0xE0531774u}}, {{0x3C24F87Bu, 0xB2AECD91u, 0x98103DC2u, 0x61B987DEu, 0xB5B6A014u, 0xCD809582u, 0xA5D92F39u, 0xDC1C3B71u}}},
+    {{{0x89303FDDu, 0xAEA39D57u, 0x19D1ED35u, 0x4D71457Fu, 0x0049FBE1u, 0xE620D431u, 0xDF3B5EF2u, 0xA65A3A01u}}, {{0x02E68703u, 0xDAD44A8Du, 0x4FAED3CAu, 0x86861D02u, 0x90ED2C76u, 0xB8F43D8Du, 0x0CFF5C6Fu, 0x798EA094u}}},
+    {{{0xD098DFEAu, 0x7C146662u, 0x2EA67879u, 0xFADCB3C9u, 0xA83A5E57u, 0xE018E5D2u, 0x77886C59u, 0xA8153B3Au}}, {{0x6E6D892Fu, 0x8A49A9DFu, 0x42DAF415u, 0xB1B5E0F7u, 0x57853E03u, 0x53D8DB9Cu, 0x61D060FCu, 0x2A473964u}}},
+    {{{0xD24C9489u, 0x61630D52u, 0xE14E4A98u, 0xC0AEF4E6u, 0xF6E9D528u, 0x9A27887Fu, 0xD9D567C2u, 0x6281BB15u}}, {{0x9DF42BC6u, 0x9187F26Bu, 0xD321B3ADu, 0x45FD964Du, 0x56E9BBF5u, 0x922738F4u, 0x908DA865u, 0x2FD3C5A0u}}},
+    {{{0x8BCECFA5u, 0x0A7E77A4u, 0x1B16BB02u, 0x2A0D62DAu, 0x638EDA3Bu, 0xDEB4695Cu, 0x0FECADDAu, 0x4F05C3B3u}}, {{0x95D37B53u, 0x2ECD024Au, 0xF01B48CDu, 0x447EE431u, 0x159534B9u, 0xADD63236u, 0x603D426Fu, 0x53A499EAu}}},
+    {{{0x94445A7Au, 0x90131CBAu, 0x81CF1EC5u, 0xDF9535F0u, 0xC601C8D5u, 0xB12F11B6u, 0x9F06C6BFu, 0xF82FEFBCu}}, {{0x642A7A98u, 0x963ACE18u, 0x4640D1E5u, 0xB51C83B6u, 0x1940B4A4u, 0x5503942Cu, 0xC6FB6B67u, 0x94BB37BDu}}},
+    {{{0x084B96AAu, 0x461E7659u, 0x522ABCCEu, 0xD0298635u, 0xAA3B980Eu, 0xE26405E1u, 0x9F67A91Bu, 0xD9309AB9u}}, {{0xC2B28A86u, 0xF26C4F37u, 0xAFCFE978u, 0xD3B6C9FBu, 0x6274CB5Fu, 0xD7E10F06u, 0x9B4EC557u, 0x6EF99B2Au}}},
+    {{{0x16B7D2D5u, 0xF6FDD42Bu, 0x1D56EA66u, 0x2637B84Du, 0x22EF502Eu, 0xC830F3D3u, 0x97834203u, 0xA285ABAAu}}, {{0x9001F99Cu, 0xC405D52Fu, 0xB6B753E9u, 0xD8657321u, 0xE10B2E2Au, 0x92B952DFu, 0xCD1B7AC6u, 0xE56E9692u}}},
+    {{{0x9F8FCF0Eu, 0xCF7B8D05u, 0xE7C4A6FAu, 0xD65B6FFDu, 0xDEAA3411u, 0xBA9C3446u, 0x38562D35u, 0x7D587CA1u}}, {{0xD8BC9459u, 0x501C1A09u, 0xD323780Au, 0xC463900Au, 0x6CFD6AD0u, 0x2723400Bu, 0x88304C61u, 0xA7295C03u}}},
+  },
+  { /* 16^39 */
+    {{{0xFD054C96u, 0x8E8BD373u, 0xA8D1CA88u, 0xEEC4143Bu, 0xE5FEE5DCu, 0x6D51DFDBu, 0x19CDE61Fu, 0x4DF9C149u}}, {{0xCAD10D5Du, 0x92EBAC06u, 0xC2884901u, 0xB5D506CDu, 0x3A1D85D4u, 0x050974C2u, 0x092D8728u, 0x0035EC51u}}},
+    {{{0x1DA49E04u, 0xC0C6B0FCu, 0xE57A8D70u, 0xE9DE4554u, 0xE4B87088u, 0xD25317D4u, 0xD2CC998Cu, 0xED32CAD8u}}, {{0x7C1DB9E0u, 0xB63120D1u, 0xB49FAB7Du, 0x52DA9FACu, 0x5859D20Bu, 0xA541CA37u, 0x1D030204u, 0x129FEF5Fu}}},
+    {{{0x5DEF001Du, 0xF4F225DAu, 0x989BA27Eu, 0x21F9BBD6u, 0x09E3B64Bu, 0x20E0BD1Cu, 0xB27E2CAFu, 0xA549A32Du}}, {{0xF0624783u, 0xDD5DB1A7u, 0x62C9705Au, 0xEB141E2Au, 0xD8A59456u, 0xDF4CC30Eu, 0x06D966CBu, 0x799B7A79u}}},
+    {{{0xE883F855u, 0xCB7418D4u, 0x63C34016u, 0x28C36DCBu, 0x1C70366Eu, 0x8049E411u, 0x4D6360F1u, 0xE821AB72u}}, {{0x59852DDFu, 0xED4E0C6Au, 0x14EC23EFu, 0x8B3B19C6u, 0x5416CF59u, 0x67D0D411u, 0x63F53CE3u, 0xADEFCBF8u}}},
+    {{{0xC52ED4CBu, 0x05AEF1E5u, 0x3C09EC5Au, 0xC954DEFBu, 0x83532E6Eu, 0x23F08BD9u, 0xDA07ECD1u, 0x7E798F30u}}, {{0x94BB9462u, 0x25716607u, 0xFF9F37A1u, 0xB173571Bu, 0xDEF2F057u, 0x041A9549u, 0xA24DAC83u, 0xD23DCCC4u}}},
+    {{{0x4206E37Au, 0xA24778ACu, 0x8C504731u, 0x4D8C1894u, 0x6B5A274Fu, 0xCF4E83F4u, 0xF2868002u, 0xB526AB87u}}, {{0xF0C5CCABu, 0xBF3678FFu, 0x00FA392Au, 0x28CE539Bu, 0x60A6F18Du, 0xD5CAACEDu, 0x78100D8Eu, 0x641F35D7u}}},
+    {{{0xD3630834u, 0xFDF3A0FBu, 0x63DAC067u, 0x8463F128u, 0xBA8C8108u, 0xAD5B9E96u, 0x31514783u, 0x224FA200u}}, {{0xC47A2272u, 0xCD3C4737u, 0xC0A50F75u, 0x3D62924Eu, 0x391D09F5u, 0x3C4B70FAu, 0xBB3EDA5Cu, 0xBBE54E32u}}},
+    {{{0xB441742Eu, 0xFBFF59EEu, 0xAF3806E9u, 0x2F14A547u, 0xBC9693A7u, 0xF455452Fu, 0xE51AD212u, 0x3F0D8994u}}, {{0xCFECADBEu, 0x8C65363Bu, 0x3AD13D95u, 0x1E205E2Cu, 0x847A6E0Bu, 0x45E5CB0Eu, 0xF28C3DC4u, 0xFBD76C23u}}},
+    {{{0x583C19D7u, 0xB67649D1u, 0xAC2CF57Bu, 0xBBBB5E45u, 0xE4228EF2u, 0x129A25CCu, 0x600A39E4u, 0xC2D4A0CCu}}, {{0xC507928Du, 0x72F28B82u, 0x17345C97u, 0x26804A83u, 0x7F41260Du, 0xD4183B5Fu, 0xC0806294u, 0x65ADA0F9u}}},
+    {{{0x5D848116u, 0xA04541E5u, 0xFC9E27BBu, 0x1CC9B100u, 0x0E948454u, 0x05072CE1u, 0xBB39D3BEu, 0x1693799Au}}, {{0x027198B3u, 0x83DF66C2u, 0xC4D992E4u, 0xC03193E5u, 0x16C60DEEu, 0x4E6AF60Fu, 0x9CB2D8C5u, 0xC49C433Bu}}},
+    {{{0xBC940C9Au, 0x84C80AD4u, 0x3AF42330u, 0x13CF3CE1u, 0x744DDC21u, 0x0E5585E2u, 0xC305F319u, 0x2EC22A7Eu}}, {{0x851E7A4Du, 0xCD194FD9u, 0xD9A35BDAu, 0x12405183u, 0x029C7FEBu, 0x4C2E24F5u, 0xDE337968u, 0x8B1DA468u}}},
+    {{{0xB9D9123Fu, 0x7E93831Eu, 0x1F88BA7Du, 0x29FC791Bu, 0xAFBD1E91u, 0x2F95F8ECu, 0x72AA6A6Fu, 0x341B538Fu}}, {{0x18BB9A40u, 0x19EA0AAFu, 0x052A26EDu, 0x72DEE6A7u, 0x1124D9ACu, 0xBA6F2F04u, 0x19C1C59Eu, 0x58581247u}}},
+    {{{0xDD683EEBu, 0xAA70EE5Fu, 0xA08D3133u, 0x3E36EB38u, 0x5084B8F3u, 0xAB1AF652u, 0x8F9A8CECu, 0xAFC66973u}}, {{0x30CD4509u, 0x91E29CABu, 0x25EDDFDCu, 0x570BAB55u, 0xCA239C16u, 0xBC359C7Fu, 0x6DD22752u, 0x002C2197u}}},
+    {{{0xC7AAD77Fu, 0xA7D07B1Cu, 0x0F5A7B7Fu, 0x6D4EBBDFu, 0xA7699670u, 0x3284AFC3u, 0xC68EB8DEu, 0x4F0EAB3Eu}}, {{0xCCE6EEA8u, 0xE6C3F11Du, 0x025AC92Cu, 0xADAA078Du, 0x62AC2F28u, 0x5A08DE30u, 0x76EBB757u, 0xB28EA271u}}},
+    {{{0xB76F4293u, 0xEA201F87u, 0x653C5139u, 0x10E978B5u, 0x370B282Eu, 0x121BC8CFu, 0x9F343309u, 0xD2557B5Au}}, {{0x5282740Au, 0x1DB187A2u, 0xDE405A5Fu, 0xE34B6838u, 0xEB4AD21Fu, 0x12682F06u, 0x55E427F0u, 0xA787B343u}}},
+  },
+  { /* 16^40 */
+    {{{0xAC1F98CDu, 0xCBFC99C8u, 0x4D7F0308u, 0x52348905u, 0x1CC66021u, 0xFAED8A9Cu, 0x4A474870u, 0x9C3919A8u}}, {{0xD4FC599Du, 0xBE7E5E03u, 0x6C64C8E6u, 0x905326F7u, 0xF260E641u, 0x584F044Bu, 0x4A4DDD57u, 0xDDB84F0Fu}}},
+    {{{0x694A09ECu, 0x435EFB7Bu, 0x3E8535F0u, 0x0CD326A5u, 0xD5C92AA4u, 0x0A42FC69u, 0x6255D80Fu, 0x2E3C0532u}}, {{0x88C7327Eu, 0x25348681u, 0x707B6651u, 0xE048A53Cu, 0xB82FC1ABu, 0xBDDAE240u, 0x656C6FB5u, 0x001FF891u}}},
+    {{{0x8FB64DB3u, 0x17B98D53u, 0x39DD5384u, 0xA7EDE4CAu, 0xBE53B8D6u, 0x40BBB83Fu, 0x29BDCCB7u, 0xC1142392u}}, {{0xFC0259BEu, 0xE230CE9Fu, 0x4D4567D1u, 0xA8758090u, 0xFE978BD1u, 0xA5CECDE4u, 0x5B486FC2u, 0x1237F6DCu}}},
+    {{{0xAB9C7CE6u, 0x205F19A2u, 0xA1908934u, 0x33710316u, 0x3E24DDA4u, 0xAE15FB7Eu, 0xCFA41587u, 0xE8E2A24Cu}}, {{0x8836267Cu, 0xB2C01EB6u, 0xB5C27A73u, 0x6E09E603u, 0x3BEE2059u, 0x4CAF2B2Bu, 0x0C6F5D1Bu, 0x46C983CEu}}},
+    {{{0x03081E46u, 0x1EDED834u, 0x554559EAu, 0x3A52218Cu, 0x19263471u, 0x082D9C2Cu, 0x31A77224u, 0x6C5B4BF8u}}, {{0x0BFBCD70u, 0xED1F9CB8u, 0x6AC22A62u, 0x41D0CF82u, 0xCE2BE478u, 0xB2347863u, 0x4926D42Fu, 0xCB051371u}}},
+    {{{0xF11349E2u, 0x80832ADDu, 0x17524C05u, 0x60E3ECF4u, 0xA41AD78Du, 0xE62147E9u, 0xC6B9C2E7u, 0xF8058324u}}, {{0x5B2025FCu, 0x5FAC469Eu, 0x626DE88Du, 0x509498B5u, 0x0EA11223u, 0xCDE81AA6u, 0x0A8856CDu, 0x95C60E5Au}}},
+    {{{0x464DCD4Bu, 0xDCAE5AECu, 0x9911C124u, 0x0C30C7D5u, 0xCAB10A45u, 0xB5670665u, 0x670CADE4u, 0xE1E9A856u}}, {{0xBB041F2Cu, 0x2D0B625Eu, 0xACA16B29u, 0x7F44D19Au, 0x9B257792u, 0xB7AC4359u, 0x4455C531u, 0x562B0A95u}}},
+    {{{0x8AC7B3C2u, 0x5B0D3966u, 0x383D5B5Fu, 0x12ACAF92u, 0x170032A2u, 0xB2F0A38Bu, 0x5D8573C2u, 0xA7549AACu}}, {{0x9287EAEFu, 0xFA0C9171u, 0x537116DFu, 0x5D6B5115u, 0xC1947D2Bu, 0x335A1D70u, 0x0D1C2415u, 0xBD17D1B9u}}},
+    {{{0x2BADD73Cu, 0x005876FEu, 0x02A64B7Du, 0x8FD9CDD9u, 0x2EDC1420u, 0x778A74E4u, 0xAD11B099u, 0x51B21A57u}}, {{0xEB36D8D1u, 0x6F7D4AE1u, 0x28C734BAu, 0x6C20130Fu, 0x1D2C1CFAu, 0xD54A07F0u, 0x001FD3E5u, 0x00793010u}}},
+    {{{0xBD7E2C95u, 0xAB7DC996u, 0x4B878D82u, 0x6F3F2BA1u, 0x8AC54157u, 0xEDD9A12Au, 0xB24AD1A5u, 0xCA07CBFBu}}, {{0x8D50DFA2u, 0x05E99BACu, 0x3B7E0CBFu, 0x3AC306F3u, 0xBC1066C9u, 0x4A8A2267u, 0x32DF0EDFu, 0xAEDC3110u}}},
+    {{{0x3B09F34Bu, 0x6D75D0B7u, 0x08CC66CEu, 0xE58873E6u, 0xF3F39D61u, 0x61AB6296u, 0x3B1CB798u, 0x9701F3A6u}}, {{0xC0DF5793u, 0xACDC850Cu, 0x7FDCC794u, 0x7104BC39u, 0x31568337u, 0x5D7031B5u, 0x8CAF0ED1u, 0x3DD44BBBu}}},
+    {{{0xAE548418u, 0x17371D11u, 0x88983923u, 0xDCE4887Du, 0x537A341Au, 0x2FB072B0u, 0xE4817E29u, 0x2E6DB0C9u}}, {{0x10A2B918u, 0xE69792C0u, 0xE1C3F5F1u, 0x4B8E1D73u, 0x78A91164u, 0xA2131489u, 0x1D776FBFu, 0x74EB6A41u}}},
+    {{{0xBF1E2F46u, 0x15CE6223u, 0x87277830u, 0x5270F71Eu, 0x40D63C57u, 0x445592E0u, 0x2C9E66CCu, 0xA036B41Du}}, {{0x5EFFB349u, 0xF731E269u, 0xCFF0B1F4u, 0x0680E282u, 0x479EB08Du, 0x7DF1F6AAu, 0x03E96B3Du, 0xC3BF91A0u}}},
+    {{{0x03DB2A09u, 0x09605516u, 0xDC201BBFu, 0xF6314287u, 0x0A766DA1u, 0x2BD63880u, 0xD9C30C35u, 0xB09DCC04u}}, {{0x80B1A093u, 0xAED7DB3Au, 0xC16AD4E7u, 0x6A951BD4u, 0x5AEAD00Eu, 0xF708D163u, 0x81CF240Du, 0x8A7F3064u}}},
+    {{{0x8C4CEA08u, 0xBCD8B903u, 0x0E0EA21Du, 0x654B58BAu, 0x34004652u, 0x6F4A6115u, 0xAA4E8C50u, 0x6A85FADBu}}, {{0x9862F4F3u, 0xA19DECE5u, 0x43D721B6u, 0xB4271A4Bu, 0x48FE6230u, 0x531933C1u, 0xBAE4659Du, 0x00B64604u}}},
+  },
+  { /* 16^41 */
+    {{{0x20A959E5u, 0x5A213821u, 0x8B91D4CCu, 0x91E1493Au, 0x1D8E06BBu, 0x8DE05F28u, 0x1DD12FDFu, 0x6057170Bu}}, {{0x2385A2A8u, 0xE899BE93u, 0x3EE24C65u, 0x465152BCu, 0xF71DF262u, 0xADD9A2DAu, 0x6A6A4807u, 0x9A1AF0B2u}}},
+    {{{0x82FD545Cu, 0x1899CA5Du, 0xD4A28E66u, 0x7C133F8Du, 0x46DC85DFu, 0x0394110Au, 0x7C52E064u, 0x6773FD67u}}, {{0x947EB1AEu, 0xE8C7F034u, 0xA1C6CF98u, 0xEAD780F5u, 0xDD2B246Bu, 0x0F0F25C9u, 0xCD97652Fu, 0x444EB6D8u}}},
+    {{{0x971C032Bu, 0x0D4DA162u, 0x17AFDC98u, 0xFF6B668Au, 0xDFC766C5u, 0x3DD11B5Fu, 0xD6E00260u, 0x71EBA8FCu}}, {{0x1668359Fu, 0xE7AB5A8Eu, 0x774B4755u, 0x71931AD1u, 0xF54CBB7Fu, 0xEF660516u, 0x4B61D39Du, 0xD2FF1262u}}},
+    {{{0x0B86F021u, 0x373C616Bu, 0x10468050u, 0x0374E438u, 0xCE0C87C2u, 0x237C79AAu, 0xD17CE565u, 0xE0F86D94u}}, {{0xB5BF325Au, 0x3B6B79CCu, 0x115FC45Bu, 0x9A80BCC0u, 0xF1C89A2Cu, 0x7A91E832u, 0x730ABCF4u, 0x0C571C73u}}},
+    {{{0x2A03A61Cu, 0xD06E4745u, 0x69070574u, 0x507868F4u, 0xBAAA9DD0u, 0x2CA17442u, 0xB3249D23u, 0x855EC305u}}, {{0xC65DFC07u, 0x5DFC6EAAu, 0xA17E4496u, 0xD332F74Eu, 0x9B42FB4Eu, 0xF543CBFFu, 0xC5F01C17u, 0x0DD85D2Eu}}},
+    {{{0x3AAA138Bu, 0x6DF0D9F7u, 0xEF786CD6u, 0x63EFBA0Bu, 0x8C4671FFu, 0x7943EBC1u, 0xD3C3AE28u, 0x417FE249u}}, {{0x4A1AE869u, 0xD1C91B33u, 0xC05566AFu, 0xC19DAFDEu, 0xF0FA9E57u, 0xC20A5D29u, 0xBCD23E38u, 0x023589D7u}}},
+    {{{0x1F32D706u, 0xB00C0A48u, 0x746A0678u, 0x0618CCA4u, 0x3095BFA2u, 0xF150D29Au, 0xBAB3FBF1u, 0x3CE4486Au}}, {{0xFC7FD9E4u, 0x40B73637u, 0xCD61E89Fu, 0xEDD15643u, 0xB1094906u, 0x88EFD046u, 0xAAE37852u, 0xE775408Du}}},
+    {{{0x02DA6E03u, 0x8AD0772Cu, 0x08CAD603u, 0x4C277DF9u, 0x3D696F4Fu, 0xCE991E19u, 0x9F245041u, 0x42CA15ABu}}, {{0x8C347793u, 0x836889FAu, 0x8106BEA7u, 0xD66E85A6u, 0xFCB800EEu, 0x647CE4D1u, 0xC81C57C9u, 0x68D2EF26u}}},
+    {{{0x791CD3FBu, 0x6DB40CBBu, 0x9729BE68u, 0x4A2A33FDu, 0x8F8844EBu, 0xF02E0321u, 0x3F4E37FAu, 0x11CCC514u}}, {{0x55160D86u, 0xA93716BAu, 0x2CDD3472u, 0xFA0B1EFDu, 0x938CC239u, 0xB528E244u, 0x902B11DEu, 0x4AA56B2Au}}},
+    {{{0x29583A3Eu, 0x108BAF04u, 0x8B156808u, 0xB1520599u, 0xED94871Cu, 0x57275DBBu, 0x16D0F7E5u, 0x5889573Fu}}, {{0x7E5B124Fu, 0x8F1598CBu, 0xD4CC69CFu, 0x96FE294Cu, 0xA9A6B4E4u, 0x044F5DF8u, 0xC55856FEu, 0x1AFA2862u}}},
+    {{{0x618F7552u, 0x387B9119u, 0x98054FACu, 0xBD41138Bu, 0xF82382DDu, 0x43B97774u, 0xE5149C6Fu, 0x0250BB17u}}, {{0x3510B14Du, 0x3F084962u, 0x333D6F1Eu, 0xDA006F3Cu, 0x5FE9D817u, 0x342D7DF7u, 0x9BBE8082u, 0x731930FCu}}},
+    {{{0x0307E636u, 0x7E158B41u, 0x321611D9u, 0xB4A77DE7u, 0xDA2112C8u, 0x3DDBC29Bu, 0x16387644u, 0x2219F160u}}, {{0x71F15109u, 0xE07A1B2Du, 0x3F73AF55u, 0x6DD7230Du, 0x1B8230BDu, 0x1B806D4Fu, 0x5CB6A2F6u, 0x04A984ACu}}},
+    {{{0x9F725D12u, 0x05D13E93u, 0xDCB5F475u, 0xD94642BBu, 0x0A022FBFu, 0xAB4A39CEu, 0xB3467FD3u, 0x1A749C88u}}, {{0x23AC56E4u, 0x0136514Du, 0x8990DAA7u, 0x60720869u, 0xC2AF3D8Fu, 0xF458BE75u, 0x73EC0E2Cu, 0x7E91D195u}}},
+    {{{0xB6C704C0u, 0x5D22D670u, 0xECDE394Fu, 0x56044660u, 0xE3507824u, 0xA167F8A6u, 0xC92F2674u, 0xA77AA907u}}, {{0x7EDFEA48u, 0xAF8BC704u, 0x74159462u, 0x4C921FC4u, 0x5C2BD5A9u, 0xF21E188Eu, 0xBF35CFE4u, 0xB8881AE5u}}},
+    {{{0x29FAE458u, 0xD61048E5u, 0x766EC97Fu, 0x8B0A5C42u, 0x5DFB7B32u, 0x109D156Au, 0xE0F8218Cu, 0xC750685Bu}}, {{0x5757B598u, 0xB0168419u, 0x335951A2u, 0x0A5DCA50u, 0xC672C7B4u, 0xFB52F414u, 0xCF921E05u, 0xEAD795F8u}}},
+  },
+  { /* 16^42 */
+    {{{0xECB94266u, 0xB1A6973Eu, 0xA7D4DF12u, 0x80CEF0FBu, 0x518DA318u, 0x421439A4u, 0x23A08411u, 0xA576DF8Eu}}, {{0xE1B28EC8u, 0xEE8BE11Au, 0xF514D9F3u, 0x432E10A7u, 0xE58CD82Cu, 0xC92B97AFu, 0xE76640B2u, 0x40A6BF20u}}},
+    {{{0xDA704896u, 0xCEC5725Bu, 0xC9ACFB8Du, 0x6F3BA063u, 0x7BE71BAEu, 0x54652086u, 0xEF3B5A3Bu, 0x9E5DCC62u}}, {{0xCA82C835u, 0x48F2769Du, 0x6030F512u, 0x79605D18u, 0x54C76122u, 0xA5FD3A21u, 0xDB925F3Eu, 0x6FEDD12Du}}},
+    {{{0xCD9ED6C1u, 0xB68AEB58u, 0xC3D593D6u, 0xC24E745Bu, 0x705EDD0Eu, 0x80BFC187u, 0xCB74F53Eu, 0x0328336Du}}, {{0xF8FAFEEEu, 0xDEC6EBE6u, 0x25CB494Au, 0x265BF4DFu, 0xA20D7C8Cu, 0xC46D5943u, 0x12FD9F28u, 0x71A89838u}}},
+    {{{0x44BF7EA0u, 0x953ED587u, 0x5CEF5833u, 0xE33625A0u, 0x76F03B20u, 0xF8D6E9F9u, 0x5B8745ADu, 0xA7DE0837u}}, {{0x9BBCABAAu, 0xE04C0553u, 0xFEBC5AA2u, 0x645A47C0u, 0x34888E9Au, 0x2104A0B3u, 0x57ADA5E5u, 0xA63D96B0u}}},
+    {{{0x3235983Au, 0x919A9A8Du, 0x013BCEB2u, 0xE38A1037u, 0x70FE1531u, 0xDC63926Du, 0x8B911C54u, 0xCE4F4EAEu}}, {{0x0D3CDECFu, 0xECFD6B19u, 0x8EBF740Au, 0x526C6522u, 0x9E707543u, 0x3EADE024u, 0xC390FBBBu, 0xF3C9F973u}}},
+    {{{0x66DA57E4u, 0x6B75648Au, 0xFDCDD9F8u, 0x98C4996Eu, 0x4631BC1Eu, 0xDBDEA2A7u, 0x983918B9u, 0x690CDAE3u}}, {{0x933F33BBu, 0x2B6195B4u, 0xCE95A3D4u, 0xF863D8FBu, 0xF595894Du, 0x7A9FD91Bu, 0x677B79A4u, 0x840ADC79u}}},
+    {{{0x55B0E6C9u, 0xA6DAAB66u, 0x786E4C89u, 0xDB5FF9CFu, 0x6DF8BCBDu, 0x78E28FB3u, 0x4B986222u, 0x4DBEBFA5u}}, {{0x5EB2CC25u, 0xE94A7855u, 0xBC504EFAu, 0x589311B2u, 0x6E2229F3u, 0xF45A626Eu, 0x3C913AEDu, 0x10FEE7B0u}}},
+    {{{0x4AD916FBu, 0xA9F8FA10u, 0xE949E4A3u, 0xE68065FDu, 0x01CFF4CBu, 0xC13C35ACu, 0x689080C9u, 0xC266658Eu}}, {{0xA0887814u, 0x56AEF52Bu, 0xEB611388u, 0x6B8FECDFu, 0xB24627ABu, 0x0F798170u, 0x54E7DAABu, 0xE7E85938u}}},
+    {{{0xA5857295u, 0x64E01A11u, 0x03433F01u, 0x69C8E47Fu, 0xCA1CA120u, 0x8B2E118Fu, 0xFEF45C21u, 0xA42A240Bu}}, {{0xCA7EB9C1u, 0x56B377FEu, 0xD1519395u, 0x27A1C22Cu, 0x24DDA4C4u, 0x67A6B22Bu, 0x61005D45u, 0x3AA0B3F2u}}},
+    {{{0x005C5B40u, 0x269BCFD6u, 0x9BB9FD1Eu, 0x150B9687u, 0xE8CCC3DFu, 0xDADED382u, 0xBF53CD14u, 0xA4B53CC8u}}, {{0xD1C61BFDu, 0xD1F5ED16u, 0xF75259E3u, 0x199CCA9Bu, 0x3DFDA587u, 0x4495CA00u, 0x83005B80u, 0xCEEF08CEu}}},
+    {{{0x6FCDC098u, 0x2220FF55u, 0x6AE46803u, 0x550AE00Fu, 0xC0C499C1u, 0x7A7F1F86u, 0x96FB2226u, 0x34E12B2Fu}}, {{0x6A7474E2u, 0x64CB1ADEu, 0xF19883F6u, 0x04DF5130u, 0x417972DBu, 0xD974CBC8u, 0xD7B5D322u, 0xA64AC2DDu}}},
+    {{{0x5CFB8036u, 0x5F9898AAu, 0xC0DA3508u, 0x3AD09A92u, 0x1FD67E83u, 0x8AE117DDu, 0xFB1647B4u, 0xCFF62751u}}, {{0x24F59DE0u, 0x843F3B5Au, 0xF6032825u, 0x78A589D8u, 0x886143C6u, 0xC5FE34B5u, 0xBD542D1Au, 0xCDF4ED26u}}},
+    {{{0x8F173B92u, 0x1CD6EB5Eu, 0x169FB761u, 0x3B7E72F4u, 0x8F4D6568u, 0x9BE31A21u, 0xD9BB91F2u, 0x10F4D240u}}, {{0x633146C2u, 0xC902006Du, 0x1486ADB7u, 0x90BB769Du, 0xA33908BAu, 0x211B25A5u, 0x091753ADu, 0x850E2D95u}}},
+    {{{0xD04393D7u, 0xEE6660EDu, 0x67749DE1u, 0x869DFF25u, 0x623573E3u, 0x4317F893u, 0x8A78F3B8u, 0xDEA1FC01u}}, {{0x95710CCDu, 0xBF97D4EFu, 0x2B79CCBDu, 0xAF6DEF9Au, 0xF6D66E03u, 0xD3BF134Fu, 0x942E5C50u, 0x4F6549CCu}}},
+    {{{0xA8D84958u, 0xEE6FD1D9u, 0x6CACC5CAu, 0x6A11DEB1u, 0x6D40CC86u, 0x49F19B97u, 0x69B677E7u, 0xE846E80Bu}}, {{0x7882CF9Fu, 0x40C4647Bu, 0x71E0C1A6u, 0xAD51A336u, 0x4798B76Fu, 0x41DBD910u, 0x894C7E25u, 0xA29CB8FCu}}},
+  },
+  { /* 16^43 */
+    {{{0xBE58AD71u, 0x8F763889u, 0xCF9A3A20u, 0xBB30D1F5u, 0x29DE8C38u, 0x0A05FE96u, 0x28DEC3E3u, 0x7778A78Cu}}, {{0xFD9F43ACu, 0x3B513FC1u, 0xFF24AC56u, 0x87B38411u, 0xF2FF5800u, 0xF7098E12u, 0xB5A5B22Fu, 0x34626D9Au}}},
+    {{{0x1073E879u, 0xA7EA1C25u, 0xE104EEA7u, 0x2CF16A5Au, 0x7F0FE393u, 0x632F482Du, 0x5CA006D1u, 0xE7B9796Bu}}, {{0xBAA89D98u, 0x38E71089u, 0xEDA98AF3u, 0x9CB5BF25u, 0x737CC1CAu, 0xDF42102Au, 0x19169E2Fu, 0x12B8988Cu}}},
+    {{{0x3319C869u, 0x2F7C6EAEu, 0x761EB270u, 0x18A9F95Du, 0x2FCCACDCu, 0xD0183902u, 0x98173FC8u, 0x3018045Du}}, {{0xD2B856F0u, 0xFC0C76C9u, 0x4A3D9A7Bu, 0xCA2A84CAu, 0x0D622E3Bu, 0xF8662432u, 0x2503B7B6u, 0xAC5FC578u}}},
+    {{{0xF2628F0Fu, 0x865D722Bu, 0xF2AEE919u, 0x65423DAAu, 0x4BE09A73u, 0xC2C915A2u, 0x50876203u, 0x071BF018u}}, {{0x45A1C334u, 0xB57C5CBDu, 0x231C80BBu, 0x098F9C6Au, 0x1C084CE2u, 0xE33600BCu, 0x504DCF4Au, 0x527AA15Du}}},
+    {{{0xA5ED29B5u, 0x4C66986Fu, 0x712ADD1Bu, 0xF5830B60u, 0x9A63C885u, 0x43AB67DBu, 0x1EE57EF3u, 0x322881B6u}}, {{0x7CD15AD2u, 0xEF4F126Eu, 0x94EE7604u, 0xCA83AEABu, 0xF41531E1u, 0xB110B19Du, 0x17A0344Eu, 0x16770284u}}},
+    {{{0x18953133u, 0x6477DC9Bu, 0x748721AEu, 0x7FB3B42Au, 0x0FCCDFA9u, 0x8812806Cu, 0xED0DDD23u, 0x0A0B2B4Fu}}, {{0x34AF0FC9u, 0x4BC24A37u, 0xB0ED4BA9u, 0x6FA384E8u, 0x86458C8Du, 0x03C1C6CAu, 0xFB5ABF2Fu, 0xCDA1182Cu}}},
+    {{{0x86C96100u, 0x3BFA8407u, 0xA6E9C8E6u, 0xA163011Au, 0x2DF3DBCCu, 0xFB43DD9Bu, 0xC0FB1B9Fu, 0x3F38473Au}}, {{0xF2624707u, 0xF1E2AC1Bu, 0x0B75F1BCu, 0x66571C7Cu, 0x2F079CE5u, 0x2534C446u, 0xF5D40395u, 0x70C69C55u}}},
+    {{{0xA39620E1u, 0x6F6376DFu, 0x50121378u, 0x5B1911C8u, 0x4C03C39Eu, 0x33A32E59u, 0xCB9BE568u, 0x0218343Au}}, {{0x506998B5u, 0x5E0199F6u, 0x2F43C9ECu, 0x443299A4u, 0x602FBFC0u, 0xAF3F24FDu, 0x970A50BEu, 0xBEA81D48u}}},
+    {{{0xFD22D2ACu, 0x234C6EC6u, 0x6DCAACE0u, 0x10DDFE12u, 0x9785DF2Fu, 0xCB43C0E0u, 0xFD27A76Du, 0x288113C5u}}, {{0x8F42A268u, 0x081EB55Fu, 0x1548C8FDu, 0xDDC3D44Au, 0x0C976137u, 0xF2077726u, 0x58FBC5C8u, 0xA1A7EB01u}}},
+    {{{0xFEE515DDu, 0x8C1A13AEu, 0x343AA422u, 0x9D045323u, 0xB4BDFE2Eu, 0x0EF5866Au, 0xE6EEC182u, 0xA2BF9AFEu}}, {{0x06C30212u, 0x5C3A96B0u, 0x9A8E9874u, 0x00F2E3AAu, 0xBC05EA28u, 0x3A0A5E2Au, 0xC55CAB7Bu, 0x5A11BC71u}}},
+    {{{0x245F8EA8u, 0xD4BA80DDu, 0x964D2900u, 0xD17248E3u, 0xD7119FE5u, 0x553F4D95u, 0xC8463A2Au, 0xF963A200u}}, {{0x59BC99EBu, 0x4BC55FB0u, 0x9D8B6082u, 0x8BB8F235u, 0x1FF42720u, 0xA3B72230u, 0x8C7F83C0u, 0x9C859426u}}},
+    {{{0xDF0A2A53u, 0x7EAF0EC0u, 0xF816611Eu, 0xD51DCAB3u, 0x43A9B892u, 0x3A839457u, 0x07C3997Cu, 0x6F86518Du}}, {{0x733BFEB2u, 0x1139A574u, 0xEAA05F35u, 0xBF54F772u, 0x5A709968u, 0x9B776EA9u, 0xFD4582F2u, 0xD50AF616u}}},
+    {{{0x2606A315u, 0x9E1A8831u, 0xF26963ADu, 0x40726072u, 0x590E097Eu, 0xF98D8B2Au, 0xFF70D9A7u, 0xA5D9224Cu}}, {{0x9E3B68D1u, 0xD3561335u, 0x7D11A7C9u, 0xED4D0D34u, 0xD7980DE9u, 0x343306ABu, 0x3B20DA5Bu, 0x87328B00u}}},
+    {{{0xD8D52891u, 0xAF19EAF4u, 0x83EB9F52u, 0x39A0F7D8u, 0x0B17FFA7u, 0x46644DE9u, 0xCBC58DE3u, 0x3BC24BC9u}}, {{0x4D05B79Cu, 0x386D1E28u, 0x0A4872D1u, 0x4DA84528u, 0x0BFB48F4u, 0x7FEBED84u, 0x8A783D8Au, 0xF08E30A4u}}},
+    {{{0x06231493u, 0x9CDB7B54u, 0x0CCC4D46u, 0x96411A83u, 0x00E5E6A4u, 0x4EB4E41Du, 0x1B73C360u, 0xF1FE982Eu}}, {{0x758848C1u, 0x196A99A6u, 0x6E5FF0D0u, 0xF173FB34u, 0x5F7D99D3u, 0x216D3C20u, 0xED9A4DDCu, 0x2E2019EAu}}},
+  },
+  { /* 16^44 */
+    {{{0x06D903ACu, 0xB09EDA9Cu, 0xE5AD7E5Cu, 0xD5F96274u, 0x0E7AFD2Eu, 0x63729FD3u, 0xE637A844u, 0x0928955Eu}}, {{0x5BCD091Fu, 0xC5180E93u, 0xA8A8D83Fu, 0xAC3D26EFu, 0x093A95EEu, 0x27B78A13u, 0x3D3F42A8u, 0xC2562100u}}},
+    {{{0x0F59DD9Eu, 0x231047A6u, 0x5B58F0E7u, 0x7CE5E9C5u, 0x4CB18AD6u, 0xDAD163B0u, 0x3771D350u, 0x4F89BDEEu}}, {{0x0156B049u, 0x1016AE32u, 0x6638DF5Cu, 0x1E488250u, 0x043BB247u, 0x5C4BAF4Cu, 0x227A1F69u, 0xCA7952D5u}}},
+    {{{0x7874B839u, 0x81112875u, 0x953D2B41u, 0xBE4115B3u, 0xB230B6AEu, 0x053DF0DFu, 0xC0E1E5A8u, 0x3E03B81Fu}}, {{0x7C0594BAu, 0xA0C1CE56u, 0xFDAB5B8Du, 0x7DE5C5F0u, 0x57198F66u, 0xC44F6607u, 0xDFF07F42u, 0xD13AE163u}}},
+    {{{0xFFF01197u, 0x529C314Cu, 0x79A245BFu, 0x94B668F0u, 0xA2C3C4C9u, 0x0C396BACu, 0xCAE3C5A8u, 0xCB9E8304u}}, {{0x3B989C1Du, 0xC334E076u, 0x015E0A24u, 0x41B2D18Cu, 0xFF088917u, 0x127258CDu, 0x1EB80E6Au, 0x62C7D280u}}},
+    {{{0x8357A513u, 0x3A3F78E6u, 0x45B3023Fu, 0xF151BD13u, 0xAA2922C5u, 0xD62FA283u, 0xA2F4492Cu, 0xE662C0B7u}}, {{0xA017D07Eu, 0x192A201Cu, 0x25538D89u, 0xD8035CD6u, 0xA121A419u, 0x05DAE208u, 0xE6124523u, 0xAB0B193Cu}}},
+    {{{0xB9A7D197u, 0x9BAE90D3u, 0x88EA5945u, 0x5E83A8C1u, 0xA22C234Bu, 0x4778FFE0u, 0x280DF639u, 0xC2C58A54u}}, {{0x89EEB5E9u, 0x4E41CCBFu, 0x45AD8248u, 0x0A47EC45u, 0x62ED39A6u, 0x573041ABu, 0x366E0927u, 0x72EA3288u}}},
+    {{{0xDF37D242u, 0x4995F7EFu, 0x079C14B0u, 0xC29FECA6u, 0xCBE3587Du, 0x843862C7u, 0xC94CF6CBu, 0x40BF80B1u}}, {{0xA6405088u, 0x3D1D8279u, 0x42BD3558u, 0x74321EBAu, 0x1B26FE12u, 0x4F53FE9Bu, 0xD856AAF0u, 0xB579DD35u}}},
+    {{{0x508D2CC2u, 0x15F9FFC2u, 0x7048C58Cu, 0x8E0BEED4u, 0x10730DC5u, 0x3C8CF2A4u, 0xF89C69BDu, 0xE2F349B0u}}, {{0xE0D4C04Fu, 0x7E347BD8u, 0xE09CBDB3u, 0x42344BE8u, 0x760215BAu, 0x81860AECu, 0x0F827237u, 0x1FEB2F28u}}},
+    {{{0x595A3558u, 0xBAF2B364u, 0xE234A7F2u, 0xAC071F85u, 0x38DB59F6u, 0x806F9781u, 0x601DCA70u, 0x3D14FE97u}}, {{0x6443DF4Cu, 0xC6ADB3ACu, 0x47C1D727u, 0x82E0A2E1u, 0xDBF56E14u, 0x8F29A931u, 0xE84681EFu, 0x16C6BDD6u}}},
+    {{{0x14EA4178u, 0x10FC7024u, 0xE4C77CD5u, 0x782E0354u, 0xA77494CBu, 0x680453C6u, 0xD1756368u, 0x0470A872u}}, {{0xB8098BD6u, 0x079449F1u, 0x6984DAEAu, 0x19B56870u, 0xFD39C0CBu, 0x676145E9u, 0xC1109ACDu, 0x0899A7A9u}}},
+    {{{0x82B1FC24u, 0xEDE9F5ADu, 0x7E3F7570u, 0x2528D81Cu, 0x2C924865u, 0x1CC1AC4Du, 0xE82E6525u, 0xDD6FA540u}}, {{0x0E9B74CAu, 0x4A431C46u, 0xED732230u, 0xEC10DE6Bu, 0xF1657E77u, 0xE366F1EBu, 0xB1D3186Fu, 0x67E62B7Eu}}},
+    {{{0x63369217u, 0xD74DE6D9u, 0x006611EAu, 0xCA1C3969u, 0x5404EACDu, 0xA21A278Fu, 0xCBA4D624u, 0x42DC50FFu}}, {{0x3E2DBC57u, 0x1C3097E2u, 0xA8E01E84u, 0xA7A139ECu, 0x160BA853u, 0x7ED78F5Fu, 0x66385B1Du, 0xA5BA9A1Fu}}},
+    {{{0x3DD08E02u, 0x81EA9159u, 0xFDADF028u, 0x108547B7u, 0xAA3D1E80u, 0x0F869499u, 0x2DE55D78u, 0x13FA2DA8u}}, {{0x3CB03410u, 0xDA5541DCu, 0x19A42B97u, 0xE644AFBBu, 0x6BB432C7u, 0x31335620u, 0x4555DA72u, 0x136338B0u}}},
+    {{{0x1646A9E9u, 0x23F1ACE9u, 0xD8AE7B04u, 0x5DCBB7A7u, 0x9CCA75DDu, 0x7D1F82BBu, 0x4B0AEF75u, 0x9582B79Cu}}, {{0xAA56A698u, 0xBC4D7493u, 0xF13B82FFu, 0x01CBB5C5u, 0xEAF8E6A4u, 0xD4EC6ACEu, 0x0ED426EEu, 0x22067D80u}}},
+    {{{0x944EE41Au, 0xAC233AB9u, 0x3B7D69A6u, 0x879B56DDu, 0x72C68282u, 0x3F7C10B6u, 0xD3C70A44u, 0xD06C4851u}}, {{0x8B295E6Fu, 0x2F1F84E9u, 0x6162EE25u, 0x9B7B8434u, 0xF4F63091u, 0xBBB0ACD4u, 0x0584D0ADu, 0x5815FD4Cu}}},
+  },
+  { /* 16^45 */
+    {{{0x63D82751u, 0x27AAE751u, 0x07AD3545u, 0x5645B4A9u, 0xA0E3B285u, 0x399064F3u, 0xEC6DB109u, 0x85D0FEF3u}}, {{0x4EB1F962u, 0x82C237A2u, 0x68773315u, 0x3E8751E9u, 0x582CF566u, 0xE29D496Eu, 0x13A38C0Bu, 0x1F036484u}}},
+    {{{0x1D5FCADEu, 0x56356D14u, 0x09711FF7u, 0x68B482E0u, 0xCD11DF04u, 0xF607A6CFu, 0x19A4C4F4u, 0x6B790F4Bu}}, {{0xC338D3FFu, 0xB6FFF86Fu, 0x7BE26B0Au, 0xA83FA5B4u, 0x9CAE09CBu, 0xF296661Fu, 0x2FF9EB3Eu, 0xD03A981Bu}}},
+    {{{0xECDE4CF3u, 0xB9955061u, 0x478A066Au, 0x9340E535u, 0xD15D9AE7u, 0xBE7C2D26u, 0xC11422C3u, 0x384DAB4Au}}, {{0x252D0566u, 0xB7C796B2u, 0x9751BA73u, 0x1F430A33u, 0xA2B4C6F0u, 0xBFB4ED6Du, 0xD1B9CA43u, 0xD6E3C5BCu}}},
+    {{{0xE3A3E0CBu, 0xBB0CCDABu, 0x85978BE0u, 0x3D2479DEu, 0xACC4F8FEu, 0xC162C367u, 0x2D7EBED3u, 0x41149B2Cu}}, {{0x339033A8u, 0x70E92E98u, 0xEF490F24u, 0xB3EC7805u, 0x9902CF28u, 0x2B415C9Bu, 0xDB7C3054u, 0xC90D5B92u}}},
+    {{{0x1E5238C2u, 0x98AF3E92u, 0x380ECB8Bu, 0x40355F5Cu, 0x4E82ED48u, 0x41B1610Bu, 0xB7D415AAu, 0x14F0EC0Eu}}, {{0x92F07922u, 0x6E86A347u, 0x0304939Du, 0xD25C00D8u, 0x3842747Fu, 0x921FC73Eu, 0xD4835D80u, 0xAB12D53Du}}},
+    {{{0x8A972627u, 0x8A4366A0u, 0x02521E1Fu, 0xE1921604u, 0xCBC441A0u, 0x8198C1EFu, 0x49BFE15Cu, 0x8A318709u}}, {{0x46BB8AF9u, 0xE7B47B56u, 0xC3EFCBCCu, 0x1744365Au, 0x8587BAA4u, 0x09577ED2u, 0x68F7A64Du, 0x64BB7C87u}}},
+    {{{0xD543E94Du, 0x8F6352EFu, 0x56F98E18u, 0xDD1302A7u, 0x8A5A0DDAu, 0xC41C3467u, 0x782C287Eu, 0xEB42F3BBu}}, {{0x45924D89u, 0x40559DE4u, 0xE60D6D42u, 0x4CD8468Du, 0x2FCDFB77u, 0xC9A0DD57u, 0x4F25D92Du, 0x234A6D07u}}},
+    {{{0xE3F3D3FCu, 0xF8DDDD28u, 0x05C29CEBu, 0x664A9B82u, 0x2872A7BAu, 0xFAEC3DFEu, 0x4E7C849Du, 0xD1FAD4FAu}}, {{0x50F3704Du, 0xED22343Cu, 0xEFF37326u, 0xBAD37131u, 0x858B7818u, 0x5473F70Eu, 0xA348FDFEu, 0x8FE19714u}}},
+    {{{0x7E19AAEDu, 0x0324E5B5u, 0x8C667327u, 0x459BACDEu, 0x6E06A920u, 0xA9EEC02Fu, 0x516820D9u, 0x1CF138CAu}}, {{0x692F400Eu, 0xC136EA5Du, 0xEFC77FFBu, 0x479EEF8Fu, 0x6B6DDE17u, 0x5F4372A6u, 0x171C6386u, 0xD6FFDAF3u}}},
+    {{{0xE0BA68DDu, 0x37473BA2u, 0x8C7EAD65u, 0xBCA7C943u, 0xC1DAD312u, 0x7F266838u, 0xFE2B7412u, 0x05CBEAABu}}, {{0x7DD03959u, 0x94229F32u, 0x5DE533B5u, 0x7F3D9670u, 0x5506EFA0u, 0xAE938666u, 0xFA90156Eu, 0x13CA23B6u}}},
+    {{{0xB6A8AA39u, 0x5F6C0E9Fu, 0x4A78FAC5u, 0x37A6637Bu, 0x849990D9u, 0xC875A096u, 0x5F40D412u, 0xB58686BEu}}, {{0x2B493C1Fu, 0x8FC7935Du, 0xE6DB347Bu, 0xABBDAF98u, 0x54C0A91Du, 0x149478D4u, 0x24C78C2Cu, 0x5632D543u}}},
+    {{{0xCA3A1550u, 0x9A544C67u, 0x8EFFDF27u, 0x801DA99Fu, 0xE1F8B751u, 0x2DD30976u, 0x34055741u, 0xEBFC69ABu}}, {{0x41362F6Eu, 0x51F42BF6u, 0xE68C0B19u, 0x7983C818u, 0xB7F4FD07u, 0xA3DF199Du, 0xB99CB540u, 0xE2FFE8CDu}}},
+    {{{0xB03B4CC5u, 0xEE91EBE3u, 0x5A1C77C2u, 0x572831BAu, 0xE7F3A802u, 0x67B5BC4Fu, 0x6B8BCC2Bu, 0x5FC19DB0u}}, {{0x65B57C28u, 0xA3B39FB8u, 0xCC087EC4u, 0x9276F503u, 0x9A3A5EF4u, 0x6EE2138Fu, 0xEC98C7C6u, 0xEC8E84C0u}}},
+    {{{0x5E8D319Fu, 0x48BBF38Eu, 0x6D4418E9u, 0xE66AA561u, 0x37AAC980u, 0x1050B653u, 0xCE93A866u, 0x6CE5C350u}}, {{0x95CF513Fu, 0x08AC6BD7u, 0x0EC53783u, 0x2DA8F2E0u, 0xCBBE23F1u, 0xBED3E3E8u, 0xE2503C85u, 0x950D0026u}}},
+    {{{0x4CB38CB5u, 0xBB4B857Du, 0x4D388948u, 0xE10B7FDFu, 0xFD3EEA1Bu, 0xDEBA8A40u, 0x42EDE289u, 0xB88FB70Du}}, {{0x5965F3D7u, 0x97BFA756u, 0x27AF8C71u, 0x4D4F3E12u, 0x4B35A8E2u, 0x6034BB99u, 0x46EA3280u, 0xD6C736ADu}}},
+  },
+  { /* 16^46 */
+    {{{0x4526087Eu, 0x8F540482u, 0x82DA2030u, 0xFDFB6D88u, 0x1798B85Du, 0xC1C9B604u, 0x97EECE97u, 0xFF2B0DCEu}}, {{0xF0C29907u, 0x2C951E01u, 0xB90E2CEBu, 0xC7B7ED6Fu, 0x54D07936u, 0x8AF4C4DCu, 0xF524BA18u, 0x493D13FEu}}},
+    {{{0x3149F8EFu, 0x3BD3A9AFu, 0xE638B458u, 0x3DEB5C4Eu, 0xECB1BB22u, 0x78E29EBBu, 0x5F366C9Fu, 0x2982DBBCu}}, {{0x16C7A248u, 0x56E726B0u, 0x12E3ED84u, 0x095DB994u, 0xC7B5BC9Du, 0xB9FA5339u, 0xAF66220Au, 0xA61B5BE9u}}},
+    {{{0x79D681F9u, 0xC59054FEu, 0xAC8FEB9Fu, 0x66CE0EEFu, 0xE02C94B0u, 0x88B7FF25u, 0x775F2308u, 0xC745FDF2u}}, {{0x7BBB1247u, 0x60317343u, 0xC67D45C7u, 0x8CDBD335u, 0x70E81867u, 0x8A71394Cu, 0xF6B9E5E7u, 0x590222F2u}}},
+    {{{0x2380441Bu, 0x85289F61u, 0x80E17658u, 0x60011F45u, 0x0497DB58u, 0xB436EB59u, 0x2AF0C0F6u, 0x1A28E504u}}, {{0x8452AF25u, 0xB05F606Au, 0x46EE67AEu, 0x04B3E75Bu, 0x8976F0EDu, 0x7C78329Au, 0x96C59DABu, 0x55779A79u}}},
+    {{{0x35CD0EA3u, 0x5E04CEEDu, 0x20CAC481u, 0xB34478E8u, 0xB672E7F2u, 0x27A59E5Eu, 0xA975050Bu, 0xABB279F3u}}, {{0x7C307BCEu, 0x47093133u, 0x9E02F3B6u, 0x7C976905u, 0x03078ED4u, 0x9FB4BE0Cu, 0xBF17970Du, 0x5DEE103Bu}}},
+    {{{0x649A2115u, 0xE77FD534u, 0x17A565EBu, 0xEC796009u, 0xD640981Au, 0xDD46ACA9u, 0xB194C6C6u, 0xFD73C052u}}, {{0xA6BA6CDAu, 0x049CAB7Bu, 0x2E9D421Fu, 0x04F60156u, 0x26F7D6D9u, 0x020ABAB0u, 0xC8178844u, 0x620768C1u}}},
+    {{{0x1BC9EE3Eu, 0x5C2E2F3Fu, 0x63E7382Cu, 0xEA9FA1A9u, 0x4267ED11u, 0x27FAEAA7u, 0x59FC6828u, 0x3F81150Bu}}, {{0x599AAE06u, 0x3CEADB0Cu, 0xFCDA8160u, 0x7623B2DCu, 0xC4795662u, 0x4671BEB3u, 0xFDBFA82Du, 0x19C88A68u}}},
+    {{{0x621E30A7u, 0x2EEF0E39u, 0x985D8324u, 0x2EDD5EB7u, 0xBD3F2014u, 0x1D250CC0u, 0x535F3060u, 0x0C8B83E9u}}, {{0x9FF688DEu, 0xBEBF7BEBu, 0xB987134Du, 0xAACAD237u, 0x7EFDC854u, 0xB850E3F1u, 0x065FDAC7u, 0x0DCC7077u}}},
+    {{{0xF8E4A007u, 0x6171BEFAu, 0x08BB358Bu, 0x15ECEECFu, 0xAA56C7ECu, 0x9594BA33u, 0xD0082DE6u, 0x5CF8132Du}}, {{0x9068B883u, 0xCE63F090u, 0xC79C7FE8u, 0xC8946F96u, 0x848C3DF6u, 0xF4AD4158u, 0x0D61FA0Du, 0xB45AEE5Cu}}},
+    {{{0x4C3C18E1u, 0x3003EFCCu, 0xBAAD7230u, 0xBA4AE5FBu, 0x04BAC7F4u, 0x91226711u, 0x83510D6Bu, 0xB3FA0545u}}, {{0x12AA2B4Fu, 0xCB11FBEEu, 0xF10CE542u, 0xAA55A499u, 0x064FE6FDu, 0x7BA18298u, 0x9340F56Bu, 0xA85C2475u}}},
+    {{{0x26C2D4A7u, 0x0956FE7Bu, 0x3BCFFFB1u, 0x1BC36F93u, 0x3C404ED2u, 0x653E3397u, 0x0D4BA494u, 0xB6D5FE4Du}}, {{0x3AE86371u, 0x118DCE7Eu, 0x6F5E3CC8u, 0x745B7E4Eu, 0x9DFFFD8Eu, 0x4DFCF920u, 0x3ABBD6C1u, 0x47F373A1u}}},
+    {{{0x1B816B2Fu, 0xFDB86C35u, 0x1228EE11u, 0xEE0CB784u, 0x126C5D5Du, 0x6E8165FEu, 0x65951A67u, 0x5A4D46DDu}}, {{0x73E86C60u, 0xAF97AEB8u, 0xFB3ECCEBu, 0xB50E6CC5u, 0x8F3DFCD6u, 0x0283E27Fu, 0xCA0E60ABu, 0x77C92396u}}},
+    {{{0xFC66DD33u, 0x50933622u, 0xF1DC76DCu, 0xEA8FBC8Fu, 0x0029B022u, 0x06BB1B15u, 0x66CF5887u, 0x61C8BBC0u}}, {{0xB6F10BFAu, 0xA3BBA9F3u, 0xC2820C8Cu, 0x6A5106EAu, 0xB985D3FBu, 0x44669994u, 0x9E54F703u, 0x93599E23u}}},
+    {{{0x335CACBBu, 0xFCE648CFu, 0xBD635B26u, 0x18AC3028u, 0xDC622671u, 0x7B977E5Bu, 0x2C720CCDu, 0x4FD699B1u}}, {{0x8E1AD839u, 0x33B2EFA8u, 0xE8223E61u, 0xAA998EB2u, 0xCDB61E2Cu, 0xD9479DBFu, 0xF511A0AEu, 0xC6C90EF3u}}},
+    {{{0xDD6B2FF8u, 0x9805B7CCu, 0x7286C8FAu, 0x876336C1u, 0x3EC3BDF1u, 0x87C9F537u, 0x74267851u, 0x94E32BA5u}}, {{0x2CE1AF3Eu, 0xADD48555u, 0x526BFE13u, 0xB33AF042u, 0x662D9E8Cu, 0x92F1E488u, 0x43DA04E1u, 0x0D1B448Bu}}},
+  },
+  { /* 16^47 */
+    {{{0xF856E241u, 0x780E5E2Cu, 0x8CD6DD28u, 0x57F1EE14u, 0x301B212Bu, 0x9ED2B2E6u, 0xB1E880EAu, 0x827FBBE4u}}, {{0xAEC293ECu, 0xD605B68Bu, 0x86903166u, 0x7FF7A631u, 0x7D1D1268u, 0x71BEF2C6u, 0x3C727B0Bu, 0xC60F9C92u}}},
+    {{{0x0CB1815Du, 0xEF6E44B7u, 0x18B87461u, 0x60470A92u, 0x576E6B36u, 0x3E2D7C8Du, 0xDCE56B97u, 0xB77F12A7u}}, {{0x8E57DBC5u, 0x6BA3D2BCu, 0x1A44816Du, 0x4C42F0F9u, 0x73CC2E65u, 0x3F0CEFB3u, 0x4F86ACC4u, 0x4B6F85B1u}}},
+    {{{0x3BB80FA7u, 0x634485CBu, 0xB7041388u, 0x3AA7DA6Bu, 0xD320819Fu, 0xC0D1A06Bu, 0x6308C2FBu, 0x0857E31Fu}}, {{0x09366B2Du, 0xBD98211Fu, 0x3CD7016Au, 0x172E3704u, 0x1DCB7147u, 0x92D7CC9Du, 0x3AE01720u, 0xF6439342u}}},
+    {{{0xC45565ECu, 0x0FE5DAD2u, 0x4977C597u, 0xD858D8DFu, 0xCB79F956u, 0x47B308B2u, 0x3018BF12u, 0x48973B94u}}, {{0xFAED07E9u, 0x3B879075u, 0x580477B8u, 0x511B3596u, 0x01445AF1u, 0x6437BB3Au, 0x4F3CDC1Bu, 0x761F7568u}}},
+    {{{0x09C70E63u, 0xF5D02C3Au, 0xE753D496u, 0x9CBB8B78u, 0x764A672Eu, 0x3545C655u, 0x56BD6004u, 0x28AACCEAu}}, {{0xF057DA4Eu, 0xB9F03882u, 0x444DA1E8u, 0xF5FC59CEu, 0xC768EBB7u, 0x67A89667u, 0xF81A0E15u, 0x2B69322Eu}}},
+    {{{0x7B6D6CD3u, 0x33A00ABEu, 0x03893788u, 0x3416611Du, 0x05652397u, 0x81A69B87u, 0x7F2B8184u, 0xEA126616u}}, {{0xF4F450BEu, 0xAAE62925u, 0xEBBE1A88u, 0xB1C9752Du, 0xF1145E25u, 0xAACE112Bu, 0x078EE3FDu, 0x21A4E2E5u}}},
+    {{{0x73E674B5u, 0x601DC52Fu, 0xE7060AACu, 0x92D8F69Cu, 0xBCEB8A4Fu, 0x45DDB2C9u, 0xA055A661u, 0xA2F3B625u}}, {{0x0E937941u, 0xB0938C8Eu, 0x7C33FA53u, 0x9222FA31u, 0xF32A7C4Bu, 0x80044A90u, 0x614C68AEu, 0x620EA159u}}},
+    {{{0xBBFD71FAu, 0xA4D4D742u, 0x5B4527D4u, 0x0B775A26u, 0x8A704C17u, 0x6D697272u, 0x8EB5559Cu, 0xE931258Eu}}, {{0x174D3307u, 0x3D9BD0D3u, 0xBB5E35F3u, 0xB3946CE1u, 0x9C954B40u, 0xE85EB416u, 0x4C3FDEE0u, 0xFB1E3336u}}},
+    {{{0xD91EB056u, 0xC7601631u, 0x8ECFD386u, 0xA002EFDBu, 0xA3F515F5u, 0x1D98B5C6u, 0xEAAE5923u, 0x3C4F83C9u}}, {{0xA05CECABu, 0x7425893Du, 0x81CF6B87u, 0x1982B544u, 0xC3B27880u, 0x33AD6573u, 0x514A8B6Au, 0x94479007u}}},
+    {{{0x548FADF1u, 0xE643D8CBu, 0xA712DF9Du, 0x00359B87u, 0xE891817Bu, 0x9C365F8Du, 0x7F7F4244u, 0xEDF38438u}}, {{0x6C415FB6u, 0x79C436CFu, 0xDEA37D28u, 0x0F4E8813u, 0x120AA6B7u, 0xDED80235u, 0xA1898500u, 0x72D3B5B0u}}},
+    {{{0xBD86DFA9u, 0x19061FDBu, 0x09B993A7u, 0xDC38B4A4u, 0xE8103BAAu, 0xE29C1E03u, 0x8A9967D4u, 0xAFF8E128u}}, {{0xC1D12681u, 0x07103C36u, 0x4419F9C7u, 0xF9116DA9u, 0x1FCF53F4u, 0xD3D3EBAAu, 0x21377C3Fu, 0x8D8B4BB3u}}},
+    {{{0x5CFF55C5u, 0x77123D42u, 0x1A275EC9u, 0x5F4EFD28u, 0x782B4B63u, 0xA6C12C1Eu, 0xFB25442Cu, 0xCF36ADFDu}}, {{0x21A0228Eu, 0xACA27885u, 0x5C0D2706u, 0xA7547EC2u, 0x3BD9F207u, 0x49C2F58Bu, 0x6AE07686u, 0xD16A1216u}}},
+    {{{0x989BA9C1u, 0x28F2736Bu, 0xA09D338Eu, 0xE40F7CA5u, 0xAECEE579u, 0xE8458262u, 0x28DC00B3u, 0xD3FB7845u}}, {{0xEB51B267u, 0x061B88DFu, 0xC011ADE0u, 0x341CEDD5u, 0x58B70FE6u, 0xCA7CA057u, 0xEFA6B4E7u, 0xF894D434u}}},
+    {{{0xC181F79Bu, 0xFE8540CBu, 0x0CE4ADB4u, 0xE045D865u, 0xC6A5CA26u, 0xE2DF82E7u, 0x6C63DFAEu, 0x31C80CA2u}}, {{0xD5225400u, 0xF0B9E526u, 0xF51125F1u, 0x622FF9EAu, 0x68F30D91u, 0x3094E4D3u, 0x202926DFu, 0x92B59EC1u}}},
+    {{{0x0F2BB909u, 0x9DA96C1Du, 0x53598D99u, 0x6391027Cu, 0x39187D7Fu, 0xFF472988u, 0x0AC9AA88u, 0x4EC9300Eu}}, {{0xA4CF4071u, 0xB88A383Fu, 0x0DAC3827u, 0xD52E1682u, 0x184C49BAu, 0x5C80DC45u, 0xBE1B04DCu, 0x782BA106u}}},
+  },
+  { /* 16^48 */
+    {{{0x2120E2B3u, 0x7F3B58FAu, 0x7F47F9AAu, 0x7A58FDCEu, 0x4CE6E521u, 0xE7BE4AE3u, 0x1F51BDBAu, 0xEAA649F2u}}, {{0xBA5AD93Du, 0xD47A5305u, 0xF13F7E59u, 0x01A6B965u, 0x9879AA5Au, 0xC69A80F8u, 0x5BBBB03Au, 0xBE3279EDu}}},
+    {{{0x1FC9B0A8u, 0x53DBC1CCu, 0x705F3DB4u, 0x9E337B5Cu, 0x002279EAu, 0xC2623EA5u, 0xBEB997EEu, 0x3ADB9DB3u}}, {{0xF05BBDDAu, 0x61AE7975u, 0x870266CCu, 0xAAD9C8F9u, 0x7C095FF6u, 0x3C774DE0u, 0xAEE74E71u, 0x374E2D6Du}}},
+    {{{0x3F2E070Du, 0xF583FD3Au, 0xC52A6A98u, 0x29AAB71Cu, 0xB85047E2u, 0xF48731C3u, 0x042F4ABFu, 0x4B72A5E9u}}, {{0xE96DD780u, 0xE44BA82Eu, 0xD2948C3Du, 0xB0B465DDu, 0x6D0F3C10u, 0x60277BB3u, 0x1D6AE1CFu, 0x599E1D4Eu}}},
+    {{{0x90AE86F9u, 0x054E9E0Cu, 0x963E7CAFu, 0xFEFDFF56u, 0x56C5FC69u, 0x7E10955Eu, 0x428E9CBBu, 0x129E53ACu}}, {{0x1E89C85Du, 0x822EFDCDu, 0x16B3E01Bu, 0xB2A232FDu, 0xB712183Fu, 0xB2DA2115u, 0x8AEE9A29u, 0x415ECB95u}}},
+    {{{0x4A02591Cu, 0xE9CE7FD8u, 0x585125A1u, 0x3EF54996u, 0xB5E1FD61u, 0x85A6BFBEu, 0x6539C8E2u, 0xA9FC93FCu}}, {{0x69BEC2DCu, 0x790ADDEFu, 0x5FCF7253u, 0xCA888C41u, 0x1A9165E5u, 0x3E84C17Au, 0xDC538717u, 0x9C2CE739u}}},
+    {{{0xF85912ECu, 0x428700A0u, 0xE4609113u, 0x27F9CA04u, 0x4AAF0543u, 0x6AB49969u, 0xE3FB5B78u, 0xAA7121D4u}}, {{0x4AE35978u, 0xB114CB26u, 0xCE056CBDu, 0xFEE134A8u, 0x96A2EDEBu, 0xC505266Bu, 0xDAD09509u, 0xC690F077u}}},
+    {{{0x2D968B59u, 0x11006E0Eu, 0x13CBBC2Eu, 0x09A28BAEu, 0x209B0277u, 0x6A7D7AC1u, 0x1A6F9F0Au, 0xC940017Cu}}, {{0x8DE572FBu, 0xFEFD7640u, 0x4390C9C8u, 0xE2842CB6u, 0xA5B5742Cu, 0x13B8A1BFu, 0x0C9B8620u, 0x39D92250u}}},
+    {{{0xE855B8DAu, 0x922243D5u, 0x12894711u, 0xC756267Du, 0xAEE10956u, 0x5B85ECB6u, 0xC8F69448u, 0x60144494u}}, {{0xF34E4BBDu, 0xAD500590u, 0x7E3F2A4Bu, 0x543955C2u, 0x9132E65Bu, 0x9E8BE1FDu, 0xF681E646u, 0x8BB5D669u}}},
+    {{{0x726B3332u, 0xA2873335u, 0x73EE5DE6u, 0x310388D0u, 0xF70BF8E0u, 0xEC6793A5u, 0x7EED0024u, 0x1F84BB9Du}}, {{0x14E8D52Eu, 0x554428A3u, 0x436DC3A2u, 0xC2BCCE2Du, 0x75B9EDF0u, 0x2547C27Fu, 0x2BCA9ECCu, 0xEE726D07u}}},
+    {{{0xB1972BCBu, 0x9DD95979u, 0x241ECCEBu, 0xC2F22E3Eu, 0x3EDA1776u, 0x8F68E021u, 0xC8BB9F02u, 0x3DF2D057u}}, {{0xD65D09DFu, 0xB2822CD3u, 0x80194771u, 0x1B914496u, 0x046A684Bu, 0xD6E6B23Bu, 0x40C86EEAu, 0xDC7EB1C6u}}},
+    {{{0xCDEFA98Eu, 0x5CDAA54Au, 0x11AC2799u, 0x72484468u, 0x3991E9C7u, 0x6CA8157Bu, 0x0945FCD0u, 0x0F13E089u}}, {{0xBE286767u, 0xC08A7769u, 0x16CEACCDu, 0x287E705Eu, 0xA7B362DBu, 0x35E3F8B0u, 0x764E7C50u, 0xADD521F1u}}},
+    {{{0xFFD292DCu, 0x1B806A24u, 0xB17714CEu, 0x775E2680u, 0x37BD79D9u, 0xBA48070Du, 0x3720F934u, 0x4B991553u}}, {{0x57095CA6u, 0x433A5FFEu, 0x5B376AFDu, 0x938323C4u, 0xB5F01F57u, 0x6DFC0A74u, 0x61103A22u, 0xE3277549u}}},
+    {{{0xE9F59B6Bu, 0xA5E1C03Bu, 0xC1888E2Fu, 0xE9B38C63u, 0x2D5826D3u, 0xB3728A1Du, 0x51DDEC7Du, 0xDDE191A5u}}, {{0x26CB1410u, 0xF6AD9629u, 0xE7154FECu, 0x8B5738BBu, 0x1C52E14Eu, 0xE0A757D6u, 0x028275CBu, 0x5B2BFB78u}}},
+    {{{0x23B43EEBu, 0xEEED1B34u, 0xBF81184Fu, 0x181C9401u, 0xFF359C5Cu, 0x7EA4825Fu, 0x9EB95E93u, 0x83C40397u}}, {{0xD484FB51u, 0xAFF34086u, 0xB553FB40u, 0x95B6BFCAu, 0xD00D61B2u, 0x0BFC1E46u, 0x437CEE3Du, 0x29575FF2u}}},
+    {{{0xC9C6B699u, 0xB68C55FDu, 0x6BE46871u, 0xA86F5735u, 0x97B41682u, 0x5A16D7BFu, 0xED836F7Au, 0x5FAB012Eu}}, {{0xC1C6C3AAu, 0xB1732152u, 0xEA883519u, 0x90AB117Fu, 0x30D62F7Bu, 0xE9EBB411u, 0xA3C3D144u, 0x2D9BFA70u}}},
+  },
+  { /* 16^49 */
+    {{{0xDA34D24Fu, 0x1E23632Du, 0xC9A13740u, 0x41B6D8F0u, 0xECF42EE5u, 0x9391DF6Du, 0xC5CF169Du, 0xE4A42D43u}}, {{0xDEBA9414u, 0x3A7F7131u, 0xA8D8E4F1u, 0xE886EEDFu, 0xFB8AD34Cu, 0x26FC99CCu, 0x16D1C735u, 0x4D9F92E7u}}},
+    {{{0x3E8F62BBu, 0x303F2EA3u, 0xF7AE4D2Au, 0x0553C562u, 0x56C4EF4Du, 0x3EF0ACF8u, 0x84CFB18Du, 0xFD6451FBu}}, {{0x132C0911u, 0xD0AD9086u, 0xD200E83Fu, 0xFA2AB492u, 0x1BC344CCu, 0xB6FE7A5Cu, 0xB1871578u, 0xE745CEB2u}}},
+    {{{0x3BEA0C68u, 0x5C8410AFu, 0x677B392Bu, 0x09430123u, 0x8D396FAFu, 0x4949BC8Eu, 0xE156A3A2u, 0x3E419634u}}, {{0x1A45EDB6u, 0xBCBB6FF7u, 0x303CDA1Au, 0x2FA11946u, 0x37069306u, 0xF373CBFEu, 0x924B21F7u, 0x0123C59Du}}},
+    {{{0xD5FE696Bu, 0xFA1D1FB9u, 0xDCF3C7A1u, 0x0042E2D5u, 0x6F9EDBBBu, 0x716E81A0u, 0xB24086BCu, 0x1EEE207Cu}}, {{0x7429337Bu, 0xBB45670Eu, 0x0AFD694Eu, 0x7A02062Eu, 0x2461C95Fu, 0xD2B196D1u, 0xAEF6269Cu, 0x652CBD19u}}},
+    {{{0x939824D7u, 0xAF75D23Cu, 0x351C9897u, 0x6EB7B64Cu, 0x2F7F0B57u, 0xEED4A3E6u, 0x455D7508u, 0x8D9438F5u}}, {{0x9366489Fu, 0x8A004F48u, 0x326B063Du, 0x8FB9E2B8u, 0x1AB6EF6Fu, 0x2CA60BD3u, 0x4FEE6C2Au, 0x3261E073u}}},
+    {{{0x17D4B84Au, 0x9A9814C4u, 0xF1F433E6u, 0x621DDF48u, 0xD2850704u, 0x0C62A492u, 0x8DC72FCBu, 0xF13A99E5u}}, {{0x53FD1C81u, 0x85990FC5u, 0x10F2D962u, 0xB6E37D47u, 0x1E3FE06Eu, 0xAA6B91CDu, 0x0F0BE995u, 0x33C2C8CDu}}},
+    {{{0x98D713DEu, 0x8E48071Au, 0x7428E620u, 0x9360C2FBu, 0x2FE54543u, 0x0D4A912Au, 0x58EE5442u, 0xB72524C5u}}, {{0x9B8350E9u, 0x76FFE525u, 0xE44A5FCBu, 0x0482D26Fu, 0xE9D69415u, 0x1042D182u, 0x8A283E45u, 0x4C51B39Au}}},
+    {{{0xEF94C0D5u, 0x08D40F19u, 0x7C572579u, 0xE1C0FC01u, 0x346E2111u, 0xD465AB2Cu, 0xA8A9EB14u, 0xCC0EA33Eu}}, {{0xAF452FE6u, 0xDEABE597u, 0x6113F543u, 0xF6074F26u, 0xB5FBE663u, 0xB23DD203u, 0x711C8A2Fu, 0xF9907A3Bu}}},
+    {{{0xFE3B2CB4u, 0x2CC6C293u, 0xF3721040u, 0x3049F35Bu, 0x8121149Eu, 0x9ADC76E3u, 0x216D1251u, 0x3DE45F5Au}}, {{0x307EB02Fu, 0xF61E33ACu, 0x5A87044Cu, 0x823E28E6u, 0xA97C9106u, 0x50E08AA4u, 0x405EADDCu, 0xBA2A8598u}}},
+    {{{0x2A0C0222u, 0x9CCBD751u, 0xC82E8B55u, 0x16937EF9u, 0xC1700F2Cu, 0x46CA18BFu, 0x9CA58A04u, 0x9E4AC64Du}}, {{0xA4FDC9BBu, 0x16CF7673u, 0x3DAB904Eu, 0x1C62030Fu, 0x63B300D0u, 0x3080E8DFu, 0x9FE4E74Du, 0xCEA45D1Du}}},
+    {{{0x6CE4E5BFu, 0x7234766Fu, 0xA09005B1u, 0x9B67CA86u, 0x748906AEu, 0xC1E3FCE3u, 0x8959BE87u, 0x8511F1C6u}}, {{0xC1789C08u, 0x2FC92944u, 0xBC536526u, 0x2DA87889u, 0xC6AA0023u, 0x4C1DDF7Eu, 0x91BCD487u, 0xECDFF5CFu}}},
+    {{{0x4E735A1Eu, 0x5F0C3B14u, 0x6BE61FA0u, 0x4003E096u, 0xD61202FCu, 0x46B8CDDAu, 0x799B56CBu, 0x678AC7C0u}}, {{0x12F7C055u, 0xA363A5F7u, 0x3D371457u, 0x597FFFB3u, 0x57105E8Eu, 0x7A70FF3Du, 0xD9A5285Bu, 0x08514E33u}}},
+    {{{0x3D3258ABu, 0x31B5668Au, 0x8ABC14DCu, 0x57D24281u, 0xEE14AB59u, 0x2CFA1C72u, 0x81CF6022u, 0x8C5A052Eu}}, {{0x022D0F8Fu, 0xE57E0853u, 0xC0D944ADu, 0x46DAE8F9u, 0x904C08C2u, 0x079A80C7u, 0xB443BDA1u, 0x6811DB4Bu}}},
+    {{{0x822AA9B8u, 0xD7BE9770u, 0x33506F8Eu, 0x00006E29u, 0x9C5AD45Fu, 0xDD66895Du, 0xD8680F6Cu, 0x64BA9514u}}, {{0xB6163565u, 0xE93D1FB9u, 0x68307B35u, 0x5FEF1B6Fu, 0xC19BE49Eu, 0xB7E07728u, 0xA6431BDBu, 0x81273F22u}}},
+    {{{0xBF91BCEEu, 0x158C2A0Au, 0x1E0C0D84u, 0xF5CF1D8Fu, 0x556BF137u, 0xBDC63CECu, 0xDEBD3560u, 0xCEF7F816u}}, {{0x81966B33u, 0x6BB4DA9Fu, 0xA172F6ACu, 0xA63E4B02u, 0xC01D245Fu, 0x2463B339u, 0x63748701u, 0x67E74C83u}}},
+  },
+  { /* 16^50 */
+    {{{0x4300BF19u, 0x47173B9Du, 0xA88FEA49u, 0x92B53576u, 0xAB352B6Bu, 0x54160FADu, 0x360CBDD9u, 0x1EC80FEFu}}, {{0xC107CEFDu, 0x671CDC1Cu, 0x6295A07Bu, 0x0146E77Fu, 0xA7ABBF5Eu, 0x2F3A4958u, 0x56B5340Du, 0xAEEFE937u}}},
+    {{{0x414FF9E4u, 0x0DAE805Du, 0xEBD89056u, 0x8E8462F6u, 0x44FC90BBu, 0xCBEEAA03u, 0x19F04BC6u, 0x5BE7EA35u}}, {{0x47E0BDBBu, 0x4030B078u, 0x2119A309u, 0x0E99C630u, 0x655AB7FEu, 0x477F890Fu, 0xF638E605u, 0x32F32EC3u}}},
+    {{{0x52FEA1F9u, 0x4B17CBBCu, 0x8C0452B9u, 0xC4FF0B50u, 0x67106531u, 0x3BCFDDABu, 0x55D1F2E8u, 0xA6DC880Au}}, {{0x7BC345E9u, 0x3B1C14E4u, 0x7E68F7E6u, 0x057B89DBu, 0x16ACBC50u, 0x038683A1u, 0x7DC367C3u, 0x7EF1A854u}}},
+    {{{0x4DDB7BB8u, 0xE3FB545Fu, 0x9F853991u, 0xD5002864u, 0x98DF7F5Cu, 0x0813FC86u, 0x6EAE4E65u, 0x58F09911u}}, {{0x2E5B2D6Eu, 0xBDEC7358u, 0x2D174302u, 0x507EE406u, 0x14638066u, 0x0D62FF76u, 0xAFFE111Au, 0x7E07002Au}}},
+    {{{0x06D6C9B3u, 0xC8D40C3Fu, 0x74865637u, 0x8C6C4CE8u, 0x78A481BAu, 0x2BDC229Cu, 0xEA424599u, 0xFE6BA93Fu}}, {{0xA948BDFBu, 0x0C2C788Fu, 0x05C2E9B0u, 0xD980F1BFu, 0x45413B56u, 0xB6BB41B3u, 0x40539872u, 0x7EE918D7u}}},
+    {{{0x1C7985C4u, 0x8B613E77u, 0x5B9E2B10u, 0x134BFC49u, 0x02F74C34u, 0xE5428428u, 0xF7B59B7Cu, 0x2320B5CAu}}, {{0x4C2C6D44u, 0x4FF4F1DFu, 0x1CD9EB8Du, 0xD96F1021u, 0x1F9BCA93u, 0x18C721B8u, 0xC88BE943u, 0xC79F943Du}}},
+    {{{0x0CF95151u, 0x422F1073u, 0x442C4B64u, 0xB964806Eu, 0xDC08DED1u, 0xB020C8C2u, 0x46FC98BFu, 0x15D5E2F1u}}, {{0x2FF8ECF2u, 0x482A07CCu, 0x7DD8C0F9u, 0xBB204FB9u, 0x789023F9u, 0x7F90E109u, 0x915FD4ECu, 0xA5B72E31u}}},
+    {{{0xCC9A8E2Cu, 0x413C1606u, 0x4CC1A1C1u, 0x823D8D1Au, 0xD860CB0Fu, 0x33BCC04Fu, 0xB29790B6u, 0xB0F9E4B9u}}, {{0xDF3D0DB4u, 0x6C2066C4u, 0xC171CEE7u, 0x3350CC02u, 0x06FDE3F0u, 0x41CBB0B9u, 0x843ADE6Du, 0x49E82BF1u}}},
+    {{{0x296A5658u, 0x3D7810B9u, 0x41EF6564u, 0x3814B252u, 0x27AE29BEu, 0xD8C7E009u, 0x5688447Au, 0x84C0E872u}}, {{0xD81B80D1u, 0x2D96729Bu, 0x1F4F1FD2u, 0xD3A61A98u, 0x0653725Eu, 0xA087E319u, 0xC16022C4u, 0x26598380u}}},
+    {{{0xD9D6FAD4u, 0x5AA02F29u, 0x1C9A124Cu, 0x94B357CFu, 0x213D59F4u, 0x8FAD04CEu, 0x670A91ECu, 0x56DB6280u}}, {{0x359E0836u, 0x67A9C0FDu, 0xA31E5CC8u, 0xF5B8B2A1u, 0x6D6830C7u, 0x50F59101u, 0xDB572724u, 0xDA0D3B94u}}},
+    {{{0x94DC6A0Fu, 0x375BB5C8u, 0x42FE1575u, 0x74434191u, 0xA2C077C2u, 0x565264E7u, 0x1A93731Du, 0xFED6B1C7u}}, {{0x976FC7E0u, 0xCCB8D72Du, 0x0A3FC409u, 0x1374D593u, 0xE4D3AE23u, 0x8479181Au, 0xB0FFFF0Au, 0x8DE2ABE6u}}},
+    {{{0xCA3A809Cu, 0x79FE0B0Bu, 0xD798346Du, 0xDAB662F5u, 0x4254A89Eu, 0xBFBCF97Eu, 0x3933DF56u, 0x125E7EC8u}}, {{0x949E70D9u, 0xDA8C900Au, 0xF07FCA3Du, 0x1E4E3B2Eu, 0xF5721A37u, 0x887747CAu, 0xE254CB38u, 0xE0D3F6EDu}}},
+    {{{0x18E29355u, 0xDB3885F1u, 0x39720D86u, 0x2F1C8E93u, 0x4023B9D8u, 0x0FCEF860u, 0x92D3CBC7u, 0x2A6A4DD9u}}, {{0xB5CC2872u, 0x0053E00Fu, 0x64C4C76Cu, 0xFE905A3Au, 0xE268F90Du, 0x760FDC81u, 0x7C4A7E0Cu, 0x8677DFBAu}}},
+    {{{0xE7681028u, 0x7F529511u, 0xAFCB9BB4u, 0x196E235Eu, 0xDDAF3D8Fu, 0xBF33CE97u, 0x185D20E1u, 0xA1ACB3F1u}}, {{0x14A11C9Du, 0x1F1A463Eu, 0x1FA0D788u, 0x66EECB27u, 0x288F0C5Au, 0x6A047588u, 0x1ABBB29Bu, 0x55A883A6u}}},
+    {{{0xE148DABFu, 0x1F9FA88Fu, 0x349D78EBu, 0xC1ADD2B9u, 0x35FAE735u, 0xD9764EC2u, 0x6C927546u, 0xE42D9302u}}, {{0x811E1361u, 0xD772C756u, 0x19E77EB9u, 0x32727570u, 0xFDF38530u, 0xD8B38CEBu, 0x6E2D84B0u, 0x6413862Cu}}},
+  },
+  { /* 16^51 */
+    {{{0x366642BEu, 0x9DDB5928u, 0x7D58BA88u, 0xCE349071u, 0x680DFA8Bu, 0x91B00AF4u, 0x04670C2Fu, 0x146A778Cu}}, {{0x3D83EFD0u, 0xD0B29748u, 0x2F7E5ED1u, 0x0AAA971Du, 0xF9D4B287u, 0xDD669827u, 0x3354028Au, 0xB318E0ECu}}},
+    {{{0x79DE5CACu, 0x11B23655u, 0x7ECB2619u, 0xEEFC983Cu, 0x0BCD14CFu, 0xE5670B5Cu, 0x8A597E24u, 0x574EF0CEu}}, {{0xC75A4805u, 0xAE59AEA6u, 0xEF10008Cu, 0x1A260A7Bu, 0x569B7845u, 0x3BD6ADA0u, 0x281F19C7u, 0x09B99930u}}},
+    {{{0x27315443u, 0x9D938738u, 0x4AE86729u, 0x3D79BBD5u, 0x20A142A1u, 0xF42C8998u, 0x0660935Fu, 0xFC696C04u}}, {{0x57D28960u, 0x7490D60Bu, 0x109BD1B1u, 0x487FF486u, 0xD69677B5u, 0xBBF0E1CDu, 0xF83B5892u, 0xE0CE27EBu}}},
+    {{{0x260966D3u, 0x808C2D74u, 0xAEFF8645u, 0x10A770C1u, 0xB98C835Du, 0x5D909397u, 0x9D8BF9F8u, 0xD3D97E79u}}, {{0x833C2E52u, 0xBDDEB850u, 0xBE8DC4EEu, 0xB5E48711u, 0x5D403AD3u, 0x6AAA8927u, 0x76BAC95Eu, 0x8DDBB463u}}},
+    {{{0x16FDB4EBu, 0xD1BB2F5Cu, 0xC62E6A79u, 0x8FA3DD79u, 0x62BEB092u, 0x1AE56A35u, 0xFF4FF2ADu, 0x974AF221u}}, {{0xA9F6F484u, 0x8409C3DFu, 0x3BFFC234u, 0x111C572Au, 0x02C090EDu, 0x64D1E43Du, 0x535003CAu, 0x5552387Du}}},
+    {{{0x7C6B5B56u, 0x7F3615FDu, 0xED888B60u, 0x4185C8AAu, 0x3BF200E5u, 0xCDF587EDu, 0x00EF4338u, 0xA0E88657u}}, {{0x3A1D7518u, 0xA16BDE51u, 0x70858A51u, 0x526B871Du, 0xB853DEADu, 0xB99A6B89u, 0x9FA9AD50u, 0xF5BA4683u}}},
+    {{{0x5D5AEEE3u, 0x73904ADBu, 0x6658C813u, 0xE8284BC3u, 0x669270C5u, 0x09121B3Au, 0x49DE398Bu, 0x5BAAB59Bu}}, {{0x70F69717u, 0x82D29AFBu, 0xABD31EEDu, 0x215DDC9Du, 0x61FFDAF7u, 0x6E5A0086u, 0x7C0F7E85u, 0x8A577F61u}}},
+    {{{0x968C6D4Bu, 0x0040FB93u, 0x8F494C12u, 0xB2BE78CFu, 0x2CBBEE0Au, 0x7B974E78u, 0x88B31898u, 0xB1AA6532u}}, {{0xE891AC51u, 0x83D9E62Au, 0x9D623CC3u, 0x100A1D90u, 0x2D63A83Bu, 0x2684AA8Eu, 0x60810D71u, 0x7ED6071Cu}}},
+    {{{0xF5726890u, 0x851B1E44u, 0xAC837D15u, 0xE59025FEu, 0xBF910A0Eu, 0x01032FCEu, 0xEB49C43Du, 0xFB685FA7u}}, {{0xB835783Au, 0x606EA8F3u, 0xE90E79B2u, 0x4FA6CB12u, 0x9864BA09u, 0x869CA16Du, 0xC98E5E2Eu, 0xD750DF22u}}},
+    {{{0x62C6E5BBu, 0xB7EEDAECu, 0x356CFE6Au, 0x24FDFFEEu, 0x392A597Fu, 0x358AB0B8u, 0x08C7105Fu, 0x25116C41u}}, {{0x0F7E1321u, 0x4DC4732Au, 0x51CC272Du, 0x77C508DFu, 0xC815DD8Fu, 0x1EB7406Du, 0xE77177E0u, 0x60D86913u}}},
+    {{{0xA8BCA48Au, 0x5464BF13u, 0xE83DF62Fu, 0x78B4D5F4u, 0xC287F71Du, 0x0AB27B91u, 0x59E2995Au, 0x5DE58FF6u}}, {{0xD2FD41CDu, 0x58794E80u, 0x4E0F8AA9u, 0x3FE5BD9Cu, 0x252D3C84u, 0x309A623Cu, 0x80359B55u, 0x685A3B3Du}}},
+    {{{0x50CEDD26u, 0x1D765DF7u, 0xEA571554u, 0x3CC8B99Du, 0xF9639E2Au, 0x611D8100u, 0x2961EBB2u, 0xAF884837u}}, {{0xB0E43F7Fu, 0x8B6E7AD3u, 0x67AA4170u, 0x54549E48u, 0xEBED2F96u, 0xD28CBB88u, 0x7B167030u, 0xDC57FBF9u}}},
+    {{{0xE5EF63B6u, 0xBDE38344u, 0x731B182Eu, 0x5AB4D016u, 0x3B4FC1C8u, 0xAF1B7FDAu, 0xEAD618BFu, 0x6F1825CDu}}, {{0x45C655F3u, 0x12C846CFu, 0x027F9454u, 0x3C895A64u, 0x78333455u, 0x98F4204Du, 0xD591911Bu, 0xFF097E7Du}}},
+    {{{0xFAA50E2Du, 0x39F9E5B1u, 0xF6AE4BDCu, 0xB5A275ECu, 0xA081ADD0u, 0x5B256E3Eu, 0x5B888036u, 0x5210D660u}}, {{0x5AFDA8EEu, 0xB029A893u, 0xC642686Eu, 0x5A273DCDu, 0x7FF6588Bu, 0x39C13C0Eu, 0x5DECD301u, 0x35F6674Au}}},
+    {{{0xF4A63F3Bu, 0x7B5047EDu, 0x9978F972u, 0x83203B01u, 0x5E76C765u, 0xB587115Fu, 0xF762A376u, 0xC5ECB895u}}, {{0x85005024u, 0xB53F3746u, 0x5E30BEE5u, 0x8BEB65EEu, 0xFF9233ECu, 0x74EA4058u, 0x197881F3u, 0x22252518u}}},
+  },
+  { /* 16^52 */
+    {{{0x3180EEF9u, 0x6D76A879u, 0x9A28B977u, 0x8D001220u, 0x1AA07B12u, 0x7E3ACEBBu, 0x1D22E5F0u, 0xFA50C0F6u}}, {{0x3F4F2811u, 0x38CD8D7Du, 0xA57A213Bu, 0x5E683293u, 0x2281A68Au, 0xB72CD287u, 0x2397EBA9u, 0x6B84C692u}}},
+    {{{0x187F5048u, 0x59C5BE23u, 0x448386D4u, 0xE72328D2u, 0x02E90836u, 0x780140FEu, 0x619074E0u, 0x63964EEEu}}, {{0x89309DF8u, 0x383A284Du, 0x4DDE6C84u, 0x3D580B93u, 0xC34BFBC9u, 0xA39FF9B1u, 0x6B89CF41u, 0x3B6CFB3Au}}},
+    {{{0x91DA5E12u, 0x71EE0E33u, 0x15CACB29u, 0xA9C60A40u, 0x3A1CA2B6u, 0xCDA329F9u, 0x4379E31Bu, 0xF7502E3Cu}}, {{0x8385F4EBu, 0x7A4B9C5Eu, 0xF725CEBCu, 0x7B86D32Eu, 0xC3D67204u, 0x59970945u, 0xD67CFAFDu, 0x3C57F5EDu}}},
+    {{{0xBADB2A65u, 0xF814BA1Eu, 0xD3CBDA31u, 0xAFD7F12Au, 0xF0FC9F75u, 0x2D1469DDu, 0x4D15B7E2u, 0x5A3CE25Bu}}, {{0x1D327F1Du, 0xD8B170CFu, 0xD825FE8Eu, 0x3EE28BC3u, 0xBF3F99AFu, 0x873A6DBFu, 0x92E05F63u, 0x8B34125Bu}}},
+    {{{0x10B7D105u, 0x20749331u, 0x94E57C9Fu, 0xF4CA5C4Bu, 0x4E3455B3u, 0xA3A4F662u, 0x83AE5862u, 0x12FE78F9u}}, {{0x9F794A60u, 0x458AC6FBu, 0xD6EE90B8u, 0x1DECE265u, 0x99A7CB77u, 0x786B5AA1u, 0x38D6BCF7u, 0x2062F1A3u}}},
+    {{{0x3E32478Eu, 0x23731207u, 0x2A9BA7EDu, 0x24AB318Fu, 0x3F332B20u, 0x0FEC6B7Fu, 0x01061388u, 0xD42011D6u}}, {{0xD04E88D4u, 0x1CE05681u, 0x35508CC3u, 0x6FB24B2Fu, 0x44BF847Bu, 0x1B2D5F5Fu, 0xA37D4E0Cu, 0xBAE5D4E9u}}},
+    {{{0x9E0C5D05u, 0xF621D833u, 0xAA572DAFu, 0x480E6C50u, 0x28084B1Au, 0x58C4BB10u, 0x47DF473Du, 0x76AAC313u}}, {{0x51ECE63Eu, 0x556619B7u, 0x015E6EE3u, 0x4B1225CFu, 0x3202625Fu, 0xABEF32C8u, 0x0D5C70EFu, 0xEF5576EFu}}},
+    {{{0x4A9F44D0u, 0x16A73375u, 0x69A8FA00u, 0x85DBCB6Eu, 0xF0DE41FFu, 0x6910BE34u, 0x98F93EDAu, 0x5CE605AFu}}, {{0x89D30105u, 0xC0D05F34u, 0xA32ECCC6u, 0xAB3CB1BFu, 0x31C76C58u, 0x7BA56BD0u, 0xEC226BFEu, 0x4CDDCF9Bu}}},
+    {{{0xFC53C086u, 0x9E26F485u, 0x9C9A1AECu, 0xC6B55C34u, 0x45E88104u, 0x87E60C31u, 0xBE5C5CCCu, 0xA663FE5Bu}}, {{0xA5016201u, 0xE69C5032u, 0x73994FC0u, 0x991ECCA5u, 0x89823DC3u, 0x5D1B102Cu, 0x6B211FBFu, 0xB541997Fu}}},
+    {{{0xC9F40840u, 0xAA20D691u, 0x9E55359Eu, 0xA71DF442u, 0x938A4347u, 0xFE4EAA23u, 0x121FF741u, 0xE0346D21u}}, {{0xF3D7CE72u, 0xC39A1AAFu, 0x6EBD33EDu, 0x269CD39Au, 0x7EE7BA2Au, 0xD756D4A9u, 0x3C998956u, 0x3EE68371u}}},
+    {{{0x4B758574u, 0x9AD801EDu, 0x434F9C6Eu, 0xD8326689u, 0x7AE2BDF3u, 0x5B7CA102u, 0x0206CD82u, 0xDE95527Au}}, {{0xFB67232Au, 0x4B7DF1FCu, 0x155A2DEBu, 0xBAE6A105u, 0x7F169ED7u, 0x4E21DC84u, 0xAC93D14Eu, 0x4CD3E056u}}},
+    {{{0xA16DDCD3u, 0x56A7237Bu, 0x21EA0035u, 0x044B1100u, 0xCB8761AFu, 0xF7B5BEB6u, 0xF64E99EDu, 0x1AE1AD36u}}, {{0x2E7EB2B7u, 0x7CC4619Du, 0xFCBB613Cu, 0x59616ADDu, 0x52104489u, 0x59C74F77u, 0x87A09220u, 0x70160549u}}},
+    {{{0xFD85474Fu, 0xD779B8ABu, 0x89634668u, 0x894C4A2Bu, 0x44785AEAu, 0xBFEDCCBEu, 0x66D32ADDu, 0x8DA6BCE0u}}, {{0x3D7B4EF7u, 0x5FDF9C7Du, 0x05DBDD7Au, 0x0B1CC593u, 0x071DFFF1u, 0x84FDDF5Du, 0xF31ED4FFu, 0x13FC6C6Au}}},
+    {{{0x0A9DE533u, 0x80FFFF89u, 0x02356E3Cu, 0x2A9BB567u, 0xA6471274u, 0x20E979F6u, 0x333790F9u, 0x1138AD12u}}, {{0xFD332573u, 0x6A8B7094u, 0x454A4000u, 0xF679BD0Bu, 0x9F95A7DFu, 0x86F0DC3Eu, 0x58751D94u, 0xB35525B7u}}},
+    {{{0x7DD042EAu, 0x6B5D4256u, 0x458EAFD0u, 0xEBFA26A6u, 0xE33C93BEu, 0xB1BD6649u, 0xCFB3BA39u, 0x7329ACC7u}}, {{0x2F5C94A1u, 0xADA8CFECu, 0x1DFAB4F0u, 0x18489773u, 0x4FAB68EEu, 0x89284E79u, 0x41B76F14u, 0x92724935u}}},
+  },
+  { /* 16^53 */
+    {{{0x5F067EC2u, 0x0E53D32Bu, 0xD5BBA522u, 0x1A288AB5u, 0x7D88E842u, 0xB1A5BF6Bu, 0xCA721A11u, 0xDA1D61D0u}}, {{0x1AD836F1u, 0x655FBA0Fu, 0xD279B48Au, 0x66A73899u, 0x61C91E29u, 0x79C07661u, 0x7C99306Cu, 0x8157F55Au}}},
+    {{{0x2CD3C369u, 0xB3C210D2u, 0xE1F8E934u, 0x23605483u, 0x1DC1283Au, 0xDF85D5F6u, 0x4EF4C444u, 0x9C7BE00Bu}}, {{0xA2329515u, 0x29EE3FEBu, 0x16769CBDu, 0x3E31153Au, 0x5CE40148u, 0x52A26D45u, 0x74B20D20u, 0x9220C0DEu}}},
+    {{{0xFA95A8DBu, 0x15D87732u, 0x479D36F6u, 0xB83EC0C4u, 0x991B1723u, 0x19E96646u, 0x6303DD04u, 0xE3E90DA4u}}, {{0x1B0D1CF9u, 0x1016CF7Fu, 0xCC984D3Du, 0xFBB1EF97u, 0xC702E76Au, 0xB00FAA90u, 0x056C178Bu, 0xFBE53BC0u}}},
+    {{{0x7BB8C9E3u, 0x76BCD92Du, 0x0541178Eu, 0x74DD06A7u, 0x38CCC491u, 0xB55664B2u, 0x2825263Bu, 0x0FCD83F4u}}, {{0xDF4AA9ADu, 0xE86D55FBu, 0xF1627BF4u, 0xADBEAECDu, 0xE5FDB683u, 0xD1D8232Du, 0xEAC5FBCEu, 0x6C0BC1CFu}}},
+    {{{0x112EE214u, 0x17AAFD64u, 0x95931540u, 0x782A4E97u, 0xD5C0C01Cu, 0xA8B650DFu, 0x32E3D775u, 0x9F4FFEC7u}}, {{0x5085F37Au, 0x3EF44222u, 0x0BC88028u, 0x9719B693u, 0xFD75C69Du, 0x60E96682u, 0x318E2F2Eu, 0x639CE2E1u}}},
+    {{{0x541D0CE6u, 0xF4FC3DCBu, 0xCF598D41u, 0x748992A2u, 0x33A05FB2u, 0x2EE14CCEu, 0x37F1A941u, 0x14295A29u}}, {{0xD738BB86u, 0x52A81A8Au, 0x1B5D241Au, 0x31089560u, 0x844083B1u, 0x1B031C44u, 0xDF115071u, 0xFEA75363u}}},
+    {{{0x1F61A0A5u, 0xF8B68145u, 0xB3C14E3Eu, 0x4B1253E1u, 0x1F440B2Cu, 0xB171A0A4u, 0x41134AC1u, 0x431F622Du}}, {{0x78CEF899u, 0x46B7B7FEu, 0x35565772u, 0x41BAAA04u, 0x9723AA72u, 0x6D6DE651u, 0xE7AA438Fu, 0xA298327Fu}}},
+    {{{0xB26B64F1u, 0x5CF39944u, 0xF5476D99u, 0xB7EDCF28u, 0x2511E59Du, 0xD4CDA4C6u, 0x1B58F010u, 0x7175407Fu}}, {{0xB24234D5u, 0x426E7EFAu, 0x74471D2Au, 0xB01FE8B7u, 0x134CC86Eu, 0xF36D3401u, 0x44E3D550u, 0x43B45543u}}},
+    {{{0x67748503u, 0xCAC267D5u, 0x731328E7u, 0x0E6E0E47u, 0x9F8A12ACu, 0x6CB62EF3u, 0xECE78FB8u, 0x993DBADDu}}, {{0x7EB0CEE2u, 0x9BA73613u, 0x9B8ADAA4u, 0x17F87BF6u, 0x87A1F51Au, 0x785F7847u, 0x8569EEEBu, 0xA521A9EEu}}},
+    {{{0x97421E21u, 0xE464DBA9u, 0x3CEFE2F4u, 0x3ACA86A2u, 0x2418CFACu, 0xBA828921u, 0x84E51772u, 0x0C20E86Bu}}, {{0xA1AA6A45u, 0xDFC83D64u, 0x5BD09349u, 0x86EE76F6u, 0x1E19A5B7u, 0x1A1237A1u, 0x76D0ADACu, 0xF561E9BFu}}},
+    {{{0xA6D23D80u, 0x8DEA2275u, 0x26474D47u, 0xE10BD11Fu, 0xB90962C0u, 0xA339431Cu, 0x06AD5EA5u, 0x75F17ABAu}}, {{0x280DD57Eu, 0x986A85B0u, 0xBB4EA590u, 0x372FFBEDu, 0xF19B6292u, 0xC7FC7D0Bu, 0x15639A80u, 0xA07A62FEu}}},
+    {{{0x4B344F7Fu, 0xC718CF9Cu, 0x48CE60C4u, 0xEE8B89FDu, 0xBD26D410u, 0x0E97E32Cu, 0xD972E0AEu, 0x354CC84Bu}}, {{0xA5DB82D6u, 0x7E4B11AEu, 0x8602E0ECu, 0x8E36C601u, 0xF9BA8855u, 0x6750B493u, 0x291C6B5Du, 0x9C04BF29u}}},
+    {{{0x61AD3413u, 0xAE2B9B6Du, 0x0327D684u, 0x8DB9C004u, 0x5CB87B7Au, 0xA6E95F48u, 0x11D9F4A0u, 0x6678555Eu}}, {{0x7EBCA672u, 0x12481020u, 0x3ADC6660u, 0xA6CE2D15u, 0x27CBDF9Eu, 0x925266D9u, 0xE278F646u, 0x510DDA3Du}}},
+    {{{0x3502B4B1u, 0x7487B5F8u, 0xD6C08A44u, 0xC4AF2554u, 0x262213A9u, 0x40486C0Fu, 0xDA0F9428u, 0xACEF1418u}}, {{0x66E85BFCu, 0x6F81FA79u, 0xADF1878Cu, 0x2A3F6290u, 0x3D8971CDu, 0xE04017B5u, 0xD7E87A4Du, 0xC4D3559Fu}}},
+    {{{0x06CC8563u, 0xAC00AF5Bu, 0xFFE101EAu, 0x9224DF5Bu, 0x81963688u, 0xADAC82BDu, 0x2CDA7748u, 0xEBDC4A36u}}, {{0xA394CCFAu, 0x49B17BCEu, 0x49204F92u, 0xBEC40792u, 0x6CDD4F07u, 0x9B1EE35Eu, 0xE856D35Fu, 0x659A3144u}}},
+  },
+  { /* 16^54 */
+    {{{0x0D064E13u, 0x2A73B061u, 0x446F1E06u, 0x15311DE0u, 0xE8FD4166u, 0x7215FF98u, 0x0C970690u, 0xA8E282FFu}}, {{0x11F4CC0Cu, 0xCEF7C731u, 0x50DD6BD6u, 0x8B679A3Eu, 0x5B251588u, 0xABFB7F3Cu, 0x8DB81C09u, 0x7F97355Bu}}},
+    {{{0x7F7653A1u, 0xC15EB9EAu, 0x753D67C1u, 0xEFBE9EAAu, 0x5EA66E63u, 0xCB876F80u, 0xE27FAECBu, 0xCAC6F2E7u}}, {{0xFEC5E556u, 0x68C10AD0u, 0x688103A0u, 0x81E83AE5u, 0xA42A3450u, 0x4CDB65D9u, 0xE2AA6F19u, 0xF7D416E5u}}},
+    {{{0xBA3979B5u, 0x22A199B0u, 0xE67E829Eu, 0xBA288F8Du, 0x1EE40E50u, 0x27F37F0Bu, 0xCDADE263u, 0xAE2207C5u}}, {{0x8450FA6Fu, 0x68F3CD66u, 0x37D4F889u, 0xFCA87B7Du, 0x23AD7060u, 0xAD4C9245u, 0x0C079F71u, 0xEA91FE51u}}},
+    {{{0x8624003Du, 0xCC9F4AB0u, 0x4238CB11u, 0x4AB76729u, 0xE58E4325u, 0xEFBC5932u, 0xEE37D206u, 0xE6DFDE46u}}, {{0x2216B93Bu, 0x7548650Eu, 0x527FD7DDu, 0x3B1CE5EAu, 0xB88F9220u, 0x8F2F48F7u, 0xBE913949u, 0x8727B3B7u}}},
+    {{{0x0EFCA824u, 0xE4101910u, 0xEA2164FAu, 0xE0BE0C4Fu, 0x06585461u, 0x9CEC5410u, 0xAD72ACE5u, 0xCB8DED0Cu}}, {{0x8F227361u, 0xF140BD05u, 0xC7931742u, 0x96AD1FDFu, 0x7A2CCBC4u, 0x5B316C48u, 0x740D88C8u, 0x33A5008Fu}}},
+    {{{0xECE4DD6Au, 0x559E11E1u, 0xA3221CEFu, 0x0A00E49Cu, 0xE8D64C46u, 0xBC9ECA37u, 0xB2792B64u, 0x49DBE4F7u}}, {{0x2A9E3EAEu, 0xB13B72A4u, 0xCA05BB69u, 0x1C38552Fu, 0xB692255Au, 0x2C5FE33Du, 0x470481C7u, 0xB8B57298u}}},
+    {{{0x3BCBD327u, 0x9411B4DAu, 0x21E4AAEEu, 0xB04E0852u, 0xD7E76ED6u, 0x08E94900u, 0x8AF18367u, 0xB0C53B29u}}, {{0x2D7BE436u, 0x1616BC4Au, 0x74636A0Fu, 0xD82A220Cu, 0x1B66B2AFu, 0x638F6A60u, 0x1FBD7EA1u, 0xEE2A9740u}}},
+    {{{0x48DCE109u, 0xB0E11035u, 0x9CF211D3u, 0xE250E314u, 0x7AC96082u, 0x66A40CFCu, 0xD9A6823Du, 0x3C4E089Cu}}, {{0x3A19AEEAu, 0xE2BF6592u, 0xD97FE697u, 0x9579E142u, 0x15764D37u, 0x80757BCAu, 0x9FE191B4u, 0x43FBBE66u}}},
+    {{{0x97B836A1u, 0xDE6EFB63u, 0xF7679EF7u, 0xC806405Fu, 0xCE77F526u, 0xD4D8862Eu, 0x329DB920u, 0x6F6BA73Fu}}, {{0x06832B84u, 0x4DBDF2FBu, 0x88E1FF93u, 0xD8990C52u, 0x05BEE9C0u, 0x3DB0B8A4u, 0xFF5FC18Eu, 0xDC778A17u}}},
+    {{{0x825D5241u, 0x68056B7Fu, 0x920BD2F6u, 0x563ED7CAu, 0x40B3EA8Au, 0x534277D3u, 0xA779674Eu, 0xF8CC1DADu}}, {{0xF070E10Au, 0x960AF038u, 0x61EB0BD4u, 0x52C2D76Cu, 0xA5166F04u, 0xB33E892Fu, 0x10B170FEu, 0x13DE4E44u}}},
+    {{{0x9EB39EDEu, 0x2AEE3420u, 0xD70612D4u, 0x31088032u, 0xE1024360u, 0xBBCFF467u, 0xC7422AF4u, 0x7D471A7Du}}, {{0xABF6607Eu, 0x0C9BCD94u, 0x1C22A8FDu, 0x7795CF7Du, 0xEFFC86FAu, 0x07B82231u, 0xF3A68565u, 0x004A7B19u}}},
+    {{{0xF4E5F03Au, 0x4FE8B5BDu, 0x1E1606D5u, 0x96565FEBu, 0x3D7DFE35u, 0x737DCFB3u, 0x0289BE33u, 0x80C34FDDu}}, {{0xFE3CA504u, 0x117F4546u, 0x1F3245CBu, 0xD30B2AEFu, 0x07DC9A03u, 0x55EDB570u, 0xA78C1ECDu, 0x247E0856u}}},
+    {{{0x565EB1C1u, 0xA56D49E2u, 0xCDAE5C5Au, 0x7FCD7567u, 0x1982F096u, 0x7070FCC3u, 0xF9B73FACu, 0xF0025163u}}, {{0x6DDE2AE0u, 0x7DA7D704u, 0xD6CD11E5u, 0x8576FF5Cu, 0xDA26AFEDu, 0x4C66B4A5u, 0x883D20DFu, 0x054EA9E8u}}},
+    {{{0xCA14F422u, 0xA610A061u, 0x9E4C4DECu, 0xB383E4EDu, 0x14DBC7BCu, 0x4AFE8022u, 0x97A9DF3Du, 0x6CED1AE8u}}, {{0xD84FC091u, 0xAE73DA43u, 0x79A9C932u, 0x8CA102C8u, 0x8BE6B9B8u, 0xBB495A72u, 0x1B0F8E7Au, 0x25888AEBu}}},
+    {{{0xDAC32C64u, 0x4CF35093u, 0xECAE4BF8u, 0x0E36FE03u, 0x0F47715Eu, 0x0F704E95u, 0x01ED23AAu, 0xAC121400u}}, {{0xDEB1A867u, 0x8812ADBAu, 0x5A53F089u, 0xED5A5D3Au, 0x730499A3u, 0x1870B695u, 0xAC338BAFu, 0xCE8EBCCBu}}},
+  },
+  { /* 16^55 */
+    {{{0x8319497Cu, 0x22F382DEu, 0x512508C0u, 0x5D59B1FAu, 0x6913CAB1u, 0x2D39E56Eu, 0xC9A28587u, 0x174A53B9u}}, {{0x079AFA73u, 0x83DA13ACu, 0x8CB98543u, 0x646B3A1Du, 0x2C47F9E6u, 0x57B4155Fu, 0xABFC9C16u, 0xCCC9DC37u}}},
+    {{{0x840DD273u, 0x5F5DA36Fu, 0x0E450111u, 0xD53D280Eu, 0xF1B92EA3u, 0x30C7071Eu, 0x96946BB6u, 0x20E6E2E7u}}, {{0xBB46B593u, 0xC07CFD15u, 0x3DA8693Cu, 0x811EC979u, 0x97874655u, 0x4A0BA1ADu, 0x4F1559E4u, 0xD3AD7AFEu}}},
+    {{{0x754B8367u, 0xE948073Du, 0x67D506BFu, 0xB775B77Du, 0x58436A5Du, 0x40CAA5D4u, 0xE446526Eu, 0x5E5A094Au}}, {{0x91CE85CAu, 0x45329A9Du, 0x3DE5FFA4u, 0x796AA9EFu, 0x572A4B7Au, 0xC2C901F1u, 0xA4795E05u, 0xAE8AF8C9u}}},
+    {{{0x1A077674u, 0xE7B54F30u, 0x6CC24CA3u, 0x35AE6813u, 0x7E71DB70u, 0xA80280A0u, 0xD7A351DBu, 0x8E0CA824u}}, {{0x12B7ED98u, 0x0B84CBECu, 0xD2F91029u, 0xCFF60419u, 0xDA62CF57u, 0xDC569D24u, 0x59192D41u, 0x04EC5607u}}},
+    {{{0x97B10D9Du, 0xF1985793u, 0x9D1F8FCAu, 0xE6A52F18u, 0x310CB82Du, 0x9DECCB83u, 0xB9702E85u, 0x00D4E0ADu}}, {{0x7140DCEDu, 0xE8210048u, 0x78E2D923u, 0x0B5898C9u, 0x432287F7u, 0x47D2F846u, 0x18376409u, 0x87B80198u}}},
+    {{{0x0CBCAD59u, 0x7B05E836u, 0xA4E0AAA0u, 0x7C845A05u, 0xA5F902F1u, 0x7AA17C85u, 0x52AC3600u, 0x2ED76C11u}}, {{0xC4EA66FEu, 0x14AC7A89u, 0x30A7F941u, 0x5F72C601u, 0xC81767EDu, 0x2CDA6EAEu, 0x43B85F22u, 0x639F4D40u}}},
+    {{{0x9C9CAEE8u, 0x20811A60u, 0xB1A270BBu, 0x632E2045u, 0xEEC4A667u, 0xF6F7A19Au, 0x68EF74C0u, 0x03665213u}}, {{0xB772B711u, 0x0A9EC6A3u, 0x3295BA7Fu, 0x01CBA989u, 0x1BA69445u, 0x9949FC68u, 0x2A93DED9u, 0x1F18C32Bu}}},
+    {{{0xA8192441u, 0xE96AFC5Eu, 0xA321B4AFu, 0xAFDB5821u, 0x3E3D66C1u, 0xC5FA6355u, 0x51C982D1u, 0xF7BB50DAu}}, {{0xD45165AEu, 0xBC640EA1u, 0xBBC4C74Bu, 0xB1CFDC1Fu, 0xDDE6485Du, 0x311BC63Bu, 0x0334A526u, 0x93CC3BE3u}}},
+    {{{0x9446C85Cu, 0x53FF9751u, 0xE601C063u, 0xDE37DE08u, 0x53F6C6EAu, 0xAA0676C4u, 0x6FDB8F1Fu, 0x0E589105u}}, {{0x2148972Eu, 0x5F6C77E7u, 0x80CDDADDu, 0xF490234Eu, 0xAF481898u, 0x0EC7418Bu, 0x11FA7BDAu, 0xE39A485Fu}}},
+    {{{0x055AE087u, 0xE0349010u, 0xA3494A57u, 0xC671B96Fu, 0x743A1510u, 0x2D3945FBu, 0x5B6EA598u, 0xA3466715u}}, {{0x22887627u, 0xCB3F3663u, 0x2394F0BCu, 0xC53EAB6Fu, 0xAA2A3051u, 0x8DEFE9A1u, 0xE56BC5BDu, 0x21CA5FA5u}}},
+    {{{0xC22E1259u, 0xFF18ADF3u, 0x0681362Au, 0x931739A4u, 0xA0077771u, 0x2B6CF5FAu, 0x26F1463Fu, 0xA740126Du}}, {{0x334A5F43u, 0x5F771724u, 0x3B1D6DADu, 0x17865E75u, 0xA67C7EE5u, 0x1B05F174u, 0xF194F1FFu, 0x05A9FFBAu}}},
+    {{{0xE4B84B48u, 0x830F4571u, 0x99E817EAu, 0x91ADF4C7u, 0x7D417F70u, 0x41910F57u, 0x7D45A4F5u, 0x5FB1DF0Eu}}, {{0x37BE8EB8u, 0x77EDEA6Au, 0x873F21ADu, 0x0629C390u, 0xFE6D2582u, 0xFBCF4646u, 0xBC3C4D49u, 0x2152FBBCu}}},
+    {{{0xCB08F1FEu, 0xD88A17A3u, 0x0BA087BFu, 0xD7CE7EE7u, 0x5D82D177u, 0xA6540576u, 0x6D9474E4u, 0x87E4B821u}}, {{0xAED5E2ECu, 0x75F74AC9u, 0xD6786D9Du, 0x6E2F23DBu, 0xA2F8C2CCu, 0xCD7D7F8Eu, 0x766348CEu, 0xF74E3AC0u}}},
+    {{{0xF9B8F255u, 0x1146D987u, 0x492A0D21u, 0xE77D43E7u, 0x8AA82FE9u, 0x1622E460u, 0x78E1B8A4u, 0x95BBD974u}}, {{0x28361439u, 0x010E3FE8u, 0xFC777FC1u, 0xF2BA72AEu, 0xF0F2D0D8u, 0xDEF2C208u, 0x29E3C77Fu, 0xBED43AD1u}}},
+    {{{0xA1C4D15Cu, 0x9A8700E6u, 0x07C0E74Bu, 0x105EA7BFu, 0xC1254A44u, 0xA92C22C0u, 0x3FEA79A5u, 0x35EA1B46u}}, {{0x7F3FE1EAu, 0xDC939BAFu, 0x3065095Eu, 0x5D633AA0u, 0xD74D3B18u, 0x7888FA5Fu, 0x1B9ED2CDu, 0xAD219165u}}},
+  },
+  { /* 16^56 */
+    {{{0x9475B7BAu, 0x884FDFF0u, 0xE4918B3Du, 0xE039E730u, 0xF5018CDBu, 0x3D3E57EDu, 0x1943785Cu, 0x95939698u}}, {{0x7524F2FDu, 0xE9B8ABF8u, 0xC8709385u, 0x9C653F64u, 0x4B9CD684u, 0x8BA0386Au, 0x88C331DDu, 0x2E7E5528u}}},
+    {{{0x0BC8F53Bu, 0x07275A94u, 0x391747C7u, 0xD702226Bu, 0xDD73D95Eu, 0xAFE32CA7u, 0xFF0DA7DEu, 0xCBEE1405u}}, {{0x78C87F45u, 0x2922E6B2u, 0x8126F728u, 0x0D9FF4F6u, 0x9B8294CFu, 0xB51F3E68u, 0x4E75F902u, 0xF6211F4Fu}}},
+    {{{0x0FD69985u, 0xA09C5DD9u, 0x6DDF72AEu, 0x9F309CCBu, 0xFBCCCF14u, 0x788F690Du, 0xCEB72F7Eu, 0x0AE97675u}}, {{0x1409A003u, 0x89C8EB41u, 0x7AEE1AFFu, 0xD0B99D41u, 0x051A54C5u, 0xE9B8DFEEu, 0xF6E48D14u, 0x91219973u}}},
+    {{{0x14B311DDu, 0xF377C88Bu, 0xFBD71B9Cu, 0x3DE3BEAEu, 0x0BA252E0u, 0xDD580BFAu, 0x8FAAF5ACu, 0xADD5BAD2u}}, {{0x49D6C38Du, 0x02F982F3u, 0x669B9B89u, 0x52D4E1E7u, 0x8359814Fu, 0x974E434Fu, 0xDA3DC3A5u, 0xE9C43CF4u}}},
+    {{{0xD9262B90u, 0x9DC193DFu, 0xFE3CC29Au, 0xB723C4C1u, 0x78025D1Fu, 0xC9B65F17u, 0x5AC1612Eu, 0x2B15862Au}}, {{0x483D7557u, 0x991996E6u, 0xF99489A4u, 0x6F534970u, 0xDA874906u, 0xA7A30D52u, 0xAA0A33FAu, 0x2EB0053Du}}},
+    {{{0x6078AFB0u, 0x4E75AE79u, 0xC4126197u, 0x14FF12C6u, 0xC66D1707u, 0x248D4468u, 0x766163B5u, 0x209D6BCDu}}, {{0xA740B310u, 0x85D1B775u, 0x39F4E3E3u, 0x01EDB793u, 0xA9898A5Bu, 0xA0965BABu, 0x9E7B3280u, 0x1A2F1342u}}},
+    {{{0xA8E7BE40u, 0x93F9714Cu, 0x91040EE5u, 0xF2D2C894u, 0x16E4769Au, 0x7EE95C16u, 0x1A96EE67u, 0x6AF9EAEDu}}, {{0x6E387E1Cu, 0xFA416E02u, 0xA0F59569u, 0x45E3F666u, 0x8347DC81u, 0x6709EA42u, 0x69006649u, 0xB3812A11u}}},
+    {{{0x0D7C0979u, 0xF5F6400Au, 0xBC5A8C96u, 0x4A29B314u, 0xFF41CED2u, 0x3FA9DF3Du, 0xA8171714u, 0x53F2432Bu}}, {{0x537B36A2u, 0xF9F7E90Cu, 0xC9E8B845u, 0x4BD5A4F5u, 0x911B07DEu, 0xCCD4E3E0u, 0xC1F079B7u, 0xBD52EFFBu}}},
+    {{{0xF482801Eu, 0xD26B6FA0u, 0xC5BD4155u, 0x40794F8Bu, 0x4CB8D6F9u, 0xEB3AAB42u, 0x0444144Eu, 0x596668EEu}}, {{0x04870C37u, 0xD477148Fu, 0x63D3535Au, 0x8DB6C1CBu, 0x8771304Eu, 0x1EC8F960u, 0x5BBAEF5Fu, 0x949AA0A8u}}},
+    {{{0x88977063u, 0xEF4040A5u, 0xFB130C4Fu, 0x65BF6F8Bu, 0x867E0FDBu, 0x61D50F83u, 0x047F9A6Fu, 0xA762E69Eu}}, {{0x294F6EF1u, 0xA06369F8u, 0x96DFCE62u, 0x958B48A3u, 0x93372A89u, 0x81A1732Du, 0xCBED1157u, 0x6B98DD57u}}},
+    {{{0xC32C19FDu, 0xE4C9B2E7u, 0x058028C3u, 0x4ACAB8E9u, 0xAB570B5Bu, 0x2FDF4D17u, 0x1B505076u, 0xBE84D188u}}, {{0x72F1281Fu, 0x67694A53u, 0x5E50DC37u, 0x7955A7F5u, 0x83083994u, 0x4D1E65F4u, 0x32DC5094u, 0xEFF960CBu}}},
+    {{{0xDF55A9BFu, 0xEBCB0298u, 0x29EA5BF8u, 0xF6B015EFu, 0x01D7C578u, 0x810307F6u, 0x9C6E3181u, 0x726298EBu}}, {{0xBC3ACCAEu, 0xE116F8B0u, 0xC00673B4u, 0xBE797BCBu, 0xF3D099E0u, 0xA9835A2Eu, 0xA9DE9BFDu, 0x38D48801u}}},
+    {{{0x56C69482u, 0xBD1B75FDu, 0x132FA167u, 0xCBEAB540u, 0xCAF2BC88u, 0x41F57274u, 0x4C0D7EE5u, 0x9867A031u}}, {{0x6F792CD7u, 0x16F06114u, 0x515628A9u, 0x9E6245CFu, 0xB1BA9963u, 0x9C792D55u, 0x3B10834Fu, 0xD02E615Au}}},
+    {{{0x41A7E7D2u, 0x9957F2D8u, 0x3EFABD85u, 0xA4C90E8Cu, 0x5946DE47u, 0x693AF755u, 0x1339E48Au, 0xB934130Fu}}, {{0x98653D39u, 0xA4A991A8u, 0xE70DCC41u, 0xFFD381DBu, 0xFBF78D1Fu, 0xAA0929A5u, 0x9B2D0576u, 0x95233F6Bu}}},
+    {{{0x1D557AA1u, 0x78A239D9u, 0xCD01FC29u, 0xDF1D92FEu, 0x0099D6ABu, 0x5927F2EAu, 0x40D8815Au, 0xA866F245u}}, {{0xC1430634u, 0x7981BBB4u, 0x7C611A4Bu, 0x61EB69C6u, 0x5DB0E139u, 0xD793D8FAu, 0xA8022B44u, 0xB58739F6u}}},
+  },
+  { /* 16^57 */
+    {{{0x9D82B151u, 0xBB51340Cu, 0x561FBA2Du, 0xCCA0A43Du, 0x3B109A8Fu, 0xD645A115u, 0xAE401E56u, 0xD2A63A50u}}, {{0xDCF89405u, 0xD4142174u, 0xF484CA52u, 0xA70F750Au, 0xB2948220u, 0x565AEE58u, 0x6443FCB7u, 0xE82D86FBu}}},
+    {{{0xCA72DA5Fu, 0x7C6C4BACu, 0x36C41349u, 0x22B9CD6Bu, 0x033725F9u, 0x23BC7202u, 0x6100525Eu, 0xBAF183A7u}}, {{0xA8F2A0CFu, 0x377CE628u, 0xCA739361u, 0x8E2336C5u, 0xDD69B1D1u, 0x5688BD58u, 0x9CCB4D33u, 0xDEAC9FBEu}}},
+    {{{0xEE4B3BA0u, 0x7859F635u, 0xF18BF1F1u, 0x5C2ABEF5u, 0x31BF245Fu, 0xBEFE170Fu, 0x221FFB73u, 0x41081105u}}, {{0x17525595u, 0x486961DCu, 0x65A06455u, 0x13364985u, 0x1D6B8498u, 0xF2CA65AEu, 0x76FF5668u, 0xDC37F369u}}},
+    {{{0xC56C3943u, 0xFA5ACA58u, 0x56B76A5Fu, 0x5ADBD02Du, 0x6E48F6FDu, 0x8F933290u, 0xE3844023u, 0xF7AEF8A7u}}, {{0xACF442F1u, 0x431F627Fu, 0xA8DCD003u, 0xEEC30184u, 0xC3AB3FCFu, 0x7C442BBDu, 0xD5FFDA79u, 0x4E3B0B44u}}},
+    {{{0x93D98DEDu, 0x4629C9B8u, 0x3B8A0218u, 0xDBDF2283u, 0x0531D65Eu, 0xC8CF2299u, 0xA16CC0C8u, 0x63A2A210u}}, {{0xE0D1CFC2u, 0x519197D4u, 0x09C7873Au, 0x1FABF6A0u, 0x54ED9446u, 0xD0650332u, 0xE7FEC76Fu, 0x882B42E2u}}},
+    {{{0x000E5485u, 0x2089E66Au, 0xF5DA5DF0u, 0x4513068Bu, 0x27320F12u, 0x8E2C7086u, 0x93A2BDFFu, 0x1CD276D7u}}, {{0x885FBD7Fu, 0xCA5CF051u, 0xB209A4ECu, 0x99D0E270u, 0x552E977Fu, 0x8D4B34D4u, 0x8B2EAF73u, 0x6615BDD1u}}},
+    {{{0xB8045445u, 0xEA861A50u, 0x901E8D7Eu, 0x80FF7371u, 0x5D57BEF0u, 0x3DF12E2Eu, 0x449D67CAu, 0x0C15815Du}}, {{0x4054A206u, 0x214F87D5u, 0x3658CEA3u, 0xBA3054E4u, 0x6663CD28u, 0xD0A93C3Bu, 0x3AE94115u, 0x2F30D60Au}}},
+    {{{0x11924459u, 0x1FAC9457u, 0xA3C7A78Cu, 0x7AF2FA25u, 0x0DDDBB1Fu, 0xC5A2E29Fu, 0x10019036u, 0xDFB547CBu}}, {{0xCC65FD9Eu, 0xFA205E0Du, 0xE5C031DCu, 0x22AF0930u, 0x9DC864CCu, 0x8B8389CEu, 0xBA0F4708u, 0x9ACCD2A9u}}},
+    {{{0xC3857FAFu, 0x1E91239Cu, 0x1E961970u, 0x882FCADEu, 0x4828EF7Fu, 0x0D57BA8Fu, 0x89AE8A9Cu, 0xC757EB6Bu}}, {{0xA0584CA4u, 0x01D9DB0Cu, 0x101894C1u, 0x627D310Du, 0x08BEC61Bu, 0x257369F2u, 0xCD23FF36u, 0xF03A59CFu}}},
+    {{{0x8EF8B517u, 0x9A8BB351u, 0x47171BACu, 0x77C2771Au, 0x4A115E25u, 0x95DBC806u, 0xCCC4DB24u, 0x712022F7u}}, {{0x249DA1ACu, 0x48B7DF28u, 0x3BD79D77u, 0xA3603EDFu, 0xB0947541u, 0xAE7101F9u, 0xDE4DE928u, 0xBD578338u}}},
+    {{{0x5459225Du, 0x0E4D184Fu, 0x2D8858D1u, 0x44FAF77Eu, 0x919C02A2u, 0xF815D409u, 0xADAFA0D0u, 0xFA8063AEu}}, {{0x7ECE1507u, 0x3A2B7E3Bu, 0xD007C59Cu, 0x0A2B6C36u, 0x824C425Cu, 0x160DE220u, 0x57C0C069u, 0x0BA71F90u}}},
+    {{{0xA90BC03Eu, 0x3C753D59u, 0x51E015E3u, 0x84B0F393u, 0x74450F80u, 0x9E5A925Fu, 0x2C82072Eu, 0x2CEED8EDu}}, {{0x7AB82ADCu, 0x1CB72B8Bu, 0x20D53CD0u, 0x4A1DF9CFu, 0xAFC7DAEBu, 0xCD850EB7u, 0xE9B9DE3Eu, 0xA4276B80u}}},
+    {{{0x16F0D044u, 0x9679FE94u, 0x909E61A7u, 0xAABA9FD4u, 0x862EE0A5u, 0x9E2F69CFu, 0x9D0257A8u, 0x658CA3C5u}}, {{0xF7CB872Du, 0xADD1F32Eu, 0xC418CE89u, 0x55A16763u, 0x713BD376u, 0x0F165D62u, 0x7AEA2546u, 0xAE5CC137u}}},
+    {{{0x42AA2494u, 0x50CD4E31u, 0x7DD10C9Au, 0x7BDCDDFEu, 0xC4EBBC82u, 0xDD1136E7u, 0x4539E8ECu, 0x379C749Au}}, {{0xCEC86C63u, 0x5BEFA9E8u, 0xB7E85643u, 0x1364F6A7u, 0xD6783F11u, 0x3C9C0EF1u, 0x8BF9C031u, 0xA2546384u}}},
+    {{{0x3696756Du, 0xAB5AC957u, 0x56561417u, 0x676AF160u, 0x5D3F305Cu, 0xCE4C1983u, 0xAF91F2BAu, 0x31C94B4Au}}, {{0xDE08AE78u, 0xABC45E8Du, 0xE6AD1070u, 0x83AEDFCAu, 0xAAF41606u, 0xBF4B8B59u, 0x556E83A9u, 0xF80F884Bu}}},
+  },
+  { /* 16^58 */
+    {{{0x5617E073u, 0x3436F9B4u, 0x3839317Bu, 0x6BACBDBDu, 0xD7CFDC86u, 0x90EE7896u, 0x35471EB8u, 0x64587E23u}}, {{0x9FAF6589u, 0x58299E5Eu, 0x133AEAB3u, 0x85B90A39u, 0x47C299A1u, 0xAE96DD64u, 0xBF6902E2u, 0xD99FCDD5u}}},
+    {{{0x4384480Du, 0x44BCD88Cu, 0x2A91F2EFu, 0x94E0B6A2u, 0xC92F0C12u, 0x2CF28B54u, 0x42DF940Fu, 0xB866D6B1u}}, {{0x0C4CAFA8u, 0x0E659B47u, 0x4B1D86D6u, 0x24E52280u, 0xEA9AD7ACu, 0x89A278D7u, 0x426AEB70u, 0x1914B0B3u}}},
+    {{{0x0E103DD6u, 0xADF71472u, 0x7C004859u, 0xC34604C0u, 0xC592A17Au, 0x36A213CFu, 0x5A4203F8u, 0xBC477BD5u}}, {{0xD6F7C343u, 0x639082D8u, 0xC63B44ACu, 0x5D293572u, 0xC6DEA639u, 0x6CBAC552u, 0x29A8DD52u, 0xE31E1E24u}}},
+    {{{0x1DB20D6Cu, 0xD229CDA8u, 0xED4FE455u, 0xE2D52AE4u, 0x6102BA87u, 0xC4D9D164u, 0x85DE819Eu, 0xEC2BB890u}}, {{0x629CF4A0u, 0xA0E99C4Du, 0xE87EFA98u, 0x33A2364Bu, 0x650940C6u, 0x332F66F0u, 0x61E013A1u, 0xCCECC176u}}},
+    {{{0xD44EAB31u, 0x7D0DC3B0u, 0x04E63490u, 0x0AC5AF14u, 0x267BF8E8u, 0x0303B423u, 0x5A6BB838u, 0x589DB4FEu}}, {{0x51361F6Au, 0x941AEBE7u, 0x2148F8DBu, 0x1F610E55u, 0x24BD90F3u, 0xF6070620u, 0x108AA2A4u, 0x6255445Cu}}},
+    {{{0x36695F94u, 0x92D80B18u, 0x91627FA5u, 0x62A169C6u, 0x3AF9A9CFu, 0xD0CCB868u, 0xB4558F5Fu, 0xB1D25D51u}}, {{0x5EE32736u, 0xA5B7EB9Au, 0xAB863EDCu, 0x60F6F18Du, 0x19ABA817u, 0xF7BEA0ACu, 0x030E90B1u, 0x706DDA72u}}},
+    {{{0x9A0C2C41u, 0x7BF96172u, 0x560336C6u, 0x42831C1Cu, 0xAD6EDB7Cu, 0xEA8A1860u, 0xD16E2FA2u, 0x1339B337u}}, {{0xA9F1BC2Bu, 0x185F054Bu, 0x7DE923A4u, 0x6B1227F8u, 0xD113A340u, 0xA7A3240Fu, 0x62C7AE5Bu, 0x9F9B2963u}}},
+    {{{0x23B09D0Fu, 0x38A60ECBu, 0x0F50BECFu, 0xE5005064u, 0x5E545905u, 0xD39D75EFu, 0x89E296CEu, 0x71C4A7E3u}}, {{0x720DDB62u, 0x637B1F01u, 0x4A62FFC7u, 0x786F2B08u, 0x92F810AAu, 0x0AF3E0A2u, 0x737AF3BAu, 0x1313FADBu}}},
+    {{{0x58FC47AFu, 0x3704B1F8u, 0x32C0CDECu, 0xA8DDFEC8u, 0x5001B568u, 0xCC50329Bu, 0x1363CF17u, 0x7FF3BBA1u}}, {{0xF9BA43A7u, 0x7F86164Cu, 0xD18BAC29u, 0x17A53B1Au, 0x7473446Bu, 0xA0BC891Bu, 0x8018A629u, 0x1F6BA7AEu}}},
+    {{{0x9E41E20Eu, 0xD1DC4CBAu, 0x78D33864u, 0x38A87A3Du, 0x03A4D3E9u, 0xBCB0F7F0u, 0xA5114DC8u, 0xFC395DC4u}}, {{0xE7CF42EEu, 0x77AD8CC2u, 0x685E4E2Bu, 0x0221475Au, 0x8BDDB6D6u, 0x4CEB81A9u, 0x08D07D09u, 0x3866E091u}}},
+    {{{0x95213775u, 0x0184D600u, 0x23D42A99u, 0x00B4293Bu, 0x5FEC7F61u, 0x6141E939u, 0x3CEB60BBu, 0x8EC67046u}}, {{0x7841FFFFu, 0x0E010F3Eu, 0xBCCF51E9u, 0x71DA98A0u, 0x5CEDEE0Eu, 0x06E64341u, 0xA0DA5BE3u, 0x8F58A66Fu}}},
+    {{{0xB6F83231u, 0x49971018u, 0x760425E3u, 0xB7C30D8Eu, 0x65B3FDD0u, 0xA8D15827u, 0x3502BA26u, 0x850F8CC5u}}, {{0x5F2E8373u, 0x4A031A9Du, 0x7722D77Fu, 0x0A85BFA1u, 0xB82CC789u, 0xD0BF7086u, 0x02A79053u, 0xBC4A9DBEu}}},
+    {{{0x3452ABBBu, 0x3CB3FF8Du, 0xE2B95C2Eu, 0xAE6AA72Fu, 0xED95D495u, 0x89DBAC3Fu, 0x41E701BBu, 0x83DE61B4u}}, {{0x054EB66Eu, 0x8A05176Bu, 0xBBCE4291u, 0xD79C5F36u, 0x8C4E1563u, 0xA6BFB6AFu, 0xA34C609Fu, 0x32F0E334u}}},
+    {{{0xDF2E6FFAu, 0x88B11064u, 0xB7155763u, 0x46BE9F37u, 0x94750D46u, 0x1445BB6Au, 0x8F9419FBu, 0x53FE8AF9u}}, {{0x64E92EB5u, 0x2A1EB372u, 0x03BD70C2u, 0x5FB5F8E6u, 0x4464DE5Cu, 0x1640CF6Cu, 0x7B515462u, 0x9328817Eu}}},
+    {{{0xF59276F1u, 0xE9688C26u, 0x92A17B15u, 0x33AE25B2u, 0x0F7CD868u, 0x1A8BB5C0u, 0x8F50C1DBu, 0x3D766389u}}, {{0x859CBCB3u, 0x01E4A65Bu, 0x19B19786u, 0xF3219820u, 0xDAD8333Eu, 0x60976E34u, 0x7A187DDBu, 0xD3766973u}}},
+  },
+  { /* 16^59 */
+    {{{0xDD45E458u, 0x358D6C86u, 0xA250E7FDu, 0x2F0AA6CEu, 0xE549DE04u, 0xB3A546D3u, 0xE4E4D885u, 0x8481BDE0u}}, {{0x9779057Eu, 0x6D64B1B5u, 0x2B262E55u, 0x900A79C4u, 0x9CECB2CAu, 0x84A25BF3u, 0xBA5404DDu, 0x38EE7B8Cu}}},
+    {{{0x6CE9F114u, 0xE5443352u, 0x299561DDu, 0x392ED605u, 0xD1D492BFu, 0x9FD43C6Cu, 0xBD383A8Bu, 0x9629A450u}}, {{0xA24AA391u, 0xCA3972C4u, 0x5C56AF8Du, 0xB925593Eu, 0x20CEF64Du, 0x576BEFD2u, 0x0C5FB6D7u, 0xBF439B28u}}},
+    {{{0x152DA17Du, 0x160A0FA4u, 0x08D0646Bu, 0x11DC13DBu, 0x5FE00BC8u, 0x0894E6B0u, 0x0F518C5Fu, 0x3BEAED1Eu}}, {{0xECC768D2u, 0xCE704985u, 0x8DFEC416u, 0x54CDE77Bu, 0xBE80E1B5u, 0xFEF4A8BEu, 0x5AFF7ACDu, 0xC3B0D7F5u}}},
+    {{{0x26CA6CC3u, 0x83D38D96u, 0xE187E183u, 0x1477D747u, 0x7CC893DFu, 0xEB1730DAu, 0xEF1E4688u, 0xB73B1C47u}}, {{0xA54FDBA3u, 0xFAC35D76u, 0x09757F5Au, 0x7322A252u, 0xBCC80509u, 0x0A57D64Bu, 0x294922A9u, 0x584315CBu}}},
+    {{{0xBA4EDCC5u, 0x234FA17Du, 0x420311B7u, 0xE74E3221u, 0x39275997u, 0x8752DFC0u, 0xCBDC9D61u, 0x6E73DBA0u}}, {{0xD59DA0E4u, 0x7B31F7CDu, 0x70067903u, 0x278A77DAu, 0x88828693u, 0xBEA45508u, 0x49EECC48u, 0xEE0AC1FCu}}},
+    {{{0xD063E1BEu, 0xC1B9AD04u, 0xF7E39A75u, 0xA92429A2u, 0x3DBCF027u, 0x72261525u, 0x1D602B14u, 0x131641D1u}}, {{0x21FEC890u, 0xFDD1FF3Eu, 0xF9745B77u, 0xBD0FAEC0u, 0xCDBD2BEBu, 0x6A42E30Fu, 0x796039F0u, 0x4C3BDA61u}}},
+    {{{0x4A80B979u, 0x409C4C42u, 0x329ABB31u, 0x0490F5FAu, 0xAA47C310u, 0x7627D97Eu, 0x37E5B592u, 0x7706DD89u}}, {{0x4126CFDEu, 0x14CF4810u, 0xFD7EFE32u, 0x17FA0A34u, 0x91EA9C71u, 0x7778DD79u, 0x7D5BB714u, 0x8A02A982u}}},
+    {{{0xD38F93E0u, 0x9C6E2192u, 0xB676899Fu, 0xD05B2A3Bu, 0x07A2FEF7u, 0x11F98920u, 0xDB401803u, 0xEDFE16B2u}}, {{0xE29405ADu, 0x3D01793Du, 0xC46E227Eu, 0x5B3D5100u, 0x4B05D0D2u, 0x94D74FAAu, 0xFCA5DB36u, 0xEE6902F1u}}},
+    {{{0x726FE285u, 0xDCDB9C4Bu, 0x413EF127u, 0xA45BAC29u, 0x41F9E06Au, 0x0D2F3C7Au, 0x929BC0F8u, 0x16D422C5u}}, {{0xC155B441u, 0x33E0FFE6u, 0x37364D42u, 0xE93F0C11u, 0xA63531B1u, 0xA8AB7E69u, 0x51E22641u, 0x0DF888FAu}}},
+    {{{0x69E306A5u, 0x5D3132B8u, 0xC4C247F1u, 0xB8B5F624u, 0x35F2E5C6u, 0x4927129Bu, 0xF9F30C33u, 0x972CB363u}}, {{0xB6E86295u, 0xD061FD40u, 0xCCAD4F35u, 0xB85702EDu, 0x5BC65079u, 0x5F9E77FEu, 0xE2DF92AAu, 0xAE634704u}}},
+    {{{0xBACFA513u, 0xAE310BCAu, 0x9A60E3AEu, 0x4E24079Fu, 0x50F56A9Cu, 0xAA5A3447u, 0xEEC76D63u, 0x1FCC0E47u}}, {{0x107AFC9Cu, 0x75075BA4u, 0x64983918u, 0x4BEDEDD1u, 0x4339F9B4u, 0xB48E3875u, 0x41E35478u, 0x165DC1A0u}}},
+    {{{0x7C46E079u, 0xD12A0352u, 0x85E9C78Du, 0xAB66930Bu, 0xB02BA374u, 0x0FEF75ADu, 0x2ACFAC53u, 0xAB86C2ADu}}, {{0x7636FFE1u, 0xEC428BC1u, 0x4850D7C0u, 0xCE7728E8u, 0xD73200C9u, 0xCF5C46D4u, 0x019F29ABu, 0x1209C286u}}},
+    {{{0xFEDC69B2u, 0x21A2707Cu, 0xB26B7717u, 0xA50A6089u, 0x35CAA386u, 0x73064304u, 0xAD6CB8A1u, 0xC12B9073u}}, {{0x20DD41DDu, 0x032AE9B0u, 0x3D27B2A0u, 0xB8EE1DBEu, 0x9F894976u, 0xD9772DC8u, 0xE534CDF1u, 0x3173C43Fu}}},
+    {{{0x9E341142u, 0xD3EC7BCEu, 0x76472760u, 0x7AE684EBu, 0x79A11668u, 0x1BA1BD21u, 0x0C2DA3B0u, 0xC6701C11u}}, {{0x9E0F4DADu, 0x8924C615u, 0x5BC9BE57u, 0x5D07FCBAu, 0xDE19F5A1u, 0x52F869BBu, 0x8D6CDD99u, 0x2A020EB3u}}},
+    {{{0xF961FE4Du, 0xAB6F585Du, 0x8B107197u, 0x8A14886Fu, 0x312CA73Eu, 0xA3F3E931u, 0xDC327A8Fu, 0xD059BF85u}}, {{0x6AE823C2u, 0xB9935B06u, 0xF4DAB64Cu, 0xFD388BA1u, 0xC84955B4u, 0x3FE0765Du, 0xC08B525Eu, 0x45107A60u}}},
+  },
+  { /* 16^60 */
+    {{{0x6CAF666Bu, 0xBCD6303Fu, 0xC4B1CE30u, 0x7FFCFED3u, 0xE817F463u, 0x62B6979Au, 0xA78102AAu, 0x13464A57u}}, {{0x7F6ECC27u, 0x3F495A90u, 0x1D0942E1u, 0x48F300A8u, 0x53CCB0CAu, 0xEF7E4334u, 0x04614580u, 0x69BE1590u}}},
+    {{{0x065084AEu, 0xC75849C6u, 0xCEABE577u, 0x9182BE7Du, 0x85FE12D1u, 0xEC05C88Cu, 0x32245362u, 0xEB3CF8F5u}}, {{0xF96B9480u, 0x6F67C1FFu, 0xE7DBD2A6u, 0xF52B45C5u, 0xEFDCA4A1u, 0x43FE63DCu, 0x22D9D700u, 0xC833C782u}}},
+    {{{0x8ECA5F51u, 0xF216B209u, 0x94FC9AEBu, 0xDDEA171Bu, 0xBF05B5CFu, 0x2C6ED6B2u, 0xDD9EE696u, 0xDDE9D514u}}, {{0xD0C638F7u, 0x9AD69A73u, 0xDE89571Fu, 0x50FEEBE8u, 0x0A7F8F09u, 0xD891F34Bu, 0x3CE28111u, 0xB84E6913u}}},
+    {{{0xC2E9A5D0u, 0xF8E5BCBCu, 0x84A201D9u, 0xA576FCF9u, 0x184519B2u, 0x4F7A60F2u, 0x092D9997u, 0xBDF1A67Du}}, {{0x8562FF7Bu, 0xCDB4F701u, 0xE5626461u, 0xA6280B61u, 0x86BF7BAAu, 0xA80BE54Au, 0xAB65A1AAu, 0x4095902Bu}}},
+    {{{0x999C88E4u, 0x2F906B05u, 0x20AD46ECu, 0x9AED513Eu, 0xB1204B17u, 0x6E9F406Eu, 0x23699373u, 0xFD1A6210u}}, {{0x595BC8DFu, 0x99C8C916u, 0x95CC00F2u, 0xDC6B71D4u, 0x54977782u, 0xFB13C069u, 0xB9C8C20Bu, 0x1AC97B54u}}},
+    {{{0xA09B0CCAu, 0x1CCC6A55u, 0x24A4D6F0u, 0xA3457589u, 0x8A28DA59u, 0xD5C454F6u, 0xDBB0F4C8u, 0x0D538CB1u}}, {{0x0C929E05u, 0x731B147Eu, 0xD89134C9u, 0x8534CD99u, 0x40EED7CFu, 0xCB0A8D5Cu, 0x7A3EC110u, 0xC8196BACu}}},
+    {{{0x5F8018CEu, 0xBD515B5Bu, 0x8D892D68u, 0xCF2DA573u, 0xF2C86DC7u, 0xF13FFCE4u, 0xD8C296B9u, 0x4EE48531u}}, {{0x1E48381Fu, 0x3C35A61Bu, 0xB4E80601u, 0x71074971u, 0xD0C7C5E6u, 0xFC7B4408u, 0x810BF8B5u, 0xB68F9ED4u}}},
+    {{{0x3B27E771u, 0xBDE5FC17u, 0x477DA62Au, 0x8C3B4196u, 0xB64483B4u, 0xCD5BE267u, 0xDDC4EC29u, 0x68856A6Eu}}, {{0x07BBDAB6u, 0x6118D62Au, 0x93B0733Au, 0x331D22F2u, 0xC19F7B4Au, 0x13B6FD49u, 0x4F79A1FBu, 0x77A33DF1u}}},
+    {{{0xF1473678u, 0x02852E91u, 0x094392F7u, 0xCBA05795u, 0x55B8C070u, 0xFF5E314Cu, 0x34C400DBu, 0xFD76CC9Cu}}, {{0x8D144F4Fu, 0x7E164EEAu, 0x1401C843u, 0x60628EEEu, 0x3D032CD6u, 0xE0FEE0A7u, 0x787143DAu, 0xF2046543u}}},
+    {{{0xCEE66B24u, 0xB5F00532u, 0xED7B8366u, 0xE8B9C60Fu, 0xBF1ADED2u, 0x80E44D99u, 0xB9E9C7B8u, 0x4CD5D8CFu}}, {{0xF40932FDu, 0x221EFDBAu, 0x12D2FAEDu, 0xCA61E45Eu, 0x9CD6D103u, 0x9FE4E8C3u, 0xDEB94B55u, 0x576EAE82u}}},
+    {{{0x8D7A2193u, 0xDF00B714u, 0xF197546Eu, 0x2C691E44u, 0x74B4EA21u, 0x19E6CE82u, 0x3123B402u, 0x85A2ABA3u}}, {{0xB0CDCF3Au, 0x7F0C83D4u, 0x9C3B1242u, 0xE1C6DADFu, 0xD1CC029Fu, 0xD82C6082u, 0xEB2B0516u, 0x9C129857u}}},
+    {{{0xEDD7E577u, 0x6AE303CEu, 0x8536C4D5u, 0xD3A0F256u, 0x70EA2107u, 0x5AC60472u, 0x8828F7B2u, 0xC352D50Fu}}, {{0xF8D9B570u, 0x3CA4FF88u, 0xB6121706u, 0x00A8ABB2u, 0x5BCE79FBu, 0x6ABD5314u, 0xBA76B9B9u, 0xBE772838u}}},
+    {{{0x377568B0u, 0x35B0305Bu, 0x19E03B05u, 0x35AE8DD0u, 0x5783650Fu, 0x440B6D6Cu, 0x73CFFE74u, 0xD25DDBFCu}}, {{0xDF39929Cu, 0x60A13926u, 0x1E3C3F00u, 0x83227388u, 0xCDE7D92Bu, 0x8BEAEF74u, 0x93F84893u, 0x7A3AFF75u}}},
+    {{{0x1E712536u, 0xA33563E8u, 0x6FF5FE71u, 0xA85051F5u, 0xAB635E9Eu, 0xE086DE71u, 0xB0A43A9Fu, 0x06914E86u}}, {{0x801128F1u, 0x2A247713u, 0x0AF7A9DAu, 0x896C226Bu, 0xE5AC28C0u, 0x27D8ACEAu, 0x52D9BD05u, 0x2B7E7928u}}},
+    {{{0xA71D7C13u, 0x55FE5118u, 0xFA0FFA38u, 0x641AB5F7u, 0x97AAC805u, 0x55F07E9Au, 0x43E94A72u, 0x45813531u}}, {{0x3AFF63CFu, 0x9638BC55u, 0x42BD96B9u, 0x70200655u, 0x77DD69C9u, 0xB57F50F1u, 0x14979AD8u, 0x9F5858ECu}}},
+  },
+  { /* 16^61 */
+    {{{0x2D83F366u, 0xCADA3A0Du, 0xE2F28588u, 0x0CD9CCEDu, 0xCC1DC97Au, 0x9AEF430Bu, 0xB713FE2Eu, 0xBC4A9DF5u}}, {{0x581F33C1u, 0xD758D666u, 0xFA547B16u, 0xA6E8A9FBu, 0xF4B798CAu, 0x383937ADu, 0x6E785C06u, 0x0D3A81CAu}}},
+    {{{0xF3FCEB19u, 0x282DE545u, 0xF785C409u, 0x2E89B221u, 0x6CE7BAB4u, 0xABC5C762u, 0x11CECCC0u, 0xDA433D5Eu}}, {{0xA6F5CC64u, 0x684E7120u, 0x9227B277u, 0x8E77FC2Du, 0xAF95E521u, 0x1DEBBDC4u, 0x21A81030u, 0xE498DBD3u}}},
+    {{{0xF712BE3Cu, 0xB06A2E32u, 0xDA146A66u, 0x7295F18Eu, 0xAB001534u, 0xD3C725DBu, 0x9331B378u, 0x39D7349Du}}, {{0x1C6FF65Cu, 0xCC3019F4u, 0xECA41644u, 0xEF5EF7A5u, 0xC66812E8u, 0xFB127554u, 0x56EF3BF7u, 0x8F929B4Fu}}},
+    {{{0x5ACF692Au, 0x54DE275Cu, 0x72207E06u, 0xBCC4838Au, 0x81C16EFDu, 0x1C1C1169u, 0xE9E8C7ECu, 0x031E8E1Eu}}, {{0xB16F667Au, 0x9CC2A84Eu, 0xC5BF73B0u, 0x70649827u, 0x90D6743Bu, 0xD9D09702u, 0x465B353Du, 0xAD7E7F5Bu}}},
+    {{{0xDF77F22Bu, 0x5AAE4FBCu, 0x94F82E03u, 0xC6997239u, 0x2995AF26u, 0x9E51CD6Cu, 0xF7DC1DD0u, 0xF0CBA617u}}, {{0x5909A03Cu, 0x1FC8E2C7u, 0x90A09566u, 0x04F18C7Eu, 0x6516D040u, 0x9EF326C3u, 0x13F9DF98u, 0x1A25AB43u}}},
+    {{{0x77829372u, 0xDEC0AA4Au, 0x88BA4553u, 0xC49B300Cu, 0x5385796Bu, 0x313626AEu, 0x0F3E0D3Bu, 0xB4319CC9u}}, {{0x0ADD5427u, 0x7729CCC0u, 0xCA3E11BBu, 0x707B1215u, 0x9C21C5A2u, 0xFFB7AFE0u, 0x9A6F502Bu, 0x4707D449u}}},
+    {{{0xC6509C12u, 0x58ACDCD4u, 0x5BD1F476u, 0x8D6BFE23u, 0xD87268EDu, 0x21D170E8u, 0xDB2154D3u, 0x381D7AB9u}}, {{0x2EB46102u, 0x54642A8Eu, 0x6CE6EAF7u, 0x20582858u, 0x3A6581E7u, 0xEB5D2457u, 0x7FDA3DA9u, 0xA47AAB5Bu}}},
+    {{{0x81F488B6u, 0x92BBD7FFu, 0x3FC7A915u, 0xE9C9BF36u, 0x62657F73u, 0x5D3E00D8u, 0xA88D6115u, 0xA9878607u}}, {{0x031DAB1Du, 0x495A7BBBu, 0x64AD5C6Du, 0x39D0F019u, 0x82157C22u, 0x1C063E7Cu, 0xD58895D6u, 0xD181A1ABu}}},
+    {{{0x384FE955u, 0x8DB3B4D6u, 0xA063BCE4u, 0xF69956A5u, 0x694C8A53u, 0x4793B73Eu, 0x67AB87E6u, 0xA703F054u}}, {{0xD61344BDu, 0xA26B2EFBu, 0xC597277Fu, 0x539E1629u, 0x6B19199Bu, 0xC0EA792Du, 0xA2B047ADu, 0xD500F935u}}},
+    {{{0xC38A8CC6u, 0xE64093B6u, 0x9F69F8FBu, 0xBA2E121Eu, 0x6ED7F3DCu, 0x48E279FFu, 0x50B3417Eu, 0x331924C7u}}, {{0x46587810u, 0xC4E8E0FBu, 0xCE9E9B54u, 0x7FB99E9Au, 0xBE2FFB31u, 0x2BA5B601u, 0x1B33F018u, 0xCA8F7941u}}},
+    {{{0x06EACE58u, 0x3499656Cu, 0xA2F3211Du, 0x1B7E4563u, 0x7053A03Fu, 0x46C6AD0Du, 0xAAD550D7u, 0x73C6B3C5u}}, {{0x2AF8654Eu, 0x7170A917u, 0xBBB8D291u, 0xAA6A878Du, 0x366D91C6u, 0x1BA90991u, 0x733A4F74u, 0x3A2FB4A4u}}},
+    {{{0xCDCBCB9Eu, 0xF4BF1126u, 0xDCD83C3Du, 0xD6FA5689u, 0x7FD43761u, 0x9ECC3244u, 0x119D337Au, 0xCDCB12D7u}}, {{0xC961CFD1u, 0xA08A585Au, 0x358DF340u, 0xA199AF24u, 0x96DE9949u, 0xBFEFBEA0u, 0x7BB9F11Fu, 0xE699E2E1u}}},
+    {{{0x00181D5Eu, 0x54B388BFu, 0xB95AAF20u, 0xDE71B3A9u, 0x1C0EDDB8u, 0xA1D00D3Au, 0x506D47FDu, 0xC627F3E7u}}, {{0x369F886Du, 0x927900A6u, 0x49CBE2C3u, 0x8EF6B005u, 0x38A1F7D6u, 0xB2D69601u, 0x1E442A63u, 0xD78F9DD7u}}},
+    {{{0x325FE9CCu, 0x1D747CF7u, 0x349D88DBu, 0xFBB883BBu, 0x42D4AC23u, 0x37041108u, 0x28EC31B1u, 0xC6ED5E63u}}, {{0x4A8FD94Bu, 0x0C0BCE1Cu, 0x60F22CF1u, 0x844F972Bu, 0x5C7F7B2Au, 0x2932EE12u, 0x49D7F830u, 0xDE47405Bu}}},
+    {{{0xB7828B16u, 0x34E28D9Fu, 0x28A4847Fu, 0xA047958Fu, 0x6F06DE53u, 0xFA25F40Au, 0x0EDFD233u, 0xBB88FABEu}}, {{0x0AEA5DF7u, 0xC51473A2u, 0xE3A1E969u, 0xEC4A8174u, 0x01159163u, 0x345DC596u, 0x04F5E8DDu, 0xB73676B3u}}},
+  },
+  { /* 16^62 */
+    {{{0xE5324CAAu, 0x954AB30Fu, 0x0A9472A3u, 0x694B65E3u, 0x9452A32Eu, 0xD23D8C74u, 0xF8298BC0u, 0x8C28A97Bu}}, {{0xCBEF9482u, 0x9E71DC73u, 0x451CB945u, 0x7AE784F0u, 0x1F7CC0EBu, 0x378FEDF3u, 0xA3305193u, 0x40A30463u}}},
+    {{{0x7611D8E2u, 0x5DFB201Fu, 0xDE49FC4Du, 0xC8130FE8u, 0x047F0DA2u, 0x96BED5A6u, 0x2A38A2F1u, 0xAB1AC187u}}, {{0xC429D15Bu, 0x01A581F3u, 0x3E1E545Fu, 0xF7EF93D3u, 0xDB6A42B6u, 0xE9AA5F39u, 0x324D17A1u, 0x13F4A37Au}}},
+    {{{0x4754DD40u, 0x863E8715u, 0xFC3466CFu, 0xA2422631u, 0xCD72F6E9u, 0x45B4841Fu, 0x32C0DFCFu, 0x97292470u}}, {{0x2AA36143u, 0x384B492Fu, 0x55ACAF49u, 0x90DAE852u, 0xCBD4DF36u, 0xCD15C75Du, 0x265FEA1Du, 0x91D1A244u}}},
+    {{{0x2651B3FAu, 0x226AEE64u, 0x772DF434u, 0x8EA1B365u, 0x253F31EFu, 0x3703A607u, 0x5BEEF82Du, 0x2564FE9Bu}}, {{0x01E5122Du, 0xDB82E6A3u, 0x6B79816Eu, 0x14F37DABu, 0x1203925Fu, 0x95FA14AEu, 0x06783890u, 0x8AD9F7A6u}}},
+    {{{0x8C2CA7FFu, 0x3C2D82EBu, 0x95DF021Au, 0x1803645Du, 0x5A2F27AFu, 0x050791ADu, 0x580A796Eu, 0x89637F97u}}, {{0x70493E68u, 0xBED415E1u, 0x8E42EAB7u, 0xF87BC6A3u, 0x54357489u, 0xD57B9CF1u, 0x8C888424u, 0x2D1FE124u}}},
+    {{{0x0C7A89EEu, 0x057C3533u, 0x7AB6D4F8u, 0x4BDBC59Cu, 0xFC98658Au, 0x12860B88u, 0x6A4179E1u, 0x71EFA4E2u}}, {{0xC1366A2Eu, 0x4F489329u, 0x8E5E9A0Bu, 0x2AAAFAB8u, 0xB17294A2u, 0x9EFB2C32u, 0x8BB624AEu, 0x145FA81Fu}}},
+    {{{0x0CA8DD7Fu, 0x6186D63Au, 0x56A1381Au, 0x1BC72803u, 0x3D535742u, 0x2FDC9DA0u, 0x1BE25E09u, 0x308138E7u}}, {{0x8A92C7F2u, 0xE415F247u, 0x434AD915u, 0xC8165646u, 0xD1408E18u, 0x5E39EC45u, 0x8828FC92u, 0x28D1E2D2u}}},
+    {{{0xAE180068u, 0xB178E3D3u, 0x20BD3103u, 0x7EA3D56Cu, 0xC30DC01Au, 0xBFC6C5C0u, 0xFFAC5B0Cu, 0xFF3D6136u}}, {{0x188C6077u, 0x70A6BB6Eu, 0x4001F5E6u, 0x547676F2u, 0xDD96ADC1u, 0x40D0372Cu, 0x84E4000Eu, 0x133239BEu}}},
+    {{{0x866A3FB1u, 0xC0DCC568u, 0x1992E206u, 0x6EC00928u, 0x85B6862Fu, 0xD1E5750Cu, 0x2A6DEB65u, 0x575FC4E8u}}, {{0x902655ADu, 0x09B8E90Au, 0xC6A3AF2Fu, 0xED33B573u, 0x978E87DAu, 0xD671DBC2u, 0x42A6FCA2u, 0x6F6EDB90u}}},
+    {{{0xBD21250Au, 0x954E7FDCu, 0x83998AD4u, 0xDF45E175u, 0xA43555E7u, 0x531E342Bu, 0x0BAB8AD2u, 0x3FA91548u}}, {{0xFAA76731u, 0x91C86C02u, 0x032B5FB7u, 0x2E45E55Au, 0x03BB127Cu, 0xCF5BDF96u, 0x5499B030u, 0xBF9B6690u}}},
+    {{{0x790117DFu, 0x21B6A8A4u, 0xCE201029u, 0xDA253BBBu, 0x1EEA2A8Fu, 0x227F26F8u, 0xB64EAB7Au, 0xA5EC9036u}}, {{0xF86462FEu, 0xD8128133u, 0x5614A363u, 0x1C8461F0u, 0xAD1FA0F7u, 0x0C597983u, 0x5EC14040u, 0xB79DC662u}}},
+    {{{0x8DE0545Fu, 0x5CB02349u, 0x2106C74Fu, 0x80E625DAu, 0x4B3508ACu, 0xA375EA00u, 0x58E07124u, 0x52045BCCu}}, {{0x506C3D91u, 0x36EA34C0u, 0x2A8FDAF2u, 0x793B9D0Fu, 0x20CE312Bu, 0xD430ED9Cu, 0xEBE3123Au, 0x1B3F31FCu}}},
+    {{{0x172AD712u, 0x0B0F975Cu, 0xDE104729u, 0x5A398CB0u, 0x146349B9u, 0x49DE7976u, 0x13310B09u, 0xA153DFE9u}}, {{0x8D48FDD2u, 0xC8A5F653u, 0x5AF0B329u, 0xBD053F28u, 0xF1F1B89Au, 0xC48318D5u, 0x3FB05B2Fu, 0xFD94D841u}}},
+    {{{0x3220479Fu, 0x89F13D0Cu, 0xE5E5B38Au, 0x5DE47B95u, 0x23760363u, 0x80162C8Du, 0xBE472FDBu, 0x58B5436Eu}}, {{0x567DB17Au, 0x44A7375Eu, 0x829BB341u, 0x96AF27C4u, 0x52F6DE83u, 0x4E2913A2u, 0x55CD672Cu, 0x85D7B6B0u}}},
+    {{{0x11CF5B3Au, 0x030C3701u, 0xBDB5A781u, 0xC4433A83u, 0x88EDC824u, 0x935C34D0u, 0xAF794615u, 0x9A541AC6u}}, {{0x36A44AE4u, 0x63F5575Fu, 0x521EA52Du, 0x5548FEE2u, 0x688F475Fu, 0xCAFE1AF3u, 0xCB106AB7u, 0xB66148C1u}}},
+  },
+  { /* 16^63 */
+    {{{0x1FACCAE0u, 0x48C4BA11u, 0x5A4BB337u, 0x3C8B350Cu, 0x4F071FD2u, 0xC1DD94CEu, 0x139527A8u, 0x08EA9666u}}, {{0x0E62B945u, 0x55AF34A3u, 0x9CF0F8E9u, 0x35B783BEu, 0xFB95C5D7u, 0xE24E7C0Cu, 0xC8EE2782u, 0x620EFABBu}}},
+    {{{0xA190B632u, 0xA293131Du, 0xA4AB5AB9u, 0x63CF2A23u, 0x15559D82u, 0xF3A66DF3u, 0x76220CD9u, 0xC25F6371u}}, {{0xFC9590CFu, 0x6EEBF3D6u, 0x9E027A1Du, 0x0A9F04FFu, 0x3809D798u, 0x98904990u, 0xE94D2873u, 0x53154FEDu}}},
+    {{{0x66A06F5Eu, 0x21A40B59u, 0x6EA08370u, 0xA3419251u, 0x1263B716u, 0xC37B0D42u, 0xEA14253Au, 0x383B24FBu}}, {{0xD3C6E772u, 0x089F4786u, 0xBB8C2B04u, 0xE8F6AE74u, 0x54EA5A19u, 0x44CF566Du, 0xC4EDBA20u, 0x54CF706Au}}},
+    {{{0xD466D561u, 0xE2CCB3B7u, 0x31978B4Du, 0x0C7B55DCu, 0x5688544Cu, 0x3E82D82Au, 0x3CCE6BABu, 0x2A9E8DFEu}}, {{0x52E76373u, 0xF96CCF52u, 0x17A02182u, 0x5E01EAECu, 0x608B96CFu, 0xBAC7B5ADu, 0xC16E651Fu, 0x01DFEDA5u}}},
+    {{{0x4638A136u, 0xC7975C1Du, 0x36838195u, 0x2B0D1CE3u, 0xB60D790Cu, 0x789E59C6u, 0x3E02ED6Du, 0xE68432D0u}}, {{0x8C6C2584u, 0xAAFD1810u, 0xDB357336u, 0x2E09E3EBu, 0x3A01E647u, 0x24D2A730u, 0x98E35A66u, 0xCA5BE413u}}},
+    {{{0xDBCF2DCEu, 0x2139B408u, 0x5C1DC6C0u, 0x68114A10u, 0x92FF9980u, 0xBD49E4C9u, 0x92E46218u, 0x95E62D42u}}, {{0x58C86594u, 0x62BDDFDFu, 0x3704D20Eu, 0x5E7B3060u, 0xB428D52Eu, 0x183A26E2u, 0x296C2875u, 0x06B68184u}}},
+    {{{0x16E8C10Cu, 0x7CE87C44u, 0x391BD680u, 0xB472985Fu, 0xE7306E7Fu, 0x0EEFBDECu, 0xE2FE5C2Au, 0x395DD559u}}, {{0x05FE638Eu, 0xBC3D6D93u, 0xDC66922Cu, 0x4C909C04u, 0xAFFA4E27u, 0xD0413E87u, 0xB4592AC5u, 0xFD62DCD4u}}},
+    {{{0x3F8BE384u, 0xE8BD3204u, 0xA31DB6C3u, 0x71EC0AADu, 0x4FDEF072u, 0x251AD6C9u, 0x2BE63E1Bu, 0xB23790A4u}}, {{0xEB19880Eu, 0xD10A473Du, 0x149ECB58u, 0x17F004F4u, 0xAA81F945u, 0xE8D50F88u, 0x19D55EDBu, 0xFC6B6949u}}},
+    {{{0x0D6C14EFu, 0x51664DB2u, 0x06F93C8Fu, 0x0858FC75u, 0xEEE26480u, 0x9F6EED5Bu, 0x35525DCBu, 0x7A514ADCu}}, {{0x0B3FBD13u, 0x7AD3E187u, 0x2AA6E24Fu, 0x29BEAEF7u, 0x4C8F5C37u, 0xE897F0B9u, 0xD152E4D8u, 0x56EDD1FEu}}},
+    {{{0x097EC94Bu, 0xFF9F053Du, 0xC8D59C2Du, 0x27ED7091u, 0x8AE68181u, 0x1EE215AAu, 0x7B4AEFEDu, 0xB2113BCBu}}, {{0x687831ADu, 0xBD5FBFFCu, 0x2357D0FDu, 0x0943220Bu, 0x454CB4EBu, 0x105A0B53u, 0x99E8EE73u, 0x93BE9E73u}}},
+    {{{0x4F6D65EBu, 0x4A9463D0u, 0x54402152u, 0x5A991077u, 0xF4908F23u, 0x8EA8EF3Bu, 0x4325D90Du, 0x1EE1FD58u}}, {{0x5D22941Cu, 0x1E036B92u, 0x863582B1u, 0xCA32F4E9u, 0x4F42FCFAu, 0x1CFAB9FCu, 0xBDD6C73Cu, 0xBB692891u}}},
+    {{{0x97A6257Fu, 0xB8052645u, 0xA27A6C40u, 0x1873C3B1u, 0xAB07E789u, 0xA6424274u, 0xE1F54F25u, 0x71E935C8u}}, {{0xD1B1E582u, 0x5B217461u, 0x0CF70F7Au, 0xEF252354u, 0x47AE2A52u, 0x3DED86BAu, 0xF47C2251u, 0x78D93E59u}}},
+    {{{0x0E36CB44u, 0x1F1950EFu, 0x8DCA2019u, 0x617E8B6Cu, 0xD883357Du, 0xBC058FD0u, 0xD38FAAA8u, 0x15515634u}}, {{0x1F495A68u, 0x329AF465u, 0xF020C1E5u, 0xA8C37175u, 0xB463205Du, 0xE370E3F0u, 0x55575215u, 0xAB4FFFC7u}}},
+    {{{0x79CA950Eu, 0xBF084724u, 0x2BB13BACu, 0x39E01576u, 0x9EE2C461u, 0xC52F8BE7u, 0x4EE795CAu, 0xABC451CAu}}, {{0x9A9490D2u, 0x07CE7D8Cu, 0xCEA553ECu, 0x52684000u, 0xC2C91456u, 0xDB1DFB80u, 0xFE820A59u, 0xAE2718BEu}}},
+    {{{0x7427BACCu, 0x51F94610u, 0xDD2D62E1u, 0x9E733164u, 0x958DC4AAu, 0x36358EB0u, 0x46BF5201u, 0x3BC6BC64u}}, {{0xEAD6FDA6u, 0x14C33FD5u, 0x228BEB47u, 0xD71B75A5u, 0x26D6C02Bu, 0xCDB62EE2u, 0x7176C305u, 0x8E305CC0u}}},
+  },
+};
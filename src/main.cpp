@@ -13,6 +13,8 @@
 #include <setjmp.h>
 #include <mbedtls/base64.h>
 #include <webp/decode.h>
+#include "decmem.h"
+#include "nostrsig.h"
 // libjpeg for progressive JPEG (1/8 scale decode)
 // Must match libjpeg's boolean=int to ensure struct size consistency
 #define HAVE_BOOLEAN
@@ -31,126 +33,1188 @@ extern "C" {
 // 例: #define RELAY_HOST "yabu.me"
 //     #define RELAY_PORT 443
 //     #define RELAY_PATH "/"
+// 複数のリレーに同時につなぐときは RELAY_LIST に {host, port, path} を並べる（RELAY_HOSTなどより優先）
+// 例: #define RELAY_LIST {"yabu.me", 443, "/"}, {"relay.damus.io", 443, "/"}
+
+// --- リレー接続 ---
+// リレーごとにWebSocket接続と購読の状態を持ち、受信したイベントは1つのタイムラインに合流させる
+struct RelayConfig {
+  const char* host;
+  uint16_t port;
+  const char* path;
+};
+#ifdef RELAY_LIST
+const RelayConfig relayConfigs[] = { RELAY_LIST };
+#else
+const RelayConfig relayConfigs[] = { { RELAY_HOST, RELAY_PORT, RELAY_PATH } };
+#endif
+#define RELAY_MAX 4  // TLS接続1本ごとに内部RAMを数十KB使う
+#define RELAY_CONFIG_COUNT (int)(sizeof(relayConfigs) / sizeof(relayConfigs[0]))
+const int relayCount = RELAY_CONFIG_COUNT < RELAY_MAX ? RELAY_CONFIG_COUNT : RELAY_MAX;
+// リレーごとの計測値。平均は指数移動平均（負 = まだ計測なし）、回数は時間とともに減衰させる
+struct RelayStats {
+  unsigned long connectMs;  // 直近の接続（TLSハンドシェイク込み）にかかった時間
+  float eoseMs;             // REQからEOSEまで
+  float lagMs;              // 同じイベントを最初に届けたリレーからの遅れ
+  float eventsPerSec;
+  float errors;             // エラー・CLOSED・タイムアウト
+  float disconnects;
+  uint32_t events;          // 集計区間内のEVENT数
+  uint32_t totalEvents;
+  uint32_t firsts;          // 最初に届けたTLイベント数
+  uint32_t totalErrors;
+  uint32_t totalDisconnects;
+  uint32_t totalInvalid;    // idか署名が合わなかったイベント数
+  uint64_t wireBytes;       // 受信したメッセージ（圧縮されたまま）
+  uint64_t jsonBytes;       // 展開後
+};
+// 拡張の申し込みをハンドシェイクに足せるWebSocketsClient
+// setExtraHeadersは追加ヘッダ全体を置き換える（beginSSLが入れる既定のOriginも消える）ので、ライブラリが持っている分の後ろに足す
+class RelaySocket : public WebSocketsClient {
+ public:
+  // beginSSLの後に呼ぶ。NULLなら申し込みを外す
+  void offerExtension(const char* ext) {
+    if (!baseSaved) {
+      baseHeaders = _client.extraHeaders;
+      baseSaved = true;
+    }
+    _client.extraHeaders = baseHeaders;
+    if (!ext) return;
+    if (_client.extraHeaders.length() > 0) _client.extraHeaders += "\r\n";
+    _client.extraHeaders += "Sec-WebSocket-Extensions: ";
+    _client.extraHeaders += ext;
+  }
+
+ private:
+  String baseHeaders;
+  bool baseSaved = false;
+};
+
+struct Relay {
+  RelaySocket ws;
+  bool connected;
+  bool demoted;      // 成績が悪いので新しい購読を回さない
+  unsigned long connectAttemptAt;
+  int reconnectFails;  // 続けて失敗した再接続の回数（つながったら0）
+  int subLimit;      // 同時に開く購読の上限
+  int subOpenCount;  // 開いている購読の数
+  RelayStats stats;
+  uint8_t* inflateRing;  // permessage-deflateの窓（context takeoverで持ち越す。NULL = 共有の窓を毎回空にして使う）
+  size_t inflatePos;     // inflateRingに書いた総バイト数
+  bool inflateBroken;    // 展開に失敗した（持ち越した窓がずれたので切断してつなぎ直す）
+  bool deflateOffered;   // 今の接続（試行）で申し込んだ
+  bool deflateSeen;      // この接続で圧縮されたメッセージを展開できた
+  int deflateDrops;      // 申し込んだ接続が圧縮されたメッセージを受け取らないまま切れた回数（続いた分）
+  bool deflateOff;       // このリレーには申し込まない
+  uint8_t* fragBuf;      // 分割されたメッセージをつなげる（初めて分割が届いたときに確保）
+  size_t fragLen;
+  bool fragging;         // 分割されたテキストの途中
+  bool fragDropped;      // 入りきらないので捨てている途中
+};
+Relay relays[RELAY_MAX];
 
-WebSocketsClient webSocket;
+int relaysConnected() {
+  int n = 0;
+  for (int r = 0; r < relayCount; r++) {
+    if (relays[r].connected) n++;
+  }
+  return n;
+}
+
+static void statsAverage(float& avg, float sample) {
+  avg = avg < 0 ? sample : avg + (sample - avg) * 0.2f;
+}
+
+// TLイベントの到着。検証を通った初着を覚えておき、他のリレーから遅れて届いた重複で遅れを測る
+#define RELAY_LAG_RING 64
+struct FirstArrival {
+  uint64_t id;
+  unsigned long at;
+  int8_t relay;
+};
+FirstArrival firstArrivals[RELAY_LAG_RING];
+int firstArrivalHead = 0;
+
+// 受信した数（検証前。重複も数える）
+void relayNoteEvent(int r) {
+  relays[r].stats.events++;
+  relays[r].stats.totalEvents++;
+}
+
+// 検証を通った最初の1件を届けた。atは受信した時刻
+void relayNoteFirst(int r, uint64_t id, unsigned long at) {
+  if (relayCount < 2) return;
+  RelayStats& st = relays[r].stats;
+  st.firsts++;
+  statsAverage(st.lagMs, 0);
+  firstArrivals[firstArrivalHead] = { id, at, (int8_t)r };
+  firstArrivalHead = (firstArrivalHead + 1) % RELAY_LAG_RING;
+}
+
+// 受理済みのイベントが別のリレーからも届いた。atは受信した時刻
+void relayNoteDuplicate(int r, uint64_t id, unsigned long at) {
+  if (relayCount < 2) return;
+  for (int i = 0; i < RELAY_LAG_RING; i++) {
+    if (firstArrivals[i].id == id && firstArrivals[i].relay != r) {
+      long lag = (long)(at - firstArrivals[i].at);
+      statsAverage(relays[r].stats.lagMs, lag > 0 ? lag : 0);
+      return;
+    }
+  }
+}
+
+// 100点から遅さ・不安定さで引く
+int relayScore(int r) {
+  const RelayStats& st = relays[r].stats;
+  float score = 100;
+  if (st.eoseMs > 0) score -= min(30.0f, st.eoseMs / 100);  // EOSEまで3秒で-30
+  if (st.lagMs > 0) score -= min(30.0f, st.lagMs / 50);     // 1.5秒遅れで-30
+  score -= min(30.0f, st.disconnects * 10);
+  score -= min(20.0f, st.errors * 5);
+  score -= min(10.0f, st.connectMs / 500.0f);
+  return score < 0 ? 0 : (int)score;
+}
+
+// 接続中で降格していないリレーの数
+int relaysHealthy() {
+  int n = 0;
+  for (int r = 0; r < relayCount; r++) {
+    if (relays[r].connected && !relays[r].demoted) n++;
+  }
+  return n;
+}
 WebServer server(80);
 
-// --- アイコンキャッシュ（RGB565 32x32 = 2048 bytes each）---
+// --- アイコンキャッシュ（32x32、16色パレット+4bitインデックス = 544 bytes each）---
 #define ICON_SIZE 32
-#define ICON_BYTES (ICON_SIZE * ICON_SIZE * 2)
+#define ICON_BYTES (ICON_SIZE * ICON_SIZE * 2)  // デコード直後のRGB565
+#define ICON_PALETTE_SIZE 16
+#define ICON_DRAW_LINES 8  // 描画時にRGB565へ展開する行数（pushImage 1回分）
 #define META_CACHE_SIZE 100
-#define ICON_BUF_COUNT 20  // 実際に画像をキャッシュする数（メモリ節約）
+// アイコンは2段構成: 全アイコンをPSRAMに置き、描画中のものだけ内部DRAMへコピーしてpushImageする
+#define ICON_BUF_COUNT 1024       // PSRAMに置くアイコン数（544KB）。metaCacheから追い出された作者の分も残す
+#define ICON_BUF_COUNT_NOPSRAM 64 // PSRAMが確保できなかったときに内部DRAMに置く数（34KB）
+#define ICON_HOT_COUNT 8          // 内部DRAMの描画用コピー数（TIMELINE_VISIBLE以上）
+// デコード用アリーナ: 起動時に一括確保し、アイコン1枚ごとに巻き戻す (decmem)
+#define DECODE_ARENA_DRAM (16 * 1024)          // 小さいテーブル用 (内部DRAM)
+#define DECODE_ARENA_PSRAM (2 * 1024 * 1024)   // 画素・係数バッファ用
+#define DECODE_BYTE_CAP DECODE_ARENA_PSRAM     // 1回のデコードの上限。超えたらそのデコードは失敗
+
+// パレット圧縮したアイコン。RGB565への展開は描画時の行バッファでだけ行う
+struct IconPacked {
+  uint16_t palette[ICON_PALETTE_SIZE];       // バイトスワップ済みRGB565（pushImage用）
+  uint8_t index[ICON_SIZE * ICON_SIZE / 2];  // 1画素4bit、上位ニブルが左の画素
+};
 
-// アイコン画像バッファプール
-uint16_t iconPool[ICON_BUF_COUNT][ICON_SIZE * ICON_SIZE];
+// アイコン画像バッファプール（setupでPSRAMに確保）
+IconPacked* iconPool = NULL;
+int iconPoolCount = 0;
 bool iconPoolUsed[ICON_BUF_COUNT];
+int16_t iconPoolOwner[ICON_BUF_COUNT];  // 使用中スロットの持ち主（metaCacheの添字、-1 = 作者がmetaCacheから追い出し済み）
+bool iconPoolRef[ICON_BUF_COUNT];       // CLOCKの参照ビット（描画で立てる）
+int iconClockHand = 0;
+uint16_t iconStaging[ICON_SIZE * ICON_SIZE];  // デコーダの出力先（バイトスワップ済みRGB565）。storeIconで圧縮してプールへ
+
+// 描画用の内部DRAMコピー（PSRAMから読みながらpushImageするとSPI転送がPSRAM読み出し待ちになる）
+IconPacked iconHot[ICON_HOT_COUNT];
+int16_t iconHotSrc[ICON_HOT_COUNT];    // コピー元のiconPoolスロット（-1 = 空）
+uint32_t iconHotStamp[ICON_HOT_COUNT]; // 最後に描画した順（LRU）
+int8_t iconPoolHot[ICON_BUF_COUNT];    // iconPoolスロット → iconHotの添字（-1 = なし）
+uint32_t iconHotClock = 0;
+
+// --- pubkey ---
+// 受信時にhex 64文字を1回だけデコードし、以降は32バイトのバイナリで比較・ハッシュする
+struct PubKey {
+  uint8_t b[32];
+  bool operator==(const PubKey& o) const { return memcmp(b, o.b, sizeof(b)) == 0; }
+};
+PubKey* iconPoolKey = NULL;  // 各スロットの作者（iconPoolと一緒にPSRAMに確保。作者が戻ってきたら付け直す）
+
+// --- テキストアリーナ（PSRAM）---
+// プロフィール名・画像URL・投稿本文の置き場所。Arduino Stringと違って内部DRAMのヒープを使わず、
+// エントリのコピー・シフトはハンドル（4バイト）を動かすだけ
+// 固定長スラブにバンプ確保し、同じ文字列は参照カウント付きで1つにまとめる（intern）
+// スラブ内の文字列がすべて解放されたらスラブごと空きに戻す（個々の文字列の隙間は再利用しない）
+// 空きスラブがなくなったら、画面に出ていない古い投稿から捨てて空きを作る
+#define TEXT_SLAB_SIZE (32 * 1024)  // data:URIの画像URL(最大16KB)が入る大きさ
+#define TEXT_SLAB_COUNT 20          // PSRAM 640KB（満杯の本文リング + プロフィール。下のstatic_assert参照）
+#define TEXT_SLAB_COUNT_NOPSRAM 2   // PSRAMが確保できなかったときに内部DRAMに置く数
+#define TEXT_INTERN_SIZE 1024       // intern表（2のべき乗）。3/4を超えたら以降はinternせずに置く
+static_assert((TEXT_INTERN_SIZE & (TEXT_INTERN_SIZE - 1)) == 0, "TEXT_INTERN_SIZE must be a power of 2");
+
+typedef uint32_t TextRef;  // アリーナ先頭からのオフセット+1（0 = 空文字列）
+struct TextHeader {        // 長さ付きの文字列ヘッダ。直後に本文+NUL
+  uint32_t hash;
+  uint16_t len;
+  uint16_t refs;
+};
+uint8_t* textArena = NULL;
+int textSlabCount = 0;
+uint32_t textSlabUsed[TEXT_SLAB_COUNT];  // スラブ内のバンプ位置（0 = 空きスラブ）
+uint16_t textSlabLive[TEXT_SLAB_COUNT];  // スラブ内で生きている文字列の数
+int textSlabCur = -1;                     // 確保中のスラブ
+TextRef textInternTable[TEXT_INTERN_SIZE];
+int textInternCount = 0;
+
+static inline TextHeader* textHeader(TextRef r) { return (TextHeader*)(textArena + r - 1); }
+
+const char* textStr(TextRef r) {
+  return r ? (const char*)(textHeader(r) + 1) : "";
+}
+
+int textLen(TextRef r) {
+  return r ? textHeader(r)->len : 0;
+}
+
+static uint32_t textHash(const char* s, int len) {  // FNV-1a
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < len; i++) h = (h ^ (uint8_t)s[i]) * 16777619u;
+  return h;
+}
+
+// intern表から外す（後方シフト、metaIndexRemoveと同じ）。internしていない文字列なら何もしない
+static void textInternRemove(TextRef r) {
+  const uint32_t mask = TEXT_INTERN_SIZE - 1;
+  uint32_t s = textHeader(r)->hash & mask;
+  while (textInternTable[s] != r) {
+    if (textInternTable[s] == 0) return;
+    s = (s + 1) & mask;
+  }
+  for (uint32_t next = (s + 1) & mask; textInternTable[next] != 0; next = (next + 1) & mask) {
+    uint32_t home = textHeader(textInternTable[next])->hash & mask;
+    if (((next - home) & mask) >= ((next - s) & mask)) {
+      textInternTable[s] = textInternTable[next];
+      s = next;
+    }
+  }
+  textInternTable[s] = 0;
+  textInternCount--;
+}
+
+bool timelineDropOldest();
+
+static int textFreeSlab() {
+  for (int i = 0; i < textSlabCount; i++) {
+    if (textSlabUsed[i] == 0) return i;
+  }
+  return -1;
+}
+
+// 文字列を置いて参照を1つ返す。同じ文字列があればそれを共有。空文字列・アリーナ満杯なら0
+TextRef textPut(const char* str, int len) {
+  if (!str || len <= 0 || !textArena) return 0;
+  const uint32_t mask = TEXT_INTERN_SIZE - 1;
+  uint32_t hash = textHash(str, len);
+  uint32_t slot = hash & mask;
+  for (; textInternTable[slot] != 0; slot = (slot + 1) & mask) {
+    TextHeader* h = textHeader(textInternTable[slot]);
+    if (h->hash == hash && h->len == len && h->refs < 0xFFFF && memcmp(h + 1, str, len) == 0) {
+      h->refs++;
+      return textInternTable[slot];
+    }
+  }
+  uint32_t need = (sizeof(TextHeader) + len + 1 + 3) & ~3u;
+  if (len > 0xFFFF || need > TEXT_SLAB_SIZE) return 0;
+  if (textSlabCur < 0 || textSlabUsed[textSlabCur] + need > TEXT_SLAB_SIZE) {
+    // 次の空きスラブへ（抜けるスラブは中の文字列がすべて解放されたときに空きに戻る）
+    // なければ古い投稿から捨てる。スラブは概ね古い順に埋まっているので、最も古いスラブが空くまで
+    int next = textFreeSlab();
+    int dropped = 0;
+    while (next < 0 && timelineDropOldest()) {
+      dropped++;
+      next = textFreeSlab();
+    }
+    if (dropped > 0) Serial.printf("[TEXT] arena full, dropped %d old posts\n", dropped);
+    if (next < 0) {
+      Serial.printf("[TEXT] arena full (%d bytes)\n", len);
+      return 0;
+    }
+    textSlabCur = next;
+  }
+  uint32_t off = textSlabCur * TEXT_SLAB_SIZE + textSlabUsed[textSlabCur];
+  textSlabUsed[textSlabCur] += need;
+  textSlabLive[textSlabCur]++;
+  TextHeader* h = (TextHeader*)(textArena + off);
+  h->hash = hash;
+  h->len = len;
+  h->refs = 1;
+  memcpy(h + 1, str, len);
+  ((char*)(h + 1))[len] = '\0';
+  TextRef r = off + 1;
+  if (textInternCount < TEXT_INTERN_SIZE * 3 / 4) {
+    textInternTable[slot] = r;
+    textInternCount++;
+  }
+  return r;
+}
+
+TextRef textPut(const char* str) {
+  return str ? textPut(str, strlen(str)) : 0;
+}
+
+void textRelease(TextRef r) {
+  if (!r) return;
+  TextHeader* h = textHeader(r);
+  if (--h->refs > 0) return;
+  textInternRemove(r);
+  int slab = (r - 1) / TEXT_SLAB_SIZE;
+  if (--textSlabLive[slab] == 0) textSlabUsed[slab] = 0;  // スラブごと解放（確保中のスラブなら先頭から使い直す）
+}
+
+// dstを新しい文字列に差し替える（同じ文字列なら参照が増えてから減るだけ）
+void textSet(TextRef& dst, const char* str) {
+  TextRef r = textPut(str);
+  textRelease(dst);
+  dst = r;
+}
 
 struct MetaEntry {
-  String pubkey;
-  String displayName;
-  String pictureUrl;
+  PubKey pubkey;
+  TextRef displayName;
+  TextRef pictureUrl;
   uint16_t color;
   int iconPoolIdx;    // -1 = 未取得, >=0 = iconPool index
   bool metaReceived;  // kind:0を受信済みか
   bool iconFailed;    // 画像取得失敗
+  bool referenced;    // CLOCKの参照ビット（findMetaで立てる）
+  uint32_t addedSeq;  // 追加順の通し番号（先読みは新しい方から）
+  uint32_t profileAt; // 反映済みkind:0のcreated_at（古い版が後から届いたら無視する）
 };
 MetaEntry metaCache[META_CACHE_SIZE];
 int metaCacheCount = 0;
-
-// --- 投稿データ ---
-#define MAX_POSTS 5
-struct Post {
-  String content;
-  String pubkey;
-  unsigned long created_at;
+int metaClockHand = 0;
+uint32_t metaAddSeq = 0;
+
+// metaCacheのハッシュ索引: オープンアドレス法（線形探索）
+// スロットはmetaCacheの添字+1（0 = 空）。エントリは上書きされるまで動かないので
+// MetaEntry*はそのままハンドルとして持ち回せる
+#define META_INDEX_SIZE 256  // 2のべき乗、META_CACHE_SIZEの2倍以上（負荷率50%以下）
+static_assert((META_INDEX_SIZE & (META_INDEX_SIZE - 1)) == 0, "META_INDEX_SIZE must be a power of 2");
+static_assert(META_INDEX_SIZE >= META_CACHE_SIZE * 2, "META_INDEX_SIZE too small");
+uint16_t metaIndex[META_INDEX_SIZE];
+
+// --- 投稿データ（タイムラインリング）---
+// 投稿はPSRAMの固定長レコードに置き、created_at順の並びはスロット番号のリング（tlOrder）で持つ
+// 挿入はリング上の位置を二分探索し、そこから新しい側のスロット番号（2バイト）だけをずらす
+// ライブの投稿はほぼ最新側に入るのでずらす量は0。満杯なら最も古い投稿のスロットを使い回す
+// リングのtlCount件目以降には空きスロットの番号を置いておく（古い投稿を捨てるとそこに回る）
+#define TIMELINE_CAPACITY 2048        // PSRAM 144KB
+#define TIMELINE_CAPACITY_NOPSRAM 64  // PSRAMが確保できなかったときに内部DRAMに置く数
+#define TIMELINE_VISIBLE 5            // 画面に出る投稿数の上限（REQのlimitも同じ）
+#define POST_TEXT_MAX 200             // 本文はこのバイト数に詰めて保存する
+static_assert(TIMELINE_CAPACITY <= 65536, "tlOrder holds 16-bit slot numbers");
+// 満杯のリングの本文がアリーナの3/4に収まること（残りはプロフィール名・画像URL）
+static_assert(TIMELINE_CAPACITY * ((sizeof(TextHeader) + POST_TEXT_MAX + 1 + 3) & ~3u) <=
+                  TEXT_SLAB_COUNT * TEXT_SLAB_SIZE * 3 / 4,
+              "text arena too small for a full timeline");
+struct PostRecord {
+  uint8_t id[32];
+  PubKey pubkey;
+  uint32_t created_at;
+  TextRef content;
 };
-Post posts[MAX_POSTS];
-int postCount = 0;
+PostRecord* tlRecords = NULL;  // スロット順（挿入順とは無関係）
+uint16_t* tlOrder = NULL;      // リング: tlTailから古い順にスロット番号
+int tlCapacity = 0;
+int tlTail = 0;
+int tlCount = 0;
+int tlScroll = 0;  // 画面の先頭が新しい方から何件目か（0 = 最新）
+
+// n件目に新しい投稿（0 = 最新）。範囲外ならNULL
+PostRecord* timelineAt(int n) {
+  if (n < 0 || n >= tlCount) return NULL;
+  return &tlRecords[tlOrder[(tlTail + tlCount - 1 - n) % tlCapacity]];
+}
+
+// created_at順の位置に挿入し、新しい方から何件目に入ったかを返す
+// 同じidの投稿がある・満杯で最も古い投稿より古い場合は-1（contentの参照は呼び出し側に残る）
+int timelineInsert(const PostRecord& rec) {
+  if (tlCapacity == 0) return -1;
+  // 挿入位置 = created_atがrecより大きい最初の位置（古い順）
+  int lo = 0, hi = tlCount;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (tlRecords[tlOrder[(tlTail + mid) % tlCapacity]].created_at <= rec.created_at) lo = mid + 1;
+    else hi = mid;
+  }
+  // 重複チェックは同じcreated_atの範囲だけ見ればよい
+  for (int i = lo - 1; i >= 0; i--) {
+    const PostRecord& r = tlRecords[tlOrder[(tlTail + i) % tlCapacity]];
+    if (r.created_at != rec.created_at) break;
+    if (memcmp(r.id, rec.id, sizeof(rec.id)) == 0) return -1;
+  }
+  if (tlCount == tlCapacity) {
+    if (lo == 0) return -1;  // 保持している最古より古い
+    textRelease(tlRecords[tlOrder[tlTail]].content);
+    tlTail = (tlTail + 1) % tlCapacity;
+    tlCount--;
+    lo--;
+  }
+  int slot = tlOrder[(tlTail + tlCount) % tlCapacity];  // 空きスロット
+  for (int i = tlCount; i > lo; i--) {
+    tlOrder[(tlTail + i) % tlCapacity] = tlOrder[(tlTail + i - 1) % tlCapacity];
+  }
+  tlOrder[(tlTail + lo) % tlCapacity] = slot;
+  tlRecords[slot] = rec;
+  tlCount++;
+  return tlCount - 1 - lo;
+}
+
+// 最も古い投稿を捨てる（テキストアリーナが満杯のとき）。画面に出ている投稿は残すので、そこまで来たらfalse
+bool timelineDropOldest() {
+  if (tlCount <= tlScroll + TIMELINE_VISIBLE) return false;
+  textRelease(tlRecords[tlOrder[tlTail]].content);
+  tlTail = (tlTail + 1) % tlCapacity;
+  tlCount--;
+  return true;
+}
 
-bool connected = false;
 bool relayStarted = false;
 bool wifiReady = false;
 
-// アイコンプールから空きを取得
-int allocIconPool() {
-  for (int i = 0; i < ICON_BUF_COUNT; i++) {
-    if (!iconPoolUsed[i]) {
-      iconPoolUsed[i] = true;
+// --- キャッシュの置き換え (CLOCK) ---
+// metaCache・iconPoolとも、針が一周する間に参照されなかったエントリを追い出す
+// TLに表示中の投稿の作者は固定（どちらのキャッシュからも追い出さない）
+bool isMetaPinned(const MetaEntry* meta) {
+  for (int n = tlScroll; n < tlScroll + TIMELINE_VISIBLE; n++) {
+    PostRecord* p = timelineAt(n);
+    if (!p) break;
+    if (p->pubkey == meta->pubkey) return true;
+  }
+  return false;
+}
+
+bool iconPoolHasFree() {
+  for (int i = 0; i < iconPoolCount; i++) {
+    if (!iconPoolUsed[i]) return true;
+  }
+  return false;
+}
+
+// アイコンプールからスロットを取得（owner: metaCacheの添字）
+// 空きがなければmayEvictのときだけ他のアイコンを追い出す（メタデータは残る）
+int allocIconPool(int owner, bool mayEvict) {
+  int idx = -1;
+  for (int i = 0; i < iconPoolCount; i++) {
+    if (!iconPoolUsed[i]) { idx = i; break; }
+  }
+  if (idx < 0 && mayEvict) {
+    for (int n = 0; n < iconPoolCount * 2 && idx < 0; n++) {
+      int i = iconClockHand;
+      iconClockHand = (iconClockHand + 1) % iconPoolCount;
+      MetaEntry* victim = iconPoolOwner[i] >= 0 ? &metaCache[iconPoolOwner[i]] : NULL;
+      if (victim && isMetaPinned(victim)) continue;
+      if (iconPoolRef[i]) { iconPoolRef[i] = false; continue; }
+      Serial.printf("[ICON] evict slot %d\n", i);
+      if (victim) victim->iconPoolIdx = -1;  // 再び表示されたら取り直す
+      idx = i;
+    }
+  }
+  if (idx < 0) return -1; // 満杯
+  // 中身が入れ替わるので描画用コピーは捨てる
+  if (iconPoolHot[idx] >= 0) {
+    iconHotSrc[iconPoolHot[idx]] = -1;
+    iconPoolHot[idx] = -1;
+  }
+  iconPoolUsed[idx] = true;
+  iconPoolOwner[idx] = owner;
+  iconPoolRef[idx] = true;
+  iconPoolKey[idx] = metaCache[owner].pubkey;
+  return idx;
+}
+
+// metaCacheから追い出された作者のアイコンを探す（見つかればownerに付け直す）
+int reattachIconPool(int owner) {
+  for (int i = 0; i < iconPoolCount; i++) {
+    if (iconPoolUsed[i] && iconPoolOwner[i] < 0 && iconPoolKey[i] == metaCache[owner].pubkey) {
+      iconPoolOwner[i] = owner;
+      iconPoolRef[i] = true;
       return i;
     }
   }
-  return -1; // 満杯
+  return -1;
+}
+
+// 描画用: スロットの内部DRAMコピーを返す。なければ最も古いコピーと入れ替える
+const IconPacked* iconForDraw(int poolIdx) {
+  int h = iconPoolHot[poolIdx];
+  if (h < 0) {
+    h = 0;
+    for (int i = 0; i < ICON_HOT_COUNT; i++) {
+      if (iconHotSrc[i] < 0) { h = i; break; }
+      if (iconHotStamp[i] < iconHotStamp[h]) h = i;
+    }
+    if (iconHotSrc[h] >= 0) iconPoolHot[iconHotSrc[h]] = -1;
+    iconHot[h] = iconPool[poolIdx];
+    iconHotSrc[h] = poolIdx;
+    iconPoolHot[poolIdx] = h;
+  }
+  iconHotStamp[h] = ++iconHotClock;
+  return &iconHot[h];
+}
+
+// metaCacheの追い出し先を選ぶ。全エントリが固定なら-1
+int evictMetaSlot() {
+  for (int n = 0; n < META_CACHE_SIZE * 2; n++) {
+    int i = metaClockHand;
+    metaClockHand = (metaClockHand + 1) % META_CACHE_SIZE;
+    MetaEntry* meta = &metaCache[i];
+    if (isMetaPinned(meta)) continue;
+    if (meta->referenced) { meta->referenced = false; continue; }
+    return i;
+  }
+  return -1;
+}
+
+// hex 64文字 → 32バイト（pubkey・イベントid）。不正な文字・長さならfalse
+// hex 2*len文字（ちょうど）をlenバイトに
+bool hexToBytes(const char* hex, uint8_t* out, int len) {
+  if (!hex) return false;
+  for (int i = 0; i < 2 * len; i++) {
+    char c = hex[i];
+    uint8_t v;
+    if (c >= '0' && c <= '9') v = c - '0';
+    else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+    else return false;
+    if (i & 1) out[i >> 1] |= v;
+    else out[i >> 1] = v << 4;
+  }
+  return hex[2 * len] == '\0';
+}
+
+bool hexToBytes32(const char* hex, uint8_t* out) {
+  return hexToBytes(hex, out, 32);
+}
+
+bool pubkeyFromHex(const char* hex, PubKey& out) {
+  return hexToBytes32(hex, out.b);
+}
+
+// 先頭nBytesバイトをhex文字列に（REQのauthors・表示用）
+String pubkeyToHex(const PubKey& pk, int nBytes = 32) {
+  static const char digits[] = "0123456789abcdef";
+  char buf[65];
+  for (int i = 0; i < nBytes; i++) {
+    buf[i * 2] = digits[pk.b[i] >> 4];
+    buf[i * 2 + 1] = digits[pk.b[i] & 0x0F];
+  }
+  buf[nBytes * 2] = '\0';
+  return String(buf);
 }
 
 // pubkeyからカラーを生成
-uint16_t pubkeyToColor(const String& pubkey) {
-  if (pubkey.length() < 6) return WHITE;
-  uint8_t r = strtol(pubkey.substring(0, 2).c_str(), NULL, 16);
-  uint8_t g = strtol(pubkey.substring(2, 4).c_str(), NULL, 16);
-  uint8_t b = strtol(pubkey.substring(4, 6).c_str(), NULL, 16);
-  r = r / 2 + 128;
-  g = g / 2 + 128;
-  b = b / 2 + 128;
+uint16_t pubkeyToColor(const PubKey& pubkey) {
+  uint8_t r = pubkey.b[0] / 2 + 128;
+  uint8_t g = pubkey.b[1] / 2 + 128;
+  uint8_t b = pubkey.b[2] / 2 + 128;
   return M5.Lcd.color565(r, g, b);
 }
 
-MetaEntry* findMeta(const String& pubkey) {
-  for (int i = 0; i < metaCacheCount; i++) {
-    if (metaCache[i].pubkey == pubkey) return &metaCache[i];
+// 索引の初期スロット。vanity npubは先頭バイトが偏るので全ワードを混ぜる
+static uint32_t metaIndexSlot(const PubKey& pk) {
+  uint32_t h = 0;
+  for (int i = 0; i < 32; i += 4) {
+    uint32_t w;
+    memcpy(&w, pk.b + i, 4);
+    h ^= w;
+  }
+  return ((h * 2654435761u) >> 16) & (META_INDEX_SIZE - 1);
+}
+
+MetaEntry* findMeta(const PubKey& pubkey) {
+  for (uint32_t s = metaIndexSlot(pubkey);; s = (s + 1) & (META_INDEX_SIZE - 1)) {
+    uint16_t h = metaIndex[s];
+    if (h == 0) return NULL;
+    if (metaCache[h - 1].pubkey == pubkey) {
+      metaCache[h - 1].referenced = true;
+      return &metaCache[h - 1];
+    }
   }
-  return NULL;
 }
 
-void addMeta(const String& pubkey, const String& displayName, const String& pictureUrl) {
+void metaIndexInsert(int idx) {
+  uint32_t s = metaIndexSlot(metaCache[idx].pubkey);
+  while (metaIndex[s] != 0) s = (s + 1) & (META_INDEX_SIZE - 1);
+  metaIndex[s] = idx + 1;
+}
+
+// 削除は後方シフト（トゥームストーンを残さない）: 空きスロットの後ろに続く
+// エントリのうち、本来の位置から見て空きを越えているものを詰める
+void metaIndexRemove(int idx) {
+  const uint32_t mask = META_INDEX_SIZE - 1;
+  uint32_t s = metaIndexSlot(metaCache[idx].pubkey);
+  while (metaIndex[s] != idx + 1) s = (s + 1) & mask;
+  for (uint32_t next = (s + 1) & mask; metaIndex[next] != 0; next = (next + 1) & mask) {
+    uint32_t home = metaIndexSlot(metaCache[metaIndex[next] - 1].pubkey);
+    if (((next - home) & mask) >= ((next - s) & mask)) {
+      metaIndex[s] = metaIndex[next];
+      s = next;
+    }
+  }
+  metaIndex[s] = 0;
+}
+
+void metaRecentForget(const PubKey& pubkey);
+
+// 満杯でも追加できなければ（全エントリが固定）NULL
+// displayName・pictureUrlはNULLか空文字列なら未設定（既存エントリの値は残す）
+MetaEntry* addMeta(const PubKey& pubkey, const char* displayName, const char* pictureUrl) {
+  bool hasName = displayName && displayName[0];
+  bool hasPicture = pictureUrl && pictureUrl[0];
   MetaEntry* existing = findMeta(pubkey);
   if (existing) {
-    if (displayName.length() > 0) existing->displayName = displayName;
-    if (pictureUrl.length() > 0) existing->pictureUrl = pictureUrl;
+    if (hasName) textSet(existing->displayName, displayName);
+    if (hasPicture) textSet(existing->pictureUrl, pictureUrl);
     existing->metaReceived = true;
-    return;
+    return existing;
   }
   int idx;
   if (metaCacheCount < META_CACHE_SIZE) {
     idx = metaCacheCount++;
   } else {
-    // 最古を上書き（アイコンプール解放）
-    idx = 0;
-    if (metaCache[0].iconPoolIdx >= 0) {
-      iconPoolUsed[metaCache[0].iconPoolIdx] = false;
+    // CLOCKで選んだエントリをその場で上書き。他のエントリの添字は変わらない
+    // アイコンはプールに残す（同じ作者が再び現れたら取り直さずに付け直す）
+    idx = evictMetaSlot();
+    if (idx < 0) return NULL;
+    metaIndexRemove(idx);
+    metaRecentForget(metaCache[idx].pubkey);  // また表示されたら問い合わせ直せるように
+    if (metaCache[idx].iconPoolIdx >= 0) {
+      iconPoolOwner[metaCache[idx].iconPoolIdx] = -1;
     }
-    for (int i = 0; i < META_CACHE_SIZE - 1; i++) metaCache[i] = metaCache[i + 1];
-    idx = META_CACHE_SIZE - 1;
   }
   metaCache[idx].pubkey = pubkey;
-  metaCache[idx].displayName = displayName;
-  metaCache[idx].pictureUrl = pictureUrl;
+  textSet(metaCache[idx].displayName, hasName ? displayName : NULL);
+  textSet(metaCache[idx].pictureUrl, hasPicture ? pictureUrl : NULL);
   metaCache[idx].color = pubkeyToColor(pubkey);
-  metaCache[idx].iconPoolIdx = -1;
-  metaCache[idx].metaReceived = (displayName.length() > 0 || pictureUrl.length() > 0);
+  metaCache[idx].iconPoolIdx = reattachIconPool(idx);
+  metaCache[idx].metaReceived = hasName || hasPicture;
   metaCache[idx].iconFailed = false;
+  metaCache[idx].referenced = true;
+  metaCache[idx].addedSeq = metaAddSeq++;
+  metaCache[idx].profileAt = 0;
+  metaIndexInsert(idx);
+  return &metaCache[idx];
+}
+
+// --- サブスクリプション管理 ---
+// 購読IDは "<スロット1桁><世代3桁>" の4桁hex。受信時は文字列比較せずにIDからスロットを引く
+// 同じ購読を複数のリレーに同じIDで送り、リレーごとに開いているかを持つ
+// 一回きりの購読（kind:0）は成績上位のリレーに出し、最初にEOSEを返したリレーで完了として全リレーでCLOSE
+// 継続する購読（TL）は再接続のたびに、そのリレーから最後に受け取った投稿以降（since）だけを送り直す
+// 「最後に受け取った投稿」は検証を通ったものだけ、未来の日付はNTPの時刻に丸める。時計が合うまではsinceを付けない
+// since付きの1ページで収まらなかった分は、さかのぼる一回きりの購読（SUB_BACKFILL）でページごとに埋める
+// 同時に開く数はリレーごとにsubLimitまで。超えた分は待たせ、CLOSEDで上限に当たったと分かったら下げる
+#define SUB_SLOTS 8                // 16まで（IDの1桁目）
+#define SUB_LIMIT_DEFAULT 8        // リレーの上限が分かるまでの同時購読数
+#define SUB_RETRY_MS 5000          // CLOSEDされた購読を送り直すまでの間隔
+#define RELAY_ONESHOT_FANOUT 2     // 一回きりの購読を出すリレーの数
+#define RESUME_SKEW_S 60           // 送り直すときのsinceを最新のcreated_atからさかのぼらせる秒数（時計のずれ・遅れて届く投稿）
+#define RESUME_PAGE 50             // since付きで送り直すときの1ページの件数
+#define RESUME_MAX_PAGES 10        // 取りこぼしを埋めるためにさかのぼるページ数の上限
+#define NTP_SERVER "pool.ntp.org"
+#define CLOCK_VALID_AFTER 1700000000UL  // これより前なら時計はまだ合っていない（NTP待ち）
+enum SubType : uint8_t { SUB_TIMELINE, SUB_META, SUB_BACKFILL };
+enum SubState : uint8_t { SUB_FREE, SUB_QUEUED, SUB_OPEN };  // リレーごとの状態（FREE = そのリレーには出していない）
+// 購読のリレーごとの状態
+struct SubRelay {
+  SubState state;
+  unsigned long sentAt;   // EOSEまでの時間を測る
+  unsigned long retryAt;
+  uint32_t newest;        // このリレーから届いた最新のcreated_at（TLを送り直すときのsince）
+  // since付きで送ったときの1ページ目の受信状況（EOSEで取りこぼしがないか判定する）
+  bool paging;
+  uint16_t pageCount;
+  uint32_t pageSince;
+  uint32_t pageOldest;
+};
+struct Subscription {
+  bool used;
+  SubType type;
+  bool oneShot;       // EOSEでCLOSEする
+  uint16_t gen;       // スロットを使い回すたびに進める（閉じた購読の遅れて届くEVENTを捨てる）
+  int owner;          // 持ち主側の番号（SUB_METAならmetaBatchesの添字、SUB_BACKFILLならページ番号）
+  String filter;      // REQのフィルタ（limit・since・untilを除くJSON）。再送用に持っておく
+  int limit;
+  uint32_t since;     // 0 = 指定なし
+  uint32_t until;
+  unsigned long openedAt;  // 最後にREQを送った時刻
+  SubRelay on[RELAY_MAX];
+};
+Subscription subs[SUB_SLOTS];
+
+void metaBatchDone(int batch);
+static void subCloseOn(int slot, int r);
+
+// 購読を出していないつながっているリレーのうち成績が一番よいもの（降格していないものを優先）。なければ-1
+static int relayBestFor(int slot) {
+  int best = -1;
+  int bestScore = -1;
+  for (int r = 0; r < relayCount; r++) {
+    if (!relays[r].connected || subs[slot].on[r].state != SUB_FREE) continue;
+    int score = relayScore(r) + (relays[r].demoted ? 0 : 1000);
+    if (score > bestScore) {
+      best = r;
+      bestScore = score;
+    }
+  }
+  return best;
+}
+
+// 継続する購読を出すリレーを決め直す: 降格していないリレー全部
+// （降格していないリレーがつながっていなければ全リレー）
+static void subAssign(int slot) {
+  bool anyHealthy = relaysHealthy() > 0;
+  for (int r = 0; r < relayCount; r++) {
+    bool want = !relays[r].demoted || !anyHealthy;
+    if (want && subs[slot].on[r].state == SUB_FREE) {
+      subs[slot].on[r].state = SUB_QUEUED;
+      subs[slot].on[r].retryAt = millis();
+    } else if (!want && subs[slot].on[r].state != SUB_FREE) {
+      subCloseOn(slot, r);
+    }
+  }
+}
+
+static void subIdOf(int slot, char* out) {
+  snprintf(out, 5, "%04x", (unsigned)((slot << 12) | subs[slot].gen));
+}
+
+// 購読IDからスロット。閉じた購読や他のIDならNULL
+Subscription* subLookup(const char* id, size_t len) {
+  if (len != 4) return NULL;
+  uint32_t v = 0;
+  for (int i = 0; i < 4; i++) {
+    char c = id[i];
+    uint8_t d;
+    if (c >= '0' && c <= '9') d = c - '0';
+    else if (c >= 'a' && c <= 'f') d = c - 'a' + 10;
+    else return NULL;
+    v = (v << 4) | d;
+  }
+  int slot = v >> 12;
+  if (slot >= SUB_SLOTS || !subs[slot].used || subs[slot].gen != (v & 0xFFF)) return NULL;
+  return &subs[slot];
 }
 
-void requestMeta(const String& pubkey) {
-  if (findMeta(pubkey)) return;
-  addMeta(pubkey, "", "");
+// どれかのリレーで開いているか
+bool subIsOpen(int slot) {
+  for (int r = 0; r < relayCount; r++) {
+    if (subs[slot].on[r].state == SUB_OPEN) return true;
+  }
+  return false;
+}
+
+static void subSendReq(int r, int slot) {
+  Subscription& sub = subs[slot];
+  SubRelay& on = sub.on[r];
+  uint32_t since = sub.since;
+  int limit = sub.limit;
+  bool resumed = !sub.oneShot && on.newest > RESUME_SKEW_S;
+  if (resumed) {
+    since = on.newest - RESUME_SKEW_S;
+    limit = RESUME_PAGE;
+  }
+  on.paging = resumed || sub.type == SUB_BACKFILL;
+  on.pageCount = 0;
+  on.pageSince = since;
+  on.pageOldest = UINT32_MAX;
+
+  char id[5];
+  subIdOf(slot, id);
+  String msg = "[\"REQ\",\"" + String(id) + "\"," + sub.filter.substring(0, sub.filter.length() - 1) +
+    ",\"limit\":" + String(limit);
+  if (since) msg += ",\"since\":" + String(since);
+  if (sub.until) msg += ",\"until\":" + String(sub.until);
+  msg += "}]";
+  relays[r].ws.sendTXT(msg);
+  on.state = SUB_OPEN;
+  sub.openedAt = on.sentAt = millis();
+  relays[r].subOpenCount++;
+  Serial.printf("[SUB] %s REQ %s (%d/%d open)\n", relayConfigs[r].host, id, relays[r].subOpenCount, relays[r].subLimit);
+}
+
+// 待っている購読を、接続中のリレーごとに上限まで送る（スロット順 = TLが先）
+void subPump() {
+  unsigned long now = millis();
+  for (int r = 0; r < relayCount; r++) {
+    if (!relays[r].connected) continue;
+    for (int i = 0; i < SUB_SLOTS && relays[r].subOpenCount < relays[r].subLimit; i++) {
+      if (subs[i].used && subs[i].on[r].state == SUB_QUEUED && (long)(now - subs[i].on[r].retryAt) >= 0) {
+        subSendReq(r, i);
+      }
+    }
+  }
+}
+
+// filterはlimit・since・untilを除いたJSONオブジェクト（キーが1つ以上）
+// relayを指定した一回きりの購読はそのリレーにだけ出す。空きスロットがなければ-1
+int subOpen(SubType type, int owner, bool oneShot, const String& filter, int limit,
+            uint32_t since = 0, uint32_t until = 0, int relay = -1) {
+  for (int i = 0; i < SUB_SLOTS; i++) {
+    if (subs[i].used) continue;
+    subs[i].used = true;
+    subs[i].type = type;
+    subs[i].oneShot = oneShot;
+    subs[i].gen = (subs[i].gen + 1) & 0xFFF;
+    subs[i].owner = owner;
+    subs[i].filter = filter;
+    subs[i].limit = limit;
+    subs[i].since = since;
+    subs[i].until = until;
+    for (int r = 0; r < relayCount; r++) {
+      subs[i].on[r].state = SUB_FREE;
+      subs[i].on[r].retryAt = millis();
+      subs[i].on[r].newest = 0;
+      subs[i].on[r].paging = false;
+    }
+    if (oneShot && relay >= 0) {
+      subs[i].on[relay].state = SUB_QUEUED;
+    } else if (oneShot) {
+      // 成績上位のリレーだけに聞く（つながっているリレーがなければ最初につながったリレー）
+      int picked = 0;
+      for (; picked < RELAY_ONESHOT_FANOUT; picked++) {
+        int r = relayBestFor(i);
+        if (r < 0) break;
+        subs[i].on[r].state = SUB_QUEUED;
+      }
+      if (picked == 0) {
+        for (int r = 0; r < relayCount; r++) subs[i].on[r].state = SUB_QUEUED;
+      }
+    } else {
+      subAssign(i);
+    }
+    subPump();
+    return i;
+  }
+  return -1;
+}
+
+// 1つのリレーでだけ閉じる
+static void subCloseOn(int slot, int r) {
+  if (subs[slot].on[r].state == SUB_OPEN) {
+    char id[5];
+    subIdOf(slot, id);
+    relays[r].ws.sendTXT("[\"CLOSE\",\"" + String(id) + "\"]");
+    relays[r].subOpenCount--;
+  }
+  subs[slot].on[r].state = SUB_FREE;
+}
+
+void subClose(int slot) {
+  for (int r = 0; r < relayCount; r++) subCloseOn(slot, r);
+  subs[slot].used = false;
+  subs[slot].filter = String();
+  subPump();
+}
+
+// 購読が終わったことを持ち主に知らせる
+static void subFinished(Subscription& sub) {
+  if (sub.type == SUB_META) metaBatchDone(sub.owner);
+}
+
+// 受信したEVENTのcreated_at（TL・さかのぼりの購読）。ページが埋まったかの判定だけ
+void subNoteEvent(Subscription& sub, int r, uint32_t createdAt) {
+  SubRelay& on = sub.on[r];
+  if (!on.paging) return;
+  on.pageCount++;
+  if (createdAt < on.pageOldest) on.pageOldest = createdAt;
+}
+
+// 今のUNIX時刻。NTPで合わせる前は0
+uint32_t clockNow() {
+  time_t t = time(NULL);
+  return t >= (time_t)CLOCK_VALID_AFTER ? (uint32_t)t : 0;
+}
+
+// 検証を通ったTLイベントのcreated_at（送り直すときのsince）。genが違えばその間に閉じた購読
+void subNoteNewest(int slot, uint16_t gen, int r, uint32_t createdAt) {
+  Subscription& sub = subs[slot];
+  if (!sub.used || sub.gen != gen) return;
+  uint32_t now = clockNow();
+  if (now == 0) return;  // 時計が合うまでは覚えない（sinceなしで送り直す）
+  if (createdAt > now) createdAt = now;  // 未来の日付の投稿で続きを飛ばさない
+  if (createdAt > sub.on[r].newest) sub.on[r].newest = createdAt;
+}
+
+// sinceからuntilまでをさかのぼって取る（pageはさかのぼったページ数）
+static void subOpenBackfill(const String& filter, int r, uint32_t since, uint32_t until, int page) {
+  if (subOpen(SUB_BACKFILL, page, true, filter, RESUME_PAGE, since, until, r) < 0) {
+    Serial.printf("[SUB] no slot to backfill %u..%u\n", since, until);
+  }
+}
+
+void subOnEose(Subscription& sub, int r) {
+  SubRelay& on = sub.on[r];
+  if (on.state == SUB_OPEN) statsAverage(relays[r].stats.eoseMs, millis() - on.sentAt);
+  // ページが埋まった: pageSinceからページの一番古い投稿までに取りこぼしがある
+  bool gap = on.paging && on.pageCount >= RESUME_PAGE && on.pageOldest > on.pageSince;
+  uint32_t gapUntil = on.pageOldest;
+  if (gap && sub.type == SUB_BACKFILL && gapUntil >= sub.until) gapUntil = sub.until - 1;  // 同じ秒だけで埋まった
+  int page = sub.type == SUB_BACKFILL ? sub.owner + 1 : 1;
+  String filter = gap ? sub.filter : String();  // subCloseで消える
+  on.paging = false;
+  if (sub.oneShot) {
+    subClose(&sub - subs);
+    subFinished(sub);
+  }
+  if (gap && page <= RESUME_MAX_PAGES) subOpenBackfill(filter, r, on.pageSince, gapUntil, page);
+}
+
+// ["CLOSED",<id>,<message>]: 上限・レート制限なら上限を下げて待ち直す
+// それ以外の拒否は、一回きりの購読ならそのリレーでは諦め（全リレーで諦めたら完了）、TLは間隔をあけて送り直す
+void subOnClosed(Subscription& sub, int r, const char* message) {
+  if (sub.on[r].state == SUB_OPEN) relays[r].subOpenCount--;
+  relays[r].stats.errors++;
+  relays[r].stats.totalErrors++;
+  bool limited = strncmp(message, "rate-limited:", 13) == 0 || strstr(message, "subscriptions");
+  Serial.printf("[SUB] %s CLOSED slot %d: %s\n", relayConfigs[r].host, (int)(&sub - subs), message);
+  int open = relays[r].subOpenCount;
+  if (limited && open > 0 && open < relays[r].subLimit) relays[r].subLimit = open;
+  if (limited || !sub.oneShot) {
+    sub.on[r].state = SUB_QUEUED;
+    sub.on[r].retryAt = millis() + SUB_RETRY_MS;
+    return;
+  }
+  sub.on[r].state = SUB_FREE;
+  for (int i = 0; i < relayCount; i++) {
+    if (sub.on[i].state != SUB_FREE) return;
+  }
+  sub.used = false;
+  sub.filter = String();
+  subFinished(sub);
+}
+
+// 切断時: そのリレーで開いていた購読は待ちに戻す（再接続後に送り直す）
+// EOSE前の一回きりの購読は、他に聞いているリレーがなければ別のつながっているリレーに回す
+void subDisconnected(int r) {
+  relays[r].subOpenCount = 0;
+  for (int i = 0; i < SUB_SLOTS; i++) {
+    if (!subs[i].used || subs[i].on[r].state != SUB_OPEN) continue;
+    subs[i].on[r].state = SUB_QUEUED;
+    subs[i].on[r].retryAt = millis();
+    if (!subs[i].oneShot) continue;
+    bool others = false;
+    for (int o = 0; o < relayCount; o++) {
+      if (o != r && subs[i].on[o].state != SUB_FREE) others = true;
+    }
+    if (others) {
+      subs[i].on[r].state = SUB_FREE;
+      continue;
+    }
+    int alt = relayBestFor(i);
+    if (alt < 0) continue;
+    subs[i].on[r].state = SUB_FREE;
+    subs[i].on[alt].state = SUB_QUEUED;
+  }
+}
+
+// --- リレーの成績 ---
+// RELAY_STATS_INTERVAL_MSごとに集計し、成績の悪いリレーを降格する（戻すときは少し高い点を要求）
+// 降格したリレーには継続する購読を出さない（他につながっている健全なリレーがあるときだけ）
+#define RELAY_STATS_INTERVAL_MS 10000
+#define RELAY_DEMOTE_SCORE 40
+#define RELAY_PROMOTE_SCORE 55
+#define RELAY_RECONNECT_MS 5000
+#define RELAY_RECONNECT_MAX_MS 60000
+unsigned long relayStatsAt = 0;
+int headerRelay = 0;  // ヘッダに計測値を出すリレー（集計のたびに順に切り替える）
+
+void drawHeader();
+
+// 継続する購読の出し先を決め直す
+void relayReroute() {
+  for (int i = 0; i < SUB_SLOTS; i++) {
+    if (subs[i].used && !subs[i].oneShot) subAssign(i);
+  }
+  subPump();
+}
+
+// 切断・接続失敗が続くリレーほど再接続の間隔をあける
+void relayBackoff(int r) {
+  unsigned long ms = RELAY_RECONNECT_MS * (1 + (unsigned long)relays[r].stats.disconnects + (unsigned long)relays[r].stats.errors +
+                                           (unsigned long)relays[r].reconnectFails);
+  relays[r].ws.setReconnectInterval(ms < RELAY_RECONNECT_MAX_MS ? ms : RELAY_RECONNECT_MAX_MS);
+}
+
+// "1:S87 E420 L35 3.2/s" （番号:点数 EOSEまでms 遅れms イベント/s）
+void relayStatusLine(int r, char* buf, size_t size) {
+  const RelayStats& st = relays[r].stats;
+  snprintf(buf, size, "%d:S%d E%d L%d %.1f/s", r + 1, relayScore(r),
+    st.eoseMs < 0 ? 0 : (int)st.eoseMs, st.lagMs < 0 ? 0 : (int)st.lagMs,
+    st.eventsPerSec < 0 ? 0 : st.eventsPerSec);
+}
+
+void processRelayStats() {
+  unsigned long now = millis();
+  unsigned long elapsed = now - relayStatsAt;
+  if (elapsed < RELAY_STATS_INTERVAL_MS) return;
+  relayStatsAt = now;
+  for (int r = 0; r < relayCount; r++) {
+    RelayStats& st = relays[r].stats;
+    statsAverage(st.eventsPerSec, st.events * 1000.0f / elapsed);
+    st.events = 0;
+    st.errors *= 0.9f;
+    st.disconnects *= 0.9f;
+    // 降格中はTLを出していないので計測が更新されない。古い遅れを少しずつ忘れて、いずれ試し直す
+    if (relays[r].demoted) {
+      st.eoseMs *= 0.9f;
+      st.lagMs *= 0.9f;
+    }
+    int score = relayScore(r);
+    bool demoted = relays[r].demoted ? score < RELAY_PROMOTE_SCORE : score < RELAY_DEMOTE_SCORE;
+    if (demoted != relays[r].demoted) {
+      relays[r].demoted = demoted;
+      Serial.printf("[RELAY] %s %s (score %d)\n", relayConfigs[r].host, demoted ? "demoted" : "promoted", score);
+    }
+  }
+  relayReroute();
+  headerRelay = (headerRelay + 1) % relayCount;
+  drawHeader();
+}
+
+// --- kind:0の取得（まとめてREQ）---
+// 知らない作者はいったん待ち行列に入れ、META_FETCH_DEBOUNCE_MSの間に集まった分を
+// 1つのREQ（authorsに複数）で送る。一回きりの購読なのでEOSEでCLOSEされる
+// 問い合わせ中・問い合わせ済みの作者はmetaCacheとは別に覚える（kind:0が届くまでmetaCacheには入れない）
+#define META_BATCH_MAX 32            // 1つのREQのauthors数
+#define META_BATCH_INFLIGHT 2        // 同時に開くkind:0の購読数
+#define META_FETCH_DEBOUNCE_MS 300
+#define META_FETCH_TIMEOUT_MS 10000  // EOSEが来なければCLOSEして諦める
+#define META_RECENT_SIZE 128         // 問い合わせ済みの作者（kind:0がなかった作者も）を覚える数。metaCacheから追い出したら外す
+struct MetaBatch {
+  PubKey authors[META_BATCH_MAX];
+  int count;
+  int sub;  // subsのスロット
+  bool active;
+};
+PubKey metaQueue[META_BATCH_MAX];
+int metaQueueCount = 0;
+unsigned long metaQueueSince = 0;
+MetaBatch metaBatches[META_BATCH_INFLIGHT];
+uint64_t metaRecent[META_RECENT_SIZE];  // pubkeyの先頭8バイト（0 = 空き）
+int metaRecentHead = 0;
+
+static uint64_t pubkeyPrefix(const PubKey& pk) {
+  uint64_t v;
+  memcpy(&v, pk.b, sizeof(v));
+  return v ? v : 1;
+}
+
+// 待ち行列・問い合わせ中・最近問い合わせ済みのどれかならtrue
+static bool metaFetchKnows(const PubKey& pubkey) {
+  for (int i = 0; i < metaQueueCount; i++) {
+    if (metaQueue[i] == pubkey) return true;
+  }
+  for (int b = 0; b < META_BATCH_INFLIGHT; b++) {
+    if (!metaBatches[b].active) continue;
+    for (int i = 0; i < metaBatches[b].count; i++) {
+      if (metaBatches[b].authors[i] == pubkey) return true;
+    }
+  }
+  uint64_t prefix = pubkeyPrefix(pubkey);
+  for (int i = 0; i < META_RECENT_SIZE; i++) {
+    if (metaRecent[i] == prefix) return true;
+  }
+  return false;
+}
+
+void requestMeta(const PubKey& pubkey) {
+  if (findMeta(pubkey) || metaFetchKnows(pubkey)) return;
+  if (metaQueueCount >= META_BATCH_MAX) return;  // 満杯（次にその作者の投稿が来たらまた頼む）
+  if (metaQueueCount == 0) metaQueueSince = millis();
+  metaQueue[metaQueueCount++] = pubkey;
+}
+
+// metaCacheから追い出した作者を問い合わせ済みから外す
+void metaRecentForget(const PubKey& pubkey) {
+  uint64_t prefix = pubkeyPrefix(pubkey);
+  for (int i = 0; i < META_RECENT_SIZE; i++) {
+    if (metaRecent[i] == prefix) metaRecent[i] = 0;
+  }
+}
+
+// 購読が終わった（EOSE・拒否・タイムアウト）: 問い合わせた作者を問い合わせ済みとして覚える
+void metaBatchDone(int batch) {
+  MetaBatch& b = metaBatches[batch];
+  for (int i = 0; i < b.count; i++) {
+    metaRecent[metaRecentHead] = pubkeyPrefix(b.authors[i]);
+    metaRecentHead = (metaRecentHead + 1) % META_RECENT_SIZE;
+  }
+  b.active = false;
+}
+
+// loopから: 待ち行列をまとめて送る・EOSEが来ないバッチを閉じる
+void processMetaFetch() {
+  unsigned long now = millis();
+  for (int b = 0; b < META_BATCH_INFLIGHT; b++) {
+    int sub = metaBatches[b].sub;
+    if (metaBatches[b].active && subIsOpen(sub) && now - subs[sub].openedAt > META_FETCH_TIMEOUT_MS) {
+      Serial.printf("[META] batch %d timed out\n", b);
+      for (int r = 0; r < relayCount; r++) {
+        if (subs[sub].on[r].state == SUB_OPEN) relays[r].stats.errors++;
+      }
+      subClose(metaBatches[b].sub);
+      metaBatchDone(b);
+    }
+  }
+  if (relaysConnected() == 0 || metaQueueCount == 0) return;
+  if (metaQueueCount < META_BATCH_MAX && now - metaQueueSince < META_FETCH_DEBOUNCE_MS) return;
+  int b = 0;
+  while (b < META_BATCH_INFLIGHT && metaBatches[b].active) b++;
+  if (b == META_BATCH_INFLIGHT) return;  // 空くまで待ち行列に溜める
 
   JsonDocument doc;
-  JsonArray arr = doc.to<JsonArray>();
-  arr.add("REQ");
-  arr.add("meta_" + pubkey.substring(0, 8));
-  JsonObject filter = arr.add<JsonObject>();
+  JsonObject filter = doc.to<JsonObject>();
   JsonArray kinds = filter["kinds"].to<JsonArray>();
   kinds.add(0);
   JsonArray authors = filter["authors"].to<JsonArray>();
-  authors.add(pubkey);
-  filter["limit"] = 1;
-  String msg;
-  serializeJson(doc, msg);
-  webSocket.sendTXT(msg);
+  for (int i = 0; i < metaQueueCount; i++) authors.add(pubkeyToHex(metaQueue[i]));
+  String json;
+  serializeJson(doc, json);
+  int sub = subOpen(SUB_META, b, true, json, metaQueueCount);
+  if (sub < 0) return;  // スロットが空くまで待つ
+
+  MetaBatch& batch = metaBatches[b];
+  memcpy(batch.authors, metaQueue, metaQueueCount * sizeof(PubKey));
+  batch.count = metaQueueCount;
+  batch.sub = sub;
+  batch.active = true;
+  metaQueueCount = 0;
+  Serial.printf("[META] batch %d: %d authors\n", b, batch.count);
+}
+
+// --- 中央正方形クロップ ---
+// アイコンは正方形で描画するので、非正方形画像は中央の正方形だけをデコードする
+// 縦長画像はクロップ下端の行でデコードを打ち切れる
+struct CropRect {
+  int x, y, w, h;
+};
+
+CropRect decodeCropRect(int w, int h, bool centerCrop) {
+  if (!centerCrop) return { 0, 0, w, h };
+  int s = min(w, h);
+  return { (w - s) / 2, (h - s) / 2, s, s };
+}
+
+// --- デコーダのメモリ使用量 ---
+// libwebp/libjpegの確保はdecmem経由 (小さいテーブル→内部DRAM、画素・係数バッファ→PSRAM)
+// デコード前にdecmem_reset_peaks()し、デコード後に層ごとのピークを出す
+void logDecMem(const char* tag) {
+  decmem_stats_t st;
+  decmem_get_stats(&st);
+  Serial.printf("[%s] mem peak dram=%u psram=%u arena=%u/%u fallbacks=%u failures=%u overflows=%u\n", tag,
+    (unsigned)st.tier[DECMEM_DRAM].peak, (unsigned)st.tier[DECMEM_PSRAM].peak,
+    (unsigned)st.arena_peak, (unsigned)st.arena_cap,
+    (unsigned)(st.tier[DECMEM_DRAM].fallbacks + st.tier[DECMEM_PSRAM].fallbacks),
+    (unsigned)st.failures, (unsigned)st.arena_overflows);
 }
 
 // --- WebP デコーダ (libwebp, スケーリング対応) ---
-bool decodeWebpToSprite(const uint8_t* data, int dataLen, TFT_eSprite& sprite, int spriteSize) {
+// dst(iconStaging)へバイトスワップ済みRGB565で直接デコード
+// 透過部分はプレースホルダ色(bgColor, RGB565)に合成
+// centerCrop: 中央正方形のみデコード（libwebpのuse_cropping、下端以降のマクロブロック行は処理しない）
+bool decodeWebpToIcon(const uint8_t* data, int dataLen, uint16_t* dst, uint16_t bgColor, bool centerCrop) {
   int w, h;
   if (!WebPGetInfo(data, dataLen, &w, &h)) {
     Serial.println("[WEBP] GetInfo failed");
@@ -158,10 +1222,22 @@ bool decodeWebpToSprite(const uint8_t* data, int dataLen, TFT_eSprite& sprite, i
   }
   Serial.printf("[WEBP] %dx%d, heap=%d\n", w, h, ESP.getFreeHeap());
 
-  // スケーリングデコード: spriteSize以下に縮小
+  // スケーリングデコード: ICON_SIZE以下に縮小
   WebPDecoderConfig config;
   if (!WebPInitDecoderConfig(&config)) { Serial.println("[WEBP] init config failed"); return false; }
 
+  CropRect crop = decodeCropRect(w, h, centerCrop);
+  if (crop.w != w || crop.h != h) {
+    config.options.use_cropping = 1;
+    config.options.crop_left = crop.x;
+    config.options.crop_top = crop.y;
+    config.options.crop_width = crop.w;
+    config.options.crop_height = crop.h;
+    Serial.printf("[WEBP] crop %dx%d+%d+%d\n", crop.w, crop.h, crop.x, crop.y);
+  }
+  w = crop.w;
+  h = crop.h;
+
   config.options.use_scaling = 1;
   // 直接ICON_SIZE(32x32)にスケーリング → ヒープ節約
   int targetSize = ICON_SIZE; // 32
@@ -174,25 +1250,32 @@ bool decodeWebpToSprite(const uint8_t* data, int dataLen, TFT_eSprite& sprite, i
   if (scaledH < 1) scaledH = 1;
   config.options.scaled_width = scaledW;
   config.options.scaled_height = scaledH;
-  config.output.colorspace = MODE_RGB;
-
-  size_t outSize = scaledW * scaledH * 3;
-  Serial.printf("[WEBP] scaling to %dx%d (%d bytes), psram=%d\n", scaledW, scaledH, outSize, ESP.getFreePsram());
-
+  // クロップ範囲を32の整数倍に削る（各辺1/16以内）→ リサイズが整数比のボックス平均になる
+  config.options.use_box_scaling = 1;
+  // フィルタ・出力をもう片方のコアのワーカーで並列実行（幅512px以上で有効）
+  config.options.use_threads = 1;
+  // 1/16以下への縮小ならマクロブロックのDCだけ復元（IDCT・フィルタ・リサイズ省略、近似）
+  config.options.use_dc_only = 1;
+  // 透過はRGB565への変換時にプレースホルダ色と合成 (0xRRGGBBに展開)
+  config.options.use_bgcolor = 1;
+  config.options.bgcolor = ((uint32_t)((bgColor >> 11) * 255 / 31) << 16) |
+                           ((uint32_t)(((bgColor >> 5) & 0x3F) * 255 / 63) << 8) |
+                           (uint32_t)((bgColor & 0x1F) * 255 / 31);
+  // 出力先はiconStaging（libwebpはMODE_RGB_565を上位バイト先に書く = pushImage用のバイトスワップ済み形式）
+  memset(dst, 0, ICON_BYTES); // 縦横比で余る部分は黒
+  config.output.colorspace = MODE_RGB_565;
+  config.output.is_external_memory = 1;
+  config.output.u.RGBA.rgba = (uint8_t*)dst;
+  config.output.u.RGBA.stride = ICON_SIZE * 2;
+  config.output.u.RGBA.size = ICON_BYTES;
+
+  Serial.printf("[WEBP] scaling to %dx%d, psram=%d\n", scaledW, scaledH, ESP.getFreePsram());
+
+  decmem_reset_peaks();
   VP8StatusCode status = WebPDecode(data, dataLen, &config);
-  if (status != VP8_STATUS_OK) { Serial.printf("[WEBP] decode failed: %d\n", status); WebPFreeDecBuffer(&config.output); return false; }
+  logDecMem("WEBP");
+  if (status != VP8_STATUS_OK) { Serial.printf("[WEBP] decode failed: %d\n", status); return false; }
 
-  uint8_t* rgb = config.output.u.RGBA.rgba;
-  int stride = config.output.u.RGBA.stride;
-  for (int y = 0; y < scaledH; y++) {
-    for (int x = 0; x < scaledW; x++) {
-      int idx = y * stride + x * 3;
-      sprite.drawPixel(x, y, sprite.color565(rgb[idx], rgb[idx+1], rgb[idx+2]));
-    }
-    yield();
-  }
-
-  WebPFreeDecBuffer(&config.output);
   Serial.println("[WEBP] decode OK");
   return true;
 }
@@ -200,8 +1283,9 @@ bool decodeWebpToSprite(const uint8_t* data, int dataLen, TFT_eSprite& sprite, i
 // --- PNG デコーダ (自作) ---
 // imgBuf: PNGファイルデータ, imgLen: データ長
 // sprite: デコード先Sprite (createSprite済み, spriteSize x spriteSize)
+// centerCrop: 中央正方形のみ描画。クロップ下端の行でinflateを打ち切り、右端より右の列はフィルタ復元しない
 // 成功時true
-bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, int spriteSize) {
+bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, int spriteSize, bool centerCrop) {
   // PNGシグネチャ確認
   const uint8_t pngSig[] = {0x89,0x50,0x4E,0x47,0x0D,0x0A,0x1A,0x0A};
   if (imgLen < 33 || memcmp(imgBuf, pngSig, 8) != 0) { Serial.println("[PNG] bad signature"); return false; }
@@ -255,6 +1339,7 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
     if (paletteCount == 0) { Serial.println("[PNG] no PLTE for indexed"); return false; }
   }
 
+  decmem_reset_peaks();
   // IDATチャンクを結合
   // まずIDATの合計サイズを計算（切り詰められたPNG対応）
   size_t totalIdat = 0;
@@ -274,7 +1359,7 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
   if (totalIdat == 0) { Serial.println("[PNG] no IDAT"); return false; }
 
   // IDATデータを結合バッファにコピー（切り詰め対応）
-  uint8_t* idatBuf = (uint8_t*)malloc(totalIdat);
+  uint8_t* idatBuf = (uint8_t*)decmem_malloc(totalIdat, DECMEM_BULK);
   if (!idatBuf) return false;
   size_t idatOff = 0;
   scanPos = pos;
@@ -289,7 +1374,7 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
     if (scanPos > imgLen) break;
   }
 
-  if (totalIdat < 6) { Serial.println("[PNG] IDAT too small"); free(idatBuf); return false; }
+  if (totalIdat < 6) { Serial.println("[PNG] IDAT too small"); decmem_free(idatBuf); return false; }
 
   // デコード先: 各行 = filterByte(1) + ceil(width * channels * bitDepth / 8)
   size_t pixelBits = pngW * channels * bitDepth;
@@ -300,16 +1385,27 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
   Serial.printf("[PNG] rowBytes=%d, stride=%d, idatSize=%d, heap=%d, psram=%d\n",
     rowBytes, stride, totalIdat, ESP.getFreeHeap(), ESP.getFreePsram());
 
+  // クロップ範囲: yEnd以降の行は不要なのでデコードしない
+  // フィルタは左・上・左上しか参照しないので、クロップ右端より右の列は復元不要
+  CropRect crop = decodeCropRect(pngW, pngH, centerCrop);
+  uint32_t yEnd = crop.y + crop.h;
+  int unfilterBytes = (int)(((size_t)(crop.x + crop.w) * channels * bitDepth + 7) / 8);
+  if (unfilterBytes > stride) unfilterBytes = stride;
+  if (crop.w != (int)pngW || crop.h != (int)pngH) {
+    Serial.printf("[PNG] crop %dx%d+%d+%d\n", crop.w, crop.h, crop.x, crop.y);
+  }
+
   // ストリーミングデコード: リングバッファ + 2行分のみ確保
   // tinflリングバッファ: 2のべき乗サイズ（32KB）
   const size_t RING_SIZE = 32768;
-  uint8_t* ringBuf = (uint8_t*)malloc(RING_SIZE);
-  uint8_t* curRow = (uint8_t*)malloc(stride);
-  uint8_t* prevRowBuf = (uint8_t*)calloc(stride, 1);
-  tinfl_decompressor* decomp = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+  // tinflのハフマンテーブルと行バッファは毎バイト参照するのでHOT（DRAM優先）
+  tinfl_decompressor* decomp = (tinfl_decompressor*)decmem_malloc(sizeof(tinfl_decompressor), DECMEM_HOT);
+  uint8_t* ringBuf = (uint8_t*)decmem_malloc(RING_SIZE, DECMEM_BULK);
+  uint8_t* curRow = (uint8_t*)decmem_malloc(stride, DECMEM_AUTO);
+  uint8_t* prevRowBuf = (uint8_t*)decmem_calloc(stride, 1, DECMEM_AUTO);
   if (!ringBuf || !curRow || !prevRowBuf || !decomp) {
     Serial.println("[PNG] stream alloc failed");
-    free(ringBuf); free(curRow); free(prevRowBuf); free(decomp); free(idatBuf);
+    decmem_free(ringBuf); decmem_free(curRow); decmem_free(prevRowBuf); decmem_free(decomp); decmem_free(idatBuf);
     return false;
   }
   tinfl_init(decomp);
@@ -325,10 +1421,10 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
   tinfl_status status = TINFL_STATUS_NEEDS_MORE_INPUT;
 
   // 行データ一時バッファ（filterByte + stride）
-  uint8_t* rowRaw = (uint8_t*)malloc(rowBytes);
-  if (!rowRaw) { free(ringBuf); free(curRow); free(prevRowBuf); free(decomp); free(idatBuf); return false; }
+  uint8_t* rowRaw = (uint8_t*)decmem_malloc(rowBytes, DECMEM_AUTO);
+  if (!rowRaw) { decmem_free(ringBuf); decmem_free(curRow); decmem_free(prevRowBuf); decmem_free(decomp); decmem_free(idatBuf); return false; }
 
-  while (curY < pngH && status != TINFL_STATUS_DONE) {
+  while (curY < yEnd && status != TINFL_STATUS_DONE) {
     // tinflでリングバッファにデコード
     size_t inBytes = zlibLen - inPos;
     size_t outBytes = RING_SIZE - (ringPos & (RING_SIZE - 1));
@@ -342,7 +1438,7 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
     // デコードされたバイトを行バッファに詰める
     size_t bytesAvail = outBytes;
     uint8_t* src = outStart;
-    while (bytesAvail > 0 && curY < pngH) {
+    while (bytesAvail > 0 && curY < yEnd) {
       size_t need = rowBytes - rowBufPos;
       size_t take = (bytesAvail < need) ? bytesAvail : need;
       memcpy(rowRaw + rowBufPos, src, take);
@@ -354,7 +1450,7 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
         // 1行分揃った → フィルタ復元
         filterType = rowRaw[0];
         uint8_t* rawData = rowRaw + 1;
-        for (int i = 0; i < stride; i++) {
+        for (int i = 0; i < unfilterBytes; i++) {
           uint8_t raw = rawData[i];
           uint8_t a = (i >= bpp) ? curRow[i - bpp] : 0;
           uint8_t b = prevRowBuf[i];
@@ -374,12 +1470,14 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
           }
         }
 
-        // Spriteに描画（ニアレストネイバー縮小）
-        int destY = curY * spriteSize / pngH;
-        bool shouldDraw = (curY == pngH - 1) || ((int)((curY+1) * spriteSize / pngH) != destY);
+        // Spriteに描画（ニアレストネイバー縮小、クロップより上の行は描画しない）
+        int cropY = (int)curY - crop.y;
+        int destY = cropY * spriteSize / crop.h;
+        bool shouldDraw = cropY >= 0 &&
+          ((curY == yEnd - 1) || ((cropY + 1) * spriteSize / crop.h != destY));
         if (shouldDraw && destY < spriteSize) {
           for (int dx = 0; dx < spriteSize; dx++) {
-            uint32_t srcX = dx * pngW / spriteSize;
+            uint32_t srcX = crop.x + dx * crop.w / spriteSize;
             uint8_t r, g, b_val;
             if (colorType == 3) {
               uint8_t idx;
@@ -398,7 +1496,7 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
           }
         }
 
-        memcpy(prevRowBuf, curRow, stride);
+        memcpy(prevRowBuf, curRow, unfilterBytes);
         curY++;
         rowBufPos = 0;
         if (curY % 100 == 0) yield();
@@ -409,43 +1507,448 @@ bool decodePngToSprite(const uint8_t* imgBuf, int imgLen, TFT_eSprite& sprite, i
     if (status < 0) { Serial.printf("[PNG] inflate error: %d\n", status); decodeOk = false; break; }
   }
 
-  free(rowRaw);
-  free(decomp);
-  free(idatBuf);
-  free(ringBuf);
-  free(curRow);
-  free(prevRowBuf);
+  decmem_free(rowRaw);
+  decmem_free(prevRowBuf);
+  decmem_free(curRow);
+  decmem_free(ringBuf);
+  decmem_free(decomp);
+  decmem_free(idatBuf);
+  logDecMem("PNG");
 
   Serial.printf("[PNG] streaming decode: %d/%d rows, status=%d\n", curY, pngH, status);
-  if (!decodeOk && curY == 0) { Serial.println("[PNG] decode failed, no rows"); return false; }
-  if (curY < pngH) { Serial.printf("[PNG] partial decode: %d/%d rows (truncated PNG?)\n", curY, pngH); }
+  if (!decodeOk && curY <= (uint32_t)crop.y) { Serial.println("[PNG] decode failed, no rows"); return false; }
+  if (curY < yEnd) { Serial.printf("[PNG] partial decode: %d/%d rows (truncated PNG?)\n", curY, yEnd); }
   return true; // 部分デコードでもOK（切り詰めPNG対応）
 }
 
+// --- GIF デコーダ (自作, 先頭フレームのみ) ---
+// アニメーションGIFも最初のフレームだけ描画する。キャンバスは持たず、LZWが出した画素を
+// 出力セルごとの合計に足し込んで面積平均で縮小する
+// フレーム外・透過の画素はプレースホルダ色(bgColor)として平均に入る
+// dst: iconStaging（バイトスワップ済みRGB565）
+// centerCrop: 中央正方形のみ。非インターレースならクロップ下端の行でLZWを打ち切る
+#define GIF_LZW_MAX_CODES 4096  // 12bitコード
+
+// データサブブロック列からLSB順にLZWコードを読む
+struct GifCodeReader {
+  const uint8_t* data;
+  int len;
+  int pos;        // 次に読むバイト
+  int blockLeft;  // 現在のサブブロックの残りバイト
+  uint32_t bits;
+  int bitCount;
+
+  int read(int codeSize) {
+    while (bitCount < codeSize) {
+      if (blockLeft == 0) {
+        if (pos >= len || data[pos] == 0) return -1;  // ブロック終端 or 切り詰め
+        blockLeft = data[pos++];
+      }
+      if (pos >= len) return -1;
+      bits |= (uint32_t)data[pos++] << bitCount;
+      bitCount += 8;
+      blockLeft--;
+    }
+    int code = bits & ((1 << codeSize) - 1);
+    bits >>= codeSize;
+    bitCount -= codeSize;
+    return code;
+  }
+};
+
+// 出力セル1つ分の合計（不透明な画素のみ）
+struct GifCell {
+  uint32_t r, g, b, n;
+};
+
+// total個の入力をcells個のセルに等分したとき、セルdに入る入力の数
+static int gifCellSpan(int d, int total, int cells) {
+  return ((d + 1) * total + cells - 1) / cells - (d * total + cells - 1) / cells;
+}
+
+bool decodeGifToIcon(const uint8_t* data, int dataLen, uint16_t* dst, uint16_t bgColor, bool centerCrop) {
+  if (dataLen < 13 || memcmp(data, "GIF8", 4) != 0) { Serial.println("[GIF] bad signature"); return false; }
+  int canvasW = data[6] | (data[7] << 8);
+  int canvasH = data[8] | (data[9] << 8);
+  int pos = 13;
+  const uint8_t* palette = NULL;
+  int paletteCount = 0;
+  if (data[10] & 0x80) {
+    paletteCount = 2 << (data[10] & 7);
+    palette = data + pos;
+    pos += paletteCount * 3;
+  }
+
+  // 拡張ブロックを読み飛ばして最初のイメージディスクリプタへ
+  // Graphic Control Extensionは直後のフレームに効くので、最後に見たものの透過色を使う
+  int transparent = -1;
+  while (pos < dataLen && data[pos] != 0x2C) {
+    if (data[pos] != 0x21 || pos + 2 >= dataLen) { Serial.println("[GIF] no image"); return false; }
+    uint8_t label = data[pos + 1];
+    pos += 2;
+    if (label == 0xF9 && pos + 5 < dataLen && data[pos] >= 4) {
+      transparent = (data[pos + 1] & 1) ? data[pos + 4] : -1;
+    }
+    while (pos < dataLen && data[pos] != 0) pos += data[pos] + 1;
+    pos++;
+  }
+  if (pos + 11 > dataLen) { Serial.println("[GIF] no image"); return false; }
+  int frameX = data[pos + 1] | (data[pos + 2] << 8);
+  int frameY = data[pos + 3] | (data[pos + 4] << 8);
+  int frameW = data[pos + 5] | (data[pos + 6] << 8);
+  int frameH = data[pos + 7] | (data[pos + 8] << 8);
+  uint8_t imgFlags = data[pos + 9];
+  bool interlaced = imgFlags & 0x40;
+  pos += 10;
+  if (imgFlags & 0x80) {
+    paletteCount = 2 << (imgFlags & 7);
+    palette = data + pos;
+    pos += paletteCount * 3;
+  }
+  if (!palette || pos + 1 >= dataLen) { Serial.println("[GIF] no palette"); return false; }
+  int minCodeSize = data[pos++];
+  if (minCodeSize < 2 || minCodeSize > 8 || frameW == 0 || frameH == 0) {
+    Serial.println("[GIF] bad image descriptor");
+    return false;
+  }
+  // 論理画面がフレームより小さい壊れたGIFはフレームに合わせる
+  if (canvasW < frameX + frameW) canvasW = frameX + frameW;
+  if (canvasH < frameY + frameH) canvasH = frameY + frameH;
+  Serial.printf("[GIF] %dx%d, frame %dx%d+%d+%d%s, %d colors\n", canvasW, canvasH,
+    frameW, frameH, frameX, frameY, interlaced ? " (interlaced)" : "", paletteCount);
+
+  // 出力サイズ（アスペクト比維持）と、縮小用のセル数（元画像より細かくはしない）
+  CropRect crop = decodeCropRect(canvasW, canvasH, centerCrop);
+  if (crop.w != canvasW || crop.h != canvasH) {
+    Serial.printf("[GIF] crop %dx%d+%d+%d\n", crop.w, crop.h, crop.x, crop.y);
+  }
+  int outW = ICON_SIZE, outH = ICON_SIZE;
+  if (crop.w > crop.h) outH = max(1, crop.h * ICON_SIZE / crop.w);
+  else outW = max(1, crop.w * ICON_SIZE / crop.h);
+  int cellsX = min(crop.w, outW), cellsY = min(crop.h, outH);
+
+  decmem_reset_peaks();
+  // LZW辞書はコードごとに参照するのでHOT、展開スタックとセルはPSRAMで足りる
+  uint16_t* prefix = (uint16_t*)decmem_malloc(GIF_LZW_MAX_CODES * (sizeof(uint16_t) + 1), DECMEM_HOT);
+  uint8_t* stack = (uint8_t*)decmem_malloc(GIF_LZW_MAX_CODES, DECMEM_AUTO);
+  uint8_t* colCell = (uint8_t*)decmem_malloc(frameW, DECMEM_AUTO);  // フレームの列 → セル列 (0xFF = クロップ外)
+  GifCell* cells = (GifCell*)decmem_calloc(cellsX * cellsY, sizeof(GifCell), DECMEM_BULK);
+  if (!prefix || !stack || !colCell || !cells) {
+    Serial.println("[GIF] alloc failed");
+    decmem_free(cells); decmem_free(colCell); decmem_free(stack); decmem_free(prefix);
+    return false;
+  }
+  uint8_t* suffix = (uint8_t*)(prefix + GIF_LZW_MAX_CODES);
+  for (int x = 0; x < frameW; x++) {
+    int cx = frameX + x - crop.x;
+    colCell[x] = (cx >= 0 && cx < crop.w) ? cx * cellsX / crop.w : 0xFF;
+  }
+
+  // 行の並び: インターレースは 0,8,16.. → 4,12.. → 2,6.. → 1,3..
+  static const uint8_t passStart[4] = { 0, 4, 2, 1 };
+  static const uint8_t passStep[4] = { 8, 8, 4, 2 };
+  int pass = 0;
+  int row = 0, x = 0;
+  int rowsDone = 0;
+  int yEnd = crop.y + crop.h;
+  GifCell* rowCells = NULL;  // 現在の行が入るセル行 (NULL = クロップ外)
+  auto selectRow = [&]() {
+    int cy = frameY + row - crop.y;
+    rowCells = (cy >= 0 && cy < crop.h) ? cells + (cy * cellsY / crop.h) * cellsX : NULL;
+  };
+  selectRow();
+
+  GifCodeReader reader = { data, dataLen, pos, 0, 0, 0 };
+  const int clearCode = 1 << minCodeSize;
+  const int endCode = clearCode + 1;
+  int codeSize = minCodeSize + 1;
+  int nextCode = endCode + 1;
+  int prevCode = -1;
+  uint8_t firstByte = 0;
+  for (int i = 0; i < clearCode; i++) { prefix[i] = 0; suffix[i] = i; }
+
+  bool done = false;
+  while (!done) {
+    int code = reader.read(codeSize);
+    if (code < 0 || code == endCode) break;
+    if (code == clearCode) {
+      codeSize = minCodeSize + 1;
+      nextCode = endCode + 1;
+      prevCode = -1;
+      continue;
+    }
+    // コードを展開（スタックには逆順に積む）
+    int sp = 0;
+    int cur = code;
+    if (prevCode < 0) {
+      if (code > clearCode) { Serial.println("[GIF] bad first code"); break; }
+    } else if (code >= nextCode) {
+      if (code > nextCode) { Serial.printf("[GIF] bad code %d\n", code); break; }
+      stack[sp++] = firstByte;  // KwKwK: 直前の列 + その先頭
+      cur = prevCode;
+    }
+    while (cur >= clearCode) {
+      stack[sp++] = suffix[cur];
+      cur = prefix[cur];
+    }
+    firstByte = (uint8_t)cur;
+    stack[sp++] = firstByte;
+    if (prevCode >= 0 && nextCode < GIF_LZW_MAX_CODES) {
+      prefix[nextCode] = prevCode;
+      suffix[nextCode] = firstByte;
+      nextCode++;
+      if (nextCode == (1 << codeSize) && codeSize < 12) codeSize++;
+    }
+    prevCode = code;
+
+    // 展開した画素をセルに足し込む
+    while (sp > 0) {
+      uint8_t idx = stack[--sp];
+      uint8_t cellX = colCell[x];
+      if (rowCells && cellX != 0xFF && idx != transparent && idx < paletteCount) {
+        GifCell& c = rowCells[cellX];
+        const uint8_t* rgb = palette + idx * 3;
+        c.r += rgb[0]; c.g += rgb[1]; c.b += rgb[2]; c.n++;
+      }
+      if (++x < frameW) continue;
+      x = 0;
+      rowsDone++;
+      row += interlaced ? passStep[pass] : 1;
+      while (interlaced && row >= frameH && pass < 3) row = passStart[++pass];
+      // 全行そろった or クロップ下端を超えた（非インターレースのみ打ち切れる）
+      if (row >= frameH || (!interlaced && frameY + row >= yEnd)) { done = true; break; }
+      selectRow();
+      if (rowsDone % 100 == 0) yield();
+    }
+  }
+  Serial.printf("[GIF] LZW: %d/%d rows%s\n", rowsDone, frameH, done ? "" : " (truncated)");
+
+  // セルの平均 → iconPool。セルの画素数に足りない分（フレーム外・透過・未デコード）は背景色
+  memset(dst, 0, ICON_BYTES); // 縦横比で余る部分は黒
+  uint32_t bgR = (bgColor >> 11) * 255 / 31;
+  uint32_t bgG = ((bgColor >> 5) & 0x3F) * 255 / 63;
+  uint32_t bgB = (bgColor & 0x1F) * 255 / 31;
+  for (int oy = 0; oy < outH; oy++) {
+    int cy = oy * cellsY / outH;
+    uint32_t spanY = gifCellSpan(cy, crop.h, cellsY);
+    for (int ox = 0; ox < outW; ox++) {
+      int cx = ox * cellsX / outW;
+      const GifCell& c = cells[cy * cellsX + cx];
+      uint32_t area = spanY * gifCellSpan(cx, crop.w, cellsX);
+      uint32_t bgN = area - c.n;
+      uint8_t r = (c.r + bgR * bgN) / area;
+      uint8_t g = (c.g + bgG * bgN) / area;
+      uint8_t b = (c.b + bgB * bgN) / area;
+      uint16_t px = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+      dst[oy * ICON_SIZE + ox] = (px >> 8) | (px << 8); // バイトスワップ
+    }
+  }
+
+  decmem_free(cells);
+  decmem_free(colCell);
+  decmem_free(stack);
+  decmem_free(prefix);
+  logDecMem("GIF");
+  // 切り詰めGIFも、クロップ内の行が1行でもあれば描画する（残りは背景色）
+  if (!done && frameY + rowsDone <= crop.y) { Serial.println("[GIF] decode failed, no rows"); return false; }
+  return true;
+}
+
+// --- デコード用アリーナのスコープ ---
+// 生存中はPNG/libjpeg/libwebpの確保がすべてアリーナから (上限DECODE_BYTE_CAP)
+// 抜けるとアリーナを巻き戻すので、どのreturn経路でもヒープはデコード前と同じ状態に戻る
+struct DecodeArenaScope {
+  DecodeArenaScope() { decmem_arena_begin(DECODE_BYTE_CAP); }
+  ~DecodeArenaScope() { decmem_arena_end(); }
+};
+
+// --- アイコンのパレット圧縮 ---
+// iconStaging(RGB565)をメディアンカットで16色に減色してプールのスロットへ（2048 → 544バイト）
+// 箱はjquant2と同じくR:G:B = 2:3:1の重みで最も幅の広い軸を選び、画素数の中央で割る
+// 16色以下のアイコン（イラスト・ドット絵）は無劣化。写真は誤差拡散（Floyd-Steinberg）で階調を保つ
+struct IconBox {
+  int start, len;  // order[]の範囲
+  int axis;        // 分割軸 (0=R, 1=G, 2=B)
+  int range;       // 重み付きの幅（0 = 単色、分割不要）
+};
+
+// バイトスワップ済みRGB565 → 8bit RGB
+static inline void iconPixelRgb(uint16_t swapped, int* c) {
+  uint16_t px = (swapped >> 8) | (swapped << 8);
+  c[0] = ((px >> 11) << 3) | (px >> 13);
+  c[1] = (((px >> 5) & 0x3F) << 2) | ((px >> 9) & 0x03);
+  c[2] = ((px & 0x1F) << 3) | ((px >> 2) & 0x07);
+}
+
+// 分割軸のソートキー（RGB565の成分そのまま、最大64段階）
+static inline int iconPixelKey(uint16_t swapped, int axis) {
+  uint16_t px = (swapped >> 8) | (swapped << 8);
+  if (axis == 0) return px >> 11;
+  if (axis == 1) return (px >> 5) & 0x3F;
+  return px & 0x1F;
+}
+
+static void iconBoxMeasure(IconBox& box, const uint16_t* order) {
+  static const int weight[3] = {2, 3, 1};
+  int lo[3] = {255, 255, 255}, hi[3] = {0, 0, 0};
+  for (int i = box.start; i < box.start + box.len; i++) {
+    int c[3];
+    iconPixelRgb(iconStaging[order[i]], c);
+    for (int k = 0; k < 3; k++) {
+      if (c[k] < lo[k]) lo[k] = c[k];
+      if (c[k] > hi[k]) hi[k] = c[k];
+    }
+  }
+  box.range = 0;
+  for (int k = 0; k < 3; k++) {
+    if ((hi[k] - lo[k]) * weight[k] > box.range) {
+      box.range = (hi[k] - lo[k]) * weight[k];
+      box.axis = k;
+    }
+  }
+}
+
+bool storeIcon(int poolIdx) {
+  const int n = ICON_SIZE * ICON_SIZE;
+  uint16_t* order = (uint16_t*)decmem_malloc(n * 2 * sizeof(uint16_t), DECMEM_AUTO);
+  if (!order) return false;
+  uint16_t* sorted = order + n;
+
+  // メディアンカット
+  IconBox boxes[ICON_PALETTE_SIZE];
+  int nBoxes = 1;
+  for (int i = 0; i < n; i++) order[i] = i;
+  boxes[0].start = 0;
+  boxes[0].len = n;
+  iconBoxMeasure(boxes[0], order);
+  while (nBoxes < ICON_PALETTE_SIZE) {
+    int best = -1;
+    for (int b = 0; b < nBoxes; b++) {
+      if (boxes[b].range > 0 && (best < 0 || boxes[b].range > boxes[best].range)) best = b;
+    }
+    if (best < 0) break;  // 全部単色
+    // 分割軸で計数ソートし、中央に最も近い値の境目で割る（同じ色は同じ箱に残るので、16色以下なら各色が1箱になる）
+    IconBox& box = boxes[best];
+    int count[64] = {0};
+    for (int i = box.start; i < box.start + box.len; i++) count[iconPixelKey(iconStaging[order[i]], box.axis)]++;
+    int split = 0;
+    for (int k = 0, sum = 0; k < 64; k++) {
+      int c = count[k];
+      count[k] = sum;
+      sum += c;
+      if (sum < box.len && abs(sum - box.len / 2) < abs(split - box.len / 2)) split = sum;
+    }
+    for (int i = box.start; i < box.start + box.len; i++) {
+      sorted[count[iconPixelKey(iconStaging[order[i]], box.axis)]++] = order[i];
+    }
+    memcpy(order + box.start, sorted, box.len * sizeof(uint16_t));
+    IconBox& upper = boxes[nBoxes++];
+    upper.start = box.start + split;
+    upper.len = box.len - split;
+    box.len = split;
+    iconBoxMeasure(box, order);
+    iconBoxMeasure(upper, order);
+  }
+
+  // パレット = 箱の平均色。誤差拡散はRGB565に丸めた後の色（実際に表示される色）で測る
+  IconPacked* icon = &iconPool[poolIdx];
+  int pal[ICON_PALETTE_SIZE][3];
+  for (int b = 0; b < ICON_PALETTE_SIZE; b++) {
+    if (b >= nBoxes) { icon->palette[b] = 0; continue; }
+    int sum[3] = {0, 0, 0};
+    for (int i = boxes[b].start; i < boxes[b].start + boxes[b].len; i++) {
+      int c[3];
+      iconPixelRgb(iconStaging[order[i]], c);
+      for (int k = 0; k < 3; k++) sum[k] += c[k];
+    }
+    int len = boxes[b].len;
+    uint16_t r = ((sum[0] + len / 2) / len * 31 + 127) / 255;
+    uint16_t g = ((sum[1] + len / 2) / len * 63 + 127) / 255;
+    uint16_t bl = ((sum[2] + len / 2) / len * 31 + 127) / 255;
+    uint16_t px = (r << 11) | (g << 5) | bl;
+    icon->palette[b] = (px >> 8) | (px << 8);
+    iconPixelRgb(icon->palette[b], pal[b]);
+  }
+  decmem_free(order);
+
+  // 最も近いパレット色へ（重みは分割と同じ）。誤差は1/16単位で右と下の行へ
+  // jquant2のerror_limitと同様に、1画素の誤差を制限して筋状のノイズを抑える
+  int16_t errBuf[2][ICON_SIZE + 2][3];
+  memset(errBuf, 0, sizeof(errBuf));
+  for (int y = 0; y < ICON_SIZE; y++) {
+    int16_t (*errCur)[3] = errBuf[y & 1];
+    int16_t (*errNext)[3] = errBuf[(y + 1) & 1];
+    memset(errNext, 0, sizeof(errBuf[0]));
+    for (int x = 0; x < ICON_SIZE; x++) {
+      int c[3];
+      iconPixelRgb(iconStaging[y * ICON_SIZE + x], c);
+      for (int k = 0; k < 3; k++) {
+        c[k] += (errCur[x + 1][k] + 8) >> 4;
+        if (c[k] < 0) c[k] = 0;
+        if (c[k] > 255) c[k] = 255;
+      }
+      int best = 0, bestDist = INT32_MAX;
+      for (int b = 0; b < nBoxes; b++) {
+        int dr = c[0] - pal[b][0], dg = c[1] - pal[b][1], db = c[2] - pal[b][2];
+        int dist = 2 * dr * dr + 3 * dg * dg + db * db;
+        if (dist < bestDist) { bestDist = dist; best = b; }
+      }
+      uint8_t& dst = icon->index[(y * ICON_SIZE + x) >> 1];
+      if (x & 1) dst = (dst & 0xF0) | best;
+      else dst = (dst & 0x0F) | (best << 4);
+      for (int k = 0; k < 3; k++) {
+        int e = c[k] - pal[best][k];
+        if (e > 32) e = 32;
+        if (e < -32) e = -32;
+        errCur[x + 2][k] += e * 7;
+        errNext[x][k] += e * 3;
+        errNext[x + 1][k] += e * 5;
+        errNext[x + 2][k] += e;
+      }
+    }
+  }
+  return true;
+}
+
+// パレットをRGB565へ展開しながらICON_DRAW_LINES行ずつpushImage
+void pushIcon(int x, int y, const IconPacked* icon) {
+  uint16_t lines[ICON_DRAW_LINES * ICON_SIZE];
+  for (int row = 0; row < ICON_SIZE; row += ICON_DRAW_LINES) {
+    const uint8_t* src = icon->index + row * ICON_SIZE / 2;
+    for (int i = 0; i < ICON_DRAW_LINES * ICON_SIZE / 2; i++) {
+      lines[i * 2] = icon->palette[src[i] >> 4];
+      lines[i * 2 + 1] = icon->palette[src[i] & 0x0F];
+    }
+    M5.Lcd.pushImage(x, y + row, ICON_SIZE, ICON_DRAW_LINES, lines);
+  }
+}
+
 // --- JPEG画像ダウンロード＆デコード ---
 // Spriteに描画してからpixel読み出しで32x32に縮小
 bool downloadIcon(MetaEntry* meta) {
-  if (meta->pictureUrl.length() == 0) return false;
+  if (textLen(meta->pictureUrl) == 0) return false;
   if (meta->iconPoolIdx >= 0) return true; // 既に取得済み
   if (meta->iconFailed) return false;
+  DecodeArenaScope arenaScope;
 
-  int poolIdx = allocIconPool();
+  // 表示中の作者なら他のアイコンを追い出してでも取る
+  int poolIdx = allocIconPool(meta - metaCache, isMetaPinned(meta));
   if (poolIdx < 0) return false; // プール満杯
 
   // data: URI対応 (Base64埋め込み画像)
-  Serial.printf("[ICON] url prefix: %.20s\n", meta->pictureUrl.c_str());
-  if (meta->pictureUrl.startsWith("data:image/")) {
-    int b64Start = meta->pictureUrl.indexOf("base64,");
-    if (b64Start < 0) { meta->iconFailed = true; iconPoolUsed[poolIdx] = false; return false; }
-    b64Start += 7; // "base64," の後
-    String b64 = meta->pictureUrl.substring(b64Start);
+  const char* url = textStr(meta->pictureUrl);
+  Serial.printf("[ICON] url prefix: %.20s\n", url);
+  if (strncmp(url, "data:image/", 11) == 0) {
+    const char* b64 = strstr(url, "base64,");
+    if (!b64) { meta->iconFailed = true; iconPoolUsed[poolIdx] = false; return false; }
+    b64 += 7; // "base64," の後（アリーナ上の文字列をそのまま読む）
     // Base64デコード（ESP32のmbedtlsを使用）
-    size_t b64Len = b64.length();
+    size_t b64Len = textLen(meta->pictureUrl) - (b64 - url);
     size_t outLen = (b64Len * 3) / 4 + 4;
     uint8_t* imgBuf = (uint8_t*)malloc(outLen);
     if (!imgBuf) { meta->iconFailed = true; iconPoolUsed[poolIdx] = false; return false; }
     size_t actualLen = 0;
-    int ret = mbedtls_base64_decode(imgBuf, outLen, &actualLen, (const uint8_t*)b64.c_str(), b64Len);
+    int ret = mbedtls_base64_decode(imgBuf, outLen, &actualLen, (const uint8_t*)b64, b64Len);
     if (ret != 0) {
       Serial.printf("[ICON] base64 decode failed: %d\n", ret);
       free(imgBuf); meta->iconFailed = true; iconPoolUsed[poolIdx] = false; return false;
@@ -461,7 +1964,7 @@ bool downloadIcon(MetaEntry* meta) {
     Serial.printf("[ICON] format: %02X %02X, size: %d, url: data:...\n", imgBuf[0], imgBuf[1], totalRead);
     // PNG判定
     if (imgBuf[0] == 0x89 && imgBuf[1] == 0x50) {
-      if (!decodePngToSprite(imgBuf, totalRead, sprite, spriteSize)) {
+      if (!decodePngToSprite(imgBuf, totalRead, sprite, spriteSize, true)) {
         free(imgBuf); sprite.deleteSprite(); meta->iconFailed = true; iconPoolUsed[poolIdx] = false; return false;
       }
     } else {
@@ -469,16 +1972,17 @@ bool downloadIcon(MetaEntry* meta) {
       sprite.drawJpg(imgBuf, totalRead, 0, 0, spriteSize, spriteSize);
     }
     free(imgBuf);
-    // iconPoolへコピー
+    // 32x32に縮小してiconStagingへ
     for (int y = 0; y < ICON_SIZE; y++) {
       for (int x = 0; x < ICON_SIZE; x++) {
         int srcX = x * spriteSize / ICON_SIZE;
         int srcY = y * spriteSize / ICON_SIZE;
         uint16_t px = sprite.readPixel(srcX, srcY);
-        iconPool[poolIdx][y * ICON_SIZE + x] = (px >> 8) | (px << 8);
+        iconStaging[y * ICON_SIZE + x] = (px >> 8) | (px << 8);
       }
     }
     sprite.deleteSprite();
+    if (!storeIcon(poolIdx)) { iconPoolUsed[poolIdx] = false; return false; }
     meta->iconPoolIdx = poolIdx;
     return true;
   }
@@ -491,8 +1995,8 @@ bool downloadIcon(MetaEntry* meta) {
   http.setTimeout(5000);
   http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
 
-  if (!http.begin(client, meta->pictureUrl)) {
-    Serial.printf("[ICON] http.begin failed: %s\n", meta->pictureUrl.c_str());
+  if (!http.begin(client, url)) {
+    Serial.printf("[ICON] http.begin failed: %s\n", url);
     meta->iconFailed = true;
     iconPoolUsed[poolIdx] = false;
     return false;
@@ -500,7 +2004,7 @@ bool downloadIcon(MetaEntry* meta) {
 
   int httpCode = http.GET();
   if (httpCode != 200) {
-    Serial.printf("[ICON] HTTP %d: %s\n", httpCode, meta->pictureUrl.c_str());
+    Serial.printf("[ICON] HTTP %d: %s\n", httpCode, url);
     http.end();
     meta->iconFailed = true;
     iconPoolUsed[poolIdx] = false;
@@ -583,7 +2087,7 @@ bool downloadIcon(MetaEntry* meta) {
   sprite.fillSprite(BLACK);
 
   // 先頭バイトで画像形式判定
-  Serial.printf("[ICON] format: %02X %02X, size: %d, url: %s\n", imgBuf[0], imgBuf[1], totalRead, meta->pictureUrl.c_str());
+  Serial.printf("[ICON] format: %02X %02X, size: %d, url: %s\n", imgBuf[0], imgBuf[1], totalRead, url);
   if (imgBuf[0] == 0xFF && imgBuf[1] == 0xD8) {
     // JPEG
     Serial.println("[ICON] JPEG decode start");
@@ -634,6 +2138,7 @@ bool downloadIcon(MetaEntry* meta) {
         iconPoolUsed[poolIdx] = false;
         return false;
       }
+      decmem_reset_peaks();
       jpeg_create_decompress(&cinfo);
       jpeg_mem_src(&cinfo, imgBuf, totalRead);
       jpeg_read_header(&cinfo, TRUE);
@@ -646,45 +2151,53 @@ bool downloadIcon(MetaEntry* meta) {
       int outH = cinfo.output_height;
       int outCh = cinfo.output_components;
       Serial.printf("[JPEG] libjpeg scaled: %dx%d ch=%d\n", outW, outH, outCh);
+      // 中央正方形クロップ: クロップ下端までのスキャンラインだけ読み、クロップ内の列だけ描画
+      CropRect crop = decodeCropRect(outW, outH, true);
+      int yEnd = crop.y + crop.h;
       // スキャンライン読み取り → Spriteに直接描画
       sprite.deleteSprite();
-      spriteSize = min(max(outW, outH), 128);
+      spriteSize = min(crop.w, 128);
       sprite.createSprite(spriteSize, spriteSize);
       sprite.fillSprite(BLACK);
-      uint8_t* rowBuf = (uint8_t*)malloc(outW * outCh);
+      uint8_t* rowBuf = (uint8_t*)decmem_malloc(outW * outCh, DECMEM_AUTO);
       if (rowBuf) {
-        int dy = 0;
-        while (cinfo.output_scanline < cinfo.output_height) {
+        while ((int)cinfo.output_scanline < yEnd) {
+          int sy = cinfo.output_scanline;
           JSAMPROW row = rowBuf;
           jpeg_read_scanlines(&cinfo, &row, 1);
-          if (dy < spriteSize) {
-            for (int dx = 0; dx < min(outW, spriteSize); dx++) {
-              int idx = dx * outCh;
+          int dy = (sy - crop.y) * spriteSize / crop.h;
+          bool shouldDraw = sy >= crop.y &&
+            ((sy == yEnd - 1) || ((sy + 1 - crop.y) * spriteSize / crop.h != dy));
+          if (shouldDraw && dy < spriteSize) {
+            for (int dx = 0; dx < spriteSize; dx++) {
+              int idx = (crop.x + dx * crop.w / spriteSize) * outCh;
               sprite.drawPixel(dx, dy, sprite.color565(rowBuf[idx], rowBuf[idx+1], rowBuf[idx+2]));
             }
           }
-          dy++;
-          if (dy % 20 == 0) yield();
+          if (sy % 20 == 0) yield();
         }
-        free(rowBuf);
+        decmem_free(rowBuf);
       }
-      jpeg_finish_decompress(&cinfo);
+      // 残りのスキャンラインは読まずに終了（finishは全行読了が必要なのでabort）
+      if (cinfo.output_scanline < cinfo.output_height) jpeg_abort_decompress(&cinfo);
+      else jpeg_finish_decompress(&cinfo);
       jpeg_destroy_decompress(&cinfo);
+      logDecMem("JPEG");
       free(imgBuf);
-      // リサンプル→iconPoolへ（以降の共通処理に流す）
+      // リサンプル→iconStagingへ（以降の共通処理に流す）
       goto resample_to_icon;
     }
-    // スケール選択: デコード後がspriteSize以下になる最大スケール
+    // スケール選択: デコード後の中央正方形がspriteSize以下になる最大スケール
     jpeg_div_eSprite_t jpgScale = JPEG_DIV_ESPRITE_NONE;
-    int maxDim = max(jpgW, jpgH);
-    if (maxDim > spriteSize * 4) jpgScale = JPEG_DIV_ESPRITE_8;
-    else if (maxDim > spriteSize * 2) jpgScale = JPEG_DIV_ESPRITE_4;
-    else if (maxDim > spriteSize) jpgScale = JPEG_DIV_ESPRITE_2;
+    int cropDim = min(jpgW, jpgH);
+    if (cropDim > spriteSize * 4) jpgScale = JPEG_DIV_ESPRITE_8;
+    else if (cropDim > spriteSize * 2) jpgScale = JPEG_DIV_ESPRITE_4;
+    else if (cropDim > spriteSize) jpgScale = JPEG_DIV_ESPRITE_2;
     // スケール後のサイズでSpriteを再作成
-    int scaledDim = maxDim;
-    if (jpgScale == JPEG_DIV_ESPRITE_8) scaledDim = maxDim / 8;
-    else if (jpgScale == JPEG_DIV_ESPRITE_4) scaledDim = maxDim / 4;
-    else if (jpgScale == JPEG_DIV_ESPRITE_2) scaledDim = maxDim / 2;
+    int scaledDim = cropDim;
+    if (jpgScale == JPEG_DIV_ESPRITE_8) scaledDim = cropDim / 8;
+    else if (jpgScale == JPEG_DIV_ESPRITE_4) scaledDim = cropDim / 4;
+    else if (jpgScale == JPEG_DIV_ESPRITE_2) scaledDim = cropDim / 2;
     if (scaledDim > spriteSize) scaledDim = spriteSize; // クリップ
     // Spriteをデコードサイズに合わせて再作成
     int jpgDecW = jpgW, jpgDecH = jpgH;
@@ -693,19 +2206,21 @@ bool downloadIcon(MetaEntry* meta) {
     else if (jpgScale == JPEG_DIV_ESPRITE_2) { jpgDecW /= 2; jpgDecH /= 2; }
     if (jpgDecW < 1) jpgDecW = 1;
     if (jpgDecH < 1) jpgDecH = 1;
-    int jpgSprSize = max(jpgDecW, jpgDecH);
+    // 中央正方形クロップ（drawJpgのオフセット指定。drawJpgには打ち切り指定がないので全行デコードはされる）
+    CropRect jpgCrop = decodeCropRect(jpgDecW, jpgDecH, true);
+    int jpgSprSize = jpgCrop.w;
     if (jpgSprSize > spriteSize) jpgSprSize = spriteSize;
     sprite.deleteSprite();
     spriteSize = jpgSprSize;
     sprite.createSprite(spriteSize, spriteSize);
     sprite.fillSprite(BLACK);
     Serial.printf("[JPEG] scale=%d, spriteSize=%d (%dx%d)\n", jpgScale, spriteSize, jpgDecW, jpgDecH);
-    sprite.drawJpg(imgBuf, totalRead, 0, 0, spriteSize, spriteSize, 0, 0, jpgScale);
+    sprite.drawJpg(imgBuf, totalRead, 0, 0, spriteSize, spriteSize, jpgCrop.x, jpgCrop.y, jpgScale);
     Serial.println("[ICON] JPEG decode done");
   } else if (imgBuf[0] == 0x89 && imgBuf[1] == 0x50) {
     // PNG
     Serial.println("[ICON] PNG decode start");
-    if (!decodePngToSprite(imgBuf, totalRead, sprite, spriteSize)) {
+    if (!decodePngToSprite(imgBuf, totalRead, sprite, spriteSize, true)) {
       Serial.println("[ICON] PNG decode FAILED");
       free(imgBuf);
       sprite.deleteSprite();
@@ -714,20 +2229,35 @@ bool downloadIcon(MetaEntry* meta) {
       return false;
     }
   } else if (imgBuf[0] == 0x52 && imgBuf[1] == 0x49) {
-    // WebP (RIFF header) - 直接ICON_SIZEにスケーリングデコード
+    // WebP (RIFF header) - iconStagingへ直接デコード（Sprite・リサンプル不要）
     Serial.println("[ICON] WebP decode start");
     sprite.deleteSprite();
-    spriteSize = ICON_SIZE; // 32x32
-    sprite.createSprite(spriteSize, spriteSize);
-    sprite.fillSprite(BLACK);
-    if (!decodeWebpToSprite(imgBuf, totalRead, sprite, spriteSize)) {
+    bool ok = decodeWebpToIcon(imgBuf, totalRead, iconStaging, meta->color, true);
+    free(imgBuf);
+    if (!ok) {
       Serial.println("[ICON] WebP decode FAILED");
-      free(imgBuf);
-      sprite.deleteSprite();
       meta->iconFailed = true;
       iconPoolUsed[poolIdx] = false;
       return false;
     }
+    if (!storeIcon(poolIdx)) { iconPoolUsed[poolIdx] = false; return false; }
+    meta->iconPoolIdx = poolIdx;
+    return true;
+  } else if (imgBuf[0] == 'G' && imgBuf[1] == 'I') {
+    // GIF - 先頭フレームをiconStagingへ直接デコード（アニメーションGIFも静止画として表示）
+    Serial.println("[ICON] GIF decode start");
+    sprite.deleteSprite();
+    bool ok = decodeGifToIcon(imgBuf, totalRead, iconStaging, meta->color, true);
+    free(imgBuf);
+    if (!ok) {
+      Serial.println("[ICON] GIF decode FAILED");
+      meta->iconFailed = true;
+      iconPoolUsed[poolIdx] = false;
+      return false;
+    }
+    if (!storeIcon(poolIdx)) { iconPoolUsed[poolIdx] = false; return false; }
+    meta->iconPoolIdx = poolIdx;
+    return true;
   } else {
     // 未対応形式 → カラーブロック維持
     free(imgBuf);
@@ -746,10 +2276,11 @@ resample_to_icon:
       int srcX = x * spriteSize / ICON_SIZE;
       int srcY = y * spriteSize / ICON_SIZE;
       uint16_t px = sprite.readPixel(srcX, srcY);
-      iconPool[poolIdx][y * ICON_SIZE + x] = (px >> 8) | (px << 8); // バイトスワップ
+      iconStaging[y * ICON_SIZE + x] = (px >> 8) | (px << 8); // バイトスワップ
     }
   }
   sprite.deleteSprite();
+  if (!storeIcon(poolIdx)) { iconPoolUsed[poolIdx] = false; return false; }
   meta->iconPoolIdx = poolIdx;
   return true;
 }
@@ -776,11 +2307,11 @@ int efontDrawChar(int x, int y, uint16_t utf16, uint16_t color) {
   return charWidth;
 }
 
-int efontDrawString(int x, int y, const String& str, uint16_t color, int maxWidth, int maxLines) {
+int efontDrawString(int x, int y, const char* str, uint16_t color, int maxWidth, int maxLines) {
   int cx = x;
   int cy = y;
   int line = 0;
-  char* p = (char*)str.c_str();
+  char* p = (char*)str;
 
   while (*p && line < maxLines) {
     uint16_t utf16;
@@ -808,12 +2339,23 @@ void drawHeader() {
   M5.Lcd.print("noscli-core2");
   M5.Lcd.setTextSize(1);
   M5.Lcd.setTextColor(CYAN);
-  M5.Lcd.setCursor(160, 10);
+  M5.Lcd.setCursor(160, 5);
   M5.Lcd.print(VERSION);
-  M5.Lcd.setCursor(230, 10);
-  if (connected) {
-    M5.Lcd.setTextColor(GREEN);
-    M5.Lcd.print("yabu.me");
+  M5.Lcd.setCursor(230, 5);
+  int n = relaysConnected();
+  if (n > 0) {
+    M5.Lcd.setTextColor(n == relayCount ? GREEN : YELLOW);
+    if (relayCount == 1) {
+      M5.Lcd.print(relayConfigs[0].host);
+    } else {
+      M5.Lcd.printf("%d/%d relays", n, relayCount);
+    }
+    // 2行目: リレーの計測値（複数なら集計のたびに順に）
+    char line[40];
+    relayStatusLine(headerRelay, line, sizeof(line));
+    M5.Lcd.setTextColor(relays[headerRelay].demoted ? TFT_DARKGREY : CYAN);
+    M5.Lcd.setCursor(160, 17);
+    M5.Lcd.print(line);
   } else {
     M5.Lcd.setTextColor(RED);
     M5.Lcd.print("offline");
@@ -829,17 +2371,18 @@ String formatTime(unsigned long ts) {
   return String(buf);
 }
 
-void drawIcon(int x, int y, MetaEntry* meta, const String& name) {
+void drawIcon(int x, int y, const PubKey& pubkey, MetaEntry* meta, const char* name) {
   if (meta && meta->iconPoolIdx >= 0) {
-    // キャッシュ済み画像を描画
-    M5.Lcd.pushImage(x, y, ICON_SIZE, ICON_SIZE, iconPool[meta->iconPoolIdx]);
+    // キャッシュ済み画像を描画（内部DRAMのコピーから）
+    iconPoolRef[meta->iconPoolIdx] = true;
+    pushIcon(x, y, iconForDraw(meta->iconPoolIdx));
   } else {
     // カラーブロック＋頭文字
-    uint16_t color = meta ? meta->color : WHITE;
+    uint16_t color = meta ? meta->color : pubkeyToColor(pubkey);  // kind:0待ちでも作者ごとの色
     M5.Lcd.fillRoundRect(x, y, ICON_SIZE, ICON_SIZE, 4, color);
-    if (name.length() > 0) {
+    if (name[0]) {
       uint16_t firstChar;
-      char* np = (char*)name.c_str();
+      char* np = (char*)name;
       efontUFT8toUTF16(&firstChar, np);
       if (firstChar >= 0x20 && firstChar <= 0x7E) {
         M5.Lcd.setTextColor(BLACK, color);
@@ -864,20 +2407,28 @@ void drawIcon(int x, int y, MetaEntry* meta, const String& name) {
   }
 }
 
+// 画面に入る分（tlScrollから最大TIMELINE_VISIBLE件）だけ描画する
 void drawTimeline() {
   M5.Lcd.fillRect(0, 30, 320, 210, BLACK);
   int y = 32;
-  for (int i = 0; i < postCount && i < MAX_POSTS; i++) {
-    if (y > 225) break;
+  for (int i = 0; i < TIMELINE_VISIBLE; i++) {
+    PostRecord* rec = timelineAt(tlScroll + i);
+    if (!rec || y > 225) break;
     if (i > 0) M5.Lcd.drawLine(5, y - 2, 315, y - 2, TFT_DARKGREY);
 
-    Post& p = posts[i];
+    PostRecord& p = *rec;
     MetaEntry* meta = findMeta(p.pubkey);
-    String name = (meta && meta->displayName.length() > 0)
-      ? meta->displayName : p.pubkey.substring(0, 8) + "...";
+    // metaCacheから追い出された作者はスクロールで戻ってきたときに取り直す（アイコンはプールに残っていれば付け直すだけ）
+    if (!meta) requestMeta(p.pubkey);
+    String shortKey;
+    const char* name = meta ? textStr(meta->displayName) : "";
+    if (!name[0]) {
+      shortKey = pubkeyToHex(p.pubkey, 4) + "...";
+      name = shortKey.c_str();
+    }
     String timeStr = formatTime(p.created_at);
 
-    drawIcon(5, y, meta, name);
+    drawIcon(5, y, p.pubkey, meta, name);
     efontDrawString(40, y, name, CYAN, 200, 1);
 
     M5.Lcd.setTextSize(1);
@@ -885,7 +2436,7 @@ void drawTimeline() {
     M5.Lcd.setCursor(248, y + 4);
     M5.Lcd.print(timeStr.c_str());
 
-    int h = efontDrawString(40, y + 17, p.content, WHITE, 275, 2);
+    int h = efontDrawString(40, y + 17, textStr(p.content), WHITE, 275, 2);
     y += 17 + h + 4;
   }
 }
@@ -903,10 +2454,11 @@ void drawIconStatusBar() {
   if (metaCacheCount == 0) return;
 
   for (int i = 0; i < metaCacheCount; i++) {
+    const MetaEntry* meta = &metaCache[i];
     uint16_t color;
-    if (metaCache[i].iconPoolIdx >= 0) {
+    if (meta->iconPoolIdx >= 0) {
       color = GREEN;
-    } else if (metaCache[i].iconFailed) {
+    } else if (meta->iconFailed) {
       color = TFT_DARKGREY;
     } else {
       color = BLACK;
@@ -919,89 +2471,847 @@ void drawIconStatusBar() {
 }
 
 // --- Nostr通信 ---
-void sendSubscribe() {
+// TLの購読（継続）。接続・再接続時の送信は購読管理が行う
+void subscribeTimeline() {
   JsonDocument doc;
-  JsonArray arr = doc.to<JsonArray>();
-  arr.add("REQ");
-  arr.add("tl");
-  JsonObject filter = arr.add<JsonObject>();
+  JsonObject filter = doc.to<JsonObject>();
   JsonArray kinds = filter["kinds"].to<JsonArray>();
   kinds.add(1);
-  filter["limit"] = MAX_POSTS;
-  String msg;
-  serializeJson(doc, msg);
-  webSocket.sendTXT(msg);
-  drawIconStatusBar();
+  String json;
+  serializeJson(doc, json);
+  subOpen(SUB_TIMELINE, 0, false, json, TIMELINE_VISIBLE);
 }
 
 // アイコンダウンロードキュー
 bool iconDownloadPending = false;
 
-void handleEvent(uint8_t* payload, size_t length) {
-  if (length > 16384) return; // data:URI入りkind:0対応（旧4096→16384）
-  JsonDocument doc;
-  if (deserializeJson(doc, payload, length)) return;
-
-  const char* type = doc[0];
-  if (!type) return;
-
-  if (strcmp(type, "EVENT") == 0) {
-    int kind = doc[2]["kind"] | -1;
-
-    if (kind == 0) {
-      const char* pubkey = doc[2]["pubkey"];
-      const char* content = doc[2]["content"];
-      if (pubkey && content) {
-        JsonDocument metaDoc;
-        if (!deserializeJson(metaDoc, content)) {
-          const char* dname = metaDoc["display_name"] | metaDoc["name"];
-          const char* picture = metaDoc["picture"];
-          addMeta(String(pubkey),
-                  dname ? String(dname) : String(""),
-                  picture ? String(picture) : String(""));
-          iconDownloadPending = true;
-          drawTimeline();
+// --- 受信済みイベントidの重複除去 ---
+// idの先頭8バイトを2世代で覚える。各世代は内部DRAMのブルームフィルタ（前段）とPSRAMの完全一致集合
+// 新着イベントはほとんどブルームフィルタで「未受信」と分かるので集合には触らない
+// 現世代がSEEN_GEN_IDS件になったら古い世代を空にして入れ替える（直近SEEN_GEN_IDS〜2倍件を覚えている）
+#define SEEN_GEN_IDS 1024
+#define SEEN_SET_SLOTS 2048   // 2のべき乗、負荷率50%以下
+#define SEEN_BLOOM_BITS 8192  // ハッシュ3個で偽陽性約3%（偽陽性は集合で確かめる）
+static_assert(SEEN_SET_SLOTS >= SEEN_GEN_IDS * 2, "SEEN_SET_SLOTS too small");
+struct SeenGen {
+  uint32_t bloom[SEEN_BLOOM_BITS / 32];
+  uint64_t* set;  // setupで確保。0 = 空き
+  int count;
+};
+SeenGen seenGen[2];
+int seenCur = 0;
+
+// idはSHA-256なので先頭8バイトがそのまま一様なハッシュになる
+static bool seenGenHas(const SeenGen& g, uint64_t key) {
+  uint32_t h1 = (uint32_t)key, h2 = (uint32_t)(key >> 32) | 1;
+  for (int i = 0; i < 3; i++) {
+    uint32_t bit = (h1 + i * h2) & (SEEN_BLOOM_BITS - 1);
+    if (!(g.bloom[bit >> 5] & (1u << (bit & 31)))) return false;
+  }
+  for (uint32_t s = (h2 >> 8) & (SEEN_SET_SLOTS - 1); g.set[s] != 0; s = (s + 1) & (SEEN_SET_SLOTS - 1)) {
+    if (g.set[s] == key) return true;
+  }
+  return false;
+}
+
+static void seenGenAdd(SeenGen& g, uint64_t key) {
+  uint32_t h1 = (uint32_t)key, h2 = (uint32_t)(key >> 32) | 1;
+  for (int i = 0; i < 3; i++) {
+    uint32_t bit = (h1 + i * h2) & (SEEN_BLOOM_BITS - 1);
+    g.bloom[bit >> 5] |= 1u << (bit & 31);
+  }
+  uint32_t s = (h2 >> 8) & (SEEN_SET_SLOTS - 1);
+  while (g.set[s] != 0) s = (s + 1) & (SEEN_SET_SLOTS - 1);
+  g.set[s] = key;
+  g.count++;
+}
+
+// 受信済み（検証を通した）ならtrue
+bool seenEventHas(uint64_t key) {
+  if (!seenGen[0].set || !seenGen[1].set) return false;
+  if (key == 0) key = 1;  // 0は空きスロットの印
+  return seenGenHas(seenGen[0], key) || seenGenHas(seenGen[1], key);
+}
+
+// 検証を通したイベントを覚える。偽のコピーで本物を隠されないように、検証前には呼ばない
+void seenEventAdd(uint64_t key) {
+  if (!seenGen[0].set || !seenGen[1].set) return;
+  if (key == 0) key = 1;
+  if (seenGen[seenCur].count >= SEEN_GEN_IDS) {
+    seenCur ^= 1;
+    SeenGen& g = seenGen[seenCur];
+    memset(g.bloom, 0, sizeof(g.bloom));
+    memset(g.set, 0, SEEN_SET_SLOTS * sizeof(uint64_t));
+    g.count = 0;
+  }
+  seenGenAdd(seenGen[seenCur], key);
+}
+
+// peekTimelineEventと同じキー（16進の先頭16桁をそのまま数値にしたもの）
+static uint64_t seenKeyOf(const uint8_t* id) {
+  uint64_t key = 0;
+  for (int i = 0; i < 8; i++) key = (key << 8) | id[i];
+  return key;
+}
+
+// JSONをパースせずに、TL（さかのぼりを含む）の購読のEVENTからidの先頭8バイトとcreated_atを拾う
+// ["EVENT","<subId>",{..."id":"<hex64>",..."created_at":<num>...}]。JSON文字列中の引用符は必ず\"になるので
+// 引用符で囲まれたid・created_atの直後に:が来るのはイベントオブジェクトのキーだけ
+// TLの購読でなければNULL。created_atが見つからなければ0
+static Subscription* peekTimelineEvent(const uint8_t* payload, size_t length, uint64_t& prefix, uint32_t& createdAt) {
+  const char* p = (const char*)payload;
+  const char* end = p + length;
+  auto skipSpace = [&]() { while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++; };
+  auto expect = [&](const char* lit) {
+    skipSpace();
+    size_t n = strlen(lit);
+    if ((size_t)(end - p) < n || memcmp(p, lit, n) != 0) return false;
+    p += n;
+    return true;
+  };
+  if (!expect("[") || !expect("\"EVENT\"") || !expect(",") || !expect("\"")) return NULL;
+  const char* subId = p;
+  while (p < end && *p != '"') p++;
+  if (p == end) return NULL;
+  Subscription* sub = subLookup(subId, p - subId);
+  if (!sub || (sub->type != SUB_TIMELINE && sub->type != SUB_BACKFILL)) return NULL;
+  p++;
+  bool haveId = false;
+  bool haveTime = false;
+  createdAt = 0;
+  for (const char* q = p; q < end && !(haveId && haveTime); q++) {
+    if (*q != '"') continue;
+    if (!haveId && end - q >= 4 && memcmp(q, "\"id\"", 4) == 0) {
+      p = q + 4;
+      if (!expect(":")) continue;  // タグの値の"id"など
+      if (!expect("\"") || end - p < 16) return NULL;
+      prefix = 0;
+      for (int i = 0; i < 16; i++) {
+        char c = p[i];
+        uint8_t v;
+        if (c >= '0' && c <= '9') v = c - '0';
+        else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+        else return NULL;
+        prefix = (prefix << 4) | v;
+      }
+      haveId = true;
+      q = p + 15;
+    } else if (!haveTime && end - q >= 12 && memcmp(q, "\"created_at\"", 12) == 0) {
+      p = q + 12;
+      if (!expect(":")) continue;
+      skipSpace();
+      while (p < end && *p >= '0' && *p <= '9') createdAt = createdAt * 10 + (*p++ - '0');
+      haveTime = true;
+      q = p - 1;
+    }
+  }
+  return haveId ? sub : NULL;
+}
+
+// --- リレーメッセージの抽出 ---
+// ["EVENT", sub, {...}] から使うキー（kind, id, pubkey, created_at, content）だけを拾う
+// JsonDocumentを作らず、文字列は受信バッファ上でその場でアンエスケープしてNUL終端する
+// （アンエスケープ後は必ず元より短い）。使わない値は括弧の深さを数えて読み飛ばすだけなので
+// メッセージの大きさによらず追加のメモリは要らない
+struct JsonCursor {
+  char* p;
+  char* end;
+  bool error;
+};
+
+static void jsonSkipSpace(JsonCursor& c) {
+  while (c.p < c.end && (*c.p == ' ' || *c.p == '\t' || *c.p == '\r' || *c.p == '\n')) c.p++;
+}
+
+// 次の文字がchなら読み進めてtrue
+static bool jsonConsume(JsonCursor& c, char ch) {
+  jsonSkipSpace(c);
+  if (c.p < c.end && *c.p == ch) { c.p++; return true; }
+  return false;
+}
+
+static int jsonHex4(const char* p) {
+  int v = 0;
+  for (int i = 0; i < 4; i++) {
+    char ch = p[i];
+    v <<= 4;
+    if (ch >= '0' && ch <= '9') v |= ch - '0';
+    else if (ch >= 'a' && ch <= 'f') v |= ch - 'a' + 10;
+    else if (ch >= 'A' && ch <= 'F') v |= ch - 'A' + 10;
+    else return -1;
+  }
+  return v;
+}
+
+// 文字列を読み、その場でアンエスケープしてNUL終端した先頭を返す（エラーならNULL）
+static char* jsonString(JsonCursor& c, int* len = NULL) {
+  if (!jsonConsume(c, '"')) { c.error = true; return NULL; }
+  char* out = c.p;
+  char* w = c.p;
+  while (c.p < c.end) {
+    char ch = *c.p++;
+    if (ch == '"') {
+      *w = '\0';
+      if (len) *len = w - out;
+      return out;
+    }
+    if (ch != '\\') { *w++ = ch; continue; }
+    if (c.p >= c.end) break;
+    ch = *c.p++;
+    switch (ch) {
+      case 'n': *w++ = '\n'; break;
+      case 't': *w++ = '\t'; break;
+      case 'r': *w++ = '\r'; break;
+      case 'b': *w++ = '\b'; break;
+      case 'f': *w++ = '\f'; break;
+      case 'u': {
+        if (c.end - c.p < 4) { c.error = true; return NULL; }
+        int cp = jsonHex4(c.p);
+        if (cp < 0) { c.error = true; return NULL; }
+        c.p += 4;
+        // サロゲートペア（絵文字）
+        if (cp >= 0xD800 && cp <= 0xDBFF && c.end - c.p >= 6 && c.p[0] == '\\' && c.p[1] == 'u') {
+          int lo = jsonHex4(c.p + 2);
+          if (lo >= 0xDC00 && lo <= 0xDFFF) {
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+            c.p += 6;
+          }
+        }
+        // \uXXXX(6文字)はUTF-8で3バイト以下、ペア(12文字)は4バイトなので追い越さない
+        if (cp < 0x80) {
+          *w++ = cp;
+        } else if (cp < 0x800) {
+          *w++ = 0xC0 | (cp >> 6);
+          *w++ = 0x80 | (cp & 0x3F);
+        } else if (cp < 0x10000) {
+          *w++ = 0xE0 | (cp >> 12);
+          *w++ = 0x80 | ((cp >> 6) & 0x3F);
+          *w++ = 0x80 | (cp & 0x3F);
+        } else {
+          *w++ = 0xF0 | (cp >> 18);
+          *w++ = 0x80 | ((cp >> 12) & 0x3F);
+          *w++ = 0x80 | ((cp >> 6) & 0x3F);
+          *w++ = 0x80 | (cp & 0x3F);
         }
+        break;
       }
-    } else if (kind == 1) {
-      const char* content = doc[2]["content"];
-      const char* pubkey = doc[2]["pubkey"];
-      unsigned long created_at = doc[2]["created_at"] | 0;
-
-      if (content && pubkey) {
-        String post = String(content);
-        post.replace("\n", " ");
-        if (post.length() > 200) post = post.substring(0, 197) + "...";
-
-        for (int i = MAX_POSTS - 1; i > 0; i--) posts[i] = posts[i - 1];
-        posts[0].content = post;
-        posts[0].pubkey = String(pubkey);
-        posts[0].created_at = created_at;
-        if (postCount < MAX_POSTS) postCount++;
-
-        requestMeta(String(pubkey));
+      default: *w++ = ch; break;  // \" \\ \/
+    }
+  }
+  c.error = true;  // 閉じていない
+  return NULL;
+}
+
+// 値を1つ読み飛ばす。配列・オブジェクトは文字列の外の括弧を数えるだけ（再帰しない）
+static void jsonSkip(JsonCursor& c) {
+  jsonSkipSpace(c);
+  int depth = 0;
+  while (c.p < c.end) {
+    char ch = *c.p;
+    if (ch == '"') {
+      for (c.p++; c.p < c.end && *c.p != '"'; c.p += (*c.p == '\\') ? 2 : 1) {}
+      if (c.p >= c.end) break;
+      c.p++;
+      if (depth == 0) return;
+    } else if (ch == '[' || ch == '{') {
+      depth++;
+      c.p++;
+    } else if (ch == ']' || ch == '}') {
+      if (depth == 0) return;  // 親の閉じ括弧（数値・リテラルの終わり）
+      depth--;
+      c.p++;
+      if (depth == 0) return;
+    } else if (ch == ',' && depth == 0) {
+      return;
+    } else {
+      c.p++;
+    }
+  }
+  c.p = c.end;
+  c.error = true;  // 閉じていない
+}
+
+// 数値（整数部のみ）。数値でなければdefを返して読み飛ばす
+static int64_t jsonInt(JsonCursor& c, int64_t def) {
+  jsonSkipSpace(c);
+  bool neg = c.p < c.end && *c.p == '-';
+  char* q = c.p + (neg ? 1 : 0);
+  if (q >= c.end || *q < '0' || *q > '9') { jsonSkip(c); return def; }
+  int64_t v = 0;
+  for (; q < c.end && *q >= '0' && *q <= '9'; q++) v = v * 10 + (*q - '0');
+  c.p = q;
+  jsonSkip(c);  // 小数部・指数部
+  return neg ? -v : v;
+}
+
+// オブジェクトの次のキーへ（'{'の直後か値の直後で呼ぶ）。終わり・エラーならfalse
+static char* jsonNextKey(JsonCursor& c) {
+  if (c.error || jsonConsume(c, '}')) return NULL;
+  jsonConsume(c, ',');
+  char* key = jsonString(c);
+  if (!key || !jsonConsume(c, ':')) { c.error = true; return NULL; }
+  return key;
+}
+
+struct NostrEvent {
+  const char* subId;
+  const char* id;      // hex 64文字
+  const char* pubkey;  // hex 64文字
+  const char* content;  // CLOSEDではリレーからのメッセージ
+  int contentLen;
+  const char* tags;     // 受信したままのJSON（アンエスケープしない、終端なし）
+  int tagsLen;
+  const char* sig;      // hex 128文字
+  int kind;
+  uint32_t created_at;
+};
+
+enum RelayMsgType { RELAY_MSG_OTHER, RELAY_MSG_EVENT, RELAY_MSG_EOSE, RELAY_MSG_CLOSED };
+
+// bufは書き換わる（文字列のアンエスケープ）
+RelayMsgType parseRelayMessage(char* buf, size_t len, NostrEvent& ev) {
+  JsonCursor c = {buf, buf + len, false};
+  memset(&ev, 0, sizeof(ev));
+  ev.kind = -1;
+  if (!jsonConsume(c, '[')) return RELAY_MSG_OTHER;
+  const char* type = jsonString(c);
+  if (!type || !jsonConsume(c, ',')) return RELAY_MSG_OTHER;
+  RelayMsgType msg;
+  if (strcmp(type, "EVENT") == 0) msg = RELAY_MSG_EVENT;
+  else if (strcmp(type, "EOSE") == 0) msg = RELAY_MSG_EOSE;
+  else if (strcmp(type, "CLOSED") == 0) msg = RELAY_MSG_CLOSED;
+  else return RELAY_MSG_OTHER;
+  ev.subId = jsonString(c);
+  if (!ev.subId) return RELAY_MSG_OTHER;
+  if (msg == RELAY_MSG_EOSE) return msg;
+  if (msg == RELAY_MSG_CLOSED) {
+    if (jsonConsume(c, ',')) ev.content = jsonString(c, &ev.contentLen);
+    if (!ev.content) ev.content = "";
+    return msg;
+  }
+  if (!jsonConsume(c, ',') || !jsonConsume(c, '{')) return RELAY_MSG_OTHER;
+  while (char* key = jsonNextKey(c)) {
+    if (strcmp(key, "kind") == 0) ev.kind = jsonInt(c, -1);
+    else if (strcmp(key, "created_at") == 0) ev.created_at = jsonInt(c, 0);
+    else if (strcmp(key, "id") == 0) ev.id = jsonString(c);
+    else if (strcmp(key, "pubkey") == 0) ev.pubkey = jsonString(c);
+    else if (strcmp(key, "content") == 0) ev.content = jsonString(c, &ev.contentLen);
+    else if (strcmp(key, "sig") == 0) ev.sig = jsonString(c);
+    else if (strcmp(key, "tags") == 0) {
+      jsonSkipSpace(c);
+      ev.tags = c.p;
+      jsonSkip(c);
+      ev.tagsLen = c.p - ev.tags;
+    } else jsonSkip(c);
+  }
+  return c.error ? RELAY_MSG_OTHER : RELAY_MSG_EVENT;
+}
+
+// kind:0のcontent（プロフィールJSON）から名前と画像URL。contentの上でその場で読む
+// 名前はdisplay_nameが空ならname
+static void parseProfile(char* content, int len, const char*& name, const char*& picture) {
+  JsonCursor c = {content, content + len, false};
+  const char* displayName = NULL;
+  const char* plainName = NULL;
+  name = picture = NULL;
+  if (!jsonConsume(c, '{')) return;
+  while (char* key = jsonNextKey(c)) {
+    jsonSkipSpace(c);
+    bool isString = c.p < c.end && *c.p == '"';
+    if (isString && strcmp(key, "display_name") == 0) displayName = jsonString(c);
+    else if (isString && strcmp(key, "name") == 0) plainName = jsonString(c);
+    else if (isString && strcmp(key, "picture") == 0) picture = jsonString(c);
+    else jsonSkip(c);
+  }
+  name = (displayName && displayName[0]) ? displayName : plainName;
+}
+
+// --- イベントの検証 ---
+// idがイベントの中身のハッシュか、sigがpubkeyによるidへのBIP-340署名かを確かめてから表示する
+// kind:1はNOSTRSIG_BATCH_MAX件ずつまとめて検証する（1件ずつより速い。合わなければ1件ずつ調べ直す）
+// 検証済みのidは覚えておき、kind:0を取り直したときに同じイベントの署名を検証し直さない
+#ifndef VERIFY_SIGNATURES
+#define VERIFY_SIGNATURES 1  // 0にすると検証しない
+#endif
+#define VERIFIED_IDS 256     // 2のべき乗
+#define VERIFY_FLUSH_MS 50   // kind:1をまとめるまで待つ時間
+// id全体（32バイト）で比べる。先頭8バイトだけだと、それが重なる別のイベントを署名なしで通してしまう
+// 直接マップ（衝突したら上書き）で、スロットはidの先頭から選ぶ。setupでPSRAMに確保（NULL = 覚えない）
+// 全部0のidは空きの印と区別できないが、eventIdValidを通った後でしか引かないので該当しない
+uint8_t (*verifiedIds)[32] = NULL;
+
+static uint8_t* verifiedSlot(const uint8_t* id) {
+  uint32_t v;
+  memcpy(&v, id, sizeof(v));
+  return verifiedIds[v & (VERIFIED_IDS - 1)];
+}
+
+static bool verifiedHas(const uint8_t* id) {
+  return verifiedIds && memcmp(verifiedSlot(id), id, 32) == 0;
+}
+
+static void verifiedAdd(const uint8_t* id) {
+  if (verifiedIds) memcpy(verifiedSlot(id), id, 32);
+}
+
+void relayNoteInvalid(int r, const char* what, const char* id) {
+  relays[r].stats.errors++;
+  relays[r].stats.totalErrors++;
+  relays[r].stats.totalInvalid++;
+  Serial.printf("[VERIFY] %s: bad %s %.16s\n", relayConfigs[r].host, what, id ? id : "?");
+}
+
+// 中身から計算したidが受信したidと同じか。同じならidにバイト列を返す
+static bool eventIdValid(const NostrEvent& ev, const PubKey& pubkey, uint8_t* id) {
+  uint8_t computed[32];
+  if (!hexToBytes32(ev.id, id)) return false;
+  if (!nostrsig_event_id(pubkey.b, ev.created_at, ev.kind, ev.tags, ev.tagsLen,
+                         ev.content, ev.contentLen, computed)) return false;
+  return memcmp(computed, id, 32) == 0;
+}
+
+// その場で検証する（kind:0など）
+static bool eventValid(int r, const NostrEvent& ev, const PubKey& pubkey) {
+  if (!VERIFY_SIGNATURES) return true;
+  uint8_t id[32], sig[64];
+  if (!eventIdValid(ev, pubkey, id)) {
+    relayNoteInvalid(r, "id", ev.id);
+    return false;
+  }
+  if (verifiedHas(id)) return true;
+  if (!hexToBytes(ev.sig, sig, 64) || !nostrsig_verify(pubkey.b, id, sig)) {
+    relayNoteInvalid(r, "sig", ev.id);
+    return false;
+  }
+  verifiedAdd(id);
+  return true;
+}
+
+// 検証を待つkind:1（contentはアリーナに置いたもの）
+struct PendingPost {
+  PostRecord rec;
+  uint8_t sig[64];
+  int relay;
+  int sub;       // 受信した購読のスロットと世代（sinceを進める）
+  uint16_t gen;
+  unsigned long at;  // 受信した時刻
+  // 検証を待つ間に同じidと署名で届いたコピー（結果は同じなので検証しない）
+  struct {
+    int8_t relay;
+    int8_t sub;
+    uint16_t gen;
+    unsigned long at;
+  } dups[RELAY_MAX];
+  int dupCount;
+};
+PendingPost verifyQueue[NOSTRSIG_BATCH_MAX];
+int verifyQueued = 0;
+unsigned long verifyQueuedAt = 0;  // 先頭を積んだ時刻
+
+// 検証を通った投稿をタイムラインに入れ、見えている範囲なら描き直す
+void addPost(const PostRecord& rec) {
+  int n = timelineInsert(rec);
+  if (n < 0) {
+    textRelease(rec.content);  // 重複・古すぎる投稿
+    return;
+  }
+  requestMeta(rec.pubkey);
+  if (n < tlScroll) {
+    tlScroll++;  // 画面より新しい側に入った: 表示中の投稿がずれないように追従（描画不要）
+  } else if (n < tlScroll + TIMELINE_VISIBLE) {
+    iconDownloadPending = true;  // 追い出されたアイコンの作者が再び表示された場合も取り直す
+    drawTimeline();
+  }
+}
+
+// 検証を通った（または検証しない）投稿。ここで初めて受信済みにする
+static void acceptPost(const PendingPost& p) {
+  uint64_t key = seenKeyOf(p.rec.id);
+  bool duplicate = seenEventHas(key);  // 別の署名のコピーが先に通っていた
+  if (duplicate) {
+    relayNoteDuplicate(p.relay, key, p.at);
+  } else {
+    seenEventAdd(key);
+    relayNoteFirst(p.relay, key, p.at);
+  }
+  subNoteNewest(p.sub, p.gen, p.relay, p.rec.created_at);
+  for (int i = 0; i < p.dupCount; i++) {
+    relayNoteDuplicate(p.dups[i].relay, key, p.dups[i].at);
+    subNoteNewest(p.dups[i].sub, p.dups[i].gen, p.dups[i].relay, p.rec.created_at);
+  }
+  if (duplicate) textRelease(p.rec.content);
+  else addPost(p.rec);
+}
+
+// 積んだkind:1をまとめて検証し、通ったものをタイムラインへ
+void flushVerify() {
+  int n = verifyQueued;
+  if (n == 0) return;
+  verifyQueued = 0;
+  const uint8_t* pubkeys[NOSTRSIG_BATCH_MAX];
+  const uint8_t* msgs[NOSTRSIG_BATCH_MAX];
+  const uint8_t* sigs[NOSTRSIG_BATCH_MAX];
+  for (int i = 0; i < n; i++) {
+    pubkeys[i] = verifyQueue[i].rec.pubkey.b;
+    msgs[i] = verifyQueue[i].rec.id;
+    sigs[i] = verifyQueue[i].sig;
+  }
+  bool allValid = nostrsig_verify_batch(n, pubkeys, msgs, sigs);
+  for (int i = 0; i < n; i++) {
+    PendingPost& p = verifyQueue[i];
+    if (allValid || nostrsig_verify(pubkeys[i], msgs[i], sigs[i])) {
+      verifiedAdd(p.rec.id);
+      acceptPost(p);
+    } else {
+      char hex[17];
+      for (int j = 0; j < 8; j++) snprintf(hex + 2 * j, 3, "%02x", p.rec.id[j]);
+      relayNoteInvalid(p.relay, "sig", hex);
+      for (int j = 0; j < p.dupCount; j++) relayNoteInvalid(p.dups[j].relay, "sig", hex);
+      textRelease(p.rec.content);
+    }
+  }
+}
+
+// idを確かめたkind:1を署名の検証待ちに積む（contentはアリーナに置いたもの）
+void queuePost(int r, int slot, const NostrEvent& ev, const PostRecord& rec) {
+  PendingPost& p = verifyQueue[verifyQueued];
+  p.rec = rec;
+  p.relay = r;
+  p.sub = slot;
+  p.gen = subs[slot].gen;
+  p.at = millis();
+  p.dupCount = 0;
+  if (!VERIFY_SIGNATURES || verifiedHas(rec.id)) {
+    acceptPost(p);
+    return;
+  }
+  if (!hexToBytes(ev.sig, p.sig, 64)) {
+    relayNoteInvalid(r, "sig", ev.id);
+    textRelease(rec.content);
+    return;
+  }
+  // 複数のリレーから同じイベントが続けて届く: 署名まで同じなら1回だけ検証する
+  // 署名が違えば別々に検証し、先に通ったほうを受理する（偽の署名のコピーで本物を落とさない）
+  for (int i = 0; i < verifyQueued; i++) {
+    PendingPost& q = verifyQueue[i];
+    if (memcmp(q.rec.id, rec.id, 32) != 0 || memcmp(q.sig, p.sig, 64) != 0) continue;
+    if (q.dupCount < RELAY_MAX) q.dups[q.dupCount++] = { (int8_t)r, (int8_t)slot, p.gen, p.at };
+    textRelease(rec.content);
+    return;
+  }
+  if (verifyQueued++ == 0) verifyQueuedAt = millis();
+  if (verifyQueued == NOSTRSIG_BATCH_MAX) flushVerify();
+}
+
+// loopから。バーストが途切れたら積んだ分を検証する
+void processVerify() {
+  if (verifyQueued > 0 && millis() - verifyQueuedAt >= VERIFY_FLUSH_MS) flushVerify();
+}
+
+// rは受信したリレー
+void handleEvent(int r, uint8_t* payload, size_t length) {
+  // TLの重複配信（複数リレー・再接続・購読の重なり）は、受理済みならパース前に捨てる
+  // 受信済みにするのは検証を通ってから（acceptPost）。ここで覚えると偽のコピーが先に届いたとき本物が捨てられる
+  // kind:0は追い出した作者を取り直したときに同じイベントが再送されるので対象外（サブスクリプションで区別）
+  uint64_t idPrefix;
+  uint32_t createdAt;
+  Subscription* peeked = peekTimelineEvent(payload, length, idPrefix, createdAt);
+  if (peeked) {
+    subNoteEvent(*peeked, r, createdAt);  // 重複も数える（since付きのページが埋まったかの判定）
+    relayNoteEvent(r);
+    if (seenEventHas(idPrefix)) {
+      relayNoteDuplicate(r, idPrefix, millis());
+      return;
+    }
+  }
+  NostrEvent ev;
+  RelayMsgType type = parseRelayMessage((char*)payload, length, ev);
+  if (type == RELAY_MSG_OTHER) return;
+  Subscription* sub = subLookup(ev.subId, strlen(ev.subId));
+  if (!sub) return;  // 閉じた購読に遅れて届いたもの
+
+  if (type == RELAY_MSG_EVENT) {
+    if (sub->type == SUB_META && ev.kind == 0) {
+      relays[r].stats.events++;
+      relays[r].stats.totalEvents++;
+      PubKey pubkey;
+      if (pubkeyFromHex(ev.pubkey, pubkey) && ev.content) {
+        // まとめたREQには同じ作者の古い版も返りうる（新しい順に届く）
+        MetaEntry* known = findMeta(pubkey);
+        if (known && known->metaReceived && ev.created_at <= known->profileAt) return;
+        if (!eventValid(r, ev, pubkey)) return;  // parseProfileがcontentを書き換える前に
+        const char* dname;
+        const char* picture;
+        parseProfile((char*)ev.content, ev.contentLen, dname, picture);
+        MetaEntry* meta = addMeta(pubkey, dname, picture);
+        if (meta) meta->profileAt = ev.created_at;
+        iconDownloadPending = true;
         drawTimeline();
       }
+    } else if ((sub->type == SUB_TIMELINE || sub->type == SUB_BACKFILL) && ev.kind == 1) {
+      PostRecord rec;
+      rec.created_at = ev.created_at;
+
+      if (ev.content && pubkeyFromHex(ev.pubkey, rec.pubkey) && hexToBytes32(ev.id, rec.id)) {
+        if (VERIFY_SIGNATURES && !eventIdValid(ev, rec.pubkey, rec.id)) {
+          relayNoteInvalid(r, "id", ev.id);
+          return;
+        }
+        // 表示用に改行を空白に、200バイトを超えたら197バイト+"..."に詰めてからアリーナへ
+        char post[POST_TEXT_MAX + 1];
+        int len = ev.contentLen;
+        if (len > POST_TEXT_MAX) {
+          memcpy(post, ev.content, POST_TEXT_MAX - 3);
+          memcpy(post + POST_TEXT_MAX - 3, "...", 3);
+          len = POST_TEXT_MAX;
+        } else {
+          memcpy(post, ev.content, len);
+        }
+        post[len] = '\0';
+        for (int i = 0; i < len; i++) {
+          if (post[i] == '\n') post[i] = ' ';
+        }
+
+        rec.content = textPut(post, len);
+        if (!rec.content) return;  // 空の本文・アリーナに入らない: 空白の投稿は並べない
+        queuePost(r, sub - subs, ev, rec);
+      }
     }
-  } else if (strcmp(type, "EOSE") == 0) {
+  } else if (type == RELAY_MSG_EOSE) {
+    flushVerify();  // 保存済みの分を出し切ってから
+    subOnEose(*sub, r);
     drawIconStatusBar();
+  } else if (type == RELAY_MSG_CLOSED) {
+    subOnClosed(*sub, r, ev.content);
   }
 }
 
-void webSocketEvent(WStype_t type, uint8_t* payload, size_t length) {
+// --- permessage-deflate (RFC 7692) ---
+// リレーからの受信を圧縮してもらう（hexのid・pubkey・sig・タグは繰り返しが多い）。送信は圧縮しない
+// WebSocketsライブラリはRSV1ビットを渡さないので、圧縮されたメッセージは先頭バイトで見分ける:
+// リレーのメッセージは必ず'['で始まり、それを圧縮したDEFLATEの先頭バイトが'['(0x5B)になることはない
+//（固定ハフマンの'['は0x8B、動的ハフマンは下位3ビットが101、無圧縮ブロックは0x00/0x01）
+// ライブラリ（links2004/WebSockets 2.4）はRSV1の立ったフレームを弾かず、応答のSec-WebSocket-Extensionsも見ない前提
+// そうでなければ申し込んだ接続が何も展開できないまま切れる（応答で弾かれるならつながらない）ので、続いたら申し込みをやめる
+#ifndef RELAY_DEFLATE
+#define RELAY_DEFLATE 1                   // 0にすると申し込まない
+#endif
+#ifndef RELAY_DEFLATE_WINDOW_BITS
+#define RELAY_DEFLATE_WINDOW_BITS 15      // server_max_window_bits（9〜15）。窓は2^この値バイト
+#endif
+#ifndef RELAY_DEFLATE_CONTEXT_TAKEOVER
+#define RELAY_DEFLATE_CONTEXT_TAKEOVER 1  // 0: server_no_context_takeover（窓は全リレーで1つ、圧縮率は下がる）
+#endif
+#define RELAY_DEFLATE_WINDOW (1 << RELAY_DEFLATE_WINDOW_BITS)
+#define RELAY_DEFLATE_GIVE_UP 3           // 申し込んだ接続が圧縮されたメッセージなしで続けてこれだけ切れたらやめる
+#define RELAY_INFLATE_MAX (128 * 1024)    // 展開後の1メッセージの上限（超えたら捨てる）
+tinfl_decompressor* inflateState = NULL;  // NULL = 申し込まない
+uint8_t* inflateShared = NULL;  // context takeoverしないリレーの窓
+uint8_t* inflateMsg = NULL;     // 展開したメッセージ（handleEventがその場で書き換える）
+
+// 起動時に確保する。確保できなければ圧縮を申し込まない。持ち越し用の窓が確保できないリレーはtakeoverなしで申し込む
+void relayInflateInit() {
+  bool needShared = false;
+  for (int r = 0; r < relayCount; r++) {
+    relays[r].inflateRing = RELAY_DEFLATE_CONTEXT_TAKEOVER ? (uint8_t*)ps_malloc(RELAY_DEFLATE_WINDOW) : NULL;
+    if (!relays[r].inflateRing) needShared = true;
+  }
+  inflateState = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));  // ハフマンテーブルは毎バイト参照するので内部DRAM
+  inflateMsg = (uint8_t*)ps_malloc(RELAY_INFLATE_MAX + 1);
+  if (needShared) inflateShared = (uint8_t*)ps_malloc(RELAY_DEFLATE_WINDOW);
+  if (!inflateState || !inflateMsg || (needShared && !inflateShared)) {
+    Serial.println("[WS] inflate buffers unavailable, not offering permessage-deflate");
+    free(inflateState);
+    free(inflateMsg);
+    free(inflateShared);
+    inflateState = NULL;
+    for (int r = 0; r < relayCount; r++) {
+      free(relays[r].inflateRing);
+      relays[r].inflateRing = NULL;
+    }
+  }
+}
+
+// 次の接続（再接続を含む）のハンドシェイクに拡張の申し込みを付ける・外す
+void relayOfferDeflate(int r, bool offer = true) {
+  Relay& relay = relays[r];
+  relay.deflateOffered = offer && inflateState && !relay.deflateOff;
+  if (!relay.deflateOffered) {
+    relay.ws.offerExtension(NULL);
+    return;
+  }
+  char ext[96];
+  snprintf(ext, sizeof(ext), "permessage-deflate; server_max_window_bits=%d%s",
+    RELAY_DEFLATE_WINDOW_BITS, relay.inflateRing ? "" : "; server_no_context_takeover");
+  relay.ws.offerExtension(ext);
+}
+
+// 申し込んだ接続が切れた。圧縮されたメッセージを1つも展開できていなければ数え、続いたら以後は申し込まない
+// （圧縮しないリレーでも数えるが、その場合は申し込みをやめても変わらない）
+static void relayDeflateClosed(int r) {
+  Relay& relay = relays[r];
+  if (!relay.deflateOffered || relay.deflateSeen) return;
+  if (++relay.deflateDrops < RELAY_DEFLATE_GIVE_UP) return;
+  Serial.printf("[WS] %s: no compressed message in %d connections, not offering permessage-deflate\n",
+                relayConfigs[r].host, relay.deflateDrops);
+  relay.deflateOff = true;
+}
+
+// 圧縮されたメッセージを展開する。outに展開後の長さ。失敗（壊れている・大きすぎる）ならfalse
+// 窓はtinflのリングバッファ（2のべき乗）としてそのまま使い、出てきた分をinflateMsgに写す
+// メッセージはSYNC_FLUSHで終わり、末尾の00 00 FF FFは削られて届く（足してから展開）
+// メッセージの境目はブロックの境目なので、tinflの状態は毎回初期化してよい（持ち越すのは窓だけ）
+static bool relayInflate(int r, const uint8_t* payload, size_t length, size_t& out) {
+  static const uint8_t tail[4] = {0x00, 0x00, 0xFF, 0xFF};
+  Relay& relay = relays[r];
+  uint8_t* ring = relay.inflateRing ? relay.inflateRing : inflateShared;
+  size_t pos = relay.inflateRing ? relay.inflatePos : 0;
+  out = 0;
+  tinfl_init(inflateState);
+  for (int part = 0; part < 2; part++) {
+    const uint8_t* in = part == 0 ? payload : tail;
+    size_t inLeft = part == 0 ? length : sizeof(tail);
+    for (;;) {
+      size_t inBytes = inLeft;
+      size_t ofs = pos & (RELAY_DEFLATE_WINDOW - 1);
+      size_t outBytes = RELAY_DEFLATE_WINDOW - ofs;
+      tinfl_status status = tinfl_decompress(inflateState, in, &inBytes, ring, ring + ofs, &outBytes,
+                                             TINFL_FLAG_HAS_MORE_INPUT);
+      in += inBytes;
+      inLeft -= inBytes;
+      pos += outBytes;
+      if (out + outBytes > RELAY_INFLATE_MAX) status = TINFL_STATUS_FAILED;
+      else memcpy(inflateMsg + out, ring + ofs, outBytes);
+      out += outBytes;
+      if (status < 0) {
+        if (relay.inflateRing) relay.inflateBroken = true;
+        return false;
+      }
+      if (status == TINFL_STATUS_DONE) {  // BFINALのブロックで終わった（足した空ブロックは読まない）
+        part = 2;
+        break;
+      }
+      if (status == TINFL_STATUS_NEEDS_MORE_INPUT) break;
+      // HAS_MORE_OUTPUT: リングの端まで書いた。写し終えたので先頭から続ける
+    }
+  }
+  if (relay.inflateRing) relay.inflatePos = pos;
+  return true;
+}
+
+// 受信したメッセージを（圧縮されていれば展開して）handleEventへ
+void relayReceive(int r, uint8_t* payload, size_t length) {
+  Relay& relay = relays[r];
+  relay.stats.wireBytes += length;
+  if (length == 0 || payload[0] == '[' || !inflateState) {
+    relay.stats.jsonBytes += length;
+    handleEvent(r, payload, length);
+    return;
+  }
+  if (relay.inflateBroken) return;  // つなぎ直すまで展開できない
+  size_t len;
+  if (!relayInflate(r, payload, length, len)) {
+    relay.stats.errors++;
+    relay.stats.totalErrors++;
+    Serial.printf("[WS] %s: inflate failed (%u bytes)\n", relayConfigs[r].host, (unsigned)length);
+    return;
+  }
+  inflateMsg[len] = '\0';  // ライブラリのペイロードと同じく終端する
+  relay.deflateSeen = true;
+  relay.deflateDrops = 0;
+  relay.stats.jsonBytes += len;
+  handleEvent(r, inflateMsg, len);
+}
+
+// 分割されたテキストメッセージ（FIN=0のフレームと続き）。つなげてからrelayReceiveへ
+// 圧縮されていればRSV1は最初のフレームにだけ立ち、続きのフレームは同じDEFLATEの続き（つなげれば1つのメッセージと同じ）
+// 分割は大きなメッセージにしか使われないので、バッファは初めて分割が届いたときに確保する
+// 入りきらなければ捨てる。窓を持ち越すリレーで圧縮されたものを捨てると窓がずれるのでつなぎ直す
+static void relayFragment(int r, WStype_t type, uint8_t* payload, size_t length) {
+  Relay& relay = relays[r];
+  if (type == WStype_FRAGMENT_TEXT_START) {
+    if (!relay.fragBuf) relay.fragBuf = (uint8_t*)ps_malloc(RELAY_INFLATE_MAX + 1);
+    relay.fragLen = 0;
+    relay.fragging = true;
+    relay.fragDropped = false;
+  } else if (type == WStype_FRAGMENT_BIN_START) {
+    relay.fragging = false;  // バイナリは使わない
+  }
+  if (!relay.fragging) return;
+  if (!relay.fragBuf || relay.fragLen + length > RELAY_INFLATE_MAX) {
+    relay.fragDropped = true;
+  } else if (!relay.fragDropped) {
+    memcpy(relay.fragBuf + relay.fragLen, payload, length);
+    relay.fragLen += length;
+  }
+  if (type != WStype_FRAGMENT_FIN) return;
+  relay.fragging = false;
+  if (relay.fragDropped) {
+    relay.stats.errors++;
+    relay.stats.totalErrors++;
+    Serial.printf("[WS] %s: fragmented message too large, dropped\n", relayConfigs[r].host);
+    bool compressed = relay.fragLen == 0 || relay.fragBuf[0] != '[';
+    if (compressed && inflateState && relay.inflateRing) relay.inflateBroken = true;
+    return;
+  }
+  relay.fragBuf[relay.fragLen] = '\0';
+  relayReceive(r, relay.fragBuf, relay.fragLen);
+}
+
+void webSocketEvent(int r, WStype_t type, uint8_t* payload, size_t length) {
   switch (type) {
     case WStype_DISCONNECTED:
-      connected = false;
+      if (!relays[r].connected) {  // 再接続の失敗ごとにも来る
+        // エラーは接続を失ってから最初の失敗だけ数える（落ちたままのリレーの点数が際限なく下がらないように）
+        // 間隔は失敗の回数で延ばす
+        if (relays[r].reconnectFails++ == 0) {
+          relays[r].stats.errors++;
+          relays[r].stats.totalErrors++;
+        }
+        // 続けて失敗したら申し込みなしの試行を交互に挟む（応答の拡張でハンドシェイクが弾かれる場合）
+        if (relays[r].reconnectFails >= 2) relayOfferDeflate(r, relays[r].reconnectFails % 2 == 1);
+        relayBackoff(r);
+        break;
+      }
+      relays[r].connected = false;
+      relays[r].inflatePos = 0;
+      relays[r].inflateBroken = false;
+      relays[r].fragging = false;
+      relayDeflateClosed(r);
+      relayOfferDeflate(r);
+      relays[r].stats.disconnects++;
+      relays[r].stats.totalDisconnects++;
+      relayBackoff(r);
+      subDisconnected(r);
+      relayReroute();
       drawHeader();
-      drawStatus("Disconnected, reconnecting...");
+      if (relaysConnected() == 0) drawStatus("Disconnected, reconnecting...");
       break;
     case WStype_CONNECTED:
-      connected = true;
+      relays[r].connected = true;
+      relays[r].reconnectFails = 0;
+      relays[r].inflatePos = 0;  // 窓は接続ごと
+      relays[r].inflateBroken = false;
+      relays[r].deflateSeen = false;
+      relays[r].fragging = false;
+      relays[r].stats.connectMs = millis() - relays[r].connectAttemptAt;
       drawHeader();
-      sendSubscribe();
+      relayReroute();  // TLと送りそびれた購読
+      drawIconStatusBar();
       break;
     case WStype_TEXT:
-      handleEvent(payload, length);
+      relayReceive(r, payload, length);
+      break;
+    case WStype_FRAGMENT_TEXT_START:
+    case WStype_FRAGMENT_BIN_START:
+    case WStype_FRAGMENT:
+    case WStype_FRAGMENT_FIN:
+      relayFragment(r, type, payload, length);
+      break;
+    case WStype_ERROR:
+      relays[r].stats.errors++;
+      relays[r].stats.totalErrors++;
       break;
     default: break;
   }
@@ -1013,9 +3323,11 @@ void processIconDownload() {
   if (!iconDownloadPending) return;
 
   // TLに表示されてるポストのアイコンを優先
-  for (int i = 0; i < postCount && i < MAX_POSTS; i++) {
-    MetaEntry* meta = findMeta(posts[i].pubkey);
-    if (meta && meta->pictureUrl.length() > 0 && meta->iconPoolIdx < 0 && !meta->iconFailed) {
+  for (int i = 0; i < TIMELINE_VISIBLE; i++) {
+    PostRecord* rec = timelineAt(tlScroll + i);
+    if (!rec) break;
+    MetaEntry* meta = findMeta(rec->pubkey);
+    if (meta && textLen(meta->pictureUrl) > 0 && meta->iconPoolIdx < 0 && !meta->iconFailed) {
       drawIconStatusBar();
       if (downloadIcon(meta)) {
         drawTimeline();
@@ -1025,21 +3337,39 @@ void processIconDownload() {
     }
   }
 
-  // metaCache全体から未取得のものを1枚ずつダウンロード（新しい方から＝スタック型）
-  for (int i = metaCacheCount - 1; i >= 0; i--) {
+  // metaCache全体から未取得のものを1枚ずつ先読み（新しい方から＝スタック型）
+  // 先読みはプールの空きスロットだけを使う（表示中でないアイコン同士で追い出し合わない）
+  MetaEntry* newest = NULL;
+  for (int i = 0; i < metaCacheCount; i++) {
     MetaEntry* meta = &metaCache[i];
-    if (meta->pictureUrl.length() > 0 && meta->iconPoolIdx < 0 && !meta->iconFailed) {
-      drawIconStatusBar();
-      if (downloadIcon(meta)) {
-        drawTimeline();
-      }
-      drawIconStatusBar();
-      return; // 1枚ずつ
+    if (textLen(meta->pictureUrl) > 0 && meta->iconPoolIdx < 0 && !meta->iconFailed &&
+        (!newest || meta->addedSeq > newest->addedSeq)) {
+      newest = meta;
+    }
+  }
+  if (newest && iconPoolHasFree()) {
+    drawIconStatusBar();
+    if (downloadIcon(newest)) {
+      drawTimeline();
     }
+    drawIconStatusBar();
+    return; // 1枚ずつ
   }
   iconDownloadPending = false;
 }
 
+// --- タイムラインのスクロール ---
+// 画面下のタッチボタン: A = 新しい方へ1件、B = 最新へ、C = 古い方へ1件
+void handleScroll() {
+  int prev = tlScroll;
+  if (M5.BtnA.wasPressed() && tlScroll > 0) tlScroll--;
+  if (M5.BtnB.wasPressed()) tlScroll = 0;
+  if (M5.BtnC.wasPressed() && tlScroll < tlCount - 1) tlScroll++;
+  if (tlScroll == prev) return;
+  iconDownloadPending = true;  // 新しく見えた作者のアイコン（プールに残っていれば付け直すだけ）
+  drawTimeline();              // 名前のない作者はここでkind:0を頼む
+}
+
 // --- Web OTA ---
 void setupWebOTA() {
   server.on("/", HTTP_GET, []() {
@@ -1048,7 +3378,27 @@ void setupWebOTA() {
       "<form method='POST' action='/update' enctype='multipart/form-data'>"
       "<input type='file' name='firmware'>"
       "<input type='submit' value='Upload'>"
-      "</form>");
+      "</form>"
+      "<p><a href='/relays'>relays</a></p>");
+  });
+  // リレーごとの計測値
+  server.on("/relays", HTTP_GET, []() {
+    String body;
+    char line[256];
+    for (int r = 0; r < relayCount; r++) {
+      const Relay& relay = relays[r];
+      const RelayStats& st = relay.stats;
+      snprintf(line, sizeof(line),
+        "%s %s%s score=%d connect=%lums eose=%dms lag=%dms events/s=%.1f events=%u firsts=%u "
+        "errors=%u disconnects=%u invalid=%u subs=%d/%d rx=%uKB json=%uKB\n",
+        relayConfigs[r].host, relay.connected ? "connected" : "offline", relay.demoted ? " demoted" : "",
+        relayScore(r), st.connectMs, st.eoseMs < 0 ? 0 : (int)st.eoseMs, st.lagMs < 0 ? 0 : (int)st.lagMs,
+        st.eventsPerSec < 0 ? 0 : st.eventsPerSec, (unsigned)st.totalEvents, (unsigned)st.firsts,
+        (unsigned)st.totalErrors, (unsigned)st.totalDisconnects, (unsigned)st.totalInvalid, relay.subOpenCount, relay.subLimit,
+        (unsigned)(st.wireBytes >> 10), (unsigned)(st.jsonBytes >> 10));
+      body += line;
+    }
+    server.send(200, "text/plain", body);
   });
   server.on("/update", HTTP_POST, []() {
     server.send(200, "text/plain", Update.hasError() ? "FAIL" : "OK");
@@ -1057,7 +3407,7 @@ void setupWebOTA() {
   }, []() {
     HTTPUpload& upload = server.upload();
     if (upload.status == UPLOAD_FILE_START) {
-      webSocket.disconnect();
+      for (int r = 0; r < relayCount; r++) relays[r].ws.disconnect();
       M5.Lcd.fillScreen(BLACK);
       M5.Lcd.setTextSize(2);
       M5.Lcd.setTextColor(YELLOW);
@@ -1086,8 +3436,61 @@ void setup() {
   M5.begin();
   M5.Lcd.fillScreen(BLACK);
 
-  // アイコンプール初期化
+  // アイコンプール初期化（PSRAMがなければ内部DRAMに従来の枚数だけ）
+  iconPoolCount = ICON_BUF_COUNT;
+  iconPool = (IconPacked*)ps_malloc(ICON_BUF_COUNT * sizeof(IconPacked));
+  iconPoolKey = (PubKey*)ps_malloc(ICON_BUF_COUNT * sizeof(PubKey));
+  if (!iconPool || !iconPoolKey) {
+    Serial.println("[ICON] PSRAM icon store unavailable, using internal RAM");
+    free(iconPool);
+    free(iconPoolKey);
+    iconPoolCount = ICON_BUF_COUNT_NOPSRAM;
+    iconPool = (IconPacked*)malloc(iconPoolCount * sizeof(IconPacked));
+    iconPoolKey = (PubKey*)malloc(iconPoolCount * sizeof(PubKey));
+    if (!iconPool || !iconPoolKey) iconPoolCount = 0;  // アイコンはカラーブロックのまま
+  }
   memset(iconPoolUsed, 0, sizeof(iconPoolUsed));
+  memset(iconPoolHot, 0xFF, sizeof(iconPoolHot));
+  for (int i = 0; i < ICON_HOT_COUNT; i++) iconHotSrc[i] = -1;
+  // 重複除去の集合（確保できなければ重複除去なし）
+  for (int i = 0; i < 2; i++) {
+    seenGen[i].set = (uint64_t*)ps_malloc(SEEN_SET_SLOTS * sizeof(uint64_t));
+    if (seenGen[i].set) memset(seenGen[i].set, 0, SEEN_SET_SLOTS * sizeof(uint64_t));
+  }
+  // 検証済みのid
+  verifiedIds = (uint8_t(*)[32])ps_malloc(VERIFIED_IDS * 32);
+  if (verifiedIds) memset(verifiedIds, 0, VERIFIED_IDS * 32);
+  // タイムラインリング
+  tlCapacity = TIMELINE_CAPACITY;
+  tlRecords = (PostRecord*)ps_malloc(TIMELINE_CAPACITY * sizeof(PostRecord));
+  tlOrder = (uint16_t*)ps_malloc(TIMELINE_CAPACITY * sizeof(uint16_t));
+  if (!tlRecords || !tlOrder) {
+    Serial.println("[TL] PSRAM timeline unavailable, using internal RAM");
+    free(tlRecords);
+    free(tlOrder);
+    tlCapacity = TIMELINE_CAPACITY_NOPSRAM;
+    tlRecords = (PostRecord*)malloc(tlCapacity * sizeof(PostRecord));
+    tlOrder = (uint16_t*)malloc(tlCapacity * sizeof(uint16_t));
+    if (!tlRecords || !tlOrder) tlCapacity = 0;  // 投稿は表示されない
+  }
+  for (int i = 0; i < tlCapacity; i++) tlOrder[i] = i;  // 最初は全スロットが空き
+  // テキストアリーナ（名前・URL・本文）
+  textSlabCount = TEXT_SLAB_COUNT;
+  textArena = (uint8_t*)ps_malloc(TEXT_SLAB_COUNT * TEXT_SLAB_SIZE);
+  if (!textArena) {
+    Serial.println("[TEXT] PSRAM text arena unavailable, using internal RAM");
+    textSlabCount = TEXT_SLAB_COUNT_NOPSRAM;
+    textArena = (uint8_t*)malloc(textSlabCount * TEXT_SLAB_SIZE);
+    if (!textArena) textSlabCount = 0;  // 名前・本文は空のまま（pubkey表示）
+  }
+  // libwebpのワーカーをFreeRTOSタスクに差し替え（最初のデコード前に必要）
+  if (!WebPInitTaskWorker()) Serial.println("[WEBP] task worker init failed");
+  // デコード用アリーナを断片化前に確保（失敗時は従来どおりヒープから確保）
+  if (!decmem_arena_reserve(DECODE_ARENA_DRAM, DECODE_ARENA_PSRAM)) {
+    Serial.println("[DECMEM] arena reserve failed, decoding from heap");
+  }
+  // permessage-deflateの展開用
+  if (RELAY_DEFLATE) relayInflateInit();
 
   drawHeader();
   drawStatus("Connecting WiFi...");
@@ -1098,21 +3501,22 @@ void setup() {
     attempts++;
   }
   if (WiFi.status() != WL_CONNECTED) {
-    efontDrawString(30, 80, String("WiFi接続失敗"), RED, 280, 1);
+    efontDrawString(30, 80, "WiFi接続失敗", RED, 280, 1);
     drawStatus("Reboot to retry");
     return;
   }
   wifiReady = true;
+  configTime(0, 0, NTP_SERVER);  // TLを送り直すときのsinceの上限（合うまではsinceなし）
   setupWebOTA();
 
   M5.Lcd.fillRect(0, 30, 320, 200, BLACK);
-  efontDrawString(30, 50, String("noscli-core2"), WHITE, 280, 1);
+  efontDrawString(30, 50, "noscli-core2", WHITE, 280, 1);
   M5.Lcd.setTextSize(2);
   M5.Lcd.setTextColor(CYAN);
   M5.Lcd.setCursor(30, 100);
   M5.Lcd.print("IP: ");
   M5.Lcd.print(WiFi.localIP());
-  efontDrawString(30, 150, String("タッチでリレーに接続"), GREEN, 280, 1);
+  efontDrawString(30, 150, "タッチでリレーに接続", GREEN, 280, 1);
   drawStatus("WiFi OK / OTA ready");
 
   // テストコード削除済み
@@ -1137,12 +3541,39 @@ void loop() {
       M5.Lcd.fillRect(0, 30, 320, 200, BLACK);
       drawHeader();
       drawStatus("Connecting relay...");
-      webSocket.beginSSL(RELAY_HOST, RELAY_PORT, RELAY_PATH);
-      webSocket.onEvent(webSocketEvent);
-      webSocket.setReconnectInterval(5000);
+      for (int r = 0; r < relayCount; r++) {
+        relays[r].connected = false;
+        relays[r].demoted = false;
+        relays[r].subLimit = SUB_LIMIT_DEFAULT;
+        relays[r].subOpenCount = 0;
+        memset(&relays[r].stats, 0, sizeof(RelayStats));
+        relays[r].stats.eoseMs = relays[r].stats.lagMs = relays[r].stats.eventsPerSec = -1;
+        relays[r].connectAttemptAt = millis();
+      }
+      relayStatsAt = millis();
+      subscribeTimeline();
+      for (int r = 0; r < relayCount; r++) {
+        relays[r].ws.beginSSL(relayConfigs[r].host, relayConfigs[r].port, relayConfigs[r].path);
+        relayOfferDeflate(r);
+        relays[r].ws.onEvent([r](WStype_t type, uint8_t* payload, size_t length) {
+          webSocketEvent(r, type, payload, length);
+        });
+        relays[r].ws.setReconnectInterval(RELAY_RECONNECT_MS);
+      }
     }
   } else {
-    webSocket.loop();
+    for (int r = 0; r < relayCount; r++) {
+      // 未接続のリレーのloopはTCP/TLSの接続で止まる。接続にかかった時間はここから測る
+      unsigned long t = millis();
+      relays[r].ws.loop();
+      if (!relays[r].connected && millis() - t > 50) relays[r].connectAttemptAt = t;
+      if (relays[r].connected && relays[r].inflateBroken) relays[r].ws.disconnect();  // コールバックの外で
+    }
+    subPump();
+    processVerify();
+    processRelayStats();
+    processMetaFetch();
+    handleScroll();
     processIconDownload();
   }
   yield();
@@ -0,0 +1,26 @@
+// The pre-extractor code path: deserialize the whole message into a
+// JsonDocument, then look the keys up.
+
+#include "arduinojson_baseline.h"
+
+#include <string.h>
+
+#include <ArduinoJson.h>
+
+int baselineExtract(const char* msg, size_t len, BaselineEvent* out) {
+  JsonDocument doc;
+  if (deserializeJson(doc, msg, len)) return 0;
+  const char* type = doc[0];
+  if (!type || strcmp(type, "EVENT") != 0) return 0;
+  const char* subId = doc[1];
+  if (!subId) return 0;
+  const char* id = doc[2]["id"];
+  const char* pubkey = doc[2]["pubkey"];
+  const char* content = doc[2]["content"];
+  out->kind = doc[2]["kind"] | -1;
+  out->created_at = doc[2]["created_at"] | 0;
+  out->idLen = id ? strlen(id) : 0;
+  out->pubkeyLen = pubkey ? strlen(pubkey) : 0;
+  out->contentLen = content ? strlen(content) : 0;
+  return 1;
+}
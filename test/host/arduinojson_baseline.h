@@ -0,0 +1,16 @@
+// What handleEvent() read with ArduinoJson before the in-place extractor:
+// bench_parser.cpp compares the two. Built only with ARDUINOJSON_DIR set
+// (run.sh), since the host stubs replace ArduinoJson in main.cpp.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct BaselineEvent {
+  int kind;
+  uint32_t created_at;
+  size_t idLen, pubkeyLen, contentLen;
+};
+
+// Returns 0 unless msg is an EVENT.
+int baselineExtract(const char* msg, size_t len, BaselineEvent* out);
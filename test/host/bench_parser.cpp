@@ -0,0 +1,111 @@
+// Throughput of the relay message extractor (parseRelayMessage) on
+// synthetic kind:1 traffic: Japanese and ASCII text, escapes, emoji as
+// \u surrogate pairs, 0-8 e/p tags. With ARDUINOJSON_DIR (see run.sh) it
+// also runs the ArduinoJson code it replaced on the same messages, checks
+// that both read the same values, and prints the ratio.
+//
+// Both sides copy each message first: the extractor needs a writable
+// buffer (on the device it is the WebSocket payload itself).
+
+#include "host.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifdef HAVE_ARDUINOJSON
+#include "arduinojson_baseline.h"
+#endif
+
+static uint32_t rng = 12345;
+static uint32_t rnd(uint32_t n) {
+  rng = rng * 1103515245u + 12345u;
+  return (rng >> 8) % n;
+}
+
+static std::string hex(int n) {
+  static const char* digits = "0123456789abcdef";
+  std::string s;
+  for (int i = 0; i < n; i++) s += digits[rnd(16)];
+  return s;
+}
+
+static std::string content() {
+  static const char* pieces[] = {"おはよう", "Nostr", " ", "\\n", "\\\"quoted\\\"", "\\ud83d\\ude00", "\\u3042",
+                                 "https:\\/\\/example.com\\/a.png", "草", "\\\\", "テスト", "hello world"};
+  std::string s;
+  int n = 2 + rnd(40);
+  for (int i = 0; i < n; i++) s += pieces[rnd(sizeof(pieces) / sizeof(pieces[0]))];
+  return s;
+}
+
+static std::string message() {
+  std::string tags = "[";
+  int n = rnd(9);
+  for (int i = 0; i < n; i++) {
+    if (i) tags += ",";
+    tags += rnd(2) ? "[\"e\",\"" + hex(64) + "\",\"wss:\\/\\/relay.test\",\"reply\"]" : "[\"p\",\"" + hex(64) + "\"]";
+  }
+  tags += "]";
+  return "[\"EVENT\",\"1a2b\",{\"id\":\"" + hex(64) + "\",\"pubkey\":\"" + hex(64) +
+         "\",\"created_at\":" + std::to_string(1700000000 + rnd(1000000)) + ",\"kind\":1,\"tags\":" + tags +
+         ",\"content\":\"" + content() + "\",\"sig\":\"" + hex(128) + "\"}]";
+}
+
+static double seconds() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main() {
+  const int kMessages = 2000;
+  const int kRounds = 50;
+  std::vector<std::string> msgs;
+  size_t bytes = 0, maxLen = 0;
+  for (int i = 0; i < kMessages; i++) {
+    msgs.push_back(message());
+    bytes += msgs.back().size();
+    maxLen = std::max(maxLen, msgs.back().size());
+  }
+  std::vector<char> buf(maxLen);
+  printf("%d messages, %.0f bytes on average\n", kMessages, (double)bytes / kMessages);
+
+  size_t sink = 0;
+  double t = seconds();
+  for (int r = 0; r < kRounds; r++) {
+    for (const std::string& m : msgs) {
+      memcpy(buf.data(), m.data(), m.size());
+      NostrEvent ev;
+      if (parseRelayMessage(buf.data(), m.size(), ev) == RELAY_MSG_EVENT) sink += ev.contentLen + ev.kind;
+    }
+  }
+  double inPlace = (seconds() - t) / kRounds;
+  CHECK(sink > 0);
+  printf("in place:    %8.0f events/s  %6.1f MB/s\n", kMessages / inPlace, bytes / inPlace / 1e6);
+
+#ifdef HAVE_ARDUINOJSON
+  for (const std::string& m : msgs) {
+    memcpy(buf.data(), m.data(), m.size());
+    NostrEvent ev;
+    BaselineEvent be;
+    CHECK(parseRelayMessage(buf.data(), m.size(), ev) == RELAY_MSG_EVENT);
+    CHECK(baselineExtract(m.data(), m.size(), &be));
+    CHECK(be.kind == ev.kind && be.created_at == ev.created_at);
+    CHECK(be.idLen == strlen(ev.id) && be.pubkeyLen == strlen(ev.pubkey));
+    CHECK(be.contentLen == (size_t)ev.contentLen);
+  }
+  t = seconds();
+  for (int r = 0; r < kRounds; r++) {
+    for (const std::string& m : msgs) {
+      memcpy(buf.data(), m.data(), m.size());
+      BaselineEvent be;
+      if (baselineExtract(buf.data(), m.size(), &be)) sink += be.contentLen + be.kind;
+    }
+  }
+  double baseline = (seconds() - t) / kRounds;
+  printf("ArduinoJson: %8.0f events/s  %6.1f MB/s  (in place is %.1fx faster)\n", kMessages / baseline,
+         bytes / baseline / 1e6, baseline / inPlace);
+#else
+  printf("ArduinoJson: not built (set ARDUINOJSON_DIR)\n");
+#endif
+  return host_result();
+}
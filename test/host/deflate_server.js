@@ -0,0 +1,67 @@
+// permessage-deflate relay for test_deflate.cpp, on the ws package (a real
+// RFC 7692 implementation). Prints "port <n>" once listening. Each
+// connection answers the first REQ with a fixed burst and then closes:
+//
+//   EVENT A, EVENT B        compressed (B refers back to A with context takeover)
+//   NOTICE                  sent uncompressed in the negotiated session
+//   EVENT C (long)          compressed, split into 3 frames (RSV1 on the first only)
+//   EOSE                    uncompressed, split into 2 frames
+//
+// Whether the server keeps its window is up to the client's offer
+// (server_no_context_takeover). Exits after two connections or 20 s.
+//
+//   NODE_PATH=<dir containing ws> node deflate_server.js
+
+const { WebSocketServer } = require("ws");
+
+const pubkey = "bb50e2d89a4ed70663d080659fe0ad4b9bc3e06c17a227433966cb59ceee020d";
+const events = [
+  { id: "042cf6ccc212f6316be70c91788b82c7f782da8714e7b91890cb1892f7932817", created_at: 1700000400,
+    content: "compressed post",
+    sig: "e95287a2d01455e12d2cf1382743552f690425f38e88caa4802cdb9d7fe65756" +
+         "f486e9c928589892223f6bc116886a7e24d5444e8f3147b562730fa0d97e2eae" },
+  { id: "b34f1cc59206d74cf2e93622d37c231249657a1db94a28243ee1cff1de960c4f", created_at: 1700000500,
+    content: "another compressed post",
+    sig: "62474127734a98fe7702f8605174eb8fefd4e097d4bd6547e08ebd558ab2f287" +
+         "08636930ff5e16a4585e0ff3536169eda82377d930d0ea80a46401092ad22b26" },
+  { id: "5d216949ddef85f1ddd6546f53f58ae336cb536c99c5bd32f4ce66fb316056bd", created_at: 1700000600,
+    content: Array.from({ length: 60 }, (_, i) => `fragment ${i} of a long post sent in several frames.`).join(" "),
+    sig: "2c5db1484df8be7f68b8de305fddf2e5ab1cffc1278d323c3aba75441f46005c" +
+         "b0f7735c390e6d43d82de09ee0357373f3e5db20e6591325586b18f08d4355eb" },
+];
+
+function eventMessage(subId, e) {
+  return JSON.stringify(["EVENT", subId, { id: e.id, pubkey, created_at: e.created_at, kind: 1, tags: [],
+                                           content: e.content, sig: e.sig }]);
+}
+
+// Sends msg as n frames; only the first may carry RSV1.
+function sendSplit(ws, msg, n, compress) {
+  const size = Math.ceil(msg.length / n);
+  for (let i = 0; i < n; i++) {
+    ws.send(msg.slice(i * size, (i + 1) * size), { fin: i === n - 1, compress });
+  }
+}
+
+const wss = new WebSocketServer({ port: 0, host: "127.0.0.1", perMessageDeflate: { threshold: 0 } });
+let closed = 0;
+wss.on("connection", (ws) => {
+  let answered = false;
+  ws.on("message", (data) => {
+    const msg = JSON.parse(data.toString());
+    if (answered || msg[0] !== "REQ") return;
+    answered = true;
+    const subId = msg[1];
+    ws.send(eventMessage(subId, events[0]));
+    ws.send(eventMessage(subId, events[1]));
+    ws.send(JSON.stringify(["NOTICE", "sent without compression"]), { compress: false });
+    sendSplit(ws, eventMessage(subId, events[2]), 3, true);
+    sendSplit(ws, JSON.stringify(["EOSE", subId]), 2, false);
+    ws.close();
+  });
+  ws.on("close", () => {
+    if (++closed === 2) process.exit(0);
+  });
+});
+wss.on("listening", () => console.log(`port ${wss.address().port}`));
+setTimeout(() => process.exit(1), 20000).unref();
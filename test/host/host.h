@@ -0,0 +1,22 @@
+// Shared by the host tests: src/main.cpp itself (so its static functions
+// can be called), plus a CHECK that counts failures.
+#pragma once
+
+#include "main.cpp"
+
+static int host_failed = 0;
+
+#define CHECK(cond)                                                  \
+  do {                                                               \
+    if (!(cond)) {                                                   \
+      printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+      host_failed++;                                                 \
+    }                                                                \
+  } while (0)
+
+// Finishes main(): prints ok or the number of failures.
+static int host_result() {
+  if (host_failed) printf("%d checks FAILED\n", host_failed);
+  else printf("ok\n");
+  return host_failed ? 1 : 0;
+}
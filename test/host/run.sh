@@ -0,0 +1,55 @@
+#!/bin/sh
+# Host tests for src/main.cpp. Builds the vendored libraries for the host,
+# then each test_*.cpp (or the files given) against stubs/ and runs it.
+#
+#   sh test/host/run.sh                      # all tests
+#   sh test/host/run.sh bench_parser.cpp     # one file (benchmarks too)
+#   ARDUINOJSON_DIR=.pio/libdeps/m5stack-core2/ArduinoJson/src \
+#     sh test/host/run.sh bench_parser.cpp   # with the ArduinoJson baseline
+#
+# Needs a C/C++ compiler and zlib. CFLAGS adds flags, e.g.
+# CFLAGS="-fsanitize=address,undefined -g".
+set -e
+cd "$(dirname "$0")"
+host=$(pwd)
+root=$(cd ../.. && pwd)
+out=${TMPDIR:-/tmp}/ncl_host_test
+flags="-O2 -g $CFLAGS"
+mkdir -p "$out/src" "$out/obj"
+
+# main.cpp includes "../secrets.h"
+cp "$root/src/main.cpp" "$out/src/main.cpp"
+cp "$host/secrets.h" "$out/secrets.h"
+
+libs=
+for f in "$root"/lib/nostrsig/*.c "$root"/lib/decmem/*.c "$root"/lib/libjpeg/src/*.c \
+         "$root"/lib/libwebp/src/dec/*.c "$root"/lib/libwebp/src/dsp/*.c "$root"/lib/libwebp/src/utils/*.c; do
+  case $f in
+    *neon*|*sse*|*mips*|*msa*|*avx*|*/cost*|*/enc*|*lossless_enc*) continue ;;
+  esac
+  o="$out/obj/$(echo "${f#$root/lib/}" | tr / _).o"
+  if [ ! -e "$o" ] || [ "$f" -nt "$o" ]; then
+    ${CC:-cc} $flags -w -U__SSE2__ -DWEBP_USE_THREAD -DHAVE_PROTOTYPES \
+      -I"$root/lib/libwebp" -I"$root/lib/decmem" -I"$root/lib/nostrsig" -c "$f" -o "$o"
+  fi
+  libs="$libs $o"
+done
+
+incs="-I$host/stubs -I$out/src -I$root/lib/libwebp/src -I$root/lib/libwebp -I$root/lib/libjpeg/src \
+  -I$root/lib/decmem -I$root/lib/nostrsig"
+extra=
+if [ -n "$ARDUINOJSON_DIR" ]; then
+  ${CXX:-c++} -std=gnu++17 $flags -I"$ARDUINOJSON_DIR" -c "$host/arduinojson_baseline.cpp" -o "$out/obj/aj.o"
+  extra="$out/obj/aj.o -DHAVE_ARDUINOJSON"
+fi
+
+tests=${*:-$(ls test_*.cpp)}
+status=0
+for t in $tests; do
+  name=$(basename "$t" .cpp)
+  ${CXX:-c++} -std=gnu++17 $flags -DHAVE_PROTOTYPES $incs "$host/$t" $libs $extra -lz -lpthread -lm \
+    -o "$out/$name"
+  echo "== $name"
+  "$out/$name" || status=1
+done
+exit $status
@@ -0,0 +1,6 @@
+// Settings for the host tests (run.sh copies this next to a copy of
+// src/main.cpp, where "../secrets.h" finds it).
+#define WIFI_SSID "host"
+#define WIFI_PASS "host"
+#define RELAY_LIST {"relay1.test", 443, "/"}, {"relay2.test", 443, "/"}
+#define NOSTR_NSEC "nsec1"
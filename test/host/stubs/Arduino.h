@@ -0,0 +1,154 @@
+// Host stand-ins for the Arduino core: just enough for src/main.cpp to
+// compile and run its non-hardware parts (parsing, verification, the
+// timeline, subscriptions) under test/host.
+#pragma once
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define F(x) x
+#define HEX 16
+
+class String {
+ public:
+  std::string s;
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const std::string& x) : s(x) {}
+  String(const char* c, unsigned n) : s(c, n) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(long long v) : s(std::to_string(v)) {}
+  String(unsigned long long v) : s(std::to_string(v)) {}
+  String(float v, unsigned decimals = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", decimals, v); s = b; }
+  String(double v, unsigned decimals = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", decimals, v); s = b; }
+  unsigned length() const { return s.size(); }
+  const char* c_str() const { return s.c_str(); }
+  String substring(unsigned a) const { return a < s.size() ? String(s.substr(a)) : String(); }
+  String substring(unsigned a, unsigned b) const { return a < s.size() && b > a ? String(s.substr(a, b - a)) : String(); }
+  int indexOf(const char* x, unsigned from = 0) const { size_t p = s.find(x, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(char x, unsigned from = 0) const { size_t p = s.find(x, from); return p == std::string::npos ? -1 : (int)p; }
+  bool startsWith(const char* x) const { return s.rfind(x, 0) == 0; }
+  bool startsWith(const String& x) const { return s.rfind(x.s, 0) == 0; }
+  bool endsWith(const char* x) const { size_t n = strlen(x); return s.size() >= n && s.compare(s.size() - n, n, x) == 0; }
+  void replace(const char* a, const char* b) {
+    size_t n = strlen(a), m = strlen(b);
+    if (n == 0) return;
+    for (size_t p = 0; (p = s.find(a, p)) != std::string::npos; p += m) s.replace(p, n, b);
+  }
+  bool reserve(unsigned n) { s.reserve(n); return true; }
+  bool concat(const char* c, unsigned n) { s.append(c, n); return true; }
+  char operator[](unsigned i) const { return s[i]; }
+  char charAt(unsigned i) const { return s[i]; }
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator!=(const String& o) const { return s != o.s; }
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char o) { s += o; return *this; }
+  String& operator+=(int o) { s += std::to_string(o); return *this; }
+  String& operator+=(unsigned long o) { s += std::to_string(o); return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+  void toLowerCase() { for (char& c : s) c = tolower((unsigned char)c); }
+  void trim() {
+    size_t a = s.find_first_not_of(" \t\r\n"), b = s.find_last_not_of(" \t\r\n");
+    s = a == std::string::npos ? std::string() : s.substr(a, b - a + 1);
+  }
+  long toInt() const { return atol(s.c_str()); }
+  void clear() { s.clear(); }
+};
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) { return 1; }
+  virtual size_t write(const uint8_t*, size_t n) { return n; }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    if (!echo) return 0;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    return n < 0 ? 0 : n;
+  }
+  size_t print(const char* s) { return echo ? fputs(s, stderr), strlen(s) : 0; }
+  size_t print(const String& s) { return print(s.c_str()); }
+  template <typename T> size_t print(T) { return 0; }
+  template <typename T> size_t print(T, int) { return 0; }
+  size_t println(const char* s) { return print(s) + print("\n"); }
+  size_t println(const String& s) { return println(s.c_str()); }
+  template <typename T> size_t println(T) { return 0; }
+  size_t println() { return print("\n"); }
+  bool echo = false;  // Serial output goes to stderr with HOST_VERBOSE=1
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+  virtual void flush() {}
+  size_t readBytes(uint8_t*, size_t) { return 0; }
+  size_t readBytes(char*, size_t) { return 0; }
+  void setTimeout(unsigned long) {}
+};
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(int) { echo = getenv("HOST_VERBOSE") != NULL; }
+};
+inline HardwareSerial Serial;
+
+// The tests move the clock.
+inline unsigned long hostMillis = 0;
+inline unsigned long millis() { return hostMillis; }
+inline unsigned long micros() { return hostMillis * 1000; }
+inline void delay(unsigned long ms) { hostMillis += ms; }
+inline void yield() {}
+
+struct EspClass {
+  int getFreeHeap() { return 200 * 1024; }
+  int getFreePsram() { return 4 * 1024 * 1024; }
+  int getMaxAllocHeap() { return 100 * 1024; }
+  int getPsramSize() { return 4 * 1024 * 1024; }
+  void restart() { exit(0); }
+};
+inline EspClass ESP;
+
+#define MALLOC_CAP_SPIRAM 1
+#define MALLOC_CAP_8BIT 2
+#define MALLOC_CAP_INTERNAL 4
+#define MALLOC_CAP_32BIT 8
+#define MALLOC_CAP_DEFAULT 16
+inline void* heap_caps_malloc(size_t n, uint32_t) { return malloc(n); }
+inline void* heap_caps_calloc(size_t n, size_t m, uint32_t) { return calloc(n, m); }
+inline void* heap_caps_realloc(void* p, size_t n, uint32_t) { return realloc(p, n); }
+inline size_t heap_caps_get_free_size(uint32_t) { return 4 * 1024 * 1024; }
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 100 * 1024; }
+inline void* ps_malloc(size_t n) { return malloc(n); }
+
+// No SNTP: time() is the host clock.
+inline void configTime(long, int, const char*, const char* = nullptr, const char* = nullptr) {}
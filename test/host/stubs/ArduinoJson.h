@@ -0,0 +1,111 @@
+// Host stand-in for ArduinoJson: main.cpp only builds small REQ filters
+// with it (objects, arrays, integers, strings) and serializes them.
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Arduino.h"
+
+struct HostJsonNode {
+  enum Type { NUL, OBJECT, ARRAY, NUMBER, STRING } type = NUL;
+  std::string text;  // number or string value
+  std::vector<std::pair<std::string, std::unique_ptr<HostJsonNode>>> members;
+  std::vector<std::unique_ptr<HostJsonNode>> items;
+
+  void clear(Type t) {
+    type = t;
+    text.clear();
+    members.clear();
+    items.clear();
+  }
+  void serialize(std::string& out) const {
+    switch (type) {
+      case NUL: out += "null"; break;
+      case NUMBER: out += text; break;
+      case STRING: quote(out, text); break;
+      case OBJECT:
+        out += '{';
+        for (size_t i = 0; i < members.size(); i++) {
+          if (i) out += ',';
+          quote(out, members[i].first);
+          out += ':';
+          members[i].second->serialize(out);
+        }
+        out += '}';
+        break;
+      case ARRAY:
+        out += '[';
+        for (size_t i = 0; i < items.size(); i++) {
+          if (i) out += ',';
+          items[i]->serialize(out);
+        }
+        out += ']';
+        break;
+    }
+  }
+  static void quote(std::string& out, const std::string& s) {
+    out += '"';
+    for (char c : s) {
+      if (c == '"' || c == '\\') out += '\\';
+      out += c;
+    }
+    out += '"';
+  }
+};
+
+class JsonArray;
+class JsonObject;
+
+class JsonVariant {
+ public:
+  explicit JsonVariant(HostJsonNode* n = nullptr) : node(n) {}
+  template <typename T> T to() { return T(node, true); }
+  HostJsonNode* node;
+};
+
+class JsonArray {
+ public:
+  JsonArray(HostJsonNode* n, bool reset) : node(n) { if (reset) node->clear(HostJsonNode::ARRAY); }
+  bool add(int v) { return push(HostJsonNode::NUMBER, std::to_string(v)); }
+  bool add(const char* v) { return push(HostJsonNode::STRING, v); }
+  bool add(const String& v) { return push(HostJsonNode::STRING, v.s); }
+  size_t size() const { return node->items.size(); }
+  HostJsonNode* node;
+
+ private:
+  bool push(HostJsonNode::Type t, const std::string& text) {
+    node->items.emplace_back(new HostJsonNode());
+    node->items.back()->type = t;
+    node->items.back()->text = text;
+    return true;
+  }
+};
+
+class JsonObject {
+ public:
+  JsonObject(HostJsonNode* n, bool reset) : node(n) { if (reset) node->clear(HostJsonNode::OBJECT); }
+  JsonVariant operator[](const char* key) const {
+    for (auto& m : node->members) {
+      if (m.first == key) return JsonVariant(m.second.get());
+    }
+    node->members.emplace_back(key, std::unique_ptr<HostJsonNode>(new HostJsonNode()));
+    return JsonVariant(node->members.back().second.get());
+  }
+  HostJsonNode* node;
+};
+
+class JsonDocument {
+ public:
+  template <typename T> T to() { return T(&root, true); }
+  void clear() { root.clear(HostJsonNode::NUL); }
+  HostJsonNode root;
+};
+
+inline size_t serializeJson(const JsonDocument& doc, String& out) {
+  out.s.clear();
+  doc.root.serialize(out.s);
+  return out.s.size();
+}
@@ -0,0 +1,24 @@
+// Host stand-in for HTTPClient: every request fails.
+#pragma once
+
+#include "WiFi.h"
+
+#define HTTPC_STRICT_FOLLOW_REDIRECTS 1
+
+class HTTPClient {
+ public:
+  void setTimeout(int) {}
+  void setFollowRedirects(int) {}
+  void setReuse(bool) {}
+  bool begin(WiFiClient&, const String&) { return false; }
+  bool begin(const String&) { return false; }
+  void addHeader(const String&, const String&) {}
+  int GET() { return -1; }
+  int getSize() { return -1; }
+  WiFiClient* getStreamPtr() { return &client; }
+  WiFiClient& getStream() { return client; }
+  bool connected() { return false; }
+  int writeToStream(Stream*) { return -1; }
+  void end() {}
+  WiFiClient client;
+};
@@ -0,0 +1,94 @@
+// Host stand-in for M5Core2: the LCD draws nothing, the buttons are never
+// pressed.
+#pragma once
+
+#include "Arduino.h"
+
+#define BLACK 0
+#define WHITE 0xFFFF
+#define RED 0xF800
+#define GREEN 0x07E0
+#define CYAN 0x07FF
+#define YELLOW 0xFFE0
+#define MAGENTA 0xF81F
+#define TFT_BLACK 0
+#define TFT_WHITE 0xFFFF
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREY 0x7BEF
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_ORANGE 0xFDA0
+#define TFT_RED RED
+#define TFT_GREEN GREEN
+#define TFT_YELLOW YELLOW
+#define TFT_CYAN CYAN
+#define TFT_MAGENTA MAGENTA
+#define ORANGE TFT_ORANGE
+
+class TFT_eSPI : public Print {
+ public:
+  void fillScreen(uint32_t) {}
+  void fillRect(int32_t, int32_t, int32_t, int32_t, uint32_t) {}
+  void fillRoundRect(int32_t, int32_t, int32_t, int32_t, int32_t, uint32_t) {}
+  void drawRect(int32_t, int32_t, int32_t, int32_t, uint32_t) {}
+  void drawLine(int32_t, int32_t, int32_t, int32_t, uint32_t) {}
+  void drawPixel(int32_t, int32_t, uint32_t) {}
+  void drawFastHLine(int32_t, int32_t, int32_t, uint32_t) {}
+  void drawFastVLine(int32_t, int32_t, int32_t, uint32_t) {}
+  void pushImage(int32_t, int32_t, int32_t, int32_t, const uint16_t*) {}
+  void setTextColor(uint16_t) {}
+  void setTextColor(uint16_t, uint16_t) {}
+  void setTextSize(uint8_t) {}
+  void setCursor(int16_t, int16_t) {}
+  void setSwapBytes(bool) {}
+  bool getSwapBytes() { return false; }
+  void startWrite() {}
+  void endWrite() {}
+  void setWindow(int32_t, int32_t, int32_t, int32_t) {}
+  void pushColors(uint16_t*, uint32_t, bool = true) {}
+  int16_t width() { return 320; }
+  int16_t height() { return 240; }
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+};
+
+typedef enum { JPEG_DIV_ESPRITE_NONE, JPEG_DIV_ESPRITE_2, JPEG_DIV_ESPRITE_4, JPEG_DIV_ESPRITE_8 } jpeg_div_eSprite_t;
+
+// A sprite is a real RGB565 buffer, so the icon paths can run.
+class TFT_eSprite : public TFT_eSPI {
+ public:
+  TFT_eSprite(TFT_eSPI*) {}
+  ~TFT_eSprite() { deleteSprite(); }
+  void* createSprite(int16_t w, int16_t h, uint8_t = 1) {
+    deleteSprite();
+    buf = (uint16_t*)calloc((size_t)w * h, 2);
+    sw = w;
+    sh = h;
+    return buf;
+  }
+  void deleteSprite() { free(buf); buf = NULL; sw = sh = 0; }
+  void fillSprite(uint32_t c) { for (int i = 0; i < sw * sh; i++) buf[i] = c; }
+  void drawPixel(int32_t x, int32_t y, uint32_t c) { if (x >= 0 && y >= 0 && x < sw && y < sh) buf[y * sw + x] = c; }
+  uint16_t readPixel(int32_t x, int32_t y) { return (x >= 0 && y >= 0 && x < sw && y < sh) ? buf[y * sw + x] : 0; }
+  bool drawJpg(const uint8_t*, size_t, uint16_t = 0, uint16_t = 0, uint16_t = 0, uint16_t = 0, uint16_t = 0,
+               uint16_t = 0, jpeg_div_eSprite_t = JPEG_DIV_ESPRITE_NONE) { return false; }
+  void* getPointer() { return buf; }
+  uint16_t* buf = NULL;
+  int sw = 0, sh = 0;
+};
+
+struct TouchPoint { int16_t x, y; };
+struct Touch_ {
+  bool ispressed() { return false; }
+  TouchPoint getPressPoint() { return {-1, -1}; }
+};
+struct Button_ {
+  bool wasPressed() { return false; }
+  bool isPressed() { return false; }
+};
+struct M5_ {
+  TFT_eSPI Lcd;
+  Touch_ Touch;
+  Button_ BtnA, BtnB, BtnC;
+  void begin() { Serial.begin(115200); }
+  void update() {}
+};
+inline M5_ M5;
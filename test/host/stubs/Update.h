@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Arduino.h"
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+struct UpdateClass {
+  bool hasError() { return true; }
+  bool begin(size_t) { return false; }
+  size_t write(uint8_t*, size_t) { return 0; }
+  size_t progress() { return 0; }
+  size_t size() { return 0; }
+  bool end(bool) { return false; }
+};
+inline UpdateClass Update;
@@ -0,0 +1,29 @@
+// Host stand-in for the ESP32 WebServer: no requests ever arrive.
+#pragma once
+
+#include <functional>
+
+#include "Arduino.h"
+
+enum HTTPMethod { HTTP_GET, HTTP_POST };
+enum { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END };
+struct HTTPUpload {
+  int status;
+  uint8_t* buf;
+  size_t currentSize;
+};
+
+class WebServer {
+ public:
+  WebServer(int) {}
+  void on(const char*, HTTPMethod, std::function<void()>) {}
+  void on(const char*, HTTPMethod, std::function<void()>, std::function<void()>) {}
+  void send(int, const char*, const String&) {}
+  void send(int, const char*, const char*) {}
+  HTTPUpload& upload() { return up; }
+  void begin() {}
+  void handleClient() {}
+  String arg(const char*) { return String(); }
+  bool hasArg(const char*) { return false; }
+  HTTPUpload up = {};
+};
@@ -0,0 +1,62 @@
+// Host stand-in for links2004/WebSockets: nothing goes on the wire. Sent
+// text and the extra handshake headers are kept for the tests, and events
+// are delivered by calling the handler directly (see deliver()). Like the
+// library, begin() resets the extra headers to its default Origin and
+// setExtraHeaders() replaces them.
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+
+typedef enum {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_FRAGMENT_TEXT_START,
+  WStype_FRAGMENT_BIN_START,
+  WStype_FRAGMENT,
+  WStype_FRAGMENT_FIN,
+  WStype_PING,
+  WStype_PONG,
+} WStype_t;
+
+class WebSocketsClient {
+ public:
+  typedef std::function<void(WStype_t type, uint8_t* payload, size_t length)> WebSocketClientEvent;
+  void beginSSL(const char*, uint16_t, const char* = "/", const char* = "", const char* = "arduino") {
+    _client.extraHeaders = "Origin: file://";
+  }
+  void begin(const char*, uint16_t, const char* = "/", const char* = "arduino") {
+    _client.extraHeaders = "Origin: file://";
+  }
+  void onEvent(WebSocketClientEvent cb) { handler = cb; }
+  void setReconnectInterval(unsigned long ms) { reconnectMs = ms; }
+  void setExtraHeaders(const char* h = NULL) { _client.extraHeaders = h ? h : ""; }
+  void enableHeartbeat(uint32_t, uint32_t, uint8_t) {}
+  bool sendTXT(const String& s) { sent.push_back(s.s); return true; }
+  bool sendTXT(const char* s) { sent.push_back(s); return true; }
+  bool sendTXT(uint8_t* p, size_t n) { sent.push_back(std::string((const char*)p, n)); return true; }
+  void loop() {}
+  void disconnect() { disconnects++; }
+  bool isConnected() { return false; }
+  // Hands an event to the handler as if the library had received it.
+  void deliver(WStype_t type, uint8_t* payload, size_t length) { if (handler) handler(type, payload, length); }
+
+  // The headers the next handshake sends after the standard ones.
+  const std::string& extraHeaders() const { return _client.extraHeaders.s; }
+
+  WebSocketClientEvent handler;
+  std::vector<std::string> sent;
+  unsigned long reconnectMs = 0;
+  int disconnects = 0;
+
+ protected:
+  struct {
+    String extraHeaders;
+  } _client;
+};
@@ -0,0 +1,27 @@
+// Host stand-in for the ESP32 WiFi library: never connects.
+#pragma once
+
+#include "Arduino.h"
+
+#define WL_CONNECTED 3
+
+struct IPAddress {
+  String toString() const { return "127.0.0.1"; }
+};
+inline size_t operator+(size_t n, const IPAddress&) { return n; }
+template <typename T> inline T& operator<<(T& p, const IPAddress&) { return p; }
+
+struct WiFiClass {
+  void begin(const char*, const char*) {}
+  int status() { return 0; }
+  IPAddress localIP() { return IPAddress(); }
+  int RSSI() { return 0; }
+};
+inline WiFiClass WiFi;
+
+class WiFiClient : public Stream {
+ public:
+  bool connected() { return false; }
+  int available() override { return 0; }
+  void stop() {}
+};
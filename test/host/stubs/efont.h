@@ -0,0 +1,17 @@
+// Host stand-in for efont: blank glyphs, UTF-8 decoding only.
+#pragma once
+
+#include "Arduino.h"
+
+inline void getefontData(uint8_t* font, uint16_t) { memset(font, 0, 32); }
+
+inline char* efontUFT8toUTF16(uint16_t* out, char* p) {
+  uint8_t c = (uint8_t)*p;
+  int n = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+  *out = c < 0x80 ? c : '?';
+  for (int i = 0; i < n; i++) {
+    if (!*p) break;
+    p++;
+  }
+  return p;
+}
@@ -0,0 +1,29 @@
+// Host stand-in for mbedtls base64 decoding (the ESP-IDF one is in ROM).
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#define MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL -0x002A
+#define MBEDTLS_ERR_BASE64_INVALID_CHARACTER -0x002C
+
+inline int mbedtls_base64_decode(unsigned char* dst, size_t dlen, size_t* olen, const unsigned char* src, size_t slen) {
+  static const char* kAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  unsigned acc = 0;
+  int bits = 0;
+  size_t n = 0;
+  for (size_t i = 0; i < slen; i++) {
+    if (src[i] == '=' || src[i] == '\r' || src[i] == '\n') continue;
+    const char* q = src[i] ? strchr(kAlphabet, src[i]) : NULL;
+    if (!q) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+    acc = (acc << 6) | (unsigned)(q - kAlphabet);
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      if (dst && n < dlen) dst[n] = (unsigned char)(acc >> bits);
+      n++;
+    }
+  }
+  *olen = n;
+  return (dst && n > dlen) || !dst ? MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL : 0;
+}
@@ -0,0 +1,95 @@
+// Host stand-in for the tinfl inflater in the ESP32 ROM, on top of zlib.
+//
+// Only what main.cpp uses: tinfl_init() then tinfl_decompress() into a
+// wrapping 32KB output ring, raw deflate or with a zlib header. zlib keeps
+// its own window, so the ring is only read once, when a stream starts: what
+// it already holds becomes the preset dictionary, which is how a raw stream
+// can refer back into earlier output (permessage-deflate context takeover).
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <zlib.h>
+
+typedef uint8_t mz_uint8;
+typedef uint32_t mz_uint32;
+typedef unsigned mz_uint;
+
+enum {
+  TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+  TINFL_FLAG_HAS_MORE_INPUT = 2,
+  TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+  TINFL_FLAG_COMPUTE_ADLER32 = 8,
+};
+
+typedef enum {
+  TINFL_STATUS_BAD_PARAM = -3,
+  TINFL_STATUS_ADLER32_MISMATCH = -2,
+  TINFL_STATUS_FAILED = -1,
+  TINFL_STATUS_DONE = 0,
+  TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+  TINFL_STATUS_HAS_MORE_OUTPUT = 2,
+} tinfl_status;
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+#define HOST_TINFL_LIVE 0x7A6C6962u  // z holds an inflate state
+
+typedef struct {
+  mz_uint32 m_state;  // 0 after tinfl_init(): the next call starts a stream
+  mz_uint32 live;
+  z_stream z;
+} tinfl_decompressor;
+
+#define tinfl_init(r) \
+  do {                \
+    (r)->m_state = 0; \
+  } while (0)
+
+static inline void host_tinfl_end(tinfl_decompressor* r) {
+  if (r->live == HOST_TINFL_LIVE) inflateEnd(&r->z);
+  r->live = 0;
+}
+
+static inline tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* in, size_t* in_size,
+                                            mz_uint8* out_start, mz_uint8* out_next, size_t* out_size,
+                                            const mz_uint32 flags) {
+  const int zlib_header = (flags & TINFL_FLAG_PARSE_ZLIB_HEADER) != 0;
+  if (r->m_state == 0) {
+    host_tinfl_end(r);
+    memset(&r->z, 0, sizeof(r->z));
+    if (inflateInit2(&r->z, zlib_header ? 15 : -15) != Z_OK) return TINFL_STATUS_FAILED;
+    r->live = HOST_TINFL_LIVE;
+    r->m_state = 1;
+    if (!zlib_header && !(flags & TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF)) {
+      // The ring, oldest byte first, as seen from out_next.
+      const size_t ofs = out_next - out_start;
+      static mz_uint8 dict[TINFL_LZ_DICT_SIZE];
+      memcpy(dict, out_next, TINFL_LZ_DICT_SIZE - ofs);
+      memcpy(dict + TINFL_LZ_DICT_SIZE - ofs, out_start, ofs);
+      inflateSetDictionary(&r->z, dict, TINFL_LZ_DICT_SIZE);
+    }
+  }
+  r->z.next_in = (Bytef*)in;
+  r->z.avail_in = (uInt)*in_size;
+  r->z.next_out = out_next;
+  r->z.avail_out = (uInt)*out_size;
+  int ret = inflate(&r->z, Z_SYNC_FLUSH);
+  *in_size -= r->z.avail_in;
+  *out_size -= r->z.avail_out;
+  if (ret == Z_STREAM_END) {
+    host_tinfl_end(r);
+    return TINFL_STATUS_DONE;
+  }
+  if (ret != Z_OK && ret != Z_BUF_ERROR) {
+    host_tinfl_end(r);
+    return TINFL_STATUS_FAILED;
+  }
+  if (r->z.avail_out == 0) return TINFL_STATUS_HAS_MORE_OUTPUT;
+  if (!(flags & TINFL_FLAG_HAS_MORE_INPUT) && r->z.avail_in == 0) {
+    host_tinfl_end(r);
+    return TINFL_STATUS_FAILED;  // tinfl: input ran out before the end of the stream
+  }
+  return TINFL_STATUS_NEEDS_MORE_INPUT;
+}
@@ -0,0 +1,237 @@
+// permessage-deflate against a real server (deflate_server.js on the ws
+// package), one relay with context takeover and one without. The test is
+// the WebSocket transport: it sends the handshake with the headers main.cpp
+// configured, sends the REQs main.cpp queued, and turns the frames it reads
+// into the events links2004/WebSockets delivers (RSV1 is not passed on;
+// a frame without FIN is WStype_FRAGMENT_TEXT_START, continuations are
+// WStype_FRAGMENT / WStype_FRAGMENT_FIN). Skipped if node or ws is missing.
+//
+// Also checks without a server: the extension is added to the library's
+// default headers (Origin kept), the offer is dropped for a relay whose
+// connections never deliver a compressed message (a library that rejects
+// RSV1 frames), and a fragmented message that does not fit is dropped.
+
+#include "host.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+
+static bool readFull(int fd, uint8_t* buf, size_t n) {
+  while (n > 0) {
+    pollfd p = { fd, POLLIN, 0 };
+    if (poll(&p, 1, 5000) <= 0) return false;
+    ssize_t got = read(fd, buf, n);
+    if (got <= 0) return false;
+    buf += got;
+    n -= got;
+  }
+  return true;
+}
+
+static void sendFrame(int fd, const std::string& text) {
+  std::string f;
+  f += (char)0x81;  // FIN, text
+  if (text.size() < 126) {
+    f += (char)(0x80 | text.size());
+  } else {
+    f += (char)(0x80 | 126);
+    f += (char)(text.size() >> 8);
+    f += (char)text.size();
+  }
+  static const uint8_t mask[4] = { 0x12, 0x34, 0x56, 0x78 };
+  f.append((const char*)mask, 4);
+  for (size_t i = 0; i < text.size(); i++) f += (char)(text[i] ^ mask[i & 3]);
+  CHECK(write(fd, f.data(), f.size()) == (ssize_t)f.size());
+}
+
+struct Session {
+  std::string extensions;  // the server's Sec-WebSocket-Extensions
+  int messages = 0, compressed = 0, fragments = 0, continuationRsv1 = 0;
+  bool closed = false;
+};
+
+static Session runSession(int r, int port) {
+  Session s;
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+    CHECK(!"connect");
+    close(fd);
+    return s;
+  }
+  // As WebSocketsClient::sendHeader: standard headers, then the extra ones.
+  std::string req = "GET / HTTP/1.1\r\nHost: 127.0.0.1:" + std::to_string(port) +
+                    "\r\nConnection: Upgrade\r\nUpgrade: websocket\r\nSec-WebSocket-Version: 13\r\n"
+                    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n" +
+                    relays[r].ws.extraHeaders() + "\r\n\r\n";
+  CHECK(write(fd, req.data(), req.size()) == (ssize_t)req.size());
+  std::string head;
+  uint8_t c;
+  while (head.find("\r\n\r\n") == std::string::npos && readFull(fd, &c, 1)) head += (char)c;
+  CHECK(head.compare(0, 12, "HTTP/1.1 101") == 0);
+  size_t ext = head.find("Sec-WebSocket-Extensions: ");
+  if (ext != std::string::npos) s.extensions = head.substr(ext + 26, head.find("\r\n", ext) - ext - 26);
+
+  webSocketEvent(r, WStype_CONNECTED, (uint8_t*)"/", 1);
+  while (!s.closed) {
+    for (const std::string& out : relays[r].ws.sent) sendFrame(fd, out);
+    relays[r].ws.sent.clear();
+    uint8_t h[2];
+    if (!readFull(fd, h, 2)) break;
+    bool fin = h[0] & 0x80, rsv1 = h[0] & 0x40;
+    int opcode = h[0] & 0x0F;
+    uint64_t len = h[1] & 0x7F;
+    if (len >= 126) {
+      uint8_t ext[8];
+      int n = len == 126 ? 2 : 8;
+      if (!readFull(fd, ext, n)) break;
+      len = 0;
+      for (int i = 0; i < n; i++) len = (len << 8) | ext[i];
+    }
+    std::string payload(len + 1, '\0');  // the library NUL-terminates
+    if (!readFull(fd, (uint8_t*)&payload[0], len)) break;
+    if (opcode == 0x8) {
+      s.closed = true;
+      break;
+    }
+    if (opcode == 0x1 && rsv1) s.compressed++;
+    if (opcode == 0x0 && rsv1) s.continuationRsv1++;
+    WStype_t type;
+    if (opcode == 0x1) type = fin ? WStype_TEXT : WStype_FRAGMENT_TEXT_START;
+    else if (opcode == 0x0) type = fin ? WStype_FRAGMENT_FIN : WStype_FRAGMENT;
+    else continue;
+    if (!fin || opcode == 0x0) s.fragments++;
+    if (fin) s.messages++;
+    webSocketEvent(r, type, (uint8_t*)&payload[0], len);
+  }
+  close(fd);
+  webSocketEvent(r, WStype_DISCONNECTED, NULL, 0);
+  return s;
+}
+
+static bool shown(const char* text) {
+  for (int i = 0; i < tlCount; i++) {
+    if (strstr(textStr(timelineAt(i)->content), text)) return true;
+  }
+  return false;
+}
+
+static void testServer() {
+  FILE* server = popen("node deflate_server.js 2>&1", "r");
+  char line[128] = "";
+  int port = 0;
+  if (!server || !fgets(line, sizeof(line), server) || sscanf(line, "port %d", &port) != 1) {
+    printf("deflate server not started, skipping (%s)\n", line[0] ? strtok(line, "\n") : "node not found");
+    if (server) pclose(server);
+    return;
+  }
+
+  // Relay 0 keeps the window across messages, relay 1 asks the server not to.
+  free(relays[1].inflateRing);
+  relays[1].inflateRing = NULL;
+  inflateShared = (uint8_t*)ps_malloc(RELAY_DEFLATE_WINDOW);
+  // As loop() once WiFi is up.
+  subscribeTimeline();
+  for (int r = 0; r < relayCount; r++) {
+    relays[r].subLimit = SUB_LIMIT_DEFAULT;
+    relays[r].ws.beginSSL(relayConfigs[r].host, relayConfigs[r].port, relayConfigs[r].path);
+    relayOfferDeflate(r);
+  }
+  CHECK(relays[1].ws.extraHeaders().find("server_no_context_takeover") != std::string::npos);
+
+  for (int r = 0; r < 2; r++) {
+    Session s = runSession(r, port);
+    const RelayStats& st = relays[r].stats;
+    CHECK(s.closed);
+    CHECK(s.extensions.find("permessage-deflate") == 0);
+    CHECK((s.extensions.find("server_no_context_takeover") != std::string::npos) == (r == 1));
+    CHECK(s.messages == 5);
+    CHECK(s.compressed == 3);  // A, B and the first frame of C
+    CHECK(s.fragments == 5);
+    CHECK(s.continuationRsv1 == 0);
+    CHECK(st.totalErrors == 0);
+    CHECK(st.totalInvalid == 0);
+    CHECK(st.totalEvents == 3);
+    CHECK(st.wireBytes < st.jsonBytes);
+    CHECK(relays[r].deflateSeen);
+    CHECK(!relays[r].inflateBroken);
+    printf("relay %d (%s context takeover): %llu bytes on the wire, %llu after inflating\n", r,
+           r == 0 ? "with" : "without", (unsigned long long)st.wireBytes, (unsigned long long)st.jsonBytes);
+  }
+  CHECK(tlCount == 3);
+  CHECK(shown("compressed post"));
+  CHECK(shown("another compressed post"));
+  CHECK(shown("fragment 0 of a long post"));
+  CHECK(relays[0].stats.firsts == 3);
+  pclose(server);
+}
+
+// The offer keeps the library's default Origin; relays whose connections
+// end without a compressed message stop getting it.
+static void testOffer() {
+  Relay& relay = relays[0];
+  relay.ws.beginSSL(relayConfigs[0].host, relayConfigs[0].port, relayConfigs[0].path);
+  relay.deflateOff = false;
+  relayOfferDeflate(0);
+  CHECK(relay.ws.extraHeaders() ==
+        "Origin: file://\r\nSec-WebSocket-Extensions: permessage-deflate; server_max_window_bits=15");
+
+  relay.deflateDrops = 0;
+  for (int i = 0; i < RELAY_DEFLATE_GIVE_UP; i++) {
+    CHECK(relay.deflateOffered);
+    webSocketEvent(0, WStype_CONNECTED, (uint8_t*)"/", 1);
+    webSocketEvent(0, WStype_DISCONNECTED, NULL, 0);
+  }
+  CHECK(relay.deflateOff);
+  CHECK(!relay.deflateOffered);
+  CHECK(relay.ws.extraHeaders() == "Origin: file://");
+
+  // Failed handshakes alternate with and without the offer after the second.
+  relay.deflateOff = false;
+  relay.deflateDrops = 0;
+  relayOfferDeflate(0);
+  webSocketEvent(0, WStype_CONNECTED, (uint8_t*)"/", 1);
+  webSocketEvent(0, WStype_DISCONNECTED, NULL, 0);
+  bool offered[4];
+  for (int i = 0; i < 4; i++) {
+    webSocketEvent(0, WStype_DISCONNECTED, NULL, 0);
+    offered[i] = relay.deflateOffered;
+  }
+  CHECK(offered[0] && !offered[1] && offered[2] && !offered[3]);
+  webSocketEvent(0, WStype_CONNECTED, (uint8_t*)"/", 1);
+  webSocketEvent(0, WStype_DISCONNECTED, NULL, 0);
+  CHECK(relay.deflateOffered);
+}
+
+// A fragmented message larger than the buffer is dropped; with context
+// takeover a dropped compressed one breaks the window.
+static void testFragmentTooLarge() {
+  Relay& relay = relays[0];
+  webSocketEvent(0, WStype_CONNECTED, (uint8_t*)"/", 1);
+  uint32_t errors = relay.stats.totalErrors;
+  static uint8_t chunk[RELAY_INFLATE_MAX / 2 + 1];
+  memset(chunk, 0x55, sizeof(chunk));
+  webSocketEvent(0, WStype_FRAGMENT_TEXT_START, chunk, sizeof(chunk));
+  webSocketEvent(0, WStype_FRAGMENT, chunk, sizeof(chunk));
+  webSocketEvent(0, WStype_FRAGMENT_FIN, chunk, 1);
+  CHECK(relay.stats.totalErrors == errors + 1);
+  CHECK(relay.inflateBroken);
+}
+
+int main() {
+  setup();
+  hostMillis = 1000000;
+  CHECK(inflateState);
+  testServer();
+  testOffer();
+  testFragmentTooLarge();
+  return host_result();
+}
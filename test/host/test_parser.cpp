@@ -0,0 +1,249 @@
+// Relay message extraction (parseRelayMessage, parseProfile,
+// peekTimelineEvent): escapes, \u and surrogate pairs, key order and
+// whitespace, values that must be skipped, malformed messages, and every
+// truncation of a valid one. Strings are copied into exactly-sized heap
+// buffers so that CFLAGS=-fsanitize=address catches reads past the end.
+
+#include "host.h"
+
+#include <string>
+
+static const char* kId = "5c83da77af1dec6d7289834998ad7aafbd9e2191396d75ec3cc27f5a77226f36";
+static const char* kPubkey = "f7234bd4c1394dda46d09f35bd384dd30cc552ad5541990f98844fb06676e9ca";
+static const char* kSig =
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000";
+
+// Parses a copy of msg; the buffer is exactly msg.size() bytes long.
+struct Parsed {
+  RelayMsgType type;
+  NostrEvent ev;  // pointers into the freed buffer: use the copies below
+  bool terminated;  // content is NUL-terminated in place
+  std::string content, subId, id, pubkey, sig, tags;
+};
+
+static Parsed parse(const std::string& msg) {
+  Parsed p;
+  char* buf = (char*)malloc(msg.size() ? msg.size() : 1);
+  memcpy(buf, msg.data(), msg.size());
+  p.type = parseRelayMessage(buf, msg.size(), p.ev);
+  if (p.ev.content) p.content.assign(p.ev.content, p.ev.contentLen);
+  p.terminated = p.ev.content && p.ev.content[p.ev.contentLen] == '\0';
+  if (p.ev.subId) p.subId = p.ev.subId;
+  if (p.ev.id) p.id = p.ev.id;
+  if (p.ev.pubkey) p.pubkey = p.ev.pubkey;
+  if (p.ev.sig) p.sig = p.ev.sig;
+  if (p.ev.tags) p.tags.assign(p.ev.tags, p.ev.tagsLen);
+  free(buf);
+  return p;
+}
+
+static std::string event(const std::string& content, const std::string& tags = "[]",
+                         const std::string& subId = "s1") {
+  return "[\"EVENT\",\"" + subId + "\",{\"id\":\"" + kId + "\",\"pubkey\":\"" + kPubkey +
+         "\",\"created_at\":1700000000,\"kind\":1,\"tags\":" + tags + ",\"content\":\"" + content +
+         "\",\"sig\":\"" + kSig + "\"}]";
+}
+
+static void testBasic() {
+  Parsed p = parse(event("hello"));
+  CHECK(p.type == RELAY_MSG_EVENT);
+  CHECK(p.subId == "s1");
+  CHECK(p.id == kId);
+  CHECK(p.pubkey == kPubkey);
+  CHECK(p.sig == kSig);
+  CHECK(p.ev.kind == 1);
+  CHECK(p.ev.created_at == 1700000000u);
+  CHECK(p.content == "hello");
+  CHECK(p.tags == "[]");
+
+  // Any key order, whitespace everywhere, unknown keys with nested values.
+  std::string msg = std::string(" [ \"EVENT\" ,\r\n \"sub\" , {\n\t\"extra\" : {\"a\":[1,{\"b\":\"}]\"}],\"c\":null} ,") +
+                    " \"content\" : \"x\" , \"kind\" : 7 , \"created_at\" : 1700000001.5e0 ," +
+                    " \"tags\" : [ [\"e\", \"]\\\"}\"] , [\"p\",\"q\"] ] , \"sig\" : \"" + kSig + "\" ," +
+                    " \"pubkey\" : \"" + kPubkey + "\" , \"id\" : \"" + kId + "\" , \"n\" : -12 , \"t\" : true } ] ";
+  p = parse(msg);
+  CHECK(p.type == RELAY_MSG_EVENT);
+  CHECK(p.subId == "sub");
+  CHECK(p.ev.kind == 7);
+  CHECK(p.ev.created_at == 1700000001u);
+  CHECK(p.content == "x");
+  CHECK(p.id == kId);
+  CHECK(p.pubkey == kPubkey);
+  CHECK(p.tags == "[ [\"e\", \"]\\\"}\"] , [\"p\",\"q\"] ]");  // raw, as received
+
+  // A kind that is not a number.
+  p = parse("[\"EVENT\",\"s\",{\"kind\":\"1\",\"content\":\"a\"}]");
+  CHECK(p.type == RELAY_MSG_EVENT);
+  CHECK(p.ev.kind == -1);
+}
+
+static void testEscapes() {
+  Parsed p = parse(event("a\\nb\\tc\\rd\\\"e\\\\f\\/g\\bh\\fi"));
+  CHECK(p.type == RELAY_MSG_EVENT);
+  CHECK(p.content == "a\nb\tc\rd\"e\\f/g\bh\fi");
+  CHECK(p.terminated);
+
+  // \u: 1, 2 and 3 byte UTF-8, upper and lower case hex, and a surrogate pair.
+  p = parse(event("\\u0041\\u00e9\\u00E9\\u3042\\ud83d\\ude00!"));
+  CHECK(p.content == "A\xC3\xA9\xC3\xA9\xE3\x81\x82\xF0\x9F\x98\x80!");
+
+  // Raw UTF-8 is passed through.
+  p = parse(event("\xE3\x81\x82\xF0\x9F\x98\x80"));
+  CHECK(p.content == "\xE3\x81\x82\xF0\x9F\x98\x80");
+
+  // A lone high surrogate is kept as a 3-byte sequence, and the escape after
+  // it is decoded on its own.
+  p = parse(event("\\ud83dx\\ud83d\\u0041"));
+  CHECK(p.content == "\xED\xA0\xBDx\xED\xA0\xBD" "A");
+
+  // \u0000 ends the C string early but not contentLen.
+  p = parse(event("a\\u0000b"));
+  CHECK(p.ev.contentLen == 3);
+  CHECK(p.content == std::string("a\0b", 3));
+
+  // Bad \u escapes make the whole message invalid.
+  CHECK(parse(event("\\u12G4")).type == RELAY_MSG_OTHER);
+  CHECK(parse(event("\\u12")).type == RELAY_MSG_OTHER);
+}
+
+static void testOtherMessages() {
+  Parsed p = parse("[\"EOSE\",\"s1\"]");
+  CHECK(p.type == RELAY_MSG_EOSE);
+  CHECK(p.subId == "s1");
+
+  p = parse("[\"CLOSED\",\"s2\",\"error: too many \\\"subs\\\"\"]");
+  CHECK(p.type == RELAY_MSG_CLOSED);
+  CHECK(p.subId == "s2");
+  CHECK(p.content == "error: too many \"subs\"");
+
+  p = parse("[\"CLOSED\",\"s3\"]");
+  CHECK(p.type == RELAY_MSG_CLOSED);
+  CHECK(p.content.empty());
+
+  CHECK(parse("[\"NOTICE\",\"hi\"]").type == RELAY_MSG_OTHER);
+  CHECK(parse("[\"OK\",\"" + std::string(kId) + "\",true,\"\"]").type == RELAY_MSG_OTHER);
+  CHECK(parse("[\"AUTH\",\"challenge\"]").type == RELAY_MSG_OTHER);
+}
+
+static void testMalformed() {
+  const char* bad[] = {
+      "",
+      " ",
+      "[",
+      "[]",
+      "{}",
+      "\"EVENT\"",
+      "[1,2]",
+      "[\"EVENT\"]",
+      "[\"EVENT\",1,{}]",
+      "[\"EVENT\",\"s\"]",
+      "[\"EVENT\",\"s\",]",
+      "[\"EVENT\",\"s\",[\"x\"]]",
+      "[\"EVENT\",\"s\",{\"id\":}]",
+      "[\"EVENT\",\"s\",{\"id\" \"x\"}]",
+      "[\"EVENT\",\"s\",{id:\"x\"}]",
+      "[\"EVENT\",\"s\",{\"content\":\"abc}]",
+      "[\"EVENT\",\"s\",{\"content\":\"abc\\",
+      "[\"EVENT\",\"s\",{\"tags\":[[\"e\",\"x\"]",
+      "[\"EVENT\",\"s\",{\"tags\":[\"]}",
+      "[\"EOSE\"",
+      "[\"EOSE\",\"s",
+  };
+  for (const char* m : bad) {
+    Parsed p = parse(m);
+    if (p.type != RELAY_MSG_OTHER) printf("  accepted: %s\n", m);
+    CHECK(p.type == RELAY_MSG_OTHER);
+  }
+}
+
+// Every prefix of a valid event that ends before the event object closes is
+// rejected, without reading past the end of the buffer.
+static void testTruncated() {
+  std::string full = event("\\u3042 \\ud83d\\ude00 \\\"q\\\" \\\\", "[[\"e\",\"]\\\"\"],[\"t\",\"x\"]]");
+  size_t close = full.rfind('}');
+  int rejected = 0;
+  for (size_t n = 0; n <= close; n++) {
+    if (parse(full.substr(0, n)).type == RELAY_MSG_OTHER) rejected++;
+  }
+  CHECK(rejected == (int)close + 1);
+  CHECK(parse(full).type == RELAY_MSG_EVENT);
+  // The closing bracket of the array is not needed.
+  CHECK(parse(full.substr(0, close + 1)).type == RELAY_MSG_EVENT);
+
+  std::string closed = "[\"CLOSED\",\"s\",\"bye\"]";
+  for (size_t n = 0; n < closed.size(); n++) parse(closed.substr(0, n));
+}
+
+static void profile(const std::string& json, std::string* name, std::string* picture) {
+  char* buf = (char*)malloc(json.size() ? json.size() : 1);
+  memcpy(buf, json.data(), json.size());
+  const char* n;
+  const char* pic;
+  parseProfile(buf, json.size(), n, pic);
+  *name = n ? n : "(null)";
+  *picture = pic ? pic : "(null)";
+  free(buf);
+}
+
+static void testProfile() {
+  std::string name, picture;
+  profile("{\"name\":\"bob\",\"display_name\":\"Bob \\u2603\",\"picture\":\"https:\\/\\/x.test\\/a.png\"}", &name,
+          &picture);
+  CHECK(name == "Bob \xE2\x98\x83");
+  CHECK(picture == "https://x.test/a.png");
+
+  // An empty display_name falls back to name; non-string values are skipped.
+  profile("{\"display_name\":\"\",\"name\":\"alice\",\"picture\":42,\"about\":{\"name\":\"no\"}}", &name, &picture);
+  CHECK(name == "alice");
+  CHECK(picture == "(null)");
+
+  profile("{\"display_name\":null,\"name\":[\"x\"],\"lud16\":\"a@b\"}", &name, &picture);
+  CHECK(name == "(null)");
+
+  profile("not json", &name, &picture);
+  CHECK(name == "(null)");
+  profile("{\"name\":\"trunc", &name, &picture);
+  CHECK(name == "(null)");
+}
+
+static void testPeek() {
+  int slot = subOpen(SUB_TIMELINE, 0, false, "{\"kinds\":[1]}", 5);
+  CHECK(slot >= 0);
+  char subId[5];
+  subIdOf(slot, subId);
+
+  uint64_t prefix = 0;
+  uint32_t createdAt = 0;
+  // "id" in the tags and in the content comes before the real key.
+  std::string msg = std::string("[\"EVENT\",\"") + subId +
+                    "\",{\"tags\":[[\"id\",\"ffff\"]],\"content\":\"\\\"id\\\":\\\"eeee\\\" \\\"created_at\\\":1\"," +
+                    "\"created_at\" : 1700000123,\"id\" : \"" + kId + "\"}]";
+  Subscription* sub = peekTimelineEvent((const uint8_t*)msg.data(), msg.size(), prefix, createdAt);
+  CHECK(sub == &subs[slot]);
+  CHECK(prefix == 0x5c83da77af1dec6dull);
+  CHECK(createdAt == 1700000123u);
+
+  // Other subscriptions are not peeked, and an id that is not hex stops it.
+  std::string other = "[\"EVENT\",\"zzzz\",{\"id\":\"" + std::string(kId) + "\"}]";
+  CHECK(!peekTimelineEvent((const uint8_t*)other.data(), other.size(), prefix, createdAt));
+  std::string notHex = std::string("[\"EVENT\",\"") + subId + "\",{\"id\":\"5c83da77af1dec6x\"}]";
+  CHECK(!peekTimelineEvent((const uint8_t*)notHex.data(), notHex.size(), prefix, createdAt));
+  for (size_t n = 0; n < msg.size(); n++) {
+    char* buf = (char*)malloc(n ? n : 1);
+    memcpy(buf, msg.data(), n);
+    peekTimelineEvent((const uint8_t*)buf, n, prefix, createdAt);
+    free(buf);
+  }
+  subClose(slot);
+}
+
+int main() {
+  testBasic();
+  testEscapes();
+  testOtherMessages();
+  testMalformed();
+  testTruncated();
+  testProfile();
+  testPeek();
+  return host_result();
+}
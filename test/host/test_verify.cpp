@@ -0,0 +1,149 @@
+// Duplicate timeline events across relays: an id is only remembered as seen
+// once a copy has passed verification, so a forged copy that arrives first
+// (bad content for the id, or a bad signature) cannot hide the genuine one.
+// Copies with the same signature are verified once, and the cache of
+// verified ids matches whole ids.
+
+#include "host.h"
+
+#include <string>
+
+// Signed by lib/nostrsig/bench/gen_vectors.py's sign() with a test key.
+static const char* kPubkey = "bb50e2d89a4ed70663d080659fe0ad4b9bc3e06c17a227433966cb59ceee020d";
+struct Signed {
+  uint32_t createdAt;
+  const char* content;
+  const char* id;
+  const char* sig;
+};
+static const Signed kA = {
+    1700000100, "genuine post", "8720a72a7fb8c5a52a31596a7b82526cf26e7cc0ed53e8ba04bdecdc39b47315",
+    "b27cc89db595b169a8d559191cfe136bd1a68a6d059ea00c66913154b59cd738"
+    "998228a98d2c3054e1ba7b9f2e55dbc022604c7309639e791033dfcabe52ef24"};
+static const Signed kB = {
+    1700000200, "second post", "d029b8dffb2c88ee493b6f18522a4d414fdba63c9fd5c2dae6c1a6eb19e8ab8b",
+    "5436c4045148bb8130569d56fa83b947fd0c0d6e8c5b05dcd7e9299e1f3bddd8"
+    "e0735e06000d53a0fc1ba666f9fe621143740978e1b494261b8163fc8d36fbeb"};
+static const Signed kC = {
+    1700000300, "third post", "b5cdcfda04130574290546c9a9b68cd792bec7c14ea6a773b0f97c6b53c423a9",
+    "dd47ff7d5ce284999e4131b65c395c9823d15ff6566b4fc0713f5e45c4ae45b6"
+    "1a1253b6a677267fea0d6b42d158a13780dd98ce1218785c1663044a3689bd49"};
+static const Signed kD = {
+    1700000700, "fourth post", "3ffb1117c82a780433e65650154025d7d55a695b51478cfe2785846aab52f885",
+    "29f877b091d7992b3f82e5d4c73a8927cd3a33df8c7657950ebdac62f2a64ef0"
+    "e9c0634938b8a30b06a40027b2a531489c63b2ea487be7248adc4efd5e39e75b"};
+
+static char subId[5];
+
+static void deliver(int r, const Signed& e, const char* content = NULL, const char* sig = NULL) {
+  std::string msg = std::string("[\"EVENT\",\"") + subId + "\",{\"id\":\"" + e.id + "\",\"pubkey\":\"" +
+                    kPubkey + "\",\"created_at\":" + std::to_string(e.createdAt) +
+                    ",\"kind\":1,\"tags\":[],\"content\":\"" + (content ? content : e.content) +
+                    "\",\"sig\":\"" + (sig ? sig : e.sig) + "\"}]";
+  handleEvent(r, (uint8_t*)&msg[0], msg.size());
+}
+
+// Lets processVerify() flush the queued burst.
+static void settle() {
+  delay(VERIFY_FLUSH_MS);
+  processVerify();
+}
+
+static int shown(const Signed& e) {
+  int n = 0;
+  for (int i = 0; i < tlCount; i++) {
+    if (strcmp(textStr(timelineAt(i)->content), e.content) == 0) n++;
+  }
+  return n;
+}
+
+// Content that does not hash to the id, then the genuine copy.
+static void testForgedContentFirst() {
+  uint32_t invalid = relays[0].stats.totalInvalid;
+  deliver(0, kA, "forged post");
+  CHECK(relays[0].stats.totalInvalid == invalid + 1);
+  deliver(1, kA);
+  settle();
+  CHECK(shown(kA) == 1);
+  CHECK(relays[1].stats.firsts == 1);
+
+  // Later copies are dropped before parsing, forged or not.
+  deliver(0, kA);
+  deliver(0, kA, "forged post");
+  settle();
+  CHECK(shown(kA) == 1);
+  CHECK(relays[0].stats.totalInvalid == invalid + 1);
+}
+
+// Right content but a bad signature, then the genuine copy in the same burst.
+static void testForgedSignatureFirst() {
+  std::string bad = kB.sig;
+  bad[10] = bad[10] == '0' ? '1' : '0';
+  uint32_t invalid = relays[0].stats.totalInvalid;
+  deliver(0, kB, NULL, bad.c_str());
+  deliver(1, kB);
+  CHECK(verifyQueued == 2);  // different signatures: both are checked
+  settle();
+  CHECK(shown(kB) == 1);
+  CHECK(relays[0].stats.totalInvalid == invalid + 1);
+  CHECK(relays[1].stats.totalInvalid == 0);
+
+  // The forged copy alone, after the genuine one was accepted.
+  deliver(0, kB, NULL, bad.c_str());
+  settle();
+  CHECK(shown(kB) == 1);
+}
+
+// The same copy from both relays: verified once, shown once, lag measured.
+static void testSameCopy() {
+  int before = tlCount;
+  uint32_t firsts0 = relays[0].stats.firsts, firsts1 = relays[1].stats.firsts;
+  deliver(0, kC);
+  delay(20);
+  deliver(1, kC);
+  CHECK(verifyQueued == 1);
+  settle();
+  CHECK(shown(kC) == 1);
+  CHECK(tlCount == before + 1);
+  CHECK(relays[0].stats.firsts == firsts0 + 1);
+  CHECK(relays[1].stats.firsts == firsts1);
+  CHECK(relays[1].stats.lagMs >= 0);
+}
+
+// The verified-id cache matches whole ids: an id that shares its first
+// bytes (and so its slot) with a verified one still has its signature checked.
+static void testVerifiedCacheFullId() {
+  uint8_t id[32], near[32];
+  CHECK(hexToBytes32(kD.id, id));
+  memcpy(near, id, 32);
+  near[31] ^= 1;
+  verifiedAdd(near);
+  CHECK(verifiedHas(near));
+  CHECK(!verifiedHas(id));
+
+  std::string bad = kD.sig;
+  bad[10] = bad[10] == '0' ? '1' : '0';
+  uint32_t invalid = relays[0].stats.totalInvalid;
+  deliver(0, kD, NULL, bad.c_str());
+  settle();
+  CHECK(shown(kD) == 0);
+  CHECK(relays[0].stats.totalInvalid == invalid + 1);
+  deliver(1, kD);
+  settle();
+  CHECK(shown(kD) == 1);
+  CHECK(verifiedHas(id));
+}
+
+int main() {
+  setup();
+  hostMillis = 1000000;
+  int slot = subOpen(SUB_TIMELINE, 0, false, "{\"kinds\":[1]}", TIMELINE_VISIBLE);
+  CHECK(slot >= 0);
+  subIdOf(slot, subId);
+
+  testForgedContentFirst();
+  testForgedSignatureFirst();
+  testSameCopy();
+  testVerifiedCacheFullId();
+  return host_result();
+}